@@ -0,0 +1,515 @@
+/**
+ * VKTS - VulKan ToolS.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) since 2014 Norbert Nopper
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef VKTS_HASHMAP_HPP_
+#define VKTS_HASHMAP_HPP_
+
+#include <vkts/core/vkts_core.hpp>
+
+namespace vkts
+{
+
+/**
+ * Spreads the bits, so that consecutive keys do not end up in consecutive slots.
+ */
+inline uint32_t hashMix(uint64_t value)
+{
+    value ^= value >> 33;
+    value *= 0xff51afd7ed558ccdull;
+    value ^= value >> 33;
+    value *= 0xc4ceb9fe1a85ec53ull;
+    value ^= value >> 33;
+
+    return static_cast<uint32_t>(value);
+}
+
+/**
+ * FNV-1a hash of the given characters.
+ */
+inline uint32_t hashString(const char* str, const size_t length)
+{
+    uint64_t value = 0xcbf29ce484222325ull;
+
+    for (size_t i = 0; i < length; i++)
+    {
+        value ^= static_cast<uint8_t>(str[i]);
+        value *= 0x100000001b3ull;
+    }
+
+    return hashMix(value);
+}
+
+template<class K, class Enable = void>
+struct HashMapHash
+{
+    static uint32_t hash(const K& key)
+    {
+        return hashMix(static_cast<uint64_t>(std::hash<K>()(key)));
+    }
+};
+
+template<class K>
+struct HashMapHash<K, typename std::enable_if<std::is_enum<K>::value>::type>
+{
+    static uint32_t hash(const K& key)
+    {
+        return hashMix(static_cast<uint64_t>(key));
+    }
+};
+
+template<>
+struct HashMapHash<std::string>
+{
+    static uint32_t hash(const std::string& key)
+    {
+        return hashString(key.c_str(), key.length());
+    }
+};
+
+template<class A, class B>
+struct HashMapHash<std::pair<A, B>>
+{
+    static uint32_t hash(const std::pair<A, B>& key)
+    {
+        return hashMix((static_cast<uint64_t>(HashMapHash<A>::hash(key.first)) << 32) | static_cast<uint64_t>(HashMapHash<B>::hash(key.second)));
+    }
+};
+
+/**
+ * Open addressing hash map with linear probing.
+ *
+ * Keys and values are stored densely in insertion order, so they can be iterated like the sorted vkts::Map.
+ * The slot table only contains the hash and the index of the entry. The hash of every key is calculated once and kept,
+ * so growing the table never touches the keys. Removing an entry moves the last entry into its place.
+ */
+template<class K, class V, class VV = Vector<V>>
+class HashMap
+{
+
+protected:
+
+    typedef struct HashMapSlot_
+    {
+        uint32_t hash;
+        uint32_t index;
+    } HashMapSlot;
+
+    Vector<K> allKeys;
+    VV allValues;
+    Vector<uint32_t> allHashes;
+
+    HashMapSlot* allSlots;
+    uint32_t slotMask;
+
+    static uint32_t getSlotCount(const uint32_t count)
+    {
+        uint32_t slotCount = VKTS_HASH_MAP_MIN_SLOTS;
+
+        // Keep the load factor below 0.75.
+        while (slotCount - slotCount / 4 <= count)
+        {
+            slotCount *= 2;
+        }
+
+        return slotCount;
+    }
+
+    void allocateSlots(const uint32_t slotCount)
+    {
+        if (allSlots)
+        {
+            delete[] allSlots;
+
+            allSlots = nullptr;
+        }
+
+        allSlots = new HashMapSlot[slotCount];
+
+        if (!allSlots)
+        {
+        	throw std::bad_alloc();
+        }
+
+        for (uint32_t i = 0; i < slotCount; i++)
+        {
+            allSlots[i].index = VKTS_HASH_MAP_EMPTY_SLOT;
+        }
+
+        slotMask = slotCount - 1;
+    }
+
+    void insertSlot(const uint32_t keyHash, const uint32_t index)
+    {
+        uint32_t slot = keyHash & slotMask;
+
+        while (allSlots[slot].index != VKTS_HASH_MAP_EMPTY_SLOT)
+        {
+            slot = (slot + 1) & slotMask;
+        }
+
+        allSlots[slot].hash = keyHash;
+        allSlots[slot].index = index;
+    }
+
+    void rehash(const uint32_t slotCount)
+    {
+        allocateSlots(slotCount);
+
+        for (uint32_t i = 0; i < allHashes.size(); i++)
+        {
+            insertSlot(allHashes[i], i);
+        }
+    }
+
+    uint32_t findSlot(const K& key, const uint32_t keyHash) const
+    {
+        uint32_t slot = keyHash & slotMask;
+
+        while (allSlots[slot].index != VKTS_HASH_MAP_EMPTY_SLOT)
+        {
+            if (allSlots[slot].hash == keyHash && allKeys[allSlots[slot].index] == key)
+            {
+                return slot;
+            }
+
+            slot = (slot + 1) & slotMask;
+        }
+
+        return VKTS_HASH_MAP_EMPTY_SLOT;
+    }
+
+    uint32_t findSlotOfIndex(const uint32_t index) const
+    {
+        uint32_t slot = allHashes[index] & slotMask;
+
+        while (allSlots[slot].index != index)
+        {
+            slot = (slot + 1) & slotMask;
+        }
+
+        return slot;
+    }
+
+    void removeSlot(uint32_t slot)
+    {
+        // Backward shift deletion, so no tombstones are needed.
+
+        uint32_t nextSlot = (slot + 1) & slotMask;
+
+        while (allSlots[nextSlot].index != VKTS_HASH_MAP_EMPTY_SLOT)
+        {
+            const uint32_t homeSlot = allSlots[nextSlot].hash & slotMask;
+
+            // Only move, if the home slot is not cyclically between the free and the next slot.
+            if (((nextSlot - homeSlot) & slotMask) >= ((nextSlot - slot) & slotMask))
+            {
+                allSlots[slot] = allSlots[nextSlot];
+
+                slot = nextSlot;
+            }
+
+            nextSlot = (nextSlot + 1) & slotMask;
+        }
+
+        allSlots[slot].index = VKTS_HASH_MAP_EMPTY_SLOT;
+    }
+
+    uint32_t appendEntry(const K& key, const V& value, const uint32_t keyHash)
+    {
+        if (allKeys.size() + 1 > (slotMask + 1) - (slotMask + 1) / 4)
+        {
+            rehash((slotMask + 1) * 2);
+        }
+
+        allKeys.append(key);
+        allValues.append(value);
+        allHashes.append(keyHash);
+
+        insertSlot(keyHash, allKeys.size() - 1);
+
+        return allKeys.size() - 1;
+    }
+
+public:
+
+    HashMap() :
+        HashMap(0)
+    {
+    }
+
+    HashMap(const uint32_t& allDataCount) :
+        allKeys(), allValues(), allHashes(), allSlots(nullptr), slotMask(0)
+    {
+        allocateSlots(getSlotCount(allDataCount));
+    }
+
+    HashMap(const HashMap& other) :
+        allKeys(other.allKeys), allValues(other.allValues), allHashes(other.allHashes), allSlots(nullptr), slotMask(0)
+    {
+        allocateSlots(other.slotMask + 1);
+
+        for (uint32_t i = 0; i <= slotMask; i++)
+        {
+            allSlots[i] = other.allSlots[i];
+        }
+    }
+
+    HashMap(HashMap&& other) :
+        allKeys(std::move(other.allKeys)), allValues(std::move(other.allValues)), allHashes(std::move(other.allHashes)), allSlots(other.allSlots), slotMask(other.slotMask)
+    {
+        other.allSlots = nullptr;
+        other.slotMask = 0;
+
+        // Moved from map stays usable.
+        other.allocateSlots(VKTS_HASH_MAP_MIN_SLOTS);
+    }
+
+    HashMap& operator= (const HashMap& other)
+    {
+        if (this == &other)
+        {
+            return *this;
+        }
+
+        allKeys = other.allKeys;
+        allValues = other.allValues;
+        allHashes = other.allHashes;
+
+        allocateSlots(other.slotMask + 1);
+
+        for (uint32_t i = 0; i <= slotMask; i++)
+        {
+            allSlots[i] = other.allSlots[i];
+        }
+
+        return *this;
+    }
+
+    HashMap& operator= (HashMap&& other)
+    {
+        if (this == &other)
+        {
+            return *this;
+        }
+
+        allKeys = std::move(other.allKeys);
+        allValues = std::move(other.allValues);
+        allHashes = std::move(other.allHashes);
+
+        std::swap(allSlots, other.allSlots);
+        std::swap(slotMask, other.slotMask);
+
+        other.allocateSlots(VKTS_HASH_MAP_MIN_SLOTS);
+
+        return *this;
+    }
+
+    ~HashMap()
+    {
+        clear();
+
+        if (allSlots)
+        {
+            delete[] allSlots;
+
+            allSlots = nullptr;
+        }
+    }
+
+    static uint32_t hash(const K& key)
+    {
+        return HashMapHash<K>::hash(key);
+    }
+
+    void clear()
+    {
+        allKeys.clear();
+        allValues.clear();
+        allHashes.clear();
+
+        for (uint32_t i = 0; i <= slotMask; i++)
+        {
+            allSlots[i].index = VKTS_HASH_MAP_EMPTY_SLOT;
+        }
+    }
+
+    /**
+     * Grows the slot table, so the given number of entries can be added without rehashing.
+     */
+    void reserve(const uint32_t count)
+    {
+        const uint32_t slotCount = getSlotCount(count);
+
+        if (slotCount > slotMask + 1)
+        {
+            rehash(slotCount);
+        }
+    }
+
+    uint32_t find(const K& key) const
+    {
+        return find(key, hash(key));
+    }
+
+    /**
+     * Find with an already calculated hash, e.g. of a frequently used key.
+     */
+    uint32_t find(const K& key, const uint32_t keyHash) const
+    {
+        const uint32_t slot = findSlot(key, keyHash);
+
+        if (slot == VKTS_HASH_MAP_EMPTY_SLOT)
+        {
+            return allKeys.size();
+        }
+
+        return allSlots[slot].index;
+    }
+
+    VkBool32 set(const K& key, const V& value)
+    {
+        return set(key, value, hash(key));
+    }
+
+    VkBool32 set(const K& key, const V& value, const uint32_t keyHash)
+    {
+        const uint32_t slot = findSlot(key, keyHash);
+
+        if (slot != VKTS_HASH_MAP_EMPTY_SLOT)
+        {
+            allValues[allSlots[slot].index] = value;
+
+            return VK_TRUE;
+        }
+
+        appendEntry(key, value, keyHash);
+
+        return VK_TRUE;
+    }
+
+    VkBool32 remove(const K& key)
+    {
+        uint32_t index = find(key);
+
+        if (index != allKeys.size())
+        {
+            return removeAt(index);
+        }
+
+        return VK_FALSE;
+    }
+
+    /**
+     * The last entry is moved to the given index.
+     */
+    VkBool32 removeAt(const uint32_t index)
+    {
+        if (index >= allKeys.size())
+        {
+            return VK_FALSE;
+        }
+
+        removeSlot(findSlotOfIndex(index));
+
+        const uint32_t lastIndex = allKeys.size() - 1;
+
+        if (index != lastIndex)
+        {
+            allSlots[findSlotOfIndex(lastIndex)].index = index;
+
+            allKeys[index] = allKeys[lastIndex];
+            allValues[index] = allValues[lastIndex];
+            allHashes[index] = allHashes[lastIndex];
+        }
+
+        allKeys.removeAt(lastIndex);
+        allValues.removeAt(lastIndex);
+        allHashes.removeAt(lastIndex);
+
+        return VK_TRUE;
+    }
+
+    VkBool32 contains(const K& key) const
+    {
+        return find(key) != allKeys.size();
+    }
+
+    V& operator[](const K& key)
+    {
+        const uint32_t keyHash = hash(key);
+
+        const uint32_t slot = findSlot(key, keyHash);
+
+        if (slot != VKTS_HASH_MAP_EMPTY_SLOT)
+        {
+            return allValues[allSlots[slot].index];
+        }
+
+        // Create, if not present.
+        V v = V();
+
+        return allValues[appendEntry(key, v, keyHash)];
+    }
+
+    const V& operator[](const K& key) const
+    {
+        return allValues[find(key)];
+    }
+
+    const K& keyAt(const uint32_t index) const
+    {
+        return allKeys[index];
+    }
+
+    V& valueAt(const uint32_t index)
+    {
+        return allValues[index];
+    }
+
+    const V& valueAt(const uint32_t index) const
+    {
+        return allValues[index];
+    }
+
+    const Vector<K>& keys() const
+    {
+        return allKeys;
+    }
+
+    const VV& values() const
+    {
+        return allValues;
+    }
+
+    uint32_t size() const
+    {
+        return allKeys.size();
+    }
+};
+
+}
+
+#endif /* VKTS_HASHMAP_HPP_ */
@@ -59,7 +59,7 @@ public:
     }
 
     Map(Map&& other) :
-        allKeys(other.allKeys), allValues(other.allValues)
+        allKeys(std::move(other.allKeys)), allValues(std::move(other.allValues))
     {
     }
 
@@ -73,8 +73,8 @@ public:
 
     Map& operator= (Map&& other)
     {
-    	allKeys = other.allKeys;
-    	allValues = other.allValues;
+    	allKeys = std::move(other.allKeys);
+    	allValues = std::move(other.allValues);
 
     	return *this;
     }
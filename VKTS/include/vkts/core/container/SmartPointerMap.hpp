@@ -32,15 +32,13 @@
 namespace vkts
 {
 
+/**
+ * Hash map of smart pointers. Entries are kept in insertion order.
+ */
 template<class K, class V>
-class SmartPointerMap
+class SmartPointerMap : public HashMap<K, V, SmartPointerVector<V>>
 {
 
-protected:
-
-    Vector<K> allKeys;
-    SmartPointerVector<V> allValues;
-
 public:
 
     SmartPointerMap() :
@@ -49,194 +47,38 @@ public:
     }
 
     SmartPointerMap(const uint32_t& allDataCount) :
-        allKeys(allDataCount), allValues(allDataCount)
+        HashMap<K, V, SmartPointerVector<V>>(allDataCount)
     {
     }
 
     SmartPointerMap(const SmartPointerMap& other) :
-        allKeys(other.allKeys), allValues(other.allValues)
+        HashMap<K, V, SmartPointerVector<V>>(other)
     {
     }
 
     SmartPointerMap(SmartPointerMap&& other) :
-        allKeys(other.allKeys), allValues(other.allValues)
+        HashMap<K, V, SmartPointerVector<V>>(std::move(other))
     {
     }
 
     SmartPointerMap& operator= (const SmartPointerMap& other)
     {
-        allKeys = other.allKeys;
-        allValues = other.allValues;
-
-        //
+        HashMap<K, V, SmartPointerVector<V>>::operator=(other);
 
     	return *this;
     }
 
     SmartPointerMap& operator= (SmartPointerMap&& other)
     {
-        allKeys = other.allKeys;
-        allValues = other.allValues;
-
-        //
+        HashMap<K, V, SmartPointerVector<V>>::operator=(std::move(other));
 
     	return *this;
     }
 
     ~SmartPointerMap()
     {
-        clear();
-    }
-
-    void clear()
-    {
-        allKeys.clear();
-        allValues.clear();
-    }
-
-    uint32_t find(const K& key) const
-    {
-        uint32_t start = 0;
-        uint32_t end = allKeys.size();
-
-        uint32_t result = 0;
-
-        while (start < end)
-        {
-            result = (end + start) / 2;
-
-            if (key == allKeys[result])
-            {
-                return result;
-            }
-            else if (end - start == 1)
-            {
-                break;
-            }
-
-            if (key < allKeys[result])
-            {
-                end = result;
-            }
-            else if (key > allKeys[result])
-            {
-                start = result;
-            }
-        }
-
-        return allKeys.size();
-    }
-
-    VkBool32 set(const K& key, const V& value)
-    {
-        for (uint32_t i = 0; i < allKeys.size(); i++)
-        {
-            if (key == allKeys[i])
-            {
-                allValues[i] = value;
-
-                return VK_TRUE;
-            }
-            else if (key < allKeys[i])
-            {
-                allKeys.insert(i, key);
-                allValues.insert(i, value);
-
-                return VK_TRUE;
-            }
-        }
-
-        allKeys.append(key);
-        allValues.append(value);
-
-        return VK_TRUE;
     }
 
-    VkBool32 remove(const K& key)
-    {
-        uint32_t index = find(key);
-
-        if (index != allKeys.size())
-        {
-            return removeAt(index);
-        }
-
-        return VK_FALSE;
-    }
-
-    VkBool32 removeAt(const uint32_t index)
-    {
-        if (index >= allKeys.size())
-        {
-            return VK_FALSE;
-        }
-
-        allKeys.removeAt(index);
-        allValues.removeAt(index);
-
-        return VK_TRUE;
-    }
-
-    VkBool32 contains(const K& key) const
-    {
-        return find(key) != allKeys.size();
-    }
-
-    V& operator[](const K& key)
-    {
-        uint32_t index = find(key);
-
-        if (index != allKeys.size())
-        {
-            return allValues[index];
-        }
-
-        // Create, if not present.
-        V v;
-        set(key, v);
-
-        return allValues[find(key)];
-    }
-
-    const V& operator[](const K& key) const
-    {
-        return allValues[find(key)];
-    }
-
-    K& keyAt(const uint32_t index)
-    {
-        return allKeys[index];
-    }
-
-    const K& keyAt(const uint32_t index) const
-    {
-        return allKeys[index];
-    }
-
-    V& valueAt(const uint32_t index)
-    {
-        return allValues[index];
-    }
-
-    const V& valueAt(const uint32_t index) const
-    {
-        return allValues[index];
-    }
-
-    const Vector<K>& keys() const
-    {
-        return allKeys;
-    }
-
-    const SmartPointerVector<V>& values() const
-    {
-        return allValues;
-    }
-
-    uint32_t size() const
-    {
-        return allKeys.size();
-    }
 };
 
 }
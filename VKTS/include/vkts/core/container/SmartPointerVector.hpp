@@ -320,7 +320,18 @@ public:
             return VK_FALSE;
         }
 
-        return remove(allData[index]);
+        // Removing by value would remove the first equal element and not the one at the index.
+        allData[index].reset();
+
+        for (uint32_t copyIndex = index; copyIndex < topElement - 1; copyIndex++)
+        {
+            allData[copyIndex] = allData[copyIndex + 1];
+            allData[copyIndex + 1].reset();
+        }
+
+        topElement--;
+
+        return VK_TRUE;
     }
 
     VkBool32 contains(const V& value) const
@@ -285,7 +285,15 @@ public:
             return VK_FALSE;
         }
 
-        return remove(allData[index]);
+        // Removing by value would remove the first equal element and not the one at the index.
+        for (uint32_t copyIndex = index; copyIndex < topElement - 1; copyIndex++)
+        {
+            allData[copyIndex] = allData[copyIndex + 1];
+        }
+
+        topElement--;
+
+        return VK_TRUE;
     }
 
     VkBool32 contains(const V& value) const
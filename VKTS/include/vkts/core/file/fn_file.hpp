@@ -49,6 +49,22 @@ VKTS_APICALL IBinaryBufferSP VKTS_APIENTRY fileLoadBinary(const char* filename);
  */
 VKTS_APICALL ITextBufferSP VKTS_APIENTRY fileLoadText(const char* filename);
 
+/**
+ * Maps the file into memory without copying it. If mapping is not available, the file is read.
+ * The returned buffer is read only. Clone it for writing.
+ *
+ * @ThreadSafe
+ */
+VKTS_APICALL IBinaryBufferSP VKTS_APIENTRY fileMapBinary(const char* filename);
+
+/**
+ * Maps the file as zero terminated text into memory without copying it. If mapping is not available, the file is read.
+ * The returned text is read only. Clone it for writing.
+ *
+ * @ThreadSafe
+ */
+VKTS_APICALL ITextBufferSP VKTS_APIENTRY fileMapText(const char* filename);
+
 /**
  *
  * @ThreadSafe
@@ -32,23 +32,52 @@
 namespace vkts
 {
 
+class JsonDocument;
+class JsonDecoder;
+
 class JSONarray : public JSONvalue
 {
 
+	friend class JsonDocument;
+	friend class JsonDecoder;
+
 private:
 
-	SmartPointerVector<JSONvalueSP> allValues;
+	JsonDocument* document;
 
-public:
+	// Values are allocated from the document.
+	mutable JSONvalue** allValues;
+	mutable uint32_t valueCount;
+	mutable uint32_t valueCapacity;
+
+	// Not yet decoded values, if lazy decoded.
+	mutable VkBool32 lazy;
+	mutable uint32_t lazyBegin;
+	mutable uint32_t lazyEnd;
+
+	void decodeLazy() const;
+
+	void setValues(JSONvalue* const* values, const uint32_t count) const;
+
+protected:
+
+	JSONarray(JsonDocument* document);
+
+	/**
+	 * Values are decoded from the given range of the documents text, when accessed the first time.
+	 */
+	JSONarray(JsonDocument* document, const uint32_t lazyBegin, const uint32_t lazyEnd);
 
-	JSONarray();
 	virtual ~JSONarray();
 
-	void addValue(const JSONvalueSP& value);
+public:
 
-	JSONvalueSP getValueAt(int32_t index) const;
+	/**
+	 * Value has to be created by the same document.
+	 */
+	void addValue(JSONvalue* value);
 
-	const SmartPointerVector<JSONvalueSP>& getAllValues() const;
+	JSONvalue* getValueAt(int32_t index) const;
 
 	uint32_t size() const;
 
@@ -35,11 +35,15 @@ namespace vkts
 class JSONfalse : public JSONvalue
 {
 
-public:
+	friend class JsonDocument;
+
+protected:
 
 	JSONfalse();
 	virtual ~JSONfalse();
 
+public:
+
 	virtual VkBool32 encode(std::string& jsonText, int32_t& spaces) const;
 
 	virtual void visit(JsonVisitor& jsonVisitor);
@@ -35,17 +35,21 @@ namespace vkts
 class JSONfloat : public JSONnumber
 {
 
+	friend class JsonDocument;
+
 private:
 
 	float floatValue;
 
-public:
+protected:
 
 	JSONfloat();
 	JSONfloat(const std::string& value);
 	JSONfloat(float value);
 	virtual ~JSONfloat();
 
+public:
+
 	float getValue() const;
 	void setValue(float value);
 
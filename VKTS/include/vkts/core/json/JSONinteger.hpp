@@ -35,17 +35,21 @@ namespace vkts
 class JSONinteger : public JSONnumber
 {
 
+	friend class JsonDocument;
+
 private:
 
 	int32_t integerValue;
 
-public:
+protected:
 
 	JSONinteger();
 	JSONinteger(const std::string& value);
 	JSONinteger(int32_t value);
 	virtual ~JSONinteger();
 
+public:
+
 	int32_t getValue() const;
 	void setValue(int32_t value);
 
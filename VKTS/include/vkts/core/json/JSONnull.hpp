@@ -35,11 +35,15 @@ namespace vkts
 class JSONnull : public JSONvalue
 {
 
-public:
+	friend class JsonDocument;
+
+protected:
 
 	JSONnull();
 	virtual ~JSONnull();
 
+public:
+
 	virtual VkBool32 encode(std::string& jsonText, int32_t& spaces) const;
 
 	virtual void visit(JsonVisitor& jsonVisitor);
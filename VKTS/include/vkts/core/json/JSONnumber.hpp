@@ -35,13 +35,13 @@ namespace vkts
 class JSONnumber : public JSONvalue
 {
 
-private:
-
-public:
+protected:
 
 	JSONnumber();
 	virtual ~JSONnumber();
 
+public:
+
 	virtual VkBool32 encode(std::string& jsonText, int32_t& spaces) const = 0;
 
 	virtual void visit(JsonVisitor& jsonVisitor) = 0;
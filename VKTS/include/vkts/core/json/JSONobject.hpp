@@ -32,28 +32,75 @@
 namespace vkts
 {
 
+class JsonDocument;
+class JsonDecoder;
+
+typedef struct JsonMember_
+{
+	const char* key;
+	uint32_t keyLength;
+	JSONvalue* value;
+} JsonMember;
+
 class JSONobject : public JSONvalue
 {
 
+	friend class JsonDocument;
+	friend class JsonDecoder;
+
 private:
 
-	SmartPointerMap<std::string, JSONvalueSP> allKeyValues;
+	JsonDocument* document;
 
-public:
+	// Members and the slots are allocated from the document.
+	mutable JsonMember* allMembers;
+	mutable uint32_t memberCount;
+	mutable uint32_t memberCapacity;
+
+	// Only larger objects do have slots with the member indices, smaller ones are searched linearly.
+	mutable uint32_t* allSlots;
+	mutable uint32_t slotMask;
+
+	// Not yet decoded members, if lazy decoded.
+	mutable VkBool32 lazy;
+	mutable uint32_t lazyBegin;
+	mutable uint32_t lazyEnd;
+
+	void decodeLazy() const;
 
-	JSONobject();
+	void insertSlot(const uint32_t index) const;
+
+	void createSlots(const uint32_t count) const;
+
+	uint32_t findMember(const char* key, const uint32_t keyLength) const;
+
+	void setMembers(const JsonMember* members, const uint32_t count) const;
+
+protected:
+
+	JSONobject(JsonDocument* document);
+
+	/**
+	 * Members are decoded from the given range of the documents text, when accessed the first time.
+	 */
+	JSONobject(JsonDocument* document, const uint32_t lazyBegin, const uint32_t lazyEnd);
 
 	virtual ~JSONobject();
 
-	void addKeyValue(const std::string& key, const JSONvalueSP& value);
+public:
+
+	/**
+	 * Value has to be created by the same document.
+	 */
+	void addKeyValue(const std::string& key, JSONvalue* value);
 
 	VkBool32 hasKey(const std::string& key) const;
 
-	JSONvalueSP getValue(const std::string& key) const;
+	JSONvalue* getValue(const std::string& key) const;
 
-	const SmartPointerMap<std::string, JSONvalueSP>& getAllKeyValues() const;
+	std::string getKeyAt(const uint32_t index) const;
 
-	const Vector<std::string>& getAllKeys() const;
+	JSONvalue* getValueAt(const uint32_t index) const;
 
 	uint32_t size() const;
 
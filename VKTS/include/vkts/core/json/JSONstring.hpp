@@ -35,19 +35,29 @@ namespace vkts
 class JSONstring : public JSONvalue
 {
 
+	friend class JsonDocument;
+	friend class JsonDecoder;
+
 private:
 
-	std::string value;
+	// Null terminated and owned by the document.
+	const char* characters;
+	uint32_t length;
 
-public:
+protected:
 
-	JSONstring();
-	JSONstring(const std::string& value);
+	JSONstring(const char* characters, const uint32_t length);
 	virtual ~JSONstring();
 
-	const std::string& getValue() const;
+public:
+
+	std::string getValue() const;
+
+	const char* getCharacters() const;
+
+	uint32_t getLength() const;
 
-	void setValue(const std::string& value);
+	static VkBool32 encodeCharacters(std::string& jsonText, const char* characters, const uint32_t length);
 
 	virtual VkBool32 encode(std::string& jsonText, int32_t& spaces) const;
 
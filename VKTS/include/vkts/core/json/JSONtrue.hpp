@@ -35,11 +35,15 @@ namespace vkts
 class JSONtrue : public JSONvalue
 {
 
-public:
+	friend class JsonDocument;
+
+protected:
 
 	JSONtrue();
 	virtual ~JSONtrue();
 
+public:
+
 	virtual VkBool32 encode(std::string& jsonText, int32_t& spaces) const;
 
 	virtual void visit(JsonVisitor& jsonVisitor);
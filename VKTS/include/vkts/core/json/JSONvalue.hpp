@@ -50,6 +50,9 @@ public:
 
 };
 
+/**
+ * Values are owned by a JsonDocument. A shared pointer to the root value keeps the whole document alive.
+ */
 typedef std::shared_ptr<JSONvalue> JSONvalueSP;
 
 }
@@ -0,0 +1,134 @@
+/**
+ * VKTS - VulKan ToolS.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) since 2014 Norbert Nopper
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef VKTS_JSONDOCUMENT_HPP_
+#define VKTS_JSONDOCUMENT_HPP_
+
+#include <vkts/core/vkts_core.hpp>
+
+namespace vkts
+{
+
+/**
+ * Owns all values and characters of one JSON document. Memory is taken from larger blocks,
+ * which are all released at once, when the document is destroyed.
+ * Values do only have non owning pointers to other values.
+ *
+ * Not thread Safe.
+ */
+class JsonDocument
+{
+
+private:
+
+	std::vector<uint8_t*> allBlocks;
+
+	uint8_t* currentBlock;
+	size_t currentBlockOffset;
+	size_t currentBlockSize;
+
+	size_t allocatedBytes;
+	size_t reservedBytes;
+
+	// Only kept for lazy decoding. Either a copy or the mapped text buffer is referenced.
+	std::string jsonText;
+	ITextBufferSP jsonTextBuffer;
+
+	const char* jsonCharacters;
+	size_t jsonLength;
+
+	// Literals do not have a state, so they are shared.
+	JSONtrue* jsonTrue;
+	JSONfalse* jsonFalse;
+	JSONnull* jsonNull;
+
+public:
+
+	JsonDocument();
+	JsonDocument(const JsonDocument& other) = delete;
+	JsonDocument(JsonDocument&& other) = delete;
+	~JsonDocument();
+
+	JsonDocument& operator =(const JsonDocument& other) = delete;
+	JsonDocument& operator =(JsonDocument && other) = delete;
+
+	void* allocate(const size_t size);
+
+	/**
+	 * Returns a null terminated copy.
+	 */
+	const char* allocateCharacters(const char* characters, const size_t length);
+
+	JSONobject* createObject();
+
+	JSONobject* createLazyObject(const uint32_t lazyBegin, const uint32_t lazyEnd);
+
+	JSONarray* createArray();
+
+	JSONarray* createLazyArray(const uint32_t lazyBegin, const uint32_t lazyEnd);
+
+	JSONstring* createString(const char* characters, const size_t length);
+
+	JSONstring* createString(const std::string& value);
+
+	JSONinteger* createInteger(const int32_t value);
+
+	JSONfloat* createFloat(const float value);
+
+	JSONtrue* createTrue();
+
+	JSONfalse* createFalse();
+
+	JSONnull* createNull();
+
+	const char* getJsonCharacters() const;
+
+	size_t getJsonLength() const;
+
+	void setJsonText(const std::string& jsonText);
+
+	/**
+	 * The text is not copied, but the text buffer is kept alive.
+	 */
+	void setJsonText(const ITextBufferSP& jsonTextBuffer);
+
+	/**
+	 * Bytes used by values and characters.
+	 */
+	size_t getAllocatedBytes() const;
+
+	/**
+	 * Bytes of all blocks.
+	 */
+	size_t getReservedBytes() const;
+
+};
+
+typedef std::shared_ptr<JsonDocument> JsonDocumentSP;
+
+}
+
+#endif /* VKTS_JSONDOCUMENT_HPP_ */
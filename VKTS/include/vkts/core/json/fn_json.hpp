@@ -38,6 +38,24 @@ namespace vkts
  */
 VKTS_APICALL JSONvalueSP VKTS_APIENTRY jsonDecode(const std::string& jsonText);
 
+/**
+ * Objects and arrays are only decoded, when their content is accessed the first time.
+ * So parts of the document, which are never visited, are never decoded.
+ * Syntax errors inside objects and arrays are only detected, when they are decoded.
+ * Accessing the returned document from several threads is not thread safe.
+ *
+ * @ThreadSafe
+ */
+VKTS_APICALL JSONvalueSP VKTS_APIENTRY jsonDecodeLazy(const std::string& jsonText);
+
+/**
+ * Same as above, but the text is not copied. Instead, the returned document keeps the text buffer alive.
+ * The text buffer, e.g. created by fileMapText, is not allowed to be modified afterwards.
+ *
+ * @ThreadSafe
+ */
+VKTS_APICALL JSONvalueSP VKTS_APIENTRY jsonDecodeLazy(const ITextBufferSP& jsonTextBuffer);
+
 /**
  *
  * @ThreadSafe
@@ -0,0 +1,156 @@
+/**
+ * VKTS - VulKan ToolS.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) since 2014 Norbert Nopper
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef VKTS_MEMORYALLOCATOR_HPP_
+#define VKTS_MEMORYALLOCATOR_HPP_
+
+#include <vkts/core/vkts_core.hpp>
+
+namespace vkts
+{
+
+/**
+ * Called for each allocation, which is moved by the defragmentation. The content has to be copied
+ * and the resources have to be bound to the destination. Returning false stops the defragmentation.
+ */
+typedef std::function<VkBool32(const VkTsMemoryAllocation& source, const VkTsMemoryAllocation& destination)> MemoryMoveFunction;
+
+/**
+ * Sub-allocates ranges from large blocks, which are kept per memory type.
+ * If the buffer image granularity is larger than one, linear and non-linear resources do use different blocks,
+ * so they can never share a granularity page. Resources larger than half of a block get a dedicated block.
+ * Allocations are identified by an index, which stays the same, even if the allocation is moved.
+ *
+ * Thread safe.
+ */
+class MemoryAllocator : public IDestroyable
+{
+
+private:
+
+	typedef struct MemoryBlock_
+	{
+		uint32_t blockId;
+		VkBool32 linear;
+		VkBool32 dedicated;
+		TlsfAllocatorSP allocator;
+	} MemoryBlock;
+
+	typedef struct MemoryRecord_
+	{
+		VkTsMemoryAllocation memoryAllocation;
+		uint32_t blockAllocation;
+		VkDeviceSize alignment;
+		VkBool32 used;
+	} MemoryRecord;
+
+	const IMemoryBlockAllocatorSP blockAllocator;
+
+	const VkPhysicalDeviceMemoryProperties memoryProperties;
+
+	const VkDeviceSize bufferImageGranularity;
+
+	VkDeviceSize allBlockSizes[VK_MAX_MEMORY_TYPES];
+
+	std::vector<MemoryBlock> allBlocks[VK_MAX_MEMORY_TYPES];
+
+	std::vector<MemoryRecord> allRecords;
+	std::vector<uint32_t> allFreeRecords;
+
+	uint32_t nextBlockId;
+
+	mutable std::mutex mutex;
+
+	int32_t createBlock(const uint32_t memoryTypeIndex, const VkDeviceSize size, const VkBool32 linear, const VkBool32 dedicated);
+
+	void releaseBlock(const uint32_t memoryTypeIndex, const uint32_t blockIndex);
+
+	int32_t findBlock(const uint32_t memoryTypeIndex, const uint32_t blockId) const;
+
+	VkBool32 allocateInBlocks(VkTsMemoryAllocation& memoryAllocation, uint32_t& blockAllocation, const uint32_t memoryTypeIndex, const VkDeviceSize size, const VkDeviceSize alignment, const VkBool32 linear, const int32_t excludeBlockIndex);
+
+	void freeRecord(const uint32_t allocation);
+
+public:
+
+	MemoryAllocator() = delete;
+	/**
+	 * With a block size of zero, an eighth of small heaps or VKTS_MEMORY_BLOCK_SIZE is used.
+	 */
+	MemoryAllocator(const IMemoryBlockAllocatorSP& blockAllocator, const VkPhysicalDeviceMemoryProperties& memoryProperties, const VkDeviceSize bufferImageGranularity, const VkDeviceSize blockSize);
+	MemoryAllocator(const MemoryAllocator& other) = delete;
+	MemoryAllocator(MemoryAllocator&& other) = delete;
+	virtual ~MemoryAllocator();
+
+	MemoryAllocator& operator =(const MemoryAllocator& other) = delete;
+	MemoryAllocator& operator =(MemoryAllocator && other) = delete;
+
+	/**
+	 * Linear are buffers and images with linear tiling.
+	 */
+	VkBool32 allocate(uint32_t& allocation, const uint32_t memoryTypeIndex, const VkDeviceSize size, const VkDeviceSize alignment, const VkBool32 linear);
+
+	void free(const uint32_t allocation);
+
+	VkBool32 getAllocation(VkTsMemoryAllocation& memoryAllocation, const uint32_t allocation) const;
+
+	/**
+	 * Moves at most maxMoves allocations out of the least used block of the memory type into the other blocks
+	 * and frees the block, if it gets empty. The move function must not call the allocator. Returns the number of moves.
+	 */
+	uint32_t defragment(const uint32_t memoryTypeIndex, const uint32_t maxMoves, const MemoryMoveFunction& moveFunction);
+
+	VkDeviceSize getBlockSize(const uint32_t memoryTypeIndex) const;
+
+	/**
+	 * Number of blocks of all memory types, which is the number of allocations done by the block allocator.
+	 */
+	uint32_t getBlockCount() const;
+
+	uint32_t getAllocationCount() const;
+
+	VkDeviceSize getUsedSize() const;
+
+	/**
+	 * Size of all blocks.
+	 */
+	VkDeviceSize getReservedSize() const;
+
+	VkDeviceSize getLargestFreeSize(const uint32_t memoryTypeIndex) const;
+
+	//
+	// IDestroyable
+	//
+
+	virtual void destroy() override;
+
+};
+
+typedef std::shared_ptr<MemoryAllocator> MemoryAllocatorSP;
+
+} /* namespace vkts */
+
+#endif /* VKTS_MEMORYALLOCATOR_HPP_ */
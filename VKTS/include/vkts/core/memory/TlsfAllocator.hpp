@@ -0,0 +1,130 @@
+/**
+ * VKTS - VulKan ToolS.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) since 2014 Norbert Nopper
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef VKTS_TLSFALLOCATOR_HPP_
+#define VKTS_TLSFALLOCATOR_HPP_
+
+#include <vkts/core/vkts_core.hpp>
+
+namespace vkts
+{
+
+/**
+ * Two level segregated fit allocator of offsets inside one range e.g. a device memory block.
+ * The range itself is never touched, so the book keeping is stored in an own node vector.
+ * Allocating and freeing have a constant cost, free neighbours are merged at once.
+ *
+ * Not thread safe.
+ */
+class TlsfAllocator
+{
+
+private:
+
+	typedef struct TlsfNode_
+	{
+		VkDeviceSize offset;
+		VkDeviceSize size;
+
+		uint32_t previousPhysical;
+		uint32_t nextPhysical;
+
+		uint32_t previousFree;
+		uint32_t nextFree;
+
+		VkBool32 free;
+	} TlsfNode;
+
+	const VkDeviceSize size;
+
+	std::vector<TlsfNode> allNodes;
+
+	// Nodes, which are not part of the range anymore.
+	std::vector<uint32_t> allUnusedNodes;
+
+	uint64_t firstLevelBitmap;
+	uint32_t allSecondLevelBitmaps[VKTS_TLSF_FIRST_LEVEL_COUNT];
+
+	uint32_t allFreeLists[VKTS_TLSF_FIRST_LEVEL_COUNT][VKTS_TLSF_SECOND_LEVEL_COUNT];
+
+	VkDeviceSize usedSize;
+
+	uint32_t allocationCount;
+
+	static void mapping(const VkDeviceSize size, uint32_t& firstLevel, uint32_t& secondLevel);
+
+	uint32_t createNode(const VkDeviceSize offset, const VkDeviceSize size);
+
+	void insertFree(const uint32_t node);
+
+	void removeFree(const uint32_t node);
+
+	uint32_t findFree(const VkDeviceSize size) const;
+
+	uint32_t split(const uint32_t node, const VkDeviceSize size);
+
+	void merge(const uint32_t node, const uint32_t nextNode);
+
+public:
+
+	TlsfAllocator() = delete;
+	explicit TlsfAllocator(const VkDeviceSize size);
+	TlsfAllocator(const TlsfAllocator& other) = delete;
+	TlsfAllocator(TlsfAllocator&& other) = delete;
+	~TlsfAllocator();
+
+	TlsfAllocator& operator =(const TlsfAllocator& other) = delete;
+	TlsfAllocator& operator =(TlsfAllocator && other) = delete;
+
+	/**
+	 * Alignment has to be a power of two. On success, the allocation is the handle to free the range.
+	 */
+	VkBool32 allocate(VkDeviceSize& offset, uint32_t& allocation, const VkDeviceSize size, const VkDeviceSize alignment);
+
+	void free(const uint32_t allocation);
+
+	VkDeviceSize getSize() const;
+
+	VkDeviceSize getUsedSize() const;
+
+	VkDeviceSize getFreeSize() const;
+
+	/**
+	 * Largest range, which can be allocated without an alignment.
+	 */
+	VkDeviceSize getLargestFreeSize() const;
+
+	uint32_t getAllocationCount() const;
+
+	VkBool32 isEmpty() const;
+
+};
+
+typedef std::shared_ptr<TlsfAllocator> TlsfAllocatorSP;
+
+} /* namespace vkts */
+
+#endif /* VKTS_TLSFALLOCATOR_HPP_ */
@@ -0,0 +1,119 @@
+/**
+ * VKTS - VulKan ToolS.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) since 2014 Norbert Nopper
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef VKTS_UPLOADRING_HPP_
+#define VKTS_UPLOADRING_HPP_
+
+#include <vkts/core/vkts_core.hpp>
+
+namespace vkts
+{
+
+/**
+ * Linear allocator over persistently mapped memory, which is split into one segment per frame e.g. per swapchain buffer.
+ * Resetting a frame hands out its segment again. Written ranges are collected and merged,
+ * so non coherent memory can be flushed with a few ranges at the end of the frame.
+ *
+ * Not thread safe.
+ */
+class UploadRing
+{
+
+private:
+
+	const VkDeviceSize frameSize;
+
+	const uint32_t frameCount;
+
+	const VkDeviceSize atomSize;
+
+	uint32_t currentFrame;
+
+	VkDeviceSize head;
+
+	std::vector<VkTsMemoryRange> allDirtyRanges;
+
+	uint64_t frameBytes;
+
+	uint32_t frameFlushRanges;
+
+public:
+
+	UploadRing() = delete;
+	/**
+	 * Flushed ranges are aligned to the atom size e.g. nonCoherentAtomSize.
+	 */
+	UploadRing(const VkDeviceSize frameSize, const uint32_t frameCount, const VkDeviceSize atomSize);
+	UploadRing(const UploadRing& other) = delete;
+	UploadRing(UploadRing&& other) = delete;
+	~UploadRing();
+
+	UploadRing& operator =(const UploadRing& other) = delete;
+	UploadRing& operator =(UploadRing && other) = delete;
+
+	/**
+	 * Starts the given frame. All ranges of its segment are free again and the counters are cleared.
+	 */
+	void reset(const uint32_t frame);
+
+	/**
+	 * Returns the offset from the begin of the memory. Alignment has to be a power of two.
+	 */
+	VkBool32 allocate(VkDeviceSize& offset, const VkDeviceSize size, const VkDeviceSize alignment);
+
+	/**
+	 * Records a write, which has to be flushed.
+	 */
+	void addDirtyRange(const VkDeviceSize offset, const VkDeviceSize size);
+
+	VkBool32 isDirty() const;
+
+	/**
+	 * Returns the sorted, merged and atom aligned written ranges since the last call.
+	 */
+	void getFlushRanges(std::vector<VkTsMemoryRange>& allFlushRanges);
+
+	VkDeviceSize getFrameSize() const;
+
+	uint32_t getFrameCount() const;
+
+	uint32_t getCurrentFrame() const;
+
+	/**
+	 * Bytes written since the frame was reset.
+	 */
+	uint64_t getFrameBytes() const;
+
+	/**
+	 * Ranges to flush returned since the frame was reset.
+	 */
+	uint32_t getFrameFlushRanges() const;
+
+};
+
+} /* namespace vkts */
+
+#endif /* VKTS_UPLOADRING_HPP_ */
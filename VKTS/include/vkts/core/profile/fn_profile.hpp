@@ -44,6 +44,36 @@ VKTS_APICALL VkBool32 VKTS_APIENTRY profileApplicationGetRam(uint64_t& ram);
 
 VKTS_APICALL VkBool32 VKTS_APIENTRY profileApplicationGetFps(uint32_t& fps, const double deltaTime);
 
+/**
+ * Counts one upload of the given size to device memory.
+ */
+VKTS_APICALL void VKTS_APIENTRY profileAddUpload(const uint64_t size);
+
+/**
+ * Returns the uploads and their total size counted since the last call, e.g. per frame.
+ */
+VKTS_APICALL void VKTS_APIENTRY profileGetUploads(uint64_t& uploads, uint64_t& size);
+
+/**
+ * Counts one flush of mapped memory with the given number of ranges.
+ */
+VKTS_APICALL void VKTS_APIENTRY profileAddFlush(const uint64_t ranges);
+
+/**
+ * Returns the flushes and their ranges counted since the last call, e.g. per frame.
+ */
+VKTS_APICALL void VKTS_APIENTRY profileGetFlushes(uint64_t& flushes, uint64_t& ranges);
+
+/**
+ * Counts one requested pipeline, either newly created or reused from a cache.
+ */
+VKTS_APICALL void VKTS_APIENTRY profileAddPipeline(const VkBool32 reused);
+
+/**
+ * Returns the created and reused pipelines counted since the last call, e.g. per loaded scene.
+ */
+VKTS_APICALL void VKTS_APIENTRY profileGetPipelines(uint64_t& created, uint64_t& reused);
+
 VKTS_APICALL void VKTS_APIENTRY profileTerminate();
 
 }
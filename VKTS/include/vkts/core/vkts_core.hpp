@@ -44,14 +44,17 @@
 #include <cstdio>
 #include <cstdlib>
 #include <cstring>
+#include <functional>
 #include <map>
 #include <memory>
 #include <mutex>
+#include <new>
 #include <queue>
 #include <stack>
 #include <stdexcept>
 #include <string>
 #include <thread>
+#include <type_traits>
 #include <vector>
 
 /**
@@ -103,6 +106,21 @@
 #define VKTS_MAX_BUFFER_CHARS 2048
 #define VKTS_MAX_TOKEN_CHARS 256
 
+#define VKTS_HASH_MAP_MIN_SLOTS 16
+#define VKTS_HASH_MAP_EMPTY_SLOT 0xFFFFFFFF
+
+#define VKTS_JSON_DOCUMENT_BLOCK_SIZE 65536
+#define VKTS_JSON_DOCUMENT_ALIGNMENT 16
+#define VKTS_JSON_OBJECT_LINEAR_MEMBERS 8
+
+#define VKTS_TLSF_FIRST_LEVEL_COUNT 64
+#define VKTS_TLSF_SECOND_LEVEL_LOG2 5
+#define VKTS_TLSF_SECOND_LEVEL_COUNT 32
+#define VKTS_TLSF_NO_NODE 0xFFFFFFFF
+
+#define VKTS_MEMORY_BLOCK_SIZE (256ull * 1024ull * 1024ull)
+#define VKTS_MEMORY_SMALL_HEAP_SIZE (1024ull * 1024ull * 1024ull)
+
 /**
  * Types.
  */
@@ -118,6 +136,22 @@ typedef struct VkTsDynamicOffset_
     uint32_t stride;
 } VkTsDynamicOffset;
 
+typedef struct VkTsMemoryAllocation_
+{
+    uint32_t memoryTypeIndex;
+    uint32_t blockId;
+    VkDeviceSize offset;
+    VkDeviceSize size;
+    VkBool32 linear;
+    VkBool32 dedicated;
+} VkTsMemoryAllocation;
+
+typedef struct VkTsMemoryRange_
+{
+    VkDeviceSize offset;
+    VkDeviceSize size;
+} VkTsMemoryRange;
+
 /**
  * Interface.
  */
@@ -138,6 +172,7 @@ typedef struct VkTsDynamicOffset_
 #include <vkts/core/container/Vector.hpp>
 
 #include <vkts/core/container/Map.hpp>
+#include <vkts/core/container/HashMap.hpp>
 #include <vkts/core/container/SmartPointerMap.hpp>
 
 /**
@@ -218,6 +253,20 @@ typedef struct VkTsDynamicOffset_
 #include <vkts/core/json/JSONfloat.hpp>
 #include <vkts/core/json/JSONinteger.hpp>
 
+#include <vkts/core/json/JsonDocument.hpp>
+
 #include <vkts/core/json/fn_json.hpp>
 
+/**
+ * Memory.
+ */
+
+#include <vkts/core/memory/TlsfAllocator.hpp>
+
+#include <vkts/core/memory/IMemoryBlockAllocator.hpp>
+
+#include <vkts/core/memory/MemoryAllocator.hpp>
+
+#include <vkts/core/memory/UploadRing.hpp>
+
 #endif /* VKTS_VKTS_CORE_HPP_ */
@@ -37,10 +37,11 @@ VKTS_APICALL VkBool32 VKTS_APIENTRY cacheGetEnabled();
 VKTS_APICALL void VKTS_APIENTRY cacheSetEnabled(const VkBool32 enabled);
 
 /**
+ * Saves the given mip level and array layer. Without a filename, the name of the image data is used.
  *
  * @ThreadSafe
  */
-VKTS_APICALL VkBool32 VKTS_APIENTRY cacheSaveImageData(const IImageDataSP& imageData, const std::string& filename = "");
+VKTS_APICALL VkBool32 VKTS_APIENTRY cacheSaveImageData(const IImageDataSP& imageData, const std::string& filename = "", const uint32_t mipLevel = 0, const uint32_t arrayLayer = 0);
 
 /**
  *
@@ -35,6 +35,16 @@ namespace vkts
 typedef IImageDataSP (VKTS_APIENTRY *PFN_imageDataLoadFunction)(const char* filename);
 typedef VkBool32 (VKTS_APIENTRY *PFN_imageDataSaveFunction)(const char* filename, const IImageDataSP& imageData, const uint32_t mipLevel, const uint32_t arrayLayer);
 
+/**
+ * Processes the range [first, last). Returning VK_FALSE stops the processing.
+ */
+typedef std::function<VkBool32(const uint32_t first, const uint32_t last)> ImageDataRangeFunction;
+
+/**
+ * Splits [0, count) into ranges of grainSize elements and processes them e.g. by calling taskParallelFor.
+ */
+typedef std::function<VkBool32(const uint32_t count, const uint32_t grainSize, const ImageDataRangeFunction& rangeFunction)> ImageDataParallelForFunction;
+
 /**
  *
  *
@@ -104,6 +114,12 @@ VKTS_APICALL void VKTS_APIENTRY imageDataSetLoadFunction(const PFN_imageDataLoad
 
 VKTS_APICALL void VKTS_APIENTRY imageDataSetSaveFunction(const PFN_imageDataSaveFunction saveFunction, const VkBool32 fallback = VK_TRUE);
 
+/**
+ * The pre-filters and the mip map generation split the work into tiles or rows, which are processed by the given function.
+ * Without a function, the tiles are processed by the task executors of the running engine, see taskParallelFor.
+ */
+VKTS_APICALL void VKTS_APIENTRY imageDataSetParallelForFunction(const ImageDataParallelForFunction& parallelForFunction);
+
 /**
  *
  * @ThreadSafe
@@ -159,10 +175,12 @@ VKTS_APICALL IImageDataSP VKTS_APIENTRY imageDataCopy(const IImageDataSP& source
 VKTS_APICALL IImageDataSP VKTS_APIENTRY imageDataMerge(const SmartPointerVector<IImageDataSP>& sourceImages, const std::string& name, const uint32_t mipLevels, const uint32_t arrayLayers);
 
 /**
+ * Creates one image containing the complete mip chain of all array layers. The first mip level is copied from the source.
+ * UNORM, SRGB and SFLOAT formats are supported. SRGB color channels are averaged in linear space.
  *
  * @ThreadSafe
  */
-VKTS_APICALL SmartPointerVector<IImageDataSP> VKTS_APIENTRY imageDataMipmap(const IImageDataSP& sourceImage, const VkBool32 addSourceAsCopy, const std::string& name);
+VKTS_APICALL IImageDataSP VKTS_APIENTRY imageDataMipmap(const IImageDataSP& sourceImage, const std::string& name, const enum VkTsMipmapFilter filter = VKTS_MIPMAP_FILTER_BOX);
 
 /**
  *
@@ -45,6 +45,8 @@
 
 enum VkTsImageDataType {VKTS_NON_COLOR_DATA, VKTS_LDR_COLOR_DATA, VKTS_HDR_COLOR_DATA, VKTS_NORMAL_DATA};
 
+enum VkTsMipmapFilter {VKTS_MIPMAP_FILTER_BOX, VKTS_MIPMAP_FILTER_KAISER, VKTS_MIPMAP_FILTER_LANCZOS};
+
 /**
  * Image data.
  */
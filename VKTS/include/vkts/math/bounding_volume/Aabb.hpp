@@ -72,6 +72,8 @@ public:
 
 };
 
+Aabb operator *(const glm::mat4& transform, const Aabb& box);
+
 } /* namespace vkts */
 
 #endif /* VKTS_AABB_HPP_ */
@@ -0,0 +1,125 @@
+/**
+ * VKTS - VulKan ToolS.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) since 2014 Norbert Nopper
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef VKTS_BVH_HPP_
+#define VKTS_BVH_HPP_
+
+#include <vkts/math/vkts_math.hpp>
+
+#define VKTS_BVH_BINS 16
+#define VKTS_BVH_MAX_LEAF_ITEMS 4
+
+namespace vkts
+{
+
+class Frustum;
+
+/**
+ * Bounding volume hierarchy over axis aligned boxes. Built with the binned surface area heuristic,
+ * boxes of items can be changed afterwards and only the affected nodes are refitted.
+ */
+class Bvh
+{
+
+private:
+
+	typedef struct BvhNode_
+	{
+		glm::vec3 min;
+		// First child node for inner nodes, first item index for leaves.
+		uint32_t first;
+		glm::vec3 max;
+		// Zero for inner nodes.
+		uint32_t count;
+	} BvhNode;
+
+	std::vector<BvhNode> allNodes;
+	std::vector<uint32_t> allParents;
+	std::vector<uint8_t> allNodesDirty;
+
+	std::vector<uint32_t> allItemIndices;
+
+	// Boxes are stored in the order of the leaves, so refitting and culling access them linearly.
+	std::vector<glm::vec3> allItemMins;
+	std::vector<glm::vec3> allItemMaxs;
+
+	std::vector<uint32_t> allItemSlots;
+	std::vector<uint32_t> allItemLeaves;
+
+	VkBool32 anyNodeDirty;
+
+	void buildRecursive(const uint32_t nodeIndex, const uint32_t first, const uint32_t count);
+
+	void gatherRecursive(const uint32_t nodeIndex, std::vector<uint32_t>& allItems) const;
+
+public:
+
+	Bvh();
+	Bvh(const Bvh& other) = delete;
+	Bvh(Bvh&& other) = delete;
+	~Bvh();
+
+	Bvh& operator =(const Bvh& other) = delete;
+	Bvh& operator =(Bvh && other) = delete;
+
+	void reset();
+
+	void build(const std::vector<Aabb>& allBoxes);
+
+	/**
+	 * Number of items.
+	 */
+	uint32_t getSize() const;
+
+	uint32_t getNodeCount() const;
+
+	/**
+	 * Changes the box of an item. Call refit before the next query.
+	 */
+	void setBox(const uint32_t item, const Aabb& box);
+
+	void refit();
+
+	/**
+	 * Gathers all items, which boxes are not outside of the frustum. Subtrees completely inside are not tested anymore.
+	 */
+	void cull(const Frustum& frustum, std::vector<uint32_t>& allVisibleItems) const;
+
+	/**
+	 * Gathers all items, which boxes intersect the given box.
+	 */
+	void intersect(const Aabb& box, std::vector<uint32_t>& allItems) const;
+
+	/**
+	 * Gathers all items, which boxes are hit by the ray, e.g. for picking.
+	 */
+	void intersect(const glm::vec3& origin, const glm::vec3& direction, std::vector<uint32_t>& allItems) const;
+
+};
+
+} /* namespace vkts */
+
+#endif /* VKTS_BVH_HPP_ */
@@ -49,6 +49,8 @@ public:
 
     void toWorldSpace(const glm::mat4& projectionMatrix, const glm::mat4& viewMatrix);
 
+    const Plane& getSide(const uint32_t i) const;
+
     VkBool32 isVisible(const glm::vec4& pointWorld) const;
 
     VkBool32 isVisible(const Sphere& sphereWorld) const;
@@ -57,6 +59,18 @@ public:
 
     VkBool32 isVisible(const Obb& obbWorld) const;
 
+    /**
+     * Sets visibleMask[i] to 1, if the sphere and the box of object i are visible. Spheres or boxes can be nullptr.
+     */
+    void cull(const Sphere* spheresWorld, const Aabb* aabbsWorld, const uint32_t count, uint8_t* visibleMask) const;
+
+    /**
+     * Culls against several frusta e.g. shadow cascades or views in one pass. Bit f of visibleMask[i] is set, if object i is visible in frustum f.
+     */
+    static void cull(const Frustum* const* allFrusta, const uint32_t frustumCount, const Sphere* spheresWorld, const Aabb* aabbsWorld, const uint32_t count, uint8_t* visibleMask);
+
+    static void cull(const Frustum* const* allFrusta, const uint32_t frustumCount, const VkTsCullBounds& boundsWorld, const uint32_t count, uint8_t* visibleMask);
+
 };
 
 } /* namespace vkts */
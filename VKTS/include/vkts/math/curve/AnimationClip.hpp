@@ -0,0 +1,128 @@
+/**
+ * VKTS - VulKan ToolS.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) since 2014 Norbert Nopper
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef VKTS_ANIMATIONCLIP_HPP_
+#define VKTS_ANIMATIONCLIP_HPP_
+
+#include <vkts/math/vkts_math.hpp>
+
+namespace vkts
+{
+
+/**
+ * Translation, rotation and scale of several tracks, sampled at a fixed rate and quantised to 16 bit.
+ * All animated values of one frame are stored next to each other, so sampling a pose reads two frames and interpolates them.
+ * Translation and scale are quantised to the range of the track. Rotation is stored as the smallest three components of the quaternion.
+ * Values, which do not change over the clip, are stored once per track. Frames, which can be interpolated from the kept neighbours, are removed.
+ */
+class AnimationClip
+{
+
+private:
+
+	uint32_t trackCount;
+
+	float startTime;
+	float sampleRate;
+	uint32_t sampleCount;
+
+	// Time of each kept frame.
+	std::vector<float> allFrameTimes;
+
+	// Per track, offset of the track inside a frame and which values are animated. Not animated values have no offset.
+	std::vector<uint32_t> allTranslateOffsets;
+	std::vector<uint32_t> allRotationOffsets;
+	std::vector<uint32_t> allScaleOffsets;
+
+	// Per track, minimum and step of the quantisation. Not animated values are the minimum with a step of zero.
+	std::vector<glm::vec3> allTranslateMinimums;
+	std::vector<glm::vec3> allTranslateSteps;
+	std::vector<Quat> allConstantRotations;
+	std::vector<glm::vec3> allScaleMinimums;
+	std::vector<glm::vec3> allScaleSteps;
+
+	uint32_t frameStride;
+
+	std::vector<uint16_t> allFrameData;
+
+	void sampleTrack(glm::vec3& translate, Quat& rotation, glm::vec3& scale, const uint32_t track, const uint16_t* frame0, const uint16_t* frame1, const float t) const;
+
+public:
+
+	AnimationClip();
+	AnimationClip(const AnimationClip& other);
+	AnimationClip(AnimationClip&& other) = delete;
+	~AnimationClip();
+
+	AnimationClip& operator =(const AnimationClip& other) = delete;
+	AnimationClip& operator =(AnimationClip && other) = delete;
+
+	void reset();
+
+	/**
+	 * Bakes the given samples, which are stored frame by frame: Index is frame * trackCount + track.
+	 * If maxError is greater than zero, frames are removed as long as interpolating the kept frames stays within the error.
+	 * The error is measured per component of the translation, scale and quaternion.
+	 */
+	VkBool32 bake(const uint32_t trackCount, const uint32_t sampleCount, const float startTime, const float sampleRate, const std::vector<glm::vec3>& allTranslates, const std::vector<Quat>& allRotations, const std::vector<glm::vec3>& allScales, const float maxError);
+
+	uint32_t getNumberTracks() const;
+
+	/**
+	 * Number of kept frames.
+	 */
+	uint32_t getNumberFrames() const;
+
+	float getStartTime() const;
+
+	float getStopTime() const;
+
+	float getSampleRate() const;
+
+	/**
+	 * Size of the frames and the per track data in bytes.
+	 */
+	size_t getMemorySize() const;
+
+	/**
+	 * Returns the first frame of the two frames enclosing the time. The cursor works like the one of the keyframe curve.
+	 */
+	uint32_t findFrame(const float time, uint32_t& cursor) const;
+
+	void sample(glm::vec3& translate, Quat& rotation, glm::vec3& scale, const uint32_t track, const float time, uint32_t& cursor) const;
+
+	/**
+	 * Samples all tracks. The vectors are resized to the number of tracks, if needed.
+	 */
+	void samplePose(std::vector<glm::vec3>& allTranslates, std::vector<Quat>& allRotations, std::vector<glm::vec3>& allScales, const float time, uint32_t& cursor) const;
+
+};
+
+typedef std::shared_ptr<AnimationClip> AnimationClipSP;
+
+} /* namespace vkts */
+
+#endif /* VKTS_ANIMATIONCLIP_HPP_ */
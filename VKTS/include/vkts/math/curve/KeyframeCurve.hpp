@@ -0,0 +1,104 @@
+/**
+ * VKTS - VulKan ToolS.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) since 2014 Norbert Nopper
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef VKTS_KEYFRAMECURVE_HPP_
+#define VKTS_KEYFRAMECURVE_HPP_
+
+#include <vkts/math/vkts_math.hpp>
+
+namespace vkts
+{
+
+/**
+ * Keys sorted by time. Each segment between two keys is evaluated by the interpolator of its first key.
+ * Polynomial coefficients of Bezier segments are calculated, when keys are added or removed.
+ * Segments are found by a cursor, which the caller keeps per playback, or by binary search.
+ */
+class KeyframeCurve
+{
+
+private:
+
+	std::vector<float> allKeys;
+	std::vector<float> allValues;
+	std::vector<glm::vec4> allHandles;
+	std::vector<VkTsInterpolator> allInterpolators;
+
+	// Per segment, interpolator used for evaluation.
+	std::vector<VkTsInterpolator> allSegmentInterpolators;
+
+	// Per Bezier segment, key and value as a * t^3 + b * t^2 + c * t + d, stored as (a, b, c, d). Key is relative to the first key of the segment.
+	std::vector<glm::vec4> allKeyCoefficients;
+	std::vector<glm::vec4> allValueCoefficients;
+
+	void updateSegment(const uint32_t index);
+
+	float sampleSegment(const uint32_t index, const float key) const;
+
+public:
+
+	KeyframeCurve();
+	KeyframeCurve(const KeyframeCurve& other);
+	KeyframeCurve(KeyframeCurve&& other) = delete;
+	~KeyframeCurve();
+
+	KeyframeCurve& operator =(const KeyframeCurve& other) = delete;
+	KeyframeCurve& operator =(KeyframeCurve && other) = delete;
+
+	void reset();
+
+	/**
+	 * Inserts the key at its sorted position. Returns VK_FALSE, if the key already exists.
+	 */
+	VkBool32 addEntry(const float key, const float value, const glm::vec4& handles, const VkTsInterpolator interpolator);
+
+	VkBool32 removeEntry(const float key);
+
+	uint32_t getNumberEntries() const;
+
+	const std::vector<float>& getKeys() const;
+
+	const std::vector<float>& getValues() const;
+
+	const std::vector<glm::vec4>& getHandles() const;
+
+	const std::vector<VkTsInterpolator>& getInterpolators() const;
+
+	/**
+	 * Returns the segment containing the key. The next and the current segment of the cursor are tested first, otherwise binary search is used.
+	 * The cursor is updated to the returned segment.
+	 */
+	uint32_t findSegment(const float key, uint32_t& cursor) const;
+
+	float sample(const float key, uint32_t& cursor) const;
+
+	float sample(const float key) const;
+
+};
+
+} /* namespace vkts */
+
+#endif /* VKTS_KEYFRAMECURVE_HPP_ */
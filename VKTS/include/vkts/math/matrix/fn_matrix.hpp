@@ -245,6 +245,20 @@ VKTS_APICALL glm::vec3 VKTS_APIENTRY decomposeScale(const glm::mat3& matrix);
  */
 VKTS_APICALL glm::vec2 VKTS_APIENTRY decomposeScale(const glm::mat2& matrix);
 
+/**
+ * Same as left * right, using SSE2 if available. Result may be one of the operands.
+ *
+ * @ThreadSafe
+ */
+VKTS_APICALL void VKTS_APIENTRY multiplyMat4(glm::mat4& result, const glm::mat4& left, const glm::mat4& right);
+
+/**
+ * Transposed inverse of the upper 3x3 matrix, as used for transforming normals.
+ *
+ * @ThreadSafe
+ */
+VKTS_APICALL void VKTS_APIENTRY normalMat3(glm::mat3& result, const glm::mat4& matrix);
+
 }
 
 #endif /* VKTS_FN_MATRIX_HPP_ */
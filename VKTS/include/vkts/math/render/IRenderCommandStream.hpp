@@ -0,0 +1,67 @@
+/**
+ * VKTS - VulKan ToolS.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) since 2014 Norbert Nopper
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef VKTS_IRENDERCOMMANDSTREAM_HPP_
+#define VKTS_IRENDERCOMMANDSTREAM_HPP_
+
+#include <vkts/math/vkts_math.hpp>
+
+namespace vkts
+{
+
+/**
+ * Receives the state changes and draws of a sorted render queue. Values are the indices of the render items.
+ * The renderer records them into a command buffer, tests record them without a device.
+ */
+class IRenderCommandStream
+{
+
+public:
+
+	IRenderCommandStream()
+	{
+	}
+
+	virtual ~IRenderCommandStream()
+	{
+	}
+
+	virtual void bindPipeline(const uint32_t pipeline) = 0;
+
+	/**
+	 * Called after the pipeline changed, as the descriptor set depends on the pipeline layout.
+	 */
+	virtual void bindDescriptorSet(const uint32_t pipeline, const uint32_t descriptorSet) = 0;
+
+	virtual void bindMesh(const uint32_t mesh) = 0;
+
+	virtual void draw(const VkTsRenderItem& renderItem) = 0;
+
+};
+
+} /* namespace vkts */
+
+#endif /* VKTS_IRENDERCOMMANDSTREAM_HPP_ */
@@ -0,0 +1,96 @@
+/**
+ * VKTS - VulKan ToolS.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) since 2014 Norbert Nopper
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef VKTS_RENDERQUEUE_HPP_
+#define VKTS_RENDERQUEUE_HPP_
+
+#include <vkts/math/vkts_math.hpp>
+
+namespace vkts
+{
+
+/**
+ * Flat list of the visible draws of a frame. Sorting orders them by pipeline, material, descriptor set and mesh, and front to back inside the same state.
+ * Recording only emits a bind, if the state differs from the previous draw.
+ */
+class RenderQueue
+{
+
+private:
+
+	std::vector<VkTsRenderItem> allRenderItems;
+
+	// Sorted order of the items and the scratch buffers of the radix sort.
+	std::vector<uint32_t> allOrder;
+	std::vector<uint32_t> allTempOrder;
+	std::vector<uint64_t> allKeys;
+	std::vector<uint64_t> allTempKeys;
+
+	VkBool32 sorted;
+
+	static uint64_t getKey(const VkTsRenderItem& renderItem);
+
+public:
+
+	RenderQueue();
+	RenderQueue(const RenderQueue& other) = delete;
+	RenderQueue(RenderQueue&& other) = delete;
+	~RenderQueue();
+
+	RenderQueue& operator =(const RenderQueue& other) = delete;
+	RenderQueue& operator =(RenderQueue && other) = delete;
+
+	/**
+	 * Removes all items. Memory is kept for the next frame.
+	 */
+	void reset();
+
+	void add(const VkTsRenderItem& renderItem);
+
+	uint32_t getNumberItems() const;
+
+	/**
+	 * Items are in sorted order, after the queue has been sorted. Otherwise, in the added order.
+	 */
+	const VkTsRenderItem& getItem(const uint32_t index) const;
+
+	/**
+	 * Radix sort of the items. Keys use 10 bits of the pipeline, 12 bits of the material, 16 bits of the descriptor set,
+	 * 16 bits of the mesh and 10 bits of the depth.
+	 * Higher indices are still drawn correctly, but less state changes are saved.
+	 */
+	void sort();
+
+	/**
+	 * Records the items in sorted order. Sorts the queue, if not done before.
+	 */
+	void record(IRenderCommandStream& commandStream);
+
+};
+
+} /* namespace vkts */
+
+#endif /* VKTS_RENDERQUEUE_HPP_ */
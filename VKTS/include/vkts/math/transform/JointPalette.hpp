@@ -0,0 +1,104 @@
+/**
+ * VKTS - VulKan ToolS.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) since 2014 Norbert Nopper
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef VKTS_JOINTPALETTE_HPP_
+#define VKTS_JOINTPALETTE_HPP_
+
+#include <vkts/math/vkts_math.hpp>
+
+namespace vkts
+{
+
+/**
+ * CPU side copy of the joints uniform buffer of an armature. Layout is the parent matrix and its normal matrix,
+ * followed by all joint matrices and all joint normal matrices. Normal matrices are stored as three columns of four floats.
+ * Matrices are written during the transform update, normal matrices are calculated in one pass before uploading.
+ */
+class JointPalette
+{
+
+private:
+
+	uint32_t maxJoints;
+
+	// Highest written joint plus one.
+	uint32_t jointCount;
+
+	std::vector<float> allData;
+
+	// Joints, which need a new normal matrix.
+	std::vector<uint32_t> allDirtyJoints;
+	std::vector<uint8_t> allDirty;
+
+	VkBool32 parentDirty;
+
+	void writeNormalMatrix(const uint32_t normalOffset, const uint32_t matrixOffset);
+
+public:
+
+	JointPalette();
+	JointPalette(const JointPalette& other) = delete;
+	JointPalette(JointPalette&& other) = delete;
+	~JointPalette();
+
+	JointPalette& operator =(const JointPalette& other) = delete;
+	JointPalette& operator =(JointPalette && other) = delete;
+
+	/**
+	 * Clears the palette. All joint matrices are identity.
+	 */
+	void reset(const uint32_t maxJoints);
+
+	uint32_t getMaxJoints() const;
+
+	uint32_t getNumberJoints() const;
+
+	void setParent(const glm::mat4& transformMatrix);
+
+	/**
+	 * Returns VK_FALSE, if the joint index is out of range.
+	 */
+	VkBool32 setJoint(const uint32_t jointIndex, const glm::mat4& transformMatrix);
+
+	glm::mat4 getJoint(const uint32_t jointIndex) const;
+
+	/**
+	 * Calculates the normal matrices of the parent and of all joints written since the last update.
+	 */
+	void update();
+
+	const float* getData() const;
+
+	/**
+	 * Size in bytes, which covers the parent and all written joints.
+	 */
+	uint32_t getSize() const;
+
+};
+
+} /* namespace vkts */
+
+#endif /* VKTS_JOINTPALETTE_HPP_ */
@@ -0,0 +1,123 @@
+/**
+ * VKTS - VulKan ToolS.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) since 2014 Norbert Nopper
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef VKTS_TRANSFORMHIERARCHY_HPP_
+#define VKTS_TRANSFORMHIERARCHY_HPP_
+
+#include <vkts/math/vkts_math.hpp>
+
+namespace vkts
+{
+
+/**
+ * Flattened transform hierarchy. Transforms are stored in topological order, so a parent is always
+ * stored before its children, and the world matrices are updated in one linear pass.
+ */
+class TransformHierarchy
+{
+
+private:
+
+	std::vector<int32_t> allParentIndices;
+
+	std::vector<glm::vec3> allTranslates;
+	std::vector<VkTsRotationMode> allRotationModes;
+	std::vector<glm::vec3> allRotates;
+	std::vector<glm::vec3> allScales;
+
+	std::vector<glm::mat4> allLocalMatrices;
+	std::vector<glm::mat4> allWorldMatrices;
+	std::vector<glm::mat3> allNormalMatrices;
+
+	// Local transform was changed since the last update.
+	std::vector<uint8_t> allDirty;
+
+	// World matrix was changed by the last update.
+	std::vector<uint8_t> allUpdated;
+
+public:
+
+	TransformHierarchy();
+	TransformHierarchy(const TransformHierarchy& other) = delete;
+	TransformHierarchy(TransformHierarchy&& other) = delete;
+	~TransformHierarchy();
+
+	TransformHierarchy& operator =(const TransformHierarchy& other) = delete;
+	TransformHierarchy& operator =(TransformHierarchy && other) = delete;
+
+	void reset();
+
+	/**
+	 * Appends a transform. The parent index has to be smaller than the returned index or -1 for the root.
+	 * Returns -1, if the parent index is invalid.
+	 */
+	int32_t addTransform(const int32_t parentIndex, const glm::vec3& translate, const VkTsRotationMode rotationMode, const glm::vec3& rotate, const glm::vec3& scale);
+
+	uint32_t getSize() const;
+
+	int32_t getParentIndex(const uint32_t index) const;
+
+	const glm::vec3& getTranslate(const uint32_t index) const;
+
+	void setTranslate(const uint32_t index, const glm::vec3& translate);
+
+	VkTsRotationMode getRotationMode(const uint32_t index) const;
+
+	void setRotationMode(const uint32_t index, const VkTsRotationMode rotationMode);
+
+	const glm::vec3& getRotate(const uint32_t index) const;
+
+	void setRotate(const uint32_t index, const glm::vec3& rotate);
+
+	const glm::vec3& getScale(const uint32_t index) const;
+
+	void setScale(const uint32_t index, const glm::vec3& scale);
+
+	void setTransform(const uint32_t index, const glm::vec3& translate, const glm::vec3& rotate, const glm::vec3& scale);
+
+	const glm::mat4& getWorldMatrix(const uint32_t index) const;
+
+	/**
+	 * Transposed inverse of the upper 3x3 world matrix.
+	 */
+	const glm::mat3& getNormalMatrix(const uint32_t index) const;
+
+	/**
+	 * Returns VK_TRUE, if the world matrix was changed by the last update.
+	 */
+	VkBool32 isUpdated(const uint32_t index) const;
+
+	/**
+	 * Updates all world and normal matrices, which have a changed local transform or a changed parent.
+	 * If rootDirty is set, all transforms are updated.
+	 */
+	void update(const glm::mat4& rootMatrix, const VkBool32 rootDirty);
+
+};
+
+} /* namespace vkts */
+
+#endif /* VKTS_TRANSFORMHIERARCHY_HPP_ */
@@ -47,6 +47,50 @@
 
 #define VKTS_MATH_PI                     3.1415926535897932384626433832795f
 
+// Frusta culled in one pass, as each one is a bit of the visible mask.
+#define VKTS_MAX_CULL_FRUSTA             8
+
+/**
+ * Types.
+ */
+
+typedef enum VkTsRotationMode_
+{
+    VKTS_EULER_YXZ = 0,
+    VKTS_EULER_XYZ = 1,
+    VKTS_EULER_XZY = 2
+} VkTsRotationMode;
+
+typedef enum VkTsInterpolator_
+{
+    VKTS_INTERPOLATOR_CONSTANT = 0,
+    VKTS_INTERPOLATOR_LINEAR = 1,
+    VKTS_INTERPOLATOR_BEZIER = 2
+} VkTsInterpolator;
+
+// Bounds as structure of arrays. Missing extents or radii are treated as zero.
+typedef struct VkTsCullBounds_
+{
+    const float* centerX;
+    const float* centerY;
+    const float* centerZ;
+    const float* extentX;
+    const float* extentY;
+    const float* extentZ;
+    const float* radius;
+} VkTsCullBounds;
+
+// One draw of a render queue. Values are indices into the tables of the renderer. Depth is the distance to the viewer.
+typedef struct VkTsRenderItem_
+{
+    uint32_t pipeline;
+    uint32_t material;
+    uint32_t descriptorSet;
+    uint32_t mesh;
+    float depth;
+    uint32_t draw;
+} VkTsRenderItem;
+
 /**
  * Random.
  */
@@ -81,6 +125,7 @@
 
 #include <vkts/math/bounding_volume/Obb.hpp>
 #include <vkts/math/bounding_volume/Aabb.hpp>
+#include <vkts/math/bounding_volume/Bvh.hpp>
 
 /**
  * Culling.
@@ -88,4 +133,28 @@
 
 #include <vkts/math/culling/Frustum.hpp>
 
+/**
+ * Transform.
+ */
+
+#include <vkts/math/transform/TransformHierarchy.hpp>
+
+#include <vkts/math/transform/JointPalette.hpp>
+
+/**
+ * Curve.
+ */
+
+#include <vkts/math/curve/KeyframeCurve.hpp>
+
+#include <vkts/math/curve/AnimationClip.hpp>
+
+/**
+ * Render queue.
+ */
+
+#include <vkts/math/render/IRenderCommandStream.hpp>
+
+#include <vkts/math/render/RenderQueue.hpp>
+
 #endif /* VKTS_MATH_HPP_ */
@@ -38,11 +38,64 @@ namespace vkts
 VKTS_APICALL VkBool32 VKTS_APIENTRY barrierInit();
 
 /**
+ * Number of spin iterations, before a thread waiting at the barrier is parked.
+ * On single processor systems, the thread is parked immediately.
+ *
+ * Not thread Safe.
+ */
+VKTS_APICALL void VKTS_APIENTRY barrierSetSpinCount(const uint32_t spinCount);
+
+/**
+ * Not thread Safe.
+ */
+VKTS_APICALL uint32_t VKTS_APIENTRY barrierGetSpinCount();
+
+/**
+ * Adds a named phase and returns its index. If the phase already exists, the existing index is returned.
+ * Returns -1, if no more phases can be added.
+ *
+ * @ThreadSafe
+ */
+VKTS_APICALL int32_t VKTS_APIENTRY barrierAddPhase(const std::string& name);
+
+/**
+ * Not thread Safe.
+ */
+VKTS_APICALL const char* VKTS_APIENTRY barrierGetPhaseName(const int32_t phase);
+
+/**
+ * Same as barrierSyncPhase(VKTS_BARRIER_DEFAULT_PHASE).
  *
  * @ThreadSafe
  */
 VKTS_APICALL VkBool32 VKTS_APIENTRY barrierSync();
 
+/**
+ * All update threads have to reach the barrier of the same phase.
+ *
+ * @ThreadSafe
+ */
+VKTS_APICALL VkBool32 VKTS_APIENTRY barrierSyncPhase(const int32_t phase);
+
+/**
+ * Gathers, how long the given update thread arrived after the first one and how long it did wait.
+ *
+ * Not thread Safe.
+ */
+VKTS_APICALL VkBool32 VKTS_APIENTRY barrierGetStatistics(const int32_t phase, const int32_t threadIndex, VkTsBarrierStatistics& statistics);
+
+/**
+ * Not thread Safe.
+ */
+VKTS_APICALL void VKTS_APIENTRY barrierResetStatistics();
+
+/**
+ * Logs the statistics of all used phases, including the update thread arriving last most of the time.
+ *
+ * Not thread Safe.
+ */
+VKTS_APICALL void VKTS_APIENTRY barrierLogStatistics();
+
 /**
  *
  * @ThreadSafe
@@ -32,6 +32,10 @@
 namespace vkts
 {
 
+class ITask;
+
+typedef std::shared_ptr<ITask> ITaskSP;
+
 class ITask
 {
 
@@ -41,11 +45,32 @@ private:
 
     const uint64_t id;
 
+    uint32_t predecessorCount;
+
+    std::atomic<uint32_t> pendingPredecessorCount;
+
+    SmartPointerVector<ITaskSP> allSuccessors;
+
+    TaskCounterSP taskCounter;
+
     VkBool32 run()
     {
         return execute();
     }
 
+    /**
+     * Returns VK_TRUE, if the last predecessor of this task was executed.
+     */
+    VkBool32 predecessorExecuted()
+    {
+        return pendingPredecessorCount.fetch_sub(1) == 1;
+    }
+
+    void resetPredecessors()
+    {
+        pendingPredecessorCount.store(predecessorCount);
+    }
+
 protected:
 
     virtual VkBool32 execute() = 0;
@@ -53,7 +78,7 @@ protected:
 public:
 
     ITask(const uint64_t id) :
-    	id(id)
+    	id(id), predecessorCount(0), pendingPredecessorCount(0), allSuccessors(), taskCounter()
     {
     }
 
@@ -65,9 +90,51 @@ public:
     {
         return id;
     }
-};
 
-typedef std::shared_ptr<ITask> ITaskSP;
+    /**
+     * The successor is sent by the task executor, after this and all other predecessors of the successor are executed.
+     *
+     * Not thread Safe.
+     */
+    void addSuccessor(const ITaskSP& successor)
+    {
+        if (!successor.get() || successor.get() == this)
+        {
+            return;
+        }
+
+        allSuccessors.append(successor);
+
+        successor->predecessorCount++;
+        successor->resetPredecessors();
+    }
+
+    const SmartPointerVector<ITaskSP>& getSuccessors() const
+    {
+        return allSuccessors;
+    }
+
+    uint32_t getPredecessorCount() const
+    {
+        return predecessorCount;
+    }
+
+    /**
+     * If a task counter is set, the executed task is not added to the executed task queue,
+     * but the task counter is decremented.
+     *
+     * Not thread Safe.
+     */
+    void setTaskCounter(const TaskCounterSP& taskCounter)
+    {
+        this->taskCounter = taskCounter;
+    }
+
+    const TaskCounterSP& getTaskCounter() const
+    {
+        return taskCounter;
+    }
+};
 
 } /* namespace vkts */
 
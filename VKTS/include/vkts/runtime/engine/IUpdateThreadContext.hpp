@@ -73,8 +73,18 @@ public:
 
     virtual VkBool32 sendTask(const ITaskSP& task) const = 0;
 
+    /**
+     * Sends all tasks at once, waking up the task executors only one time.
+     */
+    virtual VkBool32 sendTasks(const SmartPointerVector<ITaskSP>& allTasks) const = 0;
+
     virtual VkBool32 receiveExecutedTask(ITaskSP& task, const VkBool32 wait = VK_TRUE) const = 0;
 
+    /**
+     * Appends the given count of executed tasks. Returns VK_FALSE, if not all tasks could be received.
+     */
+    virtual VkBool32 receiveExecutedTasks(SmartPointerVector<ITaskSP>& allTasks, const uint32_t count, const VkBool32 wait = VK_TRUE) const = 0;
+
     virtual void resetSendTasks() const = 0;
 
     virtual void resetExecutedTasks() const = 0;
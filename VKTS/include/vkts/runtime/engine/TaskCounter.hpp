@@ -0,0 +1,114 @@
+/**
+ * VKTS - VulKan ToolS.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) since 2014 Norbert Nopper
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef VKTS_TASKCOUNTER_HPP_
+#define VKTS_TASKCOUNTER_HPP_
+
+#include <vkts/runtime/vkts_runtime.hpp>
+
+namespace vkts
+{
+
+/**
+ * Counts the not yet executed tasks of a task graph.
+ * Executors decrement the counter, update threads wait on it.
+ */
+class TaskCounter
+{
+
+private:
+
+    std::atomic<int32_t> count;
+
+    std::atomic<VkBool32> failed;
+
+    std::mutex mutex;
+
+    std::condition_variable conditionVariable;
+
+public:
+
+    TaskCounter();
+    TaskCounter(const int32_t count);
+    TaskCounter(const TaskCounter& other) = delete;
+    TaskCounter(TaskCounter&& other) = delete;
+    ~TaskCounter();
+
+    TaskCounter& operator =(const TaskCounter& other) = delete;
+    TaskCounter& operator =(TaskCounter && other) = delete;
+
+    /**
+     *
+     * @ThreadSafe
+     */
+    void add(const int32_t count);
+
+    /**
+     * Wakes up all waiting threads, as soon as the counter reaches zero.
+     *
+     * @ThreadSafe
+     */
+    void decrement();
+
+    /**
+     * Marks, that at least one task of the graph did not execute successfully.
+     *
+     * @ThreadSafe
+     */
+    void setFailed();
+
+    /**
+     *
+     * @ThreadSafe
+     */
+    int32_t getCount() const;
+
+    /**
+     *
+     * @ThreadSafe
+     */
+    VkBool32 isDone() const;
+
+    /**
+     *
+     * @ThreadSafe
+     */
+    VkBool32 hasFailed() const;
+
+    /**
+     * Blocks, until the counter reaches zero.
+     *
+     * @ThreadSafe
+     */
+    void wait();
+
+};
+
+typedef std::shared_ptr<TaskCounter> TaskCounterSP;
+
+} /* namespace vkts */
+
+#endif /* VKTS_TASKCOUNTER_HPP_ */
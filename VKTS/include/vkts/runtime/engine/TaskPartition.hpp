@@ -0,0 +1,108 @@
+/**
+ * VKTS - VulKan ToolS.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) since 2014 Norbert Nopper
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef VKTS_TASKPARTITION_HPP_
+#define VKTS_TASKPARTITION_HPP_
+
+#include <vkts/runtime/vkts_runtime.hpp>
+
+namespace vkts
+{
+
+/**
+ * Splits [0, count) into contiguous chunks of about the same cost and processes them on the task executors.
+ * The most expensive chunks are processed first. Afterwards, the measured time of each chunk corrects the cost of its items,
+ * so the next partition follows the real cost, even if the estimated one was wrong.
+ */
+class TaskPartition
+{
+
+private:
+
+    std::vector<float> allCosts;
+
+    std::vector<uint32_t> allChunkFirsts;
+
+    std::vector<uint32_t> allChunkOrder;
+
+    std::vector<double> allChunkCosts;
+
+    std::vector<double> allChunkTimes;
+
+    VkBool32 feedback();
+
+public:
+
+    TaskPartition();
+    TaskPartition(const TaskPartition& other) = delete;
+    TaskPartition(TaskPartition&& other) = delete;
+    ~TaskPartition();
+
+    TaskPartition& operator =(const TaskPartition& other) = delete;
+    TaskPartition& operator =(TaskPartition && other) = delete;
+
+    /**
+     * Resizes to the given count of items. Added items have a cost of one.
+     */
+    void setCount(const uint32_t count);
+
+    uint32_t getCount() const;
+
+    /**
+     * Sets the estimated cost of one item, e.g. the number of nodes. Previous corrections of this item are lost.
+     */
+    void setCost(const uint32_t index, const float cost);
+
+    float getCost(const uint32_t index) const;
+
+    /**
+     * Splits the items into at most chunkCount contiguous chunks of about the same cost.
+     */
+    VkBool32 partition(const uint32_t chunkCount);
+
+    uint32_t getNumberChunks() const;
+
+    /**
+     * Chunks are ordered by descending cost, so index zero is the most expensive chunk.
+     */
+    VkBool32 getChunk(const uint32_t index, uint32_t& first, uint32_t& last) const;
+
+    /**
+     * Measured time in seconds of the chunk during the last process.
+     */
+    double getChunkTime(const uint32_t index) const;
+
+    /**
+     * Partitions the items, processes the chunks on the task executors and corrects the costs by the measured times.
+     * The calling thread processes the most expensive chunk. Without task executors, all chunks are processed by the calling thread.
+     */
+    VkBool32 process(const IUpdateThreadContext& updateContext, const uint32_t chunkCount, const TaskRangeFunction& rangeFunction);
+
+};
+
+} /* namespace vkts */
+
+#endif /* VKTS_TASKPARTITION_HPP_ */
@@ -0,0 +1,78 @@
+/**
+ * VKTS - VulKan ToolS.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) since 2014 Norbert Nopper
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef VKTS_FN_TASK_HPP_
+#define VKTS_FN_TASK_HPP_
+
+#include <vkts/runtime/vkts_runtime.hpp>
+
+namespace vkts
+{
+
+/**
+ * Processes the range [first, last). Returning VK_FALSE stops all task executors.
+ */
+typedef std::function<VkBool32(const uint32_t first, const uint32_t last)> TaskRangeFunction;
+
+/**
+ * Sends a task graph. All tasks of the graph have to be in the vector.
+ * Only tasks without a predecessor are sent, the rest is sent by the task executors.
+ * Executed tasks are not added to the executed task queue, but the returned counter is decremented.
+ * Returns an empty counter, if no task executor is available.
+ *
+ * @ThreadSafe
+ */
+VKTS_APICALL TaskCounterSP VKTS_APIENTRY taskFork(const IUpdateThreadContext& updateContext, const SmartPointerVector<ITaskSP>& allTasks);
+
+/**
+ * Blocks, until all tasks of the forked graph are executed.
+ * Returns VK_FALSE, if at least one of the tasks failed.
+ *
+ * @ThreadSafe
+ */
+VKTS_APICALL VkBool32 VKTS_APIENTRY taskJoin(const TaskCounterSP& taskCounter);
+
+/**
+ * Splits [0, count) into ranges of grainSize elements and processes them on the task executors.
+ * The calling thread processes one range by itself and returns, after all ranges are processed.
+ * Without task executors, everything is processed by the calling thread.
+ * Returns VK_FALSE, if at least one of the ranges failed.
+ *
+ * @ThreadSafe
+ */
+VKTS_APICALL VkBool32 VKTS_APIENTRY taskParallelFor(const IUpdateThreadContext& updateContext, const uint32_t count, const uint32_t grainSize, const TaskRangeFunction& rangeFunction);
+
+/**
+ * Same as above, but sends the ranges to the task executors of the running engine, so no update thread context is needed.
+ * Called from a task executor, while the engine is not running or without task executors, everything is processed by the calling thread.
+ *
+ * @ThreadSafe
+ */
+VKTS_APICALL VkBool32 VKTS_APIENTRY taskParallelFor(const uint32_t count, const uint32_t grainSize, const TaskRangeFunction& rangeFunction);
+
+}
+
+#endif /* VKTS_FN_TASK_HPP_ */
@@ -52,6 +52,25 @@
 #define VKTS_TICKS_PER_SECOND_MIN 1.0
 #define VKTS_TICKS_PER_SECOND_MAX 480.0
 
+#define VKTS_BARRIER_DEFAULT_PHASE 0
+#define VKTS_MAX_BARRIER_PHASES 8
+
+#define VKTS_BARRIER_SPIN_COUNT 256
+
+/**
+ * Types.
+ */
+
+typedef struct VkTsBarrierStatistics_
+{
+    uint64_t syncCount;
+    double totalLateTime;
+    double maxLateTime;
+    double totalWaitTime;
+    double maxWaitTime;
+    uint64_t lastCount;
+} VkTsBarrierStatistics;
+
 /**
  * Barrier.
  */
@@ -62,10 +81,15 @@
  * Engine.
  */
 
+#include <vkts/runtime/engine/TaskCounter.hpp>
+
 #include <vkts/runtime/engine/ITask.hpp>
 #include <vkts/runtime/engine/IUpdateThreadContext.hpp>
 #include <vkts/runtime/engine/IUpdateThread.hpp>
 
 #include <vkts/runtime/engine/fn_engine.hpp>
+#include <vkts/runtime/engine/fn_task.hpp>
+
+#include <vkts/runtime/engine/TaskPartition.hpp>
 
 #endif /* VKTS_RUNTIME_HPP_ */
@@ -38,12 +38,34 @@ namespace vkts
  */
 VKTS_APICALL float VKTS_APIENTRY interpolate(const float key, const IChannelSP& channel);
 
+/**
+ * Cursor is the segment found by the previous call of this playback. Start with zero.
+ *
+ * @ThreadSafe
+ */
+VKTS_APICALL float VKTS_APIENTRY interpolate(const float key, const IChannelSP& channel, uint32_t& cursor);
+
+/**
+ * Samples all channels of the animation into the pose. Pose and cursors are resized to the number of channels, if needed.
+ *
+ * @ThreadSafe
+ */
+VKTS_APICALL VkBool32 VKTS_APIENTRY interpolateChannels(std::vector<float>& pose, std::vector<uint32_t>& cursors, const float key, const IAnimationSP& animation);
+
 /**
  *
  * @ThreadSafe
  */
 VKTS_APICALL VkBool32 VKTS_APIENTRY interpolateConvert(IChannelSP& converted, const IChannelSP& channel, const float sampleTime);
 
+/**
+ * Samples the current animation of each node at the given rate and bakes it into one track of the clip, in the order of the nodes.
+ * Afterwards, the clip is set to these animations. Nodes without a current animation are baked with their constant transform.
+ *
+ * @ThreadSafe
+ */
+VKTS_APICALL VkBool32 VKTS_APIENTRY interpolateBake(const AnimationClipSP& clip, const SmartPointerVector<INodeSP>& allNodes, const float sampleRate, const float maxError);
+
 }
 
 #endif /* VKTS_FN_INTERPOLATOR_HPP_ */
@@ -38,6 +38,15 @@ namespace vkts
  */
 VKTS_APICALL ISceneSP VKTS_APIENTRY sceneLoad(const char* filename, const ISceneManagerSP& sceneManager, const ISceneFactorySP& sceneFactory, const VkBool32 freeHostMemory = VK_FALSE);
 
+/**
+ * Converts all sub mesh and channel libraries, used by the given scene, into binary libraries.
+ * The binary libraries are saved next to the text libraries with the extension '.vktb' and are preferred by sceneLoad.
+ * Has to be called again, if a text library changes.
+ *
+ * @ThreadSafe
+ */
+VKTS_APICALL VkBool32 VKTS_APIENTRY sceneConvertLibraries(const char* filename);
+
 }
 
 #endif /* VKTS_FN_SCENE_LOAD_HPP_ */
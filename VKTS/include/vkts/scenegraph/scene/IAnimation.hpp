@@ -94,6 +94,15 @@ public:
 
     virtual const SmartPointerVector<IChannelSP>& getChannels() const = 0;
 
+    /**
+     * If a baked clip is set, the track of the clip is sampled instead of the channels.
+     */
+    virtual void setClip(const AnimationClipSP& clip, const uint32_t track) = 0;
+
+    virtual const AnimationClipSP& getClip() const = 0;
+
+    virtual uint32_t getClipTrack() const = 0;
+
 };
 
 typedef std::shared_ptr<IAnimation> IAnimationSP;
@@ -72,6 +72,8 @@ public:
 
     virtual const std::vector<VkTsInterpolator>& getInterpolators() const = 0;
 
+    virtual const KeyframeCurve& getCurve() const = 0;
+
 };
 
 typedef std::shared_ptr<IChannel> IChannelSP;
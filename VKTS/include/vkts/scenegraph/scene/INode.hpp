@@ -50,6 +50,14 @@ public:
 
     virtual void setName(const std::string& name) = 0;
 
+    /**
+     * Dense index of the node in its scene, assigned when the object is added. -1, if not assigned.
+     * Render data of a node, e.g. the descriptor sets of its materials, is stored at this index.
+     */
+    virtual int32_t getNodeIndex() const = 0;
+
+    virtual void setNodeIndex(const int32_t nodeIndex) = 0;
+
 
     virtual IRenderNodeSP getRenderNode(const uint32_t index) const = 0;
 
@@ -194,6 +202,8 @@ public:
 
     virtual Sphere getBoundingSphere() const = 0;
 
+    virtual const Aabb& getBoundingBox() const = 0;
+
     virtual uint32_t getLayers() const = 0;
 
     virtual void setLayers(const uint32_t layers) = 0;
@@ -214,7 +224,7 @@ public:
 
     virtual void updateDescriptorSetsRecursive(const uint32_t allWriteDescriptorSetsCount, VkWriteDescriptorSet* allWriteDescriptorSets, const uint32_t currentBuffer) = 0;
 
-    virtual void updateTransformRecursive(const double deltaTime, const uint64_t deltaTicks, const double tickTime, const uint32_t currentBuffer, const glm::mat4& parentTransformMatrix, const VkBool32 parentTransformMatrixDirty, const glm::mat4& parentBindMatrix, const VkBool32 parentBindMatrixDirty, const std::shared_ptr<INode>& armatureNode) = 0;
+    virtual void updateTransformRecursive(const double deltaTime, const uint64_t deltaTicks, const double tickTime, const uint32_t currentBuffer, const glm::mat4& parentTransformMatrix, const VkBool32 parentTransformMatrixDirty, const glm::mat4& parentBindMatrix, const VkBool32 parentBindMatrixDirty, const std::shared_ptr<INode>& armatureNode, SmartPointerVector<std::shared_ptr<INode>>& allChangedNodes) = 0;
 
     virtual void drawRecursive(const ICommandBuffersSP& cmdBuffer, const SmartPointerVector<IGraphicsPipelineSP>& allGraphicsPipelines, const uint32_t currentBuffer, const std::map<uint32_t, VkTsDynamicOffset>& dynamicOffsetMappings, const OverwriteDraw* renderOverwrite = nullptr) = 0;
 
@@ -60,6 +60,19 @@ public:
 
     virtual void setDirty() = 0;
 
+    /**
+     * Updates the node tree with a flattened transform hierarchy in one linear pass.
+     * Fails and keeps the recursive update, if the node tree contains an armature or joints.
+     */
+    virtual VkBool32 setFlattened(const VkBool32 flattened) = 0;
+
+    virtual VkBool32 isFlattened() const = 0;
+
+    /**
+     * Nodes with meshes, which transform was changed and uploaded by the last transform update.
+     */
+    virtual const SmartPointerVector<INodeSP>& getChangedNodes() const = 0;
+
     virtual void updateParameterRecursive(const Parameter* parameter) = 0;
 
     virtual void updateDescriptorSetsRecursive(const uint32_t allWriteDescriptorSetsCount, VkWriteDescriptorSet* allWriteDescriptorSets, const uint32_t currentBuffer) = 0;
@@ -47,7 +47,7 @@ public:
 
     virtual std::shared_ptr<IRenderSubMesh> create(const VkBool32 createData = VK_TRUE) const = 0;
 
-    virtual void draw(const ICommandBuffersSP& cmdBuffer, const SmartPointerVector<IGraphicsPipelineSP>& allGraphicsPipelines, const uint32_t currentBuffer, const std::map<uint32_t, VkTsDynamicOffset>& dynamicOffsetMappings, const OverwriteDraw* renderOverwrite, const ISubMesh& subMesh, const std::string& nodeName) = 0;
+    virtual void draw(const ICommandBuffersSP& cmdBuffer, const SmartPointerVector<IGraphicsPipelineSP>& allGraphicsPipelines, const uint32_t currentBuffer, const std::map<uint32_t, VkTsDynamicOffset>& dynamicOffsetMappings, const OverwriteDraw* renderOverwrite, const ISubMesh& subMesh, const int32_t nodeIndex) = 0;
 
 };
 
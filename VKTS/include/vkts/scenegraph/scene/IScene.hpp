@@ -111,6 +111,17 @@ public:
 
     virtual float getMaxLuminance() const = 0;
 
+    /**
+     * Rebuilds the bounding volume hierarchy over the objects, if they were added or removed. Otherwise, only changed bounds are refitted.
+     * Has to be called after the transforms are updated.
+     */
+    virtual void updateBoundingVolumeHierarchy() = 0;
+
+    /**
+     * Item indices are the object indices.
+     */
+    virtual const Bvh& getBoundingVolumeHierarchy() const = 0;
+
     //
 
     virtual void updateParameterRecursive(const Parameter* parameter, const uint32_t objectOffset = 0, const uint32_t objectStep = 1, const uint32_t objectLimit = UINT32_MAX) = 0;
@@ -119,6 +130,13 @@ public:
 
     virtual void updateTransformRecursive(const double deltaTime, const uint64_t deltaTicks, const double tickTime, const uint32_t currentBuffer = 0, const uint32_t objectOffset = 0, const uint32_t objectStep = 1, const uint32_t objectLimit = UINT32_MAX) = 0;
 
+    /**
+     * Updates the transforms of all objects on the task executors of the given update thread.
+     * Objects are split into chunks of about the same cost, estimated by the nodes, animation channels and sub meshes.
+     * The measured time of each chunk corrects the estimate for the next call.
+     */
+    virtual VkBool32 updateParallel(const IUpdateThreadContext& updateContext, const double deltaTime, const uint64_t deltaTicks, const double tickTime, const uint32_t currentBuffer = 0) = 0;
+
     virtual void drawRecursive(const ICommandBuffersSP& cmdBuffer, const SmartPointerVector<IGraphicsPipelineSP>& allGraphicsPipelines, const uint32_t currentBuffer, const std::map<uint32_t, VkTsDynamicOffset>& dynamicOffsetMappings, const OverwriteDraw* renderOverwrite = nullptr, const uint32_t objectOffset = 0, const uint32_t objectStep = 1, const uint32_t objectLimit = UINT32_MAX) = 0;
 
 };
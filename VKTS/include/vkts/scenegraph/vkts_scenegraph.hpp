@@ -33,11 +33,12 @@
 
 /**
  *
- * Depends on VKTS entity and Vulkan object.
+ * Depends on VKTS entity, runtime and Vulkan object.
  *
  */
 
 #include <vkts/vulkan/composition/vkts_composition.hpp>
+#include <vkts/runtime/vkts_runtime.hpp>
 
 #include <vkts/scenegraph/fn_bindings.hpp>
 #include <vkts/entity/vkts_entity.hpp>
@@ -50,6 +51,9 @@
 #define VKTS_CONVERT_BEZIER VK_TRUE
 #define VKTS_CONVERT_SAMPLING (1.0f/60.0f)
 
+// Dirty flags of a node are stored as one bit per buffer.
+#define VKTS_MAX_DIRTY_BUFFERS 32
+
 /**
  * Types.
  */
@@ -70,20 +74,6 @@ typedef enum VkTsTargetTransformElement_
 	VKTS_TARGET_TRANSFORM_ELEMENT_W = 3
 } VkTsTargetTransformElement;
 
-typedef enum VkTsRotationMode_
-{
-    VKTS_EULER_YXZ = 0,
-    VKTS_EULER_XYZ = 1,
-    VKTS_EULER_XZY = 2
-} VkTsRotationMode;
-
-typedef enum VkTsInterpolator_
-{
-    VKTS_INTERPOLATOR_CONSTANT = 0,
-    VKTS_INTERPOLATOR_LINEAR = 1,
-    VKTS_INTERPOLATOR_BEZIER = 2
-} VkTsInterpolator;
-
 /**
  * Parameter set.
  */
@@ -57,6 +57,23 @@ public:
 
     virtual const IDeviceMemorySP& getDeviceMemory() const = 0;
 
+    /**
+     * Starts a frame of the given buffer. Its sub-ranges can be allocated again and
+     * writes to non coherent memory are collected until they are flushed at once.
+     */
+    virtual void reset(const uint32_t currentBuffer) const = 0;
+
+    /**
+     * Returns an aligned sub-range of the current buffer, which can be uploaded to until the buffer is reset.
+     */
+    virtual VkBool32 allocate(uint32_t& offset, const uint32_t size, const uint32_t alignment) const = 0;
+
+    /**
+     * Stops collecting and adds the collected writes to the context object.
+     * They are flushed with the writes of all other buffer objects by IContextObject::flushMappedMemoryRanges.
+     */
+    virtual VkBool32 flush() const = 0;
+
     virtual VkBool32 upload(const uint32_t offset, const VkMemoryMapFlags flags, const void* data, const uint32_t size) const = 0;
 
     virtual VkBool32 upload(const uint32_t offset, const VkMemoryMapFlags flags, const glm::mat4& mat) const = 0;
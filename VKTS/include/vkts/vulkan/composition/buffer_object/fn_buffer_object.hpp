@@ -38,6 +38,14 @@ namespace vkts
  */
 VKTS_APICALL IBufferObjectSP VKTS_APIENTRY bufferObjectCreate(IBufferSP& stageBuffer, IDeviceMemorySP& stageDeviceMemory, const IContextObjectSP& contextObject, const ICommandBuffersSP& cmdBuffer, const IBinaryBufferSP& binaryBuffer, const VkBufferCreateInfo& bufferCreateInfo, const VkMemoryPropertyFlags memoryPropertyFlag);
 
+/**
+ * Creates a device local buffer and queues the binary buffer to the upload manager.
+ * The buffer can only be used after the upload has been submitted.
+ *
+ * @ThreadSafe
+ */
+VKTS_APICALL IBufferObjectSP VKTS_APIENTRY bufferObjectCreate(const IUploadManagerSP& uploadManager, const IContextObjectSP& contextObject, const IBinaryBufferSP& binaryBuffer, const VkBufferCreateInfo& bufferCreateInfo, const VkAccessFlags dstAccessMask, const VkMemoryPropertyFlags memoryPropertyFlag);
+
 /**
  *
  * @ThreadSafe
@@ -48,6 +48,11 @@ public:
 
     virtual const ICommandBuffersSP& getCommandBuffer() const = 0;
 
+    /**
+     * If set, assets are uploaded by the upload manager instead of the command buffer and no stage objects are added.
+     */
+    virtual const IUploadManagerSP& getUploadManager() const = 0;
+
     //
 
     virtual void addStageImage(const IImageSP& stageImage) = 0;
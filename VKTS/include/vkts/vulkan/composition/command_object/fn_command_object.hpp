@@ -36,7 +36,7 @@ namespace vkts
  *
  * @ThreadSafe
  */
-VKTS_APICALL ICommandObjectSP VKTS_APIENTRY commandObjectCreate(const ICommandBuffersSP& cmdBuffer);
+VKTS_APICALL ICommandObjectSP VKTS_APIENTRY commandObjectCreate(const ICommandBuffersSP& cmdBuffer, const IUploadManagerSP& uploadManager = IUploadManagerSP());
 
 
 }
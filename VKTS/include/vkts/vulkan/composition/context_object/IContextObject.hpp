@@ -56,6 +56,26 @@ public:
 
     virtual const IQueueSP& getQueue() const = 0;
 
+    /**
+     * Queue used for uploads. Is the queue of the context, if no transfer queue was given.
+     */
+    virtual const IQueueSP& getTransferQueue() const = 0;
+
+    /**
+     * Collects ranges of mapped, non coherent memory written during the frame.
+     * The memory is kept alive until the ranges are flushed. Ranges of memory destroyed explicitly before are dropped.
+     *
+     * @ThreadSafe
+     */
+    virtual VkBool32 addFlushRanges(const IDeviceMemorySP& deviceMemory, const uint32_t rangeCount, const VkTsMemoryRange* ranges) = 0;
+
+    /**
+     * Flushes all collected ranges with one call. Has to be called at the end of the frame, before the uploaded data is used.
+     *
+     * @ThreadSafe
+     */
+    virtual VkBool32 flushMappedMemoryRanges() = 0;
+
     virtual void destroyDevice() = 0;
 
 };
@@ -38,6 +38,14 @@ namespace vkts
  */
 VKTS_APICALL IImageObjectSP VKTS_APIENTRY imageObjectCreate(IImageSP& stageImage, IBufferSP& stageBuffer, IDeviceMemorySP& stageDeviceMemory, const IContextObjectSP& contextObject, const ICommandBuffersSP& cmdBuffer, const std::string& name, const IImageDataSP& imageData, const VkImageCreateInfo& imageCreateInfo, const VkAccessFlags srcAccessMask, const VkAccessFlags dstAccessMask, const VkImageLayout newLayout, const VkImageSubresourceRange& subresourceRange, const VkMemoryPropertyFlags memoryPropertyFlags);
 
+/**
+ * Creates a device local image and queues the image data to the upload manager.
+ * The image can only be used after the upload has been submitted.
+ *
+ * @ThreadSafe
+ */
+VKTS_APICALL IImageObjectSP VKTS_APIENTRY imageObjectCreate(const IUploadManagerSP& uploadManager, const IContextObjectSP& contextObject, const std::string& name, const IImageDataSP& imageData, const VkImageCreateInfo& imageCreateInfo, const VkAccessFlags dstAccessMask, const VkImageLayout newLayout, const VkImageSubresourceRange& subresourceRange, const VkMemoryPropertyFlags memoryPropertyFlags);
+
 /**
  *
  * @ThreadSafe
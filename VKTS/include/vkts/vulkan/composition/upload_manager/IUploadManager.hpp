@@ -0,0 +1,136 @@
+/**
+ * VKTS - VulKan ToolS.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) since 2014 Norbert Nopper
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef VKTS_IUPLOADMANAGER_HPP_
+#define VKTS_IUPLOADMANAGER_HPP_
+
+#include <vkts/vulkan/composition/vkts_composition.hpp>
+
+namespace vkts
+{
+
+/**
+ * Called once the upload has been executed by the device or has failed.
+ */
+typedef std::function<void(const uint64_t ticket, const VkBool32 success)> UploadCallbackFunction;
+
+/**
+ * Records buffer and image uploads from a reusable staging ring and submits them in batches.
+ * Each upload returns a ticket, which can be polled, waited for or given a callback.
+ *
+ * With a transfer queue of another queue family, the ownership of the resources is released on the
+ * transfer queue and acquired on the queue of the context object.
+ *
+ * All functions are thread safe.
+ */
+class IUploadManager: public IDestroyable
+{
+
+public:
+
+    IUploadManager() :
+        IDestroyable()
+    {
+    }
+
+    virtual ~IUploadManager()
+    {
+    }
+
+    virtual const IContextObjectSP& getContextObject() const = 0;
+
+    virtual const IQueueSP& getTransferQueue() const = 0;
+
+    /**
+     * Size of the staging ring in bytes. Uploads larger than one batch segment use their own staging buffer.
+     */
+    virtual VkDeviceSize getStageSize() const = 0;
+
+    virtual uint32_t getBatchCount() const = 0;
+
+    //
+
+    /**
+     * Copies the data into the staging ring and records the copy to the buffer.
+     * After the upload, the buffer is accessed with the given access mask. Returns zero on failure.
+     */
+    virtual uint64_t uploadBuffer(const IBufferSP& buffer, const VkDeviceSize offset, const void* data, const VkDeviceSize size, const VkAccessFlags dstAccessMask, const UploadCallbackFunction& callback = nullptr) = 0;
+
+    /**
+     * Copies all mip levels and array layers of the image data into the staging ring and records the copies to the image.
+     * After the upload, the image is in the given layout. Returns zero on failure.
+     */
+    virtual uint64_t uploadImage(const IImageSP& image, const IImageDataSP& imageData, const VkAccessFlags dstAccessMask, const VkImageLayout newLayout, const VkImageSubresourceRange& subresourceRange, const UploadCallbackFunction& callback = nullptr) = 0;
+
+    /**
+     * Submits the recorded uploads. Work submitted afterwards to the queue of the context object sees the uploaded data.
+     */
+    virtual VkBool32 submit() = 0;
+
+    /**
+     * Retires finished batches, so their staging memory is reused, and calls the callbacks. Does not block.
+     */
+    virtual VkBool32 update() = 0;
+
+    //
+
+    /**
+     * Returns VK_TRUE, if the upload has been executed by the device. Failed uploads are never complete.
+     */
+    virtual VkBool32 isComplete(const uint64_t ticket) = 0;
+
+    /**
+     * Returns VK_TRUE, if the upload could not be submitted or executed. A ticket of zero is always failed.
+     */
+    virtual VkBool32 isFailed(const uint64_t ticket) = 0;
+
+    /**
+     * Submits, if the ticket is still recorded, and blocks until it is complete. Returns VK_FALSE, if the upload failed.
+     */
+    virtual VkBool32 wait(const uint64_t ticket) = 0;
+
+    virtual VkBool32 waitIdle() = 0;
+
+    //
+
+    virtual uint64_t getUploadCount() const = 0;
+
+    virtual uint64_t getUploadBytes() const = 0;
+
+    virtual uint64_t getSubmitCount() const = 0;
+
+    /**
+     * Uploads, which did not fit into one batch segment and had their own staging buffer.
+     */
+    virtual uint64_t getDedicatedStageCount() const = 0;
+
+};
+
+typedef std::shared_ptr<IUploadManager> IUploadManagerSP;
+
+} /* namespace vkts */
+
+#endif /* VKTS_IUPLOADMANAGER_HPP_ */
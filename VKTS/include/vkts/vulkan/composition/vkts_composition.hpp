@@ -37,12 +37,22 @@
 
 #include <vkts/image/vkts_image.hpp>
 
-#include <vkts/vulkan/composition/command_object/ICommandObject.hpp>
-#include <vkts/vulkan/composition/command_object/fn_command_object.hpp>
+/**
+ * Defines.
+ */
+
+#define VKTS_UPLOAD_STAGE_SIZE      (64 * 1024 * 1024)
+#define VKTS_UPLOAD_BATCH_COUNT     4
 
 #include <vkts/vulkan/composition/context_object/IContextObject.hpp>
 #include <vkts/vulkan/composition/context_object/fn_context_object.hpp>
 
+#include <vkts/vulkan/composition/upload_manager/IUploadManager.hpp>
+#include <vkts/vulkan/composition/upload_manager/fn_upload_manager.hpp>
+
+#include <vkts/vulkan/composition/command_object/ICommandObject.hpp>
+#include <vkts/vulkan/composition/command_object/fn_command_object.hpp>
+
 #include <vkts/vulkan/composition/buffer_object/IBufferObject.hpp>
 #include <vkts/vulkan/composition/buffer_object/fn_buffer_object.hpp>
 
@@ -39,15 +39,20 @@ private:
 
 	const Frustum* viewFrustum;
 
+	const IScene* culledScene;
+
+	// Sorted, so objects can be looked up while drawing in parallel.
+	std::vector<const IObject*> allVisibleObjects;
+
 public:
 
 	Cull() :
-		OverwriteDraw(), viewFrustum(nullptr)
+		OverwriteDraw(), viewFrustum(nullptr), culledScene(nullptr), allVisibleObjects()
     {
     }
 
 	Cull(const Frustum* viewFrustum) :
-		OverwriteDraw(), viewFrustum(viewFrustum)
+		OverwriteDraw(), viewFrustum(viewFrustum), culledScene(nullptr), allVisibleObjects()
     {
     }
 
@@ -65,12 +70,90 @@ public:
 	void setViewFrustum(const Frustum* viewFrustum)
 	{
 		this->viewFrustum = viewFrustum;
+
+		culledScene = nullptr;
+	}
+
+	/**
+	 * Culls all objects of the scene at once using its bounding volume hierarchy. Without an up to date hierarchy, the bounding spheres are culled in one batch.
+	 * Has to be called before drawing. Otherwise, each object is tested.
+	 */
+	void cullScene(const IScene& scene)
+	{
+		culledScene = nullptr;
+
+		allVisibleObjects.clear();
+
+		if (!viewFrustum)
+		{
+			return;
+		}
+
+		const auto& allObjects = scene.getObjects();
+
+		const Bvh& bvh = scene.getBoundingVolumeHierarchy();
+
+		if (bvh.getSize() == scene.getNumberObjects())
+		{
+			std::vector<uint32_t> allVisibleItems;
+
+			bvh.cull(*viewFrustum, allVisibleItems);
+
+			for (uint32_t i = 0; i < allVisibleItems.size(); i++)
+			{
+				allVisibleObjects.push_back(allObjects[allVisibleItems[i]].get());
+			}
+		}
+		else
+		{
+			std::vector<Sphere> allSpheres(allObjects.size());
+
+			for (uint32_t i = 0; i < allObjects.size(); i++)
+			{
+				if (allObjects[i]->getRootNode().get())
+				{
+					allSpheres[i] = allObjects[i]->getRootNode()->getBoundingSphere();
+				}
+			}
+
+			std::vector<uint8_t> allVisibleMasks(allObjects.size());
+
+			viewFrustum->cull(allSpheres.data(), nullptr, allObjects.size(), allVisibleMasks.data());
+
+			for (uint32_t i = 0; i < allObjects.size(); i++)
+			{
+				if (allVisibleMasks[i])
+				{
+					allVisibleObjects.push_back(allObjects[i].get());
+				}
+			}
+		}
+
+		std::sort(allVisibleObjects.begin(), allVisibleObjects.end());
+
+		culledScene = &scene;
 	}
 
     //
 
+    virtual VkBool32 visit(const IScene& scene, const ICommandBuffersSP& cmdBuffer, const SmartPointerVector<IGraphicsPipelineSP>& allGraphicsPipelines, const uint32_t currentBuffer, const std::map<uint32_t, VkTsDynamicOffset>& dynamicOffsetMappings, const uint32_t objectOffset, const uint32_t objectStep, const uint32_t objectLimit) const
+    {
+    	if (culledScene == &scene && allVisibleObjects.size() == 0)
+    	{
+    		// Nothing visible.
+    		return VK_FALSE;
+    	}
+
+    	return VK_TRUE;
+    }
+
     virtual VkBool32 visit(const IObject& object, const ICommandBuffersSP& cmdBuffer, const SmartPointerVector<IGraphicsPipelineSP>& allGraphicsPipelines, const uint32_t currentBuffer, const std::map<uint32_t, VkTsDynamicOffset>& dynamicOffsetMappings) const
     {
+    	if (culledScene)
+    	{
+    		return std::binary_search(allVisibleObjects.begin(), allVisibleObjects.end(), &object);
+    	}
+
     	if (viewFrustum)
     	{
     		if (viewFrustum->isVisible(object.getRootNode()->getBoundingSphere()))
@@ -0,0 +1,325 @@
+/**
+ * VKTS - VulKan ToolS.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) since 2014 Norbert Nopper
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef VKTS_SORT_HPP_
+#define VKTS_SORT_HPP_
+
+#include <vkts/scenegraph/vkts_scenegraph.hpp>
+
+namespace vkts
+{
+
+/**
+ * Collects the visible sub meshes instead of drawing them, so they can be sorted and recorded with less state changes.
+ * Has to be the last overwrite, so culling and blending are applied before. Overwrites, which record commands
+ * during the traversal, e.g. Displace, can not be combined with it. Collecting is not thread safe, so each thread needs its own sort.
+ */
+class Sort : public OverwriteDraw
+{
+
+private:
+
+	class VulkanCommandStream : public IRenderCommandStream
+	{
+
+	private:
+
+		const Sort& sort;
+
+		const ICommandBuffersSP& cmdBuffer;
+
+		const uint32_t currentBuffer;
+
+		const std::map<uint32_t, VkTsDynamicOffset>& dynamicOffsetMappings;
+
+	public:
+
+		VulkanCommandStream(const Sort& sort, const ICommandBuffersSP& cmdBuffer, const uint32_t currentBuffer, const std::map<uint32_t, VkTsDynamicOffset>& dynamicOffsetMappings) :
+			IRenderCommandStream(), sort(sort), cmdBuffer(cmdBuffer), currentBuffer(currentBuffer), dynamicOffsetMappings(dynamicOffsetMappings)
+		{
+		}
+
+		virtual ~VulkanCommandStream()
+		{
+		}
+
+		virtual void bindPipeline(const uint32_t pipeline) override
+		{
+			vkCmdBindPipeline(cmdBuffer->getCommandBuffer(), VK_PIPELINE_BIND_POINT_GRAPHICS, sort.allPipelines[pipeline]->getPipeline());
+		}
+
+		virtual void bindDescriptorSet(const uint32_t pipeline, const uint32_t descriptorSet) override
+		{
+			const INode* node = sort.allDescriptorSets[descriptorSet].first;
+			const ISubMesh* subMesh = sort.allDescriptorSets[descriptorSet].second;
+
+			if (subMesh->getBSDFMaterial().get())
+			{
+				subMesh->getBSDFMaterial()->drawRecursive(cmdBuffer, sort.allPipelines[pipeline], currentBuffer, dynamicOffsetMappings, nullptr, node->getNodeIndex());
+			}
+			else if (subMesh->getPhongMaterial().get())
+			{
+				subMesh->getPhongMaterial()->drawRecursive(cmdBuffer, sort.allPipelines[pipeline], currentBuffer, dynamicOffsetMappings, nullptr, node->getNodeIndex());
+			}
+		}
+
+		virtual void bindMesh(const uint32_t mesh) override
+		{
+			const ISubMesh* subMesh = sort.allMeshes[mesh];
+
+			vkCmdBindIndexBuffer(cmdBuffer->getCommandBuffer(0), subMesh->getIndexBuffer()->getBuffer()->getBuffer(), 0, VK_INDEX_TYPE_UINT32);
+
+			VkDeviceSize offsets[1] = {0};
+
+			VkBuffer buffers[1] = {subMesh->getVertexBuffer()->getBuffer()->getBuffer()};
+
+			vkCmdBindVertexBuffers(cmdBuffer->getCommandBuffer(0), 0, 1, buffers, offsets);
+		}
+
+		virtual void draw(const VkTsRenderItem& renderItem) override
+		{
+			vkCmdDrawIndexed(cmdBuffer->getCommandBuffer(0), sort.allDraws[renderItem.draw]->getNumberIndices(), 1, 0, 0, 0);
+		}
+
+	};
+
+	glm::mat4 viewMatrix;
+
+	// Visiting is const, so the collected state is mutable.
+
+	mutable RenderQueue renderQueue;
+
+	mutable const INode* currentNode;
+
+	// Descriptor sets are per node and material, so only the ones of the current node are searched.
+	mutable uint32_t currentNodeFirstDescriptorSet;
+
+	// Tables, the render items are indexing.
+	mutable SmartPointerVector<IGraphicsPipelineSP> allPipelines;
+	mutable std::vector<std::pair<const INode*, const ISubMesh*>> allDescriptorSets;
+	mutable std::vector<const ISubMesh*> allMeshes;
+	mutable std::vector<const ISubMesh*> allDraws;
+
+	mutable std::vector<const void*> allDescriptorSetMaterials;
+
+	// Hash maps keep their memory, when they are cleared for the next frame.
+	mutable HashMap<const IGraphicsPipeline*, uint32_t> allPipelineIndices;
+	mutable HashMap<const void*, uint32_t> allMaterialIndices;
+	mutable HashMap<std::pair<const IBufferObject*, const IBufferObject*>, uint32_t> allMeshIndices;
+
+	// Phong materials use the pipeline matching the vertex buffer.
+	mutable SmartPointerMap<VkTsVertexBufferType, IGraphicsPipelineSP> allPhongPipelines;
+
+	template<class K>
+	static uint32_t getIndex(HashMap<K, uint32_t>& allIndices, const K& key)
+	{
+		const uint32_t keyHash = HashMap<K, uint32_t>::hash(key);
+
+		const uint32_t index = allIndices.find(key, keyHash);
+
+		if (index == allIndices.size())
+		{
+			allIndices.set(key, index, keyHash);
+		}
+
+		return allIndices.valueAt(index);
+	}
+
+public:
+
+	Sort() :
+		OverwriteDraw(), viewMatrix(1.0f), renderQueue(), currentNode(nullptr), currentNodeFirstDescriptorSet(0), allPipelines(), allDescriptorSets(), allMeshes(), allDraws(), allDescriptorSetMaterials(), allPipelineIndices(), allMaterialIndices(), allMeshIndices(), allPhongPipelines()
+    {
+    }
+
+    virtual ~Sort()
+    {
+    }
+
+    //
+
+	const glm::mat4& getViewMatrix() const
+	{
+		return viewMatrix;
+	}
+
+	/**
+	 * Used for the front to back order of the draws with the same state.
+	 */
+	void setViewMatrix(const glm::mat4& viewMatrix)
+	{
+		this->viewMatrix = viewMatrix;
+	}
+
+	/**
+	 * Removes all collected draws. Has to be called before drawing the next frame.
+	 */
+	void reset()
+	{
+		renderQueue.reset();
+
+		currentNode = nullptr;
+
+		currentNodeFirstDescriptorSet = 0;
+
+		allPipelines.clear();
+		allDescriptorSets.clear();
+		allMeshes.clear();
+		allDraws.clear();
+
+		allDescriptorSetMaterials.clear();
+
+		allPipelineIndices.clear();
+		allMaterialIndices.clear();
+		allMeshIndices.clear();
+
+		allPhongPipelines.clear();
+	}
+
+	const RenderQueue& getRenderQueue() const
+	{
+		return renderQueue;
+	}
+
+	/**
+	 * Sorts and records the collected draws.
+	 */
+	void record(const ICommandBuffersSP& cmdBuffer, const uint32_t currentBuffer, const std::map<uint32_t, VkTsDynamicOffset>& dynamicOffsetMappings)
+	{
+		if (!cmdBuffer.get())
+		{
+			return;
+		}
+
+		VulkanCommandStream commandStream(*this, cmdBuffer, currentBuffer, dynamicOffsetMappings);
+
+		renderQueue.record(commandStream);
+	}
+
+    //
+
+    virtual VkBool32 visit(const INode& node, const ICommandBuffersSP& cmdBuffer, const SmartPointerVector<IGraphicsPipelineSP>& allGraphicsPipelines, const uint32_t currentBuffer, const std::map<uint32_t, VkTsDynamicOffset>& dynamicOffsetMappings) const
+    {
+    	currentNode = &node;
+
+    	currentNodeFirstDescriptorSet = (uint32_t)allDescriptorSets.size();
+
+    	return VK_TRUE;
+    }
+
+    virtual VkBool32 visit(const ISubMesh& subMesh, const ICommandBuffersSP& cmdBuffer, const SmartPointerVector<IGraphicsPipelineSP>& allGraphicsPipelines, const uint32_t currentBuffer, const std::map<uint32_t, VkTsDynamicOffset>& dynamicOffsetMappings) const
+    {
+    	IGraphicsPipelineSP graphicsPipeline;
+
+    	const void* material = nullptr;
+
+    	if (subMesh.getBSDFMaterial().get())
+    	{
+    		graphicsPipeline = subMesh.getGraphicsPipeline();
+
+    		material = subMesh.getBSDFMaterial().get();
+    	}
+    	else if (subMesh.getPhongMaterial().get())
+    	{
+    		const uint32_t phongPipelineIndex = allPhongPipelines.find(subMesh.getVertexBufferType());
+
+    		if (phongPipelineIndex == allPhongPipelines.size())
+    		{
+				for (uint32_t i = 0; i < allGraphicsPipelines.size(); i++)
+				{
+					if (allGraphicsPipelines[i]->getVertexBufferType() == subMesh.getVertexBufferType())
+					{
+						graphicsPipeline = allGraphicsPipelines[i];
+
+						break;
+					}
+				}
+
+				allPhongPipelines.set(subMesh.getVertexBufferType(), graphicsPipeline);
+    		}
+    		else
+    		{
+    			graphicsPipeline = allPhongPipelines.valueAt(phongPipelineIndex);
+    		}
+
+    		material = subMesh.getPhongMaterial().get();
+    	}
+    	else
+    	{
+            logPrint(VKTS_LOG_SEVERE, __FILE__, __LINE__, "No material");
+
+            return VK_FALSE;
+    	}
+
+    	if (!graphicsPipeline.get() || !currentNode || !subMesh.getIndexBuffer().get() || !subMesh.getIndexBuffer()->getBuffer().get() || !subMesh.getVertexBuffer().get() || !subMesh.getVertexBuffer()->getBuffer().get())
+    	{
+    		return VK_FALSE;
+    	}
+
+    	//
+
+    	VkTsRenderItem renderItem;
+
+    	renderItem.pipeline = getIndex(allPipelineIndices, (const IGraphicsPipeline*)graphicsPipeline.get());
+    	if (renderItem.pipeline == allPipelines.size())
+    	{
+    		allPipelines.append(graphicsPipeline);
+    	}
+
+    	renderItem.material = getIndex(allMaterialIndices, material);
+
+    	renderItem.descriptorSet = currentNodeFirstDescriptorSet;
+    	while (renderItem.descriptorSet < allDescriptorSetMaterials.size() && allDescriptorSetMaterials[renderItem.descriptorSet] != material)
+    	{
+    		renderItem.descriptorSet++;
+    	}
+    	if (renderItem.descriptorSet == allDescriptorSets.size())
+    	{
+    		allDescriptorSets.push_back(std::make_pair(currentNode, &subMesh));
+    		allDescriptorSetMaterials.push_back(material);
+    	}
+
+    	renderItem.mesh = getIndex(allMeshIndices, std::make_pair((const IBufferObject*)subMesh.getVertexBuffer().get(), (const IBufferObject*)subMesh.getIndexBuffer().get()));
+    	if (renderItem.mesh == allMeshes.size())
+    	{
+    		allMeshes.push_back(&subMesh);
+    	}
+
+    	renderItem.depth = -(viewMatrix * currentNode->getBoundingSphere().getCenter()).z;
+
+    	renderItem.draw = (uint32_t)allDraws.size();
+    	allDraws.push_back(&subMesh);
+
+    	renderQueue.add(renderItem);
+
+    	// Drawn later by record.
+    	return VK_FALSE;
+    }
+};
+
+} /* namespace vkts */
+
+#endif /* VKTS_SORT_HPP_ */
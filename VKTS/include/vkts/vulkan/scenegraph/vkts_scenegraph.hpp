@@ -57,5 +57,6 @@
 #include <vkts/vulkan/scenegraph/overwrite/Blend.hpp>
 #include <vkts/vulkan/scenegraph/overwrite/Cull.hpp>
 #include <vkts/vulkan/scenegraph/overwrite/Displace.hpp>
+#include <vkts/vulkan/scenegraph/overwrite/Sort.hpp>
 
 #endif /* VKTS_VKTS_SCENEGRAPH_HPP_ */
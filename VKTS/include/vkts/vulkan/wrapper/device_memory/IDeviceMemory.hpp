@@ -64,12 +64,27 @@ public:
 
     virtual const VkDeviceMemory getDeviceMemory() const = 0;
 
+    /**
+     * Offset inside the device memory. Resources have to be bound at this offset.
+     */
+    virtual VkDeviceSize getOffset() const = 0;
+
     virtual VkResult mapMemory(const VkDeviceSize offset, const VkDeviceSize size, const VkMemoryMapFlags flags) = 0;
 
     virtual void* getMemory() = 0;
 
     virtual VkResult flushMappedMemoryRanges(const VkDeviceSize offset, const VkDeviceSize size) const = 0;
 
+    /**
+     * Flushes all ranges with one call. Ranges have to be aligned to the non coherent atom size.
+     */
+    virtual VkResult flushMappedMemoryRanges(const uint32_t rangeCount, const VkTsMemoryRange* ranges) const = 0;
+
+    /**
+     * Appends the ranges as Vulkan mapped memory ranges, so ranges of several device memories can be flushed with one call.
+     */
+    virtual VkBool32 getMappedMemoryRanges(std::vector<VkMappedMemoryRange>& allMappedMemoryRanges, const uint32_t rangeCount, const VkTsMemoryRange* ranges) const = 0;
+
     virtual VkResult invalidateMappedMemoryRanges(const VkDeviceSize offset, const VkDeviceSize size) const = 0;
 
     virtual void unmapMemory() = 0;
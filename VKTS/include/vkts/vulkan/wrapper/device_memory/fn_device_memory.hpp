@@ -39,10 +39,34 @@ namespace vkts
 VKTS_APICALL VkBool32 VKTS_APIENTRY deviceGetMemoryTypeIndex(const uint32_t memoryTypeCount, const VkMemoryType* memoryType, const uint32_t memoryTypeBits, const VkMemoryPropertyFlags propertyFlags, uint32_t& memoryTypeIndex);
 
 /**
+ * Sub-allocates all following device memory of the device from large blocks. Has to be terminated before the device is destroyed.
+ * With a block size of zero, a default depending on the heap size is used.
  *
  * @ThreadSafe
  */
-VKTS_APICALL IDeviceMemorySP VKTS_APIENTRY deviceMemoryCreate(const VkDevice device, const VkMemoryRequirements& memoryRequirements, const uint32_t memoryTypeCount, const VkMemoryType* memoryTypes, const VkMemoryPropertyFlags propertyFlags);
+VKTS_APICALL VkBool32 VKTS_APIENTRY deviceMemoryInitAllocator(const VkDevice device, const VkPhysicalDeviceMemoryProperties& memoryProperties, const VkDeviceSize bufferImageGranularity, const VkDeviceSize nonCoherentAtomSize, const VkDeviceSize blockSize = 0);
+
+/**
+ * Frees all blocks of the device.
+ *
+ * @ThreadSafe
+ */
+VKTS_APICALL void VKTS_APIENTRY deviceMemoryTerminateAllocator(const VkDevice device);
+
+/**
+ * Moves allocations of the memory type into other blocks. See MemoryAllocator::defragment.
+ *
+ * @ThreadSafe
+ */
+VKTS_APICALL uint32_t VKTS_APIENTRY deviceMemoryDefragment(const VkDevice device, const uint32_t memoryTypeIndex, const uint32_t maxMoves, const MemoryMoveFunction& moveFunction);
+
+/**
+ * If an allocator is initialized for the device, the memory is a range of a block and has to be bound at its offset.
+ * Linear are buffers and images with linear tiling.
+ *
+ * @ThreadSafe
+ */
+VKTS_APICALL IDeviceMemorySP VKTS_APIENTRY deviceMemoryCreate(const VkDevice device, const VkMemoryRequirements& memoryRequirements, const uint32_t memoryTypeCount, const VkMemoryType* memoryTypes, const VkMemoryPropertyFlags propertyFlags, const VkBool32 linear = VK_TRUE);
 
 }
 
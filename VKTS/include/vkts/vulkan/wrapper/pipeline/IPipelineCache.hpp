@@ -58,6 +58,24 @@ public:
 
     virtual const VkPipelineCache getPipelineCache() const = 0;
 
+    /**
+     * Returns the data as reported by vkGetPipelineCacheData.
+     */
+    virtual IBinaryBufferSP getData() const = 0;
+
+    /**
+     * Merges the given caches, e.g. used by worker threads, into this cache.
+     */
+    virtual VkResult mergePipelineCaches(const uint32_t srcCacheCount, const VkPipelineCache* srcCaches) const = 0;
+
+    /**
+     * Returns the data prefixed by a header with the device identity and a checksum.
+     * The file data can be saved from any thread and loaded with pipelineCreateCache.
+     */
+    virtual IBinaryBufferSP getFileData(const VkPhysicalDeviceProperties& physicalDeviceProperties) const = 0;
+
+    virtual VkBool32 save(const char* filename, const VkPhysicalDeviceProperties& physicalDeviceProperties) const = 0;
+
 };
 
 typedef std::shared_ptr<IPipelineCache> IPipelineCacheSP;
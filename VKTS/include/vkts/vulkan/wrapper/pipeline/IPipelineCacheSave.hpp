@@ -0,0 +1,70 @@
+/**
+ * VKTS - VulKan ToolS.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) since 2014 Norbert Nopper
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef VKTS_IPIPELINECACHESAVE_HPP_
+#define VKTS_IPIPELINECACHESAVE_HPP_
+
+#include <vkts/vulkan/wrapper/vkts_wrapper.hpp>
+
+namespace vkts
+{
+
+/**
+ * Pipeline cache, which is saved on its own thread, e.g. while the other resources are destroyed.
+ * The thread does not depend on the task executors of the engine.
+ */
+class IPipelineCacheSave
+{
+
+public:
+
+    IPipelineCacheSave()
+    {
+    }
+
+    virtual ~IPipelineCacheSave()
+    {
+    }
+
+    /**
+     * Blocks, until the cache is saved or the timeout in seconds has elapsed.
+     * Returns VK_FALSE, if saving failed or is not done yet.
+     */
+    virtual VkBool32 wait(const double timeout) const = 0;
+
+    /**
+     * Blocks, until the saving thread has finished. Has to be called, before the application exits.
+     * Returns VK_FALSE, if saving failed.
+     */
+    virtual VkBool32 join() = 0;
+
+};
+
+typedef std::shared_ptr<IPipelineCacheSave> IPipelineCacheSaveSP;
+
+} /* namespace vkts */
+
+#endif /* VKTS_IPIPELINECACHESAVE_HPP_ */
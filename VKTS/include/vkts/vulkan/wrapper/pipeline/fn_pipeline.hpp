@@ -38,6 +38,22 @@ namespace vkts
  */
 VKTS_APICALL IPipelineCacheSP VKTS_APIENTRY pipelineCreateCache(const VkDevice device, const VkPipelineCacheCreateFlags flags, const uint32_t initialSize = 0, const void* initialData = nullptr);
 
+/**
+ * Creates the cache with the data saved by IPipelineCache::save. If the file is missing, broken or
+ * was saved for another device, driver version or pipeline cache UUID, an empty cache is created.
+ *
+ * @ThreadSafe
+ */
+VKTS_APICALL IPipelineCacheSP VKTS_APIENTRY pipelineCreateCache(const VkDevice device, const VkPipelineCacheCreateFlags flags, const char* filename, const VkPhysicalDeviceProperties& physicalDeviceProperties);
+
+/**
+ * Gathers the file data of the cache on the calling thread and saves it on its own thread.
+ * The cache can be destroyed afterwards. The returned save has to be joined, before the application exits.
+ *
+ * @ThreadSafe
+ */
+VKTS_APICALL IPipelineCacheSaveSP VKTS_APIENTRY pipelineCacheSaveAsync(const IPipelineCacheSP& pipelineCache, const char* filename, const VkPhysicalDeviceProperties& physicalDeviceProperties);
+
 /**
  *
  * @ThreadSafe
@@ -38,12 +38,28 @@ namespace vkts
  */
 VKTS_APICALL IQueueSP VKTS_APIENTRY queueGet(const VkDevice device, const uint32_t queueFamilyIndex, const uint32_t queueIndex);
 
+/**
+ * Access to a queue has to be externally synchronized, so all submits, waits and presents to the same queue are done under this lock.
+ * The lock is shared by all queue objects of the same queue.
+ *
+ * @ThreadSafe
+ */
+VKTS_APICALL std::mutex& VKTS_APIENTRY queueGetMutex(const VkQueue queue);
+
 /**
  *
  * @ThreadSafe
  */
 VKTS_APICALL VkBool32 VKTS_APIENTRY queueGetFamilyIndex(const std::vector<VkQueueFamilyProperties>& allQueueFamilyProperties, const VkQueueFlags queueFlags, const uint32_t queueIndex, const std::vector<VkBool32>* filter, uint32_t& queueFamilyIndex);
 
+/**
+ * Finds a queue family, which supports transfers but neither graphics nor compute e.g. a DMA engine.
+ * Returns VK_FALSE without logging, if there is none.
+ *
+ * @ThreadSafe
+ */
+VKTS_APICALL VkBool32 VKTS_APIENTRY queueGetTransferFamilyIndex(const std::vector<VkQueueFamilyProperties>& allQueueFamilyProperties, uint32_t& queueFamilyIndex);
+
 }
 
 #endif /* VKTS_FN_QUEUE_HPP_ */
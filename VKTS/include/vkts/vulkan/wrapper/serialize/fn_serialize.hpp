@@ -44,6 +44,15 @@ VKTS_APICALL uint32_t VKTS_APIENTRY serializeGetStructureTypeSize(const void* pt
  */
 VKTS_APICALL IBinaryBufferSP VKTS_APIENTRY serializeStructureType(const void* ptr);
 
+/**
+ * Serializes the structure, all structures and arrays it points to and the pNext chains.
+ * Only values are written, no pointers and no padding, so equal create infos result in equal data, e.g. for a cache key.
+ * Handles are written as they are. Returns an empty buffer for structure types, which are not supported.
+ *
+ * @ThreadSafe
+ */
+VKTS_APICALL IBinaryBufferSP VKTS_APIENTRY serializeStructureTypeDeep(const void* ptr);
+
 }
 
 #endif /* VKTS_FN_SERIALIZE_HPP_ */
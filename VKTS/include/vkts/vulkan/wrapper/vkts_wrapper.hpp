@@ -251,6 +251,7 @@ typedef struct VkTsStructureTypeHeader_
 #include <vkts/vulkan/wrapper/pipeline/IComputePipeline.hpp>
 #include <vkts/vulkan/wrapper/pipeline/IGraphicsPipeline.hpp>
 #include <vkts/vulkan/wrapper/pipeline/IPipelineCache.hpp>
+#include <vkts/vulkan/wrapper/pipeline/IPipelineCacheSave.hpp>
 #include <vkts/vulkan/wrapper/pipeline/IPipelineLayout.hpp>
 
 #include <vkts/vulkan/wrapper/pipeline/DefaultComputePipeline.hpp>
@@ -73,7 +73,7 @@ VkBool32 Example::createTexture(vkts::IImageSP& currentImage, vkts::IDeviceMemor
 
 	// Bind image to memory.
 
-	result = vkBindImageMemory(device->getDevice(), currentImage->getImage(), currentDeviceImageObject->getDeviceMemory(), 0);
+	result = vkBindImageMemory(device->getDevice(), currentImage->getImage(), currentDeviceImageObject->getDeviceMemory(), currentDeviceImageObject->getOffset());
 
 	if (result != VK_SUCCESS)
 	{
@@ -876,7 +876,7 @@ VkBool32 Example::buildVertexBuffer()
 		return VK_FALSE;
 	}
 
-	result = vertexBuffer->bindBufferMemory(deviceMemoryVertexBuffer->getDeviceMemory(), 0);
+	result = vertexBuffer->bindBufferMemory(deviceMemoryVertexBuffer->getDeviceMemory(), deviceMemoryVertexBuffer->getOffset());
 
 	if (result != VK_SUCCESS)
 	{
@@ -27,7 +27,7 @@
 #include "Example.hpp"
 
 Example::Example(const vkts::IContextObjectSP& contextObject, const int32_t windowIndex, const vkts::IVisualContextSP& visualContext, const vkts::ISurfaceSP& surface) :
-		IUpdateThread(), contextObject(contextObject), windowIndex(windowIndex), visualContext(visualContext), surface(surface), commandPool(nullptr), imageAcquiredSemaphore(nullptr), renderingCompleteSemaphore(nullptr), descriptorSetLayout(nullptr), vertexViewProjectionUniformBuffer(nullptr), fragmentUniformBuffer(nullptr), vertexShaderModule(nullptr), fragmentShaderModule(nullptr), pipelineLayout(nullptr), renderFactory(nullptr), sceneManager(nullptr), sceneFactory(nullptr), scene(nullptr), swapchain(nullptr), renderPass(nullptr), allGraphicsPipelines(), depthTexture(nullptr), depthStencilImageView(nullptr), swapchainImagesCount(0), swapchainImageView(), framebuffer(), cmdBuffer(), cmdBufferFence()
+		IUpdateThread(), contextObject(contextObject), windowIndex(windowIndex), visualContext(visualContext), surface(surface), commandPool(nullptr), imageAcquiredSemaphore(nullptr), renderingCompleteSemaphore(nullptr), descriptorSetLayout(nullptr), vertexViewProjectionUniformBuffer(nullptr), fragmentUniformBuffer(nullptr), vertexShaderModule(nullptr), fragmentShaderModule(nullptr), pipelineLayout(nullptr), renderFactory(nullptr), sceneManager(nullptr), sceneFactory(nullptr), scene(nullptr), swapchain(nullptr), renderPass(nullptr), allGraphicsPipelines(), depthTexture(nullptr), depthStencilImageView(nullptr), swapchainImagesCount(0), swapchainImageView(), framebuffer(), cmdBuffer(), sort(), cmdBufferFence()
 {
 }
 
@@ -115,7 +115,12 @@ VkBool32 Example::buildCmdBuffer(const int32_t usedBuffer)
 
 	if (scene.get())
 	{
-		scene->drawRecursive(cmdBuffer[usedBuffer], allGraphicsPipelines, usedBuffer, dynamicOffsets);
+		// Sub meshes are collected, sorted by their state and recorded afterwards.
+		sort[usedBuffer].reset();
+
+		scene->drawRecursive(cmdBuffer[usedBuffer], allGraphicsPipelines, usedBuffer, dynamicOffsets, &sort[usedBuffer]);
+
+		sort[usedBuffer].record(cmdBuffer[usedBuffer], usedBuffer, dynamicOffsets);
 	}
 
 	cmdBuffer[usedBuffer]->cmdEndRenderPass();
@@ -829,6 +834,7 @@ VkBool32 Example::buildResources(const vkts::IUpdateThreadContext& updateContext
     swapchainImageView = vkts::SmartPointerVector<vkts::IImageViewSP>(swapchainImagesCount);
     framebuffer = vkts::SmartPointerVector<vkts::IFramebufferSP>(swapchainImagesCount);
     cmdBuffer = vkts::SmartPointerVector<vkts::ICommandBuffersSP>(swapchainImagesCount);
+    sort = std::vector<vkts::Sort>(swapchainImagesCount);
     cmdBufferFence = vkts::SmartPointerVector<vkts::IFenceSP>(swapchainImagesCount);
 
     for (uint32_t i = 0; i < swapchainImagesCount; i++)
@@ -1025,6 +1031,12 @@ void Example::terminateResources(const vkts::IUpdateThreadContext& updateContext
 					cmdBuffer[i]->destroy();
 				}
 
+				// Releases the collected pipelines and sub meshes.
+				if ((size_t)i < sort.size())
+				{
+					sort[i].reset();
+				}
+
 				if (framebuffer[i].get())
 				{
 					framebuffer[i]->destroy();
@@ -1240,6 +1252,15 @@ VkBool32 Example::update(const vkts::IUpdateThreadContext& updateContext)
 			scene->updateTransformRecursive(updateContext.getDeltaTime(), updateContext.getDeltaTicks(), updateContext.getTickTime(), currentBuffer);
 		}
 
+		// All uploads of the frame are flushed at once.
+
+		if (!contextObject->flushMappedMemoryRanges())
+		{
+			vkts::logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Could not flush memory.");
+
+			return VK_FALSE;
+		}
+
 		//
 
         VkSemaphore waitSemaphores = imageAcquiredSemaphore->getSemaphore();
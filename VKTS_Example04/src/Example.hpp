@@ -103,6 +103,9 @@ private:
 
     vkts::SmartPointerVector<vkts::ICommandBuffersSP> cmdBuffer;
 
+    // One per command buffer, so the collected state keeps its memory, when the command buffer is built again.
+    std::vector<vkts::Sort> sort;
+
     vkts::SmartPointerVector<vkts::IFenceSP> cmdBufferFence;
 
 	VkBool32 buildCmdBuffer(const int32_t usedBuffer);
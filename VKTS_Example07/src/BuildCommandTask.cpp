@@ -44,12 +44,6 @@ VkBool32 BuildCommandTask::execute()
     	cmdBuffer[usedBuffer]->reset();
     }
 
-    // Update / transform the scene.
-    if (scene.get())
-    {
-        scene->updateTransformRecursive(updateContext.getDeltaTime(), updateContext.getDeltaTicks(), updateContext.getTickTime(), usedBuffer, objectOffset, objectStep);
-    }
-
     //
     // Record secondary command buffer.
     //
@@ -27,7 +27,7 @@
 #include "Example.hpp"
 
 Example::Example(const vkts::IContextObjectSP& contextObject, const int32_t windowIndex, const vkts::IVisualContextSP& visualContext, const vkts::ISurfaceSP& surface) :
-		IUpdateThread(), contextObject(contextObject), windowIndex(windowIndex), visualContext(visualContext), surface(surface), camera(nullptr), inputController(nullptr), allUpdateables(), commandPool(nullptr), imageAcquiredSemaphore(nullptr), renderingCompleteSemaphore(nullptr), descriptorSetLayout(nullptr), vertexViewProjectionUniformBuffer(nullptr), fragmentUniformBuffer(nullptr), vertexShaderModule(nullptr), tessellationControlShaderModule(nullptr), tessellationEvaluationShaderModule(nullptr), geometryShaderModule(nullptr), fragmentShaderModule(nullptr), pipelineLayout(nullptr), sceneManager(nullptr), sceneFactory(nullptr), scene(nullptr), allBuildCommandTasks(), swapchain(nullptr), renderPass(nullptr), allGraphicsPipelines(), depthTexture(nullptr), depthStencilImageView(nullptr), swapchainImagesCount(0), swapchainImageView(), framebuffer(), cmdBuffer(), cmdBufferFence(), commandBufferCount(0)
+		IUpdateThread(), contextObject(contextObject), windowIndex(windowIndex), visualContext(visualContext), surface(surface), camera(nullptr), inputController(nullptr), allUpdateables(), commandPool(nullptr), imageAcquiredSemaphore(nullptr), renderingCompleteSemaphore(nullptr), descriptorSetLayout(nullptr), vertexViewProjectionUniformBuffer(nullptr), fragmentUniformBuffer(nullptr), vertexShaderModule(nullptr), tessellationControlShaderModule(nullptr), tessellationEvaluationShaderModule(nullptr), geometryShaderModule(nullptr), fragmentShaderModule(nullptr), pipelineLayout(nullptr), sceneManager(nullptr), sceneFactory(nullptr), scene(nullptr), allBuildCommandTasks(), allTasks(), swapchain(nullptr), renderPass(nullptr), allGraphicsPipelines(), depthTexture(nullptr), depthStencilImageView(nullptr), swapchainImagesCount(0), swapchainImageView(), framebuffer(), cmdBuffer(), cmdBufferFence(), commandBufferCount(0)
 {
 }
 
@@ -1060,6 +1060,7 @@ VkBool32 Example::buildResources(const vkts::IUpdateThreadContext& updateContext
 	if (scene.get())
 	{
 		allBuildCommandTasks.clear();
+		allTasks.clear();
 
 		for (uint32_t i = 0; i < VKTS_NUMBER_TASKS; i++)
 		{
@@ -1073,6 +1074,7 @@ VkBool32 Example::buildResources(const vkts::IUpdateThreadContext& updateContext
 			}
 
 			allBuildCommandTasks.append(currentBuildCommandTask);
+			allTasks.append(currentBuildCommandTask);
 		}
 	}
 
@@ -1453,6 +1455,17 @@ VkBool32 Example::update(const vkts::IUpdateThreadContext& updateContext)
 
 		//
 
+		// Update / transform the scene, balanced over the task executors.
+		if (scene.get())
+		{
+			if (!scene->updateParallel(updateContext, updateContext.getDeltaTime(), updateContext.getDeltaTicks(), updateContext.getTickTime(), currentBuffer))
+			{
+				return VK_FALSE;
+			}
+		}
+
+		//
+
 		commandBufferCount = 0;
 
         // Build/record secondary buffer in separate threads.
@@ -1475,26 +1488,23 @@ VkBool32 Example::update(const vkts::IUpdateThreadContext& updateContext)
 			allBuildCommandTasks[i]->setExtent(swapchain->getImageExtent());
 			allBuildCommandTasks[i]->setUsedBuffer(currentBuffer);
 			allBuildCommandTasks[i]->setOverwrite(&cull);
+		}
+
+		// Send all the tasks at once ...
+		auto taskCounter = vkts::taskFork(updateContext, allTasks);
 
-			// Send the tasks ...
-			updateContext.sendTask(allBuildCommandTasks[i]);
+		// ... and wait, until all of them are executed.
+		if (!vkts::taskJoin(taskCounter))
+		{
+            return VK_FALSE;
 		}
 
 		for (uint32_t i = 0; i < allBuildCommandTasks.size(); i++)
 		{
-			vkts::ITaskSP executedTask;
-
-			updateContext.receiveExecutedTask(executedTask);
-
-			if (!executedTask.get())
-			{
-	            return VK_FALSE;
-			}
-
 			// If available, add secondary command buffer to list to be executed later.
-			if (allBuildCommandTasks[(uint32_t)executedTask->getID()]->getCommandBuffer() != VK_NULL_HANDLE)
+			if (allBuildCommandTasks[i]->getCommandBuffer() != VK_NULL_HANDLE)
 			{
-				secondaryCmdBuffers[commandBufferCount] = allBuildCommandTasks[(uint32_t)executedTask->getID()]->getCommandBuffer();
+				secondaryCmdBuffers[commandBufferCount] = allBuildCommandTasks[i]->getCommandBuffer();
 
 				commandBufferCount++;
 			}
@@ -1604,6 +1614,7 @@ void Example::terminate(const vkts::IUpdateThreadContext& updateContext)
 			terminateResources(updateContext);
 
 			allBuildCommandTasks.clear();
+			allTasks.clear();
 
 			if (sceneFactory.get())
 			{
@@ -99,6 +99,7 @@ private:
 	vkts::ISceneSP scene;
 
 	vkts::SmartPointerVector<IBuildCommandTaskSP> allBuildCommandTasks;
+	vkts::SmartPointerVector<vkts::ITaskSP> allTasks;
 
 	vkts::ISwapchainSP swapchain;
 
@@ -2050,6 +2050,15 @@ VkBool32 Example::update(const vkts::IUpdateThreadContext& updateContext)
 				scene->updateTransformRecursive(updateContext.getDeltaTime(), updateContext.getDeltaTicks(), updateContext.getTickTime(), currentBuffer);
 			}
 
+			// All uploads of the frame are flushed at once.
+
+			if (!contextObject->flushMappedMemoryRanges())
+			{
+				vkts::logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Could not flush memory.");
+
+				return VK_FALSE;
+			}
+
 			//
 
 			VkSemaphore waitSemaphores = imageAcquiredSemaphore->getSemaphore();
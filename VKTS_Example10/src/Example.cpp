@@ -582,6 +582,14 @@ VkBool32 Example::buildScene(const vkts::ICommandObjectSP& commandObject)
 
 		//
 
+		uint64_t createdPipelines;
+		uint64_t reusedPipelines;
+
+		// Discard pipelines counted before loading the scene.
+		vkts::profileGetPipelines(createdPipelines, reusedPipelines);
+
+		const double loadStartTime = vkts::timeGetRaw();
+
 		scene = vkts::sceneLoad(VKTS_SCENE_NAME, sceneManager, sceneFactory, VK_TRUE);
 
 		if (!scene.get())
@@ -591,6 +599,10 @@ VkBool32 Example::buildScene(const vkts::ICommandObjectSP& commandObject)
 			return VK_FALSE;
 		}
 
+		vkts::profileGetPipelines(createdPipelines, reusedPipelines);
+
+		vkts::logPrint(VKTS_LOG_INFO, __FILE__, __LINE__, "Loaded scene in %.3f seconds with %u created and %u reused pipelines.", vkts::timeGetRaw() - loadStartTime, (uint32_t)createdPipelines, (uint32_t)reusedPipelines);
+
 		vkts::logPrint(VKTS_LOG_INFO, __FILE__, __LINE__, "Number objects: %d", scene->getNumberObjects());
 
 		//
@@ -1548,7 +1560,18 @@ VkBool32 Example::buildResources(const vkts::IUpdateThreadContext& updateContext
 
 	//
 
-	auto commandObject = vkts::commandObjectCreate(updateCmdBuffer);
+	// Textures and meshes are uploaded in batches, on the transfer queue if available.
+
+	auto uploadManager = vkts::uploadManagerCreate(contextObject, contextObject->getTransferQueue());
+
+	if (!uploadManager.get())
+	{
+		vkts::logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Could not create upload manager.");
+
+		return VK_FALSE;
+	}
+
+	auto commandObject = vkts::commandObjectCreate(updateCmdBuffer, uploadManager);
 
 	if (!commandObject.get())
 	{
@@ -1619,6 +1642,13 @@ VkBool32 Example::buildResources(const vkts::IUpdateThreadContext& updateContext
 		return VK_FALSE;
 	}
 
+	if (!uploadManager->submit())
+	{
+		vkts::logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Could not submit uploads.");
+
+		return VK_FALSE;
+	}
+
 	result = updateCmdBuffer->endCommandBuffer();
 
 	if (result != VK_SUCCESS)
@@ -1658,6 +1688,10 @@ VkBool32 Example::buildResources(const vkts::IUpdateThreadContext& updateContext
 		return VK_FALSE;
 	}
 
+	vkts::logPrint(VKTS_LOG_INFO, __FILE__, __LINE__, "Uploaded %llu bytes in %llu uploads with %llu submits.", (unsigned long long)uploadManager->getUploadBytes(), (unsigned long long)uploadManager->getUploadCount(), (unsigned long long)uploadManager->getSubmitCount());
+
+	uploadManager->destroy();
+
 	commandObject->destroy();
 
 	updateCmdBuffer->destroy();
@@ -1809,6 +1843,10 @@ void Example::terminateResources(const vkts::IUpdateThreadContext& updateContext
 //
 VkBool32 Example::init(const vkts::IUpdateThreadContext& updateContext)
 {
+	const double startTime = vkts::timeGetRaw();
+
+	//
+
 	if (!visualContext->isWindowAttached(windowIndex))
 	{
 		vkts::logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Could not get window.");
@@ -1853,7 +1891,13 @@ VkBool32 Example::init(const vkts::IUpdateThreadContext& updateContext)
 
 	//
 
-	pipelineCache = vkts::pipelineCreateCache(contextObject->getDevice()->getDevice(), 0);
+	// Pipelines of the last run are reused, if the cache was saved on this device and driver.
+
+	VkPhysicalDeviceProperties physicalDeviceProperties;
+
+	contextObject->getPhysicalDevice()->getPhysicalDeviceProperties(physicalDeviceProperties);
+
+	pipelineCache = vkts::pipelineCreateCache(contextObject->getDevice()->getDevice(), 0, VKTS_PIPELINE_CACHE_NAME, physicalDeviceProperties);
 
 	if (!pipelineCache.get())
 	{
@@ -1933,6 +1977,8 @@ VkBool32 Example::init(const vkts::IUpdateThreadContext& updateContext)
 		return VK_FALSE;
 	}
 
+	vkts::logPrint(VKTS_LOG_INFO, __FILE__, __LINE__, "Initialized in %.3f seconds with %u bytes of pipeline cache data.", vkts::timeGetRaw() - startTime, (uint32_t)pipelineCache->getInitialDataSize());
+
 	return VK_TRUE;
 }
 
@@ -2084,6 +2130,10 @@ VkBool32 Example::update(const vkts::IUpdateThreadContext& updateContext)
 
 			int32_t lightCount = glm::min((int32_t)scene->getLights().size(), VKTS_MAX_LIGHTS);
 
+			// All lights are flushed at once.
+
+			resolveFragmentLightsUniformBuffer->reset(currentBuffer);
+
 			if (!resolveFragmentLightsUniformBuffer->upload(dynamicOffsets[VKTS_BINDING_UNIFORM_BUFFER_LIGHT].stride * (VkDeviceSize)currentBuffer + VKTS_MAX_LIGHTS * 4 * sizeof(float) * 2, 0, lightCount))
 			{
 				vkts::logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Could not upload lights.");
@@ -2107,6 +2157,22 @@ VkBool32 Example::update(const vkts::IUpdateThreadContext& updateContext)
 					return VK_FALSE;
 				}
 			}
+
+			if (!resolveFragmentLightsUniformBuffer->flush())
+			{
+				vkts::logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Could not flush lights.");
+
+				return VK_FALSE;
+			}
+		}
+
+		// All uploads of the frame are flushed at once.
+
+		if (!contextObject->flushMappedMemoryRanges())
+		{
+			vkts::logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Could not flush memory.");
+
+			return VK_FALSE;
 		}
 
 		//
@@ -2255,6 +2321,19 @@ void Example::terminate(const vkts::IUpdateThreadContext& updateContext)
 		{
 			terminateResources(updateContext);
 
+			// The device is idle, so the cache is complete. It is saved on its own thread, while the remaining resources are destroyed.
+
+			vkts::IPipelineCacheSaveSP pipelineCacheSave;
+
+			if (pipelineCache.get())
+			{
+				VkPhysicalDeviceProperties physicalDeviceProperties;
+
+				contextObject->getPhysicalDevice()->getPhysicalDeviceProperties(physicalDeviceProperties);
+
+				pipelineCacheSave = vkts::pipelineCacheSaveAsync(pipelineCache, VKTS_PIPELINE_CACHE_NAME, physicalDeviceProperties);
+			}
+
 			for (int32_t i = 0; i < (int32_t)swapchainImagesCount; i++)
 			{
 				if (cmdBuffer[i].get())
@@ -2306,7 +2385,7 @@ void Example::terminate(const vkts::IUpdateThreadContext& updateContext)
 
 			if (environmentRenderFactory.get())
 			{
-				renderFactory.reset();
+				environmentRenderFactory.reset();
 			}
 
 			if (environmentScene.get())
@@ -2434,6 +2513,20 @@ void Example::terminate(const vkts::IUpdateThreadContext& updateContext)
 			{
 				commandPool->destroy();
 			}
+
+			// Report a stalled file system, but always join, as the thread must not outlive the application.
+			if (pipelineCacheSave.get())
+			{
+				if (!pipelineCacheSave->wait(VKTS_PIPELINE_CACHE_SAVE_TIMEOUT))
+				{
+					vkts::logPrint(VKTS_LOG_WARNING, __FILE__, __LINE__, "Saving pipeline cache takes longer than %.1f seconds.", VKTS_PIPELINE_CACHE_SAVE_TIMEOUT);
+				}
+
+				if (!pipelineCacheSave->join())
+				{
+					vkts::logPrint(VKTS_LOG_WARNING, __FILE__, __LINE__, "Could not save pipeline cache.");
+				}
+			}
 		}
 	}
 }
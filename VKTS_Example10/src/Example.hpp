@@ -29,6 +29,7 @@
 
 #include <vkts/vkts.hpp>
 
+
 #define VKTS_EXAMPLE_NAME "Example10"
 
 #define VKTS_NUMBER_DYNAMIC_UNIFORM_BUFFERS 3
@@ -60,6 +61,9 @@
 #define VKTS_RESOLVE_FRAGMENT_SHADER_NAME "shader/SPIR/V/resolve_bsdf.frag.spv"
 
 
+#define VKTS_PIPELINE_CACHE_NAME "cache/Example10.pipelinecache"
+#define VKTS_PIPELINE_CACHE_SAVE_TIMEOUT 5.0
+
 #define VKTS_SCENE_NAME "material_probes/material_probes.vkts"
 
 #define VKTS_ENVIRONMENT_SCENE_NAME "primitives/sphere.vkts"
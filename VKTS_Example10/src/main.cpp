@@ -107,6 +107,19 @@ int main(int argc, char* argv[])
 
 	vkts::logSetLevel(VKTS_LOG_INFO);
 
+	//
+	// Set task executors, so the image data is pre-filtered in parallel during the scene load.
+	//
+
+	if (!vkts::engineSetTaskExecutorCount(vkts::processorGetNumber()))
+	{
+		vkts::logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Could not set task executors.");
+
+		terminateApp();
+
+		return -1;
+	}
+
 	//
 
 	if (!vkts::profileInit())
@@ -316,18 +329,33 @@ int main(int argc, char* argv[])
 
 	//
 
+	// Optional dedicated transfer queue for asset uploads.
+
+	uint32_t transferQueueFamilyIndex = 0;
+
+	VkBool32 useTransferQueue = vkts::queueGetTransferFamilyIndex(physicalDevice->getAllQueueFamilyProperties(), transferQueueFamilyIndex);
+
+	//
+
 	float queuePriorities[1] = {0.0f};
 
-	VkDeviceQueueCreateInfo deviceQueueCreateInfo{};
+	VkDeviceQueueCreateInfo deviceQueueCreateInfo[2]{};
 
-	deviceQueueCreateInfo.sType = VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO;
+	deviceQueueCreateInfo[0].sType = VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO;
 
-	deviceQueueCreateInfo.flags = 0;
-	deviceQueueCreateInfo.queueFamilyIndex = 0;
-	deviceQueueCreateInfo.queueCount = 1;
-	deviceQueueCreateInfo.pQueuePriorities = queuePriorities;
+	deviceQueueCreateInfo[0].flags = 0;
+	deviceQueueCreateInfo[0].queueFamilyIndex = queueFamilyIndex;
+	deviceQueueCreateInfo[0].queueCount = 1;
+	deviceQueueCreateInfo[0].pQueuePriorities = queuePriorities;
 
-	auto device = vkts::deviceCreate(physicalDevice->getPhysicalDevice(), 0, 1, &deviceQueueCreateInfo, 0, nullptr, vkts::extensionGetNeededDeviceExtensionCount(), vkts::extensionGetNeededDeviceExtensionNames(), nullptr);
+	deviceQueueCreateInfo[1].sType = VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO;
+
+	deviceQueueCreateInfo[1].flags = 0;
+	deviceQueueCreateInfo[1].queueFamilyIndex = transferQueueFamilyIndex;
+	deviceQueueCreateInfo[1].queueCount = 1;
+	deviceQueueCreateInfo[1].pQueuePriorities = queuePriorities;
+
+	auto device = vkts::deviceCreate(physicalDevice->getPhysicalDevice(), 0, useTransferQueue ? 2 : 1, deviceQueueCreateInfo, 0, nullptr, vkts::extensionGetNeededDeviceExtensionCount(), vkts::extensionGetNeededDeviceExtensionNames(), nullptr);
 
 	if (!device.get())
 	{
@@ -353,7 +381,25 @@ int main(int argc, char* argv[])
 
 	//
 
-	contextObject = vkts::contextObjectCreate(instance, physicalDevice, device, queue);
+	vkts::IQueueSP transferQueue;
+
+	if (useTransferQueue)
+	{
+		transferQueue = vkts::queueGet(device->getDevice(), transferQueueFamilyIndex, 0);
+
+		if (!transferQueue.get())
+		{
+			vkts::logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Could not get transfer queue.");
+
+			terminateApp();
+
+			return -1;
+		}
+	}
+
+	//
+
+	contextObject = vkts::contextObjectCreate(instance, physicalDevice, device, queue, VK_TRUE, transferQueue);
 
 	if (!contextObject.get())
 	{
@@ -469,6 +469,14 @@ VkBool32 Example::buildScene(const vkts::ICommandObjectSP& commandObject)
 
 		//
 
+		uint64_t createdPipelines;
+		uint64_t reusedPipelines;
+
+		// Discard pipelines counted before loading the scene.
+		vkts::profileGetPipelines(createdPipelines, reusedPipelines);
+
+		const double loadStartTime = vkts::timeGetRaw();
+
 		scene = vkts::sceneLoad(VKTS_SCENE_NAME, sceneManager, sceneFactory, VK_TRUE);
 
 		if (!scene.get())
@@ -478,6 +486,10 @@ VkBool32 Example::buildScene(const vkts::ICommandObjectSP& commandObject)
 			return VK_FALSE;
 		}
 
+		vkts::profileGetPipelines(createdPipelines, reusedPipelines);
+
+		vkts::logPrint(VKTS_LOG_INFO, __FILE__, __LINE__, "Loaded scene in %.3f seconds with %u created and %u reused pipelines.", vkts::timeGetRaw() - loadStartTime, (uint32_t)createdPipelines, (uint32_t)reusedPipelines);
+
 		vkts::logPrint(VKTS_LOG_INFO, __FILE__, __LINE__, "Number objects: %d", scene->getNumberObjects());
 
 		//
@@ -1521,6 +1533,10 @@ void Example::terminateResources(const vkts::IUpdateThreadContext& updateContext
 //
 VkBool32 Example::init(const vkts::IUpdateThreadContext& updateContext)
 {
+	const double startTime = vkts::timeGetRaw();
+
+	//
+
 	if (!visualContext->isWindowAttached(windowIndex))
 	{
 		vkts::logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Could not get window.");
@@ -1546,7 +1562,13 @@ VkBool32 Example::init(const vkts::IUpdateThreadContext& updateContext)
 
 	//
 
-	pipelineCache = vkts::pipelineCreateCache(contextObject->getDevice()->getDevice(), 0);
+	// Pipelines of the last run are reused, if the cache was saved on this device and driver.
+
+	VkPhysicalDeviceProperties physicalDeviceProperties;
+
+	contextObject->getPhysicalDevice()->getPhysicalDeviceProperties(physicalDeviceProperties);
+
+	pipelineCache = vkts::pipelineCreateCache(contextObject->getDevice()->getDevice(), 0, VKTS_PIPELINE_CACHE_NAME, physicalDeviceProperties);
 
 	if (!pipelineCache.get())
 	{
@@ -1612,6 +1634,8 @@ VkBool32 Example::init(const vkts::IUpdateThreadContext& updateContext)
 		return VK_FALSE;
 	}
 
+	vkts::logPrint(VKTS_LOG_INFO, __FILE__, __LINE__, "Initialized in %.3f seconds with %u bytes of pipeline cache data.", vkts::timeGetRaw() - startTime, (uint32_t)pipelineCache->getInitialDataSize());
+
 	return VK_TRUE;
 }
 
@@ -1730,6 +1754,10 @@ VkBool32 Example::update(const vkts::IUpdateThreadContext& updateContext)
 
 			int32_t lightCount = glm::min((int32_t)scene->getLights().size(), VKTS_MAX_LIGHTS);
 
+			// All lights are flushed at once.
+
+			fragmentLightsUniformBuffer->reset(currentBuffer);
+
 			if (!fragmentLightsUniformBuffer->upload(dynamicOffsets[VKTS_BINDING_UNIFORM_BUFFER_LIGHT].stride * (VkDeviceSize)currentBuffer + VKTS_MAX_LIGHTS * 4 * sizeof(float) * 2, 0, lightCount))
 			{
 				vkts::logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Could not upload lights.");
@@ -1753,6 +1781,13 @@ VkBool32 Example::update(const vkts::IUpdateThreadContext& updateContext)
 					return VK_FALSE;
 				}
 			}
+
+			if (!fragmentLightsUniformBuffer->flush())
+			{
+				vkts::logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Could not flush lights.");
+
+				return VK_FALSE;
+			}
 		}
 
 		if (!camera.get())
@@ -1825,6 +1860,15 @@ VkBool32 Example::update(const vkts::IUpdateThreadContext& updateContext)
 			environmentScene->updateTransformRecursive(updateContext.getDeltaTime(), updateContext.getDeltaTicks(), updateContext.getTickTime(), currentBuffer);
 		}
 
+		// All uploads of the frame are flushed at once.
+
+		if (!contextObject->flushMappedMemoryRanges())
+		{
+			vkts::logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Could not flush memory.");
+
+			return VK_FALSE;
+		}
+
 		//
 
 		uint32_t currentFPS;
@@ -1971,6 +2015,19 @@ void Example::terminate(const vkts::IUpdateThreadContext& updateContext)
 		{
 			terminateResources(updateContext);
 
+			// The device is idle, so the cache is complete. It is saved on its own thread, while the remaining resources are destroyed.
+
+			vkts::IPipelineCacheSaveSP pipelineCacheSave;
+
+			if (pipelineCache.get())
+			{
+				VkPhysicalDeviceProperties physicalDeviceProperties;
+
+				contextObject->getPhysicalDevice()->getPhysicalDeviceProperties(physicalDeviceProperties);
+
+				pipelineCacheSave = vkts::pipelineCacheSaveAsync(pipelineCache, VKTS_PIPELINE_CACHE_NAME, physicalDeviceProperties);
+			}
+
 			for (int32_t i = 0; i < (int32_t)swapchainImagesCount; i++)
 			{
 				if (cmdBuffer[i].get())
@@ -2017,7 +2074,7 @@ void Example::terminate(const vkts::IUpdateThreadContext& updateContext)
 
 			if (environmentRenderFactory.get())
 			{
-				renderFactory.reset();
+				environmentRenderFactory.reset();
 			}
 
 			if (environmentScene.get())
@@ -2115,6 +2172,20 @@ void Example::terminate(const vkts::IUpdateThreadContext& updateContext)
 			{
 				commandPool->destroy();
 			}
+
+			// Report a stalled file system, but always join, as the thread must not outlive the application.
+			if (pipelineCacheSave.get())
+			{
+				if (!pipelineCacheSave->wait(VKTS_PIPELINE_CACHE_SAVE_TIMEOUT))
+				{
+					vkts::logPrint(VKTS_LOG_WARNING, __FILE__, __LINE__, "Saving pipeline cache takes longer than %.1f seconds.", VKTS_PIPELINE_CACHE_SAVE_TIMEOUT);
+				}
+
+				if (!pipelineCacheSave->join())
+				{
+					vkts::logPrint(VKTS_LOG_WARNING, __FILE__, __LINE__, "Could not save pipeline cache.");
+				}
+			}
 		}
 	}
 }
@@ -29,6 +29,7 @@
 
 #include <vkts/vkts.hpp>
 
+
 #define VKTS_EXAMPLE_NAME "Example12"
 
 #define VKTS_NUMBER_DYNAMIC_UNIFORM_BUFFERS 3
@@ -59,6 +60,9 @@
 #define VKTS_ENV_FRAGMENT_SHADER_NAME "shader/SPIR/V/environment.frag.spv"
 
 
+#define VKTS_PIPELINE_CACHE_NAME "cache/Example12.pipelinecache"
+#define VKTS_PIPELINE_CACHE_SAVE_TIMEOUT 5.0
+
 #define VKTS_SCENE_NAME "buster_drone/buster_drone.vkts"
 //#define VKTS_SCENE_NAME "cerberus/cerberus.vkts"
 
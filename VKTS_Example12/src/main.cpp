@@ -107,6 +107,19 @@ int main(int argc, char* argv[])
 
 	vkts::logSetLevel(VKTS_LOG_INFO);
 
+	//
+	// Set task executors, so the image data is pre-filtered in parallel during the scene load.
+	//
+
+	if (!vkts::engineSetTaskExecutorCount(vkts::processorGetNumber()))
+	{
+		vkts::logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Could not set task executors.");
+
+		terminateApp();
+
+		return -1;
+	}
+
 	//
 
 	if (!vkts::profileInit())
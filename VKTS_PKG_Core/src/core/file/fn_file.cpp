@@ -27,6 +27,8 @@
 #include <vkts/core/vkts_core.hpp>
 
 #include "../binary_buffer/BinaryBuffer.hpp"
+#include "../binary_buffer/MappedBinaryBuffer.hpp"
+#include "../text_buffer/MappedTextBuffer.hpp"
 #include "../text_buffer/TextBuffer.hpp"
 
 #include "fn_file_internal.hpp"
@@ -106,7 +108,8 @@ IBinaryBufferSP VKTS_APIENTRY fileLoadBinary(const char* filename)
 
 ITextBufferSP VKTS_APIENTRY fileLoadText(const char* filename)
 {
-    auto buffer = fileLoadBinary(filename);
+    // Copy only once from the mapped file into the text.
+    auto buffer = fileMapBinary(filename);
 
     if (!buffer.get())
     {
@@ -124,6 +127,37 @@ ITextBufferSP VKTS_APIENTRY fileLoadText(const char* filename)
     return ITextBufferSP(new TextBuffer(text));
 }
 
+IBinaryBufferSP VKTS_APIENTRY fileMapBinary(const char* filename)
+{
+    // No lock, as mapping and reading a file does not change any shared state.
+
+    uint32_t size = 0;
+
+    auto memory = _fileMap(filename, size, VK_FALSE);
+
+    if (memory.get())
+    {
+        return IBinaryBufferSP(new MappedBinaryBuffer(memory, size));
+    }
+
+    return _fileLoadBinary(filename);
+}
+
+ITextBufferSP VKTS_APIENTRY fileMapText(const char* filename)
+{
+    uint32_t length = 0;
+
+    auto memory = _fileMap(filename, length, VK_TRUE);
+
+    if (memory.get())
+    {
+        return ITextBufferSP(new MappedTextBuffer(memory, length));
+    }
+
+    // Zero termination not possible, so the text is copied.
+    return fileLoadText(filename);
+}
+
 VkBool32 VKTS_APIENTRY fileSaveBinary(const char* filename, const IBinaryBufferSP& buffer)
 {
     if (!buffer.get())
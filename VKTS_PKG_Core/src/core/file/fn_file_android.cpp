@@ -101,6 +101,41 @@ IBinaryBufferSP VKTS_APIENTRY _fileLoadBinary(const char* filename)
 	return buffer;
 }
 
+std::shared_ptr<const uint8_t> VKTS_APIENTRY _fileMap(const char* filename, uint32_t& size, const VkBool32 terminate)
+{
+	// Assets are not zero terminated, so text is read.
+    if (!filename || terminate)
+    {
+        return std::shared_ptr<const uint8_t>();
+    }
+
+    if (!::g_app || !::g_app->activity->assetManager)
+	{
+		return std::shared_ptr<const uint8_t>();
+	}
+
+    AAsset* sourceAsset = AAssetManager_open(::g_app->activity->assetManager, filename, AASSET_MODE_BUFFER);
+
+    if (!sourceAsset)
+    {
+		return std::shared_ptr<const uint8_t>();
+    }
+
+    const uint8_t* data = (const uint8_t*)AAsset_getBuffer(sourceAsset);
+
+    if (!data || AAsset_getLength(sourceAsset) <= 0)
+    {
+    	AAsset_close(sourceAsset);
+
+		return std::shared_ptr<const uint8_t>();
+    }
+
+	size = (uint32_t)AAsset_getLength(sourceAsset);
+
+	// The asset buffer stays valid, until the asset is closed.
+	return std::shared_ptr<const uint8_t>(data, [sourceAsset](const uint8_t* data) { AAsset_close(sourceAsset); });
+}
+
 VkBool32 VKTS_APIENTRY _filePrepareSaveBinary(const char* filename)
 {
 	if (!::g_app)
@@ -36,6 +36,13 @@ VKTS_APICALL VkBool32 VKTS_APIENTRY _fileInit();
 
 VKTS_APICALL IBinaryBufferSP VKTS_APIENTRY _fileLoadBinary(const char* filename);
 
+/**
+ * Maps the whole file read only into memory and returns the start of the mapping.
+ * If terminate is set, a zero byte follows the last byte of the file.
+ * Returns an empty pointer, if the platform can not map the file. Then, the file has to be read.
+ */
+VKTS_APICALL std::shared_ptr<const uint8_t> VKTS_APIENTRY _fileMap(const char* filename, uint32_t& size, const VkBool32 terminate);
+
 VKTS_APICALL void VKTS_APIENTRY _fileSetBaseDirectory(const char* directory);
 
 VKTS_APICALL const char* VKTS_APIENTRY _fileGetBaseDirectory();
@@ -28,11 +28,83 @@
 
 #include "fn_file_internal.hpp"
 
+#include <fcntl.h>
+#include <sys/mman.h>
 #include <sys/stat.h>
+#include <unistd.h>
 
 namespace vkts
 {
 
+std::shared_ptr<const uint8_t> VKTS_APIENTRY _fileMap(const char* filename, uint32_t& size, const VkBool32 terminate)
+{
+    if (!filename)
+    {
+        return std::shared_ptr<const uint8_t>();
+    }
+
+    std::string loadFilename = _fileGetBaseDirectory() + std::string(filename);
+
+    int fileDescriptor = open(loadFilename.c_str(), O_RDONLY);
+
+    if (fileDescriptor < 0)
+    {
+        return std::shared_ptr<const uint8_t>();
+    }
+
+    struct stat sb;
+
+    if (fstat(fileDescriptor, &sb) != 0 || !S_ISREG(sb.st_mode) || sb.st_size <= 0 || static_cast<uint64_t>(sb.st_size) > static_cast<uint64_t>(UINT32_MAX))
+    {
+        close(fileDescriptor);
+
+        return std::shared_ptr<const uint8_t>();
+    }
+
+    const size_t fileSize = static_cast<size_t>(sb.st_size);
+
+    const size_t pageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+
+    // The rest of the last page behind the end of the file is filled with zeros.
+    // Only if the file ends exactly on a page boundary, a zero page has to be placed behind it.
+    size_t mappedSize = fileSize;
+
+    void* address = nullptr;
+
+    if (terminate && (fileSize % pageSize) == 0)
+    {
+        mappedSize = fileSize + pageSize;
+
+        address = mmap(nullptr, mappedSize, PROT_READ, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+
+        if (address != MAP_FAILED)
+        {
+            if (mmap(address, fileSize, PROT_READ, MAP_PRIVATE | MAP_FIXED, fileDescriptor, 0) == MAP_FAILED)
+            {
+                munmap(address, mappedSize);
+
+                address = MAP_FAILED;
+            }
+        }
+    }
+    else
+    {
+        address = mmap(nullptr, mappedSize, PROT_READ, MAP_PRIVATE, fileDescriptor, 0);
+    }
+
+    // The mapping stays valid after closing the file.
+    close(fileDescriptor);
+
+    if (address == MAP_FAILED)
+    {
+        return std::shared_ptr<const uint8_t>();
+    }
+
+    size = static_cast<uint32_t>(fileSize);
+
+    return std::shared_ptr<const uint8_t>(static_cast<const uint8_t*>(address), [mappedSize](const uint8_t* data) { munmap(const_cast<uint8_t*>(data), mappedSize); });
+}
+
 VkBool32 VKTS_APIENTRY _fileCreateDirectory(const char* directory)
 {
 	if (!directory)
@@ -31,6 +31,13 @@
 namespace vkts
 {
 
+std::shared_ptr<const uint8_t> VKTS_APIENTRY _fileMap(const char* /*filename*/, uint32_t& /*size*/, const VkBool32 /*terminate*/)
+{
+	// Not mapped for now, so the file is read.
+
+	return std::shared_ptr<const uint8_t>();
+}
+
 VkBool32 VKTS_APIENTRY _fileCreateDirectory(const char* directory)
 {
 	if (!directory)
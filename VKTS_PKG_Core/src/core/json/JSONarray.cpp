@@ -26,56 +26,115 @@
 
 #include <vkts/core/vkts_core.hpp>
 
+#include "JsonDecoder.hpp"
+
 namespace vkts
 {
 
-JSONarray::JSONarray() :
-	JSONvalue(), allValues()
+void JSONarray::decodeLazy() const
 {
+	if (!lazy)
+	{
+		return;
+	}
+
+	lazy = VK_FALSE;
+
+	JsonDecoder decoder(document);
+
+	if (!decoder.decodeLazyElements(lazyBegin, lazyEnd, *this))
+	{
+		logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Could not decode array at %u", lazyBegin);
+	}
 }
 
-JSONarray::~JSONarray()
+void JSONarray::setValues(JSONvalue* const* values, const uint32_t count) const
 {
+	allValues = static_cast<JSONvalue**>(document->allocate(sizeof(JSONvalue*) * count));
+	valueCount = count;
+	valueCapacity = count;
+
+	if (count > 0)
+	{
+		memcpy(allValues, values, sizeof(JSONvalue*) * count);
+	}
 }
 
-void JSONarray::addValue(const JSONvalueSP& value)
+JSONarray::JSONarray(JsonDocument* document) :
+	JSONvalue(), document(document), allValues(nullptr), valueCount(0), valueCapacity(0), lazy(VK_FALSE), lazyBegin(0), lazyEnd(0)
 {
-	allValues.append(value);
 }
 
-JSONvalueSP JSONarray::getValueAt(int32_t index) const
+JSONarray::JSONarray(JsonDocument* document, const uint32_t lazyBegin, const uint32_t lazyEnd) :
+	JSONvalue(), document(document), allValues(nullptr), valueCount(0), valueCapacity(0), lazy(VK_TRUE), lazyBegin(lazyBegin), lazyEnd(lazyEnd)
 {
-	return allValues[index];
 }
 
-const SmartPointerVector<JSONvalueSP>& JSONarray::getAllValues() const
+JSONarray::~JSONarray()
+{
+}
+
+void JSONarray::addValue(JSONvalue* value)
+{
+	decodeLazy();
+
+	if (valueCount == valueCapacity)
+	{
+		// Previous values stay in the document until it is released.
+
+		const uint32_t newValueCapacity = glm::max(valueCapacity * 2, 4u);
+
+		JSONvalue** newAllValues = static_cast<JSONvalue**>(document->allocate(sizeof(JSONvalue*) * newValueCapacity));
+
+		if (valueCount > 0)
+		{
+			memcpy(newAllValues, allValues, sizeof(JSONvalue*) * valueCount);
+		}
+
+		allValues = newAllValues;
+		valueCapacity = newValueCapacity;
+	}
+
+	allValues[valueCount] = value;
+
+	valueCount++;
+}
+
+JSONvalue* JSONarray::getValueAt(int32_t index) const
 {
-	return allValues;
+	decodeLazy();
+
+	if (index < 0 || (uint32_t)index >= valueCount)
+	{
+		return nullptr;
+	}
+
+	return allValues[index];
 }
 
 uint32_t JSONarray::size() const
 {
-	return allValues.size();
+	decodeLazy();
+
+	return valueCount;
 }
 
 VkBool32 JSONarray::encode(std::string& jsonText, int32_t& spaces) const
 {
 	jsonText += JSON_left_square_bracket;
 
-	const auto& allValues = getAllValues();
-
-	if (allValues.size() > 0)
+	if (size() > 0)
 	{
 		doLineFeed(jsonText, spaces, 1);
 
-		for (uint32_t i = 0; i < allValues.size(); i++)
+		for (uint32_t i = 0; i < valueCount; i++)
 		{
 			if (!allValues[i]->encode(jsonText, spaces))
 			{
 				return VK_FALSE;
 			}
 
-			if (i + 1 < allValues.size())
+			if (i + 1 < valueCount)
 			{
 				jsonText += JSON_comma;
 
@@ -26,11 +26,139 @@
 
 #include <vkts/core/vkts_core.hpp>
 
+#include "JsonDecoder.hpp"
+
 namespace vkts
 {
 
-JSONobject::JSONobject() :
-	JSONvalue(), allKeyValues()
+void JSONobject::decodeLazy() const
+{
+	if (!lazy)
+	{
+		return;
+	}
+
+	lazy = VK_FALSE;
+
+	JsonDecoder decoder(document);
+
+	if (!decoder.decodeLazyMembers(lazyBegin, lazyEnd, *this))
+	{
+		logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Could not decode object at %u", lazyBegin);
+	}
+}
+
+void JSONobject::insertSlot(const uint32_t index) const
+{
+	uint32_t slot = hashString(allMembers[index].key, allMembers[index].keyLength) & slotMask;
+
+	while (allSlots[slot] != VKTS_HASH_MAP_EMPTY_SLOT)
+	{
+		slot = (slot + 1) & slotMask;
+	}
+
+	allSlots[slot] = index;
+}
+
+void JSONobject::createSlots(const uint32_t count) const
+{
+	// Load factor is kept below 0.5.
+
+	uint32_t slotCount = VKTS_HASH_MAP_MIN_SLOTS;
+
+	while (slotCount < count * 2)
+	{
+		slotCount *= 2;
+	}
+
+	allSlots = static_cast<uint32_t*>(document->allocate(sizeof(uint32_t) * slotCount));
+	slotMask = slotCount - 1;
+
+	memset(allSlots, 0xFF, sizeof(uint32_t) * slotCount);
+
+	for (uint32_t i = 0; i < memberCount; i++)
+	{
+		insertSlot(i);
+	}
+}
+
+uint32_t JSONobject::findMember(const char* key, const uint32_t keyLength) const
+{
+	if (allSlots)
+	{
+		uint32_t slot = hashString(key, keyLength) & slotMask;
+
+		while (allSlots[slot] != VKTS_HASH_MAP_EMPTY_SLOT)
+		{
+			const JsonMember& member = allMembers[allSlots[slot]];
+
+			if (member.keyLength == keyLength && memcmp(member.key, key, keyLength) == 0)
+			{
+				return allSlots[slot];
+			}
+
+			slot = (slot + 1) & slotMask;
+		}
+
+		return VKTS_HASH_MAP_EMPTY_SLOT;
+	}
+
+	for (uint32_t i = 0; i < memberCount; i++)
+	{
+		if (allMembers[i].keyLength == keyLength && memcmp(allMembers[i].key, key, keyLength) == 0)
+		{
+			return i;
+		}
+	}
+
+	return VKTS_HASH_MAP_EMPTY_SLOT;
+}
+
+void JSONobject::setMembers(const JsonMember* members, const uint32_t count) const
+{
+	allMembers = static_cast<JsonMember*>(document->allocate(sizeof(JsonMember) * count));
+	memberCount = 0;
+	memberCapacity = count;
+
+	allSlots = nullptr;
+	slotMask = 0;
+
+	if (count > VKTS_JSON_OBJECT_LINEAR_MEMBERS)
+	{
+		createSlots(count);
+	}
+
+	for (uint32_t i = 0; i < count; i++)
+	{
+		// Same as adding: A duplicate key keeps its position, but the last value is used.
+
+		const uint32_t index = findMember(members[i].key, members[i].keyLength);
+
+		if (index != VKTS_HASH_MAP_EMPTY_SLOT)
+		{
+			allMembers[index].value = members[i].value;
+
+			continue;
+		}
+
+		allMembers[memberCount] = members[i];
+
+		if (allSlots)
+		{
+			insertSlot(memberCount);
+		}
+
+		memberCount++;
+	}
+}
+
+JSONobject::JSONobject(JsonDocument* document) :
+	JSONvalue(), document(document), allMembers(nullptr), memberCount(0), memberCapacity(0), allSlots(nullptr), slotMask(0), lazy(VK_FALSE), lazyBegin(0), lazyEnd(0)
+{
+}
+
+JSONobject::JSONobject(JsonDocument* document, const uint32_t lazyBegin, const uint32_t lazyEnd) :
+	JSONvalue(), document(document), allMembers(nullptr), memberCount(0), memberCapacity(0), allSlots(nullptr), slotMask(0), lazy(VK_TRUE), lazyBegin(lazyBegin), lazyEnd(lazyEnd)
 {
 }
 
@@ -38,51 +166,105 @@ JSONobject::~JSONobject()
 {
 }
 
-void JSONobject::addKeyValue(const std::string& key, const JSONvalueSP& value)
+void JSONobject::addKeyValue(const std::string& key, JSONvalue* value)
 {
-	allKeyValues[key] = value;
+	decodeLazy();
+
+	const uint32_t index = findMember(key.c_str(), (uint32_t)key.length());
+
+	if (index != VKTS_HASH_MAP_EMPTY_SLOT)
+	{
+		allMembers[index].value = value;
+
+		return;
+	}
+
+	if (memberCount == memberCapacity)
+	{
+		// Previous members stay in the document until it is released.
+
+		const uint32_t newMemberCapacity = glm::max(memberCapacity * 2, 4u);
+
+		JsonMember* newAllMembers = static_cast<JsonMember*>(document->allocate(sizeof(JsonMember) * newMemberCapacity));
+
+		if (memberCount > 0)
+		{
+			memcpy(newAllMembers, allMembers, sizeof(JsonMember) * memberCount);
+		}
+
+		allMembers = newAllMembers;
+		memberCapacity = newMemberCapacity;
+	}
+
+	allMembers[memberCount].key = document->allocateCharacters(key.c_str(), key.length());
+	allMembers[memberCount].keyLength = (uint32_t)key.length();
+	allMembers[memberCount].value = value;
+
+	memberCount++;
+
+	if (allSlots && memberCount * 2 <= slotMask + 1)
+	{
+		insertSlot(memberCount - 1);
+	}
+	else if (memberCount > VKTS_JSON_OBJECT_LINEAR_MEMBERS)
+	{
+		createSlots(memberCount);
+	}
 }
 
 VkBool32 JSONobject::hasKey(const std::string& key) const
 {
-	return allKeyValues.contains(key);
+	decodeLazy();
+
+	return findMember(key.c_str(), (uint32_t)key.length()) != VKTS_HASH_MAP_EMPTY_SLOT;
 }
 
-JSONvalueSP JSONobject::getValue(const std::string& key) const
+JSONvalue* JSONobject::getValue(const std::string& key) const
 {
-	return allKeyValues[key];
+	decodeLazy();
+
+	const uint32_t index = findMember(key.c_str(), (uint32_t)key.length());
+
+	if (index == VKTS_HASH_MAP_EMPTY_SLOT)
+	{
+		return nullptr;
+	}
+
+	return allMembers[index].value;
 }
 
-const SmartPointerMap<std::string, JSONvalueSP>& JSONobject::getAllKeyValues() const
+std::string JSONobject::getKeyAt(const uint32_t index) const
 {
-	return allKeyValues;
+	decodeLazy();
+
+	return std::string(allMembers[index].key, allMembers[index].keyLength);
 }
 
-const Vector<std::string>& JSONobject::getAllKeys() const
+JSONvalue* JSONobject::getValueAt(const uint32_t index) const
 {
-	return allKeyValues.keys();
+	decodeLazy();
+
+	return allMembers[index].value;
 }
 
 uint32_t JSONobject::size() const
 {
-	return allKeyValues.size();
+	decodeLazy();
+
+	return memberCount;
 }
 
 VkBool32 JSONobject::encode(std::string& jsonText, int32_t& spaces) const
 {
 	jsonText += JSON_left_curly_bracket;
 
-	const auto& allKeys = getAllKeys();
-
-	if (allKeys.size() > 0)
+	if (size() > 0)
 	{
 		doLineFeed(jsonText, spaces, 1);
 
-		for (uint32_t key = 0; key < allKeys.size(); key++)
+		for (uint32_t i = 0; i < memberCount; i++)
 		{
-			JSONstring tempJSONstring(allKeys[key]);
-
-			if (!tempJSONstring.encode(jsonText, spaces))
+			if (!JSONstring::encodeCharacters(jsonText, allMembers[i].key, allMembers[i].keyLength))
 			{
 				return VK_FALSE;
 			}
@@ -91,12 +273,12 @@ VkBool32 JSONobject::encode(std::string& jsonText, int32_t& spaces) const
 			jsonText += JSON_colon;
 			jsonText += JSON_space;
 
-			if (!getValue(allKeys[key])->encode(jsonText, spaces))
+			if (!allMembers[i].value->encode(jsonText, spaces))
 			{
 				return VK_FALSE;
 			}
 
-			if (key + 1 < allKeys.size())
+			if (i + 1 < memberCount)
 			{
 				jsonText += JSON_comma;
 
@@ -29,36 +29,37 @@
 namespace vkts
 {
 
-JSONstring::JSONstring() :
-	JSONvalue(), value("")
+JSONstring::JSONstring(const char* characters, const uint32_t length) :
+	JSONvalue(), characters(characters), length(length)
 {
 }
 
-JSONstring::JSONstring(const std::string& value) : JSONvalue(), value(value)
+JSONstring::~JSONstring()
 {
 }
 
-JSONstring::~JSONstring()
+std::string JSONstring::getValue() const
 {
+	return std::string(characters, length);
 }
 
-const std::string& JSONstring::getValue() const
+const char* JSONstring::getCharacters() const
 {
-	return value;
+	return characters;
 }
 
-void JSONstring::setValue(const std::string& value)
+uint32_t JSONstring::getLength() const
 {
-	this->value = value;
+	return length;
 }
 
-VkBool32 JSONstring::encode(std::string& jsonText, int32_t& spaces) const
+VkBool32 JSONstring::encodeCharacters(std::string& jsonText, const char* characters, const uint32_t length)
 {
 	jsonText += JSON_quotation_mark;
 
-	for (uint32_t i = 0; i < getValue().length(); i++)
+	for (uint32_t i = 0; i < length; i++)
 	{
-		char c = getValue()[i];
+		char c = characters[i];
 
 		if (c == JSON_quotation_mark[0])
 		{
@@ -102,7 +103,7 @@ VkBool32 JSONstring::encode(std::string& jsonText, int32_t& spaces) const
 		}
 		else
 		{
-			jsonText += getValue().substr(i, 1);
+			jsonText += c;
 		}
 	}
 
@@ -111,6 +112,11 @@ VkBool32 JSONstring::encode(std::string& jsonText, int32_t& spaces) const
 	return VK_TRUE;
 }
 
+VkBool32 JSONstring::encode(std::string& jsonText, int32_t& spaces) const
+{
+	return encodeCharacters(jsonText, characters, length);
+}
+
 void JSONstring::visit(JsonVisitor& jsonVisitor)
 {
 	jsonVisitor.visit(*this);
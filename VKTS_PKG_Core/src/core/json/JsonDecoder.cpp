@@ -28,109 +28,104 @@
 
 #include "JsonDecoder.hpp"
 
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define VKTS_JSON_SSE2
+#include <emmintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+#endif
+
 namespace vkts
 {
 
-JsonDecoder::JsonDecoder() :
-	jsonText("")
+static inline VkBool32 jsonIsWhitespace(const char c)
 {
+	return c == ' ' || c == '\n' || c == '\r' || c == '\t';
 }
 
-JsonDecoder::~JsonDecoder()
+static inline VkBool32 jsonIsDigit(const char c)
 {
+	return c >= '0' && c <= '9';
 }
 
-//
+#ifdef VKTS_JSON_SSE2
 
-VkBool32 JsonDecoder::match(const std::string& token, uint32_t& index)
+static inline uint32_t jsonFirstBit(const uint32_t mask)
 {
-	uint32_t length = (uint32_t)token.length();
-
-	if ((uint32_t)jsonText.length() < index + length)
-	{
-		return VK_FALSE;
-	}
-
-	if (jsonText.substr(index, length).compare(token) == 0)
-	{
-		index += length;
+#if defined(_MSC_VER)
+	unsigned long index;
 
-		return VK_TRUE;
-	}
+	_BitScanForward(&index, mask);
 
-	return VK_FALSE;
+	return (uint32_t)index;
+#else
+	return (uint32_t)__builtin_ctz(mask);
+#endif
 }
 
-//
+#endif
 
-VkBool32 JsonDecoder::decodeWhitespace(uint32_t& index)
+JsonDecoder::JsonDecoder(JsonDocument* document) :
+	document(document), jsonBegin(nullptr), jsonEnd(nullptr), lazy(VK_FALSE), allMemberEntries(), allValueEntries(), escapedCharacters()
 {
-	return match(JSON_Encode_character_tabulation, index) || match(JSON_Encode_line_feed, index) ||match(JSON_Encode_carriage_return, index) || match(JSON_space, index);
 }
 
-//
-
-VkBool32 JsonDecoder::decodeLeftSquareBracket(uint32_t& index)
+JsonDecoder::~JsonDecoder()
 {
-	return match(JSON_left_square_bracket, index);
 }
 
-VkBool32 JsonDecoder::decodeLeftCurlyBracket(uint32_t& index)
-{
-	return match(JSON_left_curly_bracket, index);
-}
+//
 
-VkBool32 JsonDecoder::decodeRightSquareBracket(uint32_t& index)
+void JsonDecoder::decodeWhitespace(const char*& current) const
 {
-	return match(JSON_right_square_bracket, index);
-}
+	// Most of the time, there is no or only one whitespace.
+	if (current < jsonEnd && !jsonIsWhitespace(*current))
+	{
+		return;
+	}
 
-VkBool32 JsonDecoder::decodeRightCurlyBracket(uint32_t& index)
-{
-	return match(JSON_right_curly_bracket, index);
-}
+#ifdef VKTS_JSON_SSE2
+	const __m128i space = _mm_set1_epi8(' ');
+	const __m128i lineFeed = _mm_set1_epi8('\n');
+	const __m128i carriageReturn = _mm_set1_epi8('\r');
+	const __m128i characterTabulation = _mm_set1_epi8('\t');
 
-VkBool32 JsonDecoder::decodeColon(uint32_t& index)
-{
-	return match(JSON_colon, index);
-}
+	while (jsonEnd - current >= 16)
+	{
+		const __m128i characters = _mm_loadu_si128((const __m128i*)current);
 
-VkBool32 JsonDecoder::decodeComma(uint32_t& index)
-{
-	return match(JSON_comma, index);
-}
+		const __m128i whitespace = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(characters, space), _mm_cmpeq_epi8(characters, lineFeed)), _mm_or_si128(_mm_cmpeq_epi8(characters, carriageReturn), _mm_cmpeq_epi8(characters, characterTabulation)));
 
-//
+		const uint32_t mask = ~(uint32_t)_mm_movemask_epi8(whitespace) & 0xFFFF;
 
-VkBool32 JsonDecoder::decodePlus(uint32_t& index, std::string& characters)
-{
-	if (match(JSON_plus, index))
-	{
-		characters += JSON_plus;
+		if (mask)
+		{
+			current += jsonFirstBit(mask);
 
-		return VK_TRUE;
+			return;
+		}
+
+		current += 16;
 	}
+#endif
 
-	return VK_FALSE;
+	while (current < jsonEnd && jsonIsWhitespace(*current))
+	{
+		current++;
+	}
 }
 
-VkBool32 JsonDecoder::decodeMinus(uint32_t& index, std::string& characters)
+VkBool32 JsonDecoder::match(const char* token, const size_t length, const char*& current) const
 {
-	if (match(JSON_minus, index))
+	if ((size_t)(jsonEnd - current) < length)
 	{
-		characters += JSON_minus;
-
-		return VK_TRUE;
+		return VK_FALSE;
 	}
 
-	return VK_FALSE;
-}
-
-VkBool32 JsonDecoder::decodePoint(uint32_t& index, std::string& characters)
-{
-	if (match(JSON_point, index))
+	if (memcmp(current, token, length) == 0)
 	{
-		characters += JSON_point;
+		current += length;
 
 		return VK_TRUE;
 	}
@@ -138,379 +133,558 @@ VkBool32 JsonDecoder::decodePoint(uint32_t& index, std::string& characters)
 	return VK_FALSE;
 }
 
-//
-
-VkBool32 JsonDecoder::decodeHexadecimalDigit(uint32_t& index, std::string& characters, int32_t& value)
+const char* JsonDecoder::findQuotationMarkOrReverseSolidus(const char* current) const
 {
-	if (match(JSON_A, index) || match(JSON_B, index) || match(JSON_C, index) || match(JSON_D, index) || match(JSON_E, index) || match(JSON_F, index))
+#ifdef VKTS_JSON_SSE2
+	const __m128i quotationMark = _mm_set1_epi8('"');
+	const __m128i reverseSolidus = _mm_set1_epi8('\\');
+
+	while (jsonEnd - current >= 16)
 	{
-		characters += jsonText.substr(index - 1, 1);
+		const __m128i characters = _mm_loadu_si128((const __m128i*)current);
 
-		value = static_cast<int32_t>(jsonText.substr(index - 1, 1)[0] - JSON_A[0]);
+		const uint32_t mask = (uint32_t)_mm_movemask_epi8(_mm_or_si128(_mm_cmpeq_epi8(characters, quotationMark), _mm_cmpeq_epi8(characters, reverseSolidus)));
 
-		return VK_TRUE;
-	}
-	if (match(JSON_a, index) || match(JSON_b, index) || match(JSON_c, index) || match(JSON_d, index) || match(JSON_e, index) || match(JSON_f, index))
-	{
-		characters += jsonText.substr(index - 1, 1);
+		if (mask)
+		{
+			return current + jsonFirstBit(mask);
+		}
 
-		value = static_cast<int32_t>(jsonText.substr(index - 1, 1)[0] - JSON_a[0]);
+		current += 16;
+	}
+#endif
 
-		return VK_TRUE;
+	while (current < jsonEnd && *current != '"' && *current != '\\')
+	{
+		current++;
 	}
 
-	return VK_FALSE;
+	return current;
 }
 
-//
-
-VkBool32 JsonDecoder::decodeDigit_0(uint32_t& index, std::string& characters, int32_t& value)
+const char* JsonDecoder::findStructuralOrQuotationMark(const char* current) const
 {
-	if (match(JSON_0, index))
+#ifdef VKTS_JSON_SSE2
+	// Setting bit 5 maps '[' to '{' and ']' to '}'.
+	const __m128i bit5 = _mm_set1_epi8(0x20);
+	const __m128i leftCurlyBracket = _mm_set1_epi8('{');
+	const __m128i rightCurlyBracket = _mm_set1_epi8('}');
+	const __m128i quotationMark = _mm_set1_epi8('"');
+
+	while (jsonEnd - current >= 16)
 	{
-		characters += JSON_0;
+		const __m128i characters = _mm_loadu_si128((const __m128i*)current);
 
-		value = 0;
+		const __m128i brackets = _mm_or_si128(characters, bit5);
 
-		return VK_TRUE;
+		const uint32_t mask = (uint32_t)_mm_movemask_epi8(_mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(brackets, leftCurlyBracket), _mm_cmpeq_epi8(brackets, rightCurlyBracket)), _mm_cmpeq_epi8(characters, quotationMark)));
+
+		if (mask)
+		{
+			return current + jsonFirstBit(mask);
+		}
+
+		current += 16;
 	}
+#endif
 
-	return VK_FALSE;
+	while (current < jsonEnd && *current != '"' && *current != '{' && *current != '}' && *current != '[' && *current != ']')
+	{
+		current++;
+	}
+
+	return current;
 }
 
-VkBool32 JsonDecoder::decodeDigit_1_9(uint32_t& index, std::string& characters, int32_t& value)
+VkBool32 JsonDecoder::skipString(const char*& current) const
 {
-	if (match(JSON_1, index) || match(JSON_2, index) || match(JSON_3, index) || match(JSON_4, index) || match(JSON_5, index) || match(JSON_6, index) || match(JSON_7, index) || match(JSON_8, index) || match(JSON_9, index))
+	const char* tempCurrent = current + 1;
+
+	while (VK_TRUE)
 	{
-		characters += jsonText.substr(index - 1, 1);
+		tempCurrent = findQuotationMarkOrReverseSolidus(tempCurrent);
 
-		value = atoi(jsonText.substr(index - 1, 1).c_str());
+		if (tempCurrent == jsonEnd)
+		{
+			return VK_FALSE;
+		}
 
-		return VK_TRUE;
+		if (*tempCurrent == '"')
+		{
+			break;
+		}
+
+		// Skip the escaped character.
+		tempCurrent += 2;
+
+		if (tempCurrent > jsonEnd)
+		{
+			return VK_FALSE;
+		}
 	}
 
-	return VK_FALSE;
-}
+	current = tempCurrent + 1;
 
-VkBool32 JsonDecoder::decodeDigit(uint32_t& index, std::string& characters, int32_t& value)
-{
-	return decodeDigit_0(index, characters, value) || decodeDigit_1_9(index, characters, value);
+	return VK_TRUE;
 }
 
-VkBool32 JsonDecoder::decodeExponent(uint32_t& index, std::string& characters)
+VkBool32 JsonDecoder::skipContainer(const char*& current) const
 {
-	if (match(JSON_e, index) || match(JSON_E, index))
-	{
-		characters += JSON_e;
+	const char* tempCurrent = current;
 
-		return VK_TRUE;
-	}
+	int32_t depth = 0;
 
-	return VK_FALSE;
-}
+	while (VK_TRUE)
+	{
+		tempCurrent = findStructuralOrQuotationMark(tempCurrent);
 
-//
+		if (tempCurrent == jsonEnd)
+		{
+			return VK_FALSE;
+		}
 
-VkBool32 JsonDecoder::decodeQuotationMark(uint32_t& index, std::string& characters)
-{
-	if (match(JSON_quotation_mark, index))
-	{
-		characters += JSON_quotation_mark;
+		if (*tempCurrent == '"')
+		{
+			if (!skipString(tempCurrent))
+			{
+				return VK_FALSE;
+			}
 
-		return VK_TRUE;
-	}
+			continue;
+		}
 
-	return VK_FALSE;
-}
+		if (*tempCurrent == '{' || *tempCurrent == '[')
+		{
+			depth++;
+		}
+		else
+		{
+			depth--;
+		}
 
-VkBool32 JsonDecoder::decodeReverseSolidus(uint32_t& index, std::string& characters)
-{
-	if (match(JSON_reverse_solidus, index))
-	{
-		// Do nothing.
+		tempCurrent++;
 
-		return VK_TRUE;
+		if (depth == 0)
+		{
+			break;
+		}
 	}
 
-	return VK_FALSE;
+	current = tempCurrent;
+
+	return VK_TRUE;
 }
 
-VkBool32 JsonDecoder::decodeSolidus(uint32_t& index, std::string& characters)
+//
+
+VkBool32 JsonDecoder::decodeHexadecimalNumber(const char*& current, uint32_t& value) const
 {
-	if (match(JSON_solidus, index))
+	if (jsonEnd - current < 4)
 	{
-		characters += JSON_solidus;
-
-		return VK_TRUE;
+		return VK_FALSE;
 	}
 
-	return VK_FALSE;
-}
+	value = 0;
 
-VkBool32 JsonDecoder::decodeBackspace(uint32_t& index, std::string& characters)
-{
-	if (match(JSON_Decode_backspace, index))
+	for (uint32_t i = 0; i < 4; i++)
 	{
-		characters += JSON_Encode_backspace;
+		const char c = current[i];
 
-		return VK_TRUE;
+		value *= 16;
+
+		if (jsonIsDigit(c))
+		{
+			value += (uint32_t)(c - '0');
+		}
+		else if (c >= 'A' && c <= 'F')
+		{
+			value += (uint32_t)(c - 'A') + 10;
+		}
+		else if (c >= 'a' && c <= 'f')
+		{
+			value += (uint32_t)(c - 'a') + 10;
+		}
+		else
+		{
+			return VK_FALSE;
+		}
 	}
 
-	return VK_FALSE;
+	current += 4;
+
+	return VK_TRUE;
 }
 
-VkBool32 JsonDecoder::decodeFormFeed(uint32_t& index, std::string& characters)
+VkBool32 JsonDecoder::decodeCharacters(const char*& current, std::string& characters) const
 {
-	if (match(JSON_Decode_form_feed, index))
-	{
-		characters += JSON_Encode_form_feed;
+	const char* tempCurrent = current;
 
-		return VK_TRUE;
+	characters.clear();
+
+	if (tempCurrent == jsonEnd || *tempCurrent != '"')
+	{
+		return VK_FALSE;
 	}
 
-	return VK_FALSE;
-}
+	tempCurrent++;
 
-VkBool32 JsonDecoder::decodeLineFeed(uint32_t& index, std::string& characters)
-{
-	if (match(JSON_Decode_line_feed, index))
+	while (VK_TRUE)
 	{
-		characters += JSON_Encode_line_feed;
+		const char* found = findQuotationMarkOrReverseSolidus(tempCurrent);
 
-		return VK_TRUE;
-	}
+		if (found == jsonEnd)
+		{
+			return VK_FALSE;
+		}
 
-	return VK_FALSE;
-}
+		// Copy everything until the quotation mark or the escape at once.
+		characters.append(tempCurrent, found - tempCurrent);
 
-VkBool32 JsonDecoder::decodeCarriageReturn(uint32_t& index, std::string& characters)
-{
-	if (match(JSON_Decode_carriage_return, index))
-	{
-		characters += JSON_Encode_carriage_return;
+		tempCurrent = found + 1;
 
-		return VK_TRUE;
-	}
+		if (*found == '"')
+		{
+			break;
+		}
 
-	return VK_FALSE;
-}
+		if (tempCurrent == jsonEnd)
+		{
+			return VK_FALSE;
+		}
 
-VkBool32 JsonDecoder::decodeCharacterTabulation(uint32_t& index, std::string& characters)
-{
-	if (match(JSON_Decode_character_tabulation, index))
-	{
-		characters += JSON_Encode_character_tabulation;
+		const char escape = *tempCurrent;
 
-		return VK_TRUE;
+		tempCurrent++;
+
+		switch (escape)
+		{
+			case '"':
+			case '\\':
+			case '/':
+				characters += escape;
+				break;
+			case 'b':
+				characters += '\b';
+				break;
+			case 'f':
+				characters += '\f';
+				break;
+			case 'n':
+				characters += '\n';
+				break;
+			case 'r':
+				characters += '\r';
+				break;
+			case 't':
+				characters += '\t';
+				break;
+			case 'u':
+			{
+				uint32_t codePoint;
+
+				if (!decodeHexadecimalNumber(tempCurrent, codePoint))
+				{
+					return VK_FALSE;
+				}
+
+				// Surrogate pair.
+				if (codePoint >= 0xD800 && codePoint <= 0xDBFF)
+				{
+					uint32_t lowSurrogate;
+
+					if (!match("\\u", 2, tempCurrent) || !decodeHexadecimalNumber(tempCurrent, lowSurrogate) || lowSurrogate < 0xDC00 || lowSurrogate > 0xDFFF)
+					{
+						return VK_FALSE;
+					}
+
+					codePoint = 0x10000 + ((codePoint - 0xD800) << 10) + (lowSurrogate - 0xDC00);
+				}
+
+				// Encode as UTF-8.
+				if (codePoint < 0x80)
+				{
+					characters += (char)codePoint;
+				}
+				else if (codePoint < 0x800)
+				{
+					characters += (char)(0xC0 | (codePoint >> 6));
+					characters += (char)(0x80 | (codePoint & 0x3F));
+				}
+				else if (codePoint < 0x10000)
+				{
+					characters += (char)(0xE0 | (codePoint >> 12));
+					characters += (char)(0x80 | ((codePoint >> 6) & 0x3F));
+					characters += (char)(0x80 | (codePoint & 0x3F));
+				}
+				else
+				{
+					characters += (char)(0xF0 | (codePoint >> 18));
+					characters += (char)(0x80 | ((codePoint >> 12) & 0x3F));
+					characters += (char)(0x80 | ((codePoint >> 6) & 0x3F));
+					characters += (char)(0x80 | (codePoint & 0x3F));
+				}
+			}
+			break;
+			default:
+				return VK_FALSE;
+		}
 	}
 
-	return VK_FALSE;
+	current = tempCurrent;
+
+	return VK_TRUE;
 }
 
-VkBool32 JsonDecoder::decodeHexadecimalNumber(uint32_t& index, std::string& characters)
+VkBool32 JsonDecoder::decodeCharacters(const char*& current, const char*& characters, uint32_t& length)
 {
-	int32_t value = 0;
-	int32_t tempValue = 0;
-
-	uint32_t tempIndex = index;
-
-	if (!match(JSON_u, tempIndex))
+	if (current == jsonEnd || *current != '"')
 	{
 		return VK_FALSE;
 	}
 
-	if (tempIndex + 4 > jsonText.length())
+	const char* found = findQuotationMarkOrReverseSolidus(current + 1);
+
+	if (found == jsonEnd)
 	{
 		return VK_FALSE;
 	}
 
-	while (tempIndex < jsonText.length())
+	// Without escapes, the characters are copied directly.
+	if (*found == '"')
 	{
-		if (!decodeDigit(tempIndex, characters, tempValue) && !decodeHexadecimalDigit(tempIndex, characters, tempValue))
-		{
-			return VK_FALSE;
-		}
+		length = (uint32_t)(found - (current + 1));
+		characters = document->allocateCharacters(current + 1, length);
+
+		current = found + 1;
 
-		value = value * 16 + tempValue;
+		return VK_TRUE;
 	}
 
-	characters += static_cast<char>(value & 0xFF);
+	if (!decodeCharacters(current, escapedCharacters))
+	{
+		return VK_FALSE;
+	}
 
-	index = tempIndex;
+	length = (uint32_t)escapedCharacters.length();
+	characters = document->allocateCharacters(escapedCharacters.c_str(), length);
 
 	return VK_TRUE;
 }
 
 //
 
-VkBool32 JsonDecoder::decodeObject(uint32_t& index, JSONobjectSP& jsonObject)
+VkBool32 JsonDecoder::decodeMembers(const char*& current, const JSONobject& jsonObject)
 {
-	JSONobjectSP tempJsonObject = JSONobjectSP(new JSONobject());
+	const char* tempCurrent = current;
 
-	uint32_t tempIndex = index;
+	const size_t firstMemberEntry = allMemberEntries.size();
 
-	VkBool32 loop = VK_TRUE;
+	decodeWhitespace(tempCurrent);
 
-	while (decodeWhitespace(tempIndex));
-
-	if (!decodeLeftCurlyBracket(tempIndex))
+	if (match("}", 1, tempCurrent))
 	{
-		return VK_FALSE;
-	}
+		jsonObject.setMembers(nullptr, 0);
 
-	while (decodeWhitespace(tempIndex));
+		current = tempCurrent;
 
-	if (decodeRightCurlyBracket(tempIndex))
-	{
-		//
+		return VK_TRUE;
 	}
-	else
+
+	while (VK_TRUE)
 	{
-		while (decodeWhitespace(tempIndex));
+		JsonMember member;
 
-		while (loop)
+		if (!decodeCharacters(tempCurrent, member.key, member.keyLength))
 		{
-			JSONstringSP jsonString;
-			JSONvalueSP jsonValue;
-
-			loop = VK_FALSE;
-
-			if (!decodeString(tempIndex, jsonString))
-			{
-				return VK_FALSE;
-			}
-
-			while (decodeWhitespace(tempIndex));
-
-			if (!decodeColon(tempIndex))
-			{
-				return VK_FALSE;
-			}
+			return VK_FALSE;
+		}
 
-			while (decodeWhitespace(tempIndex));
+		decodeWhitespace(tempCurrent);
 
-			if (!decodeValue(tempIndex, jsonValue))
-			{
-				return VK_FALSE;
-			}
+		if (!match(":", 1, tempCurrent))
+		{
+			return VK_FALSE;
+		}
 
-			tempJsonObject->addKeyValue(jsonString->getValue(), jsonValue);
+		if (!decodeValue(tempCurrent, member.value))
+		{
+			return VK_FALSE;
+		}
 
-			while (decodeWhitespace(tempIndex));
+		allMemberEntries.push_back(member);
 
-			if (decodeComma(tempIndex))
-			{
-				loop = VK_TRUE;
-			}
+		if (match(",", 1, tempCurrent))
+		{
+			decodeWhitespace(tempCurrent);
 
-			while (decodeWhitespace(tempIndex));
+			continue;
 		}
 
-		if (!decodeRightCurlyBracket(tempIndex))
+		if (match("}", 1, tempCurrent))
 		{
-			return VK_FALSE;
+			break;
 		}
+
+		return VK_FALSE;
 	}
 
-	while (decodeWhitespace(tempIndex));
+	jsonObject.setMembers(&allMemberEntries[firstMemberEntry], (uint32_t)(allMemberEntries.size() - firstMemberEntry));
 
-	jsonObject = tempJsonObject;
+	allMemberEntries.resize(firstMemberEntry);
 
-	index = tempIndex;
+	current = tempCurrent;
 
 	return VK_TRUE;
 }
 
-VkBool32 JsonDecoder::decodeArray(uint32_t& index, JSONarraySP& jsonArray)
+VkBool32 JsonDecoder::decodeElements(const char*& current, const JSONarray& jsonArray)
 {
-	JSONarraySP tempJsonArray = JSONarraySP(new JSONarray());
+	const char* tempCurrent = current;
+
+	const size_t firstValueEntry = allValueEntries.size();
 
-	uint32_t tempIndex = index;
+	decodeWhitespace(tempCurrent);
 
-	VkBool32 loop = VK_TRUE;
+	if (match("]", 1, tempCurrent))
+	{
+		jsonArray.setValues(nullptr, 0);
+
+		current = tempCurrent;
 
-	while (decodeWhitespace(tempIndex));
+		return VK_TRUE;
+	}
 
-	if (!decodeLeftSquareBracket(tempIndex))
+	while (VK_TRUE)
 	{
+		JSONvalue* jsonValue;
+
+		if (!decodeValue(tempCurrent, jsonValue))
+		{
+			return VK_FALSE;
+		}
+
+		allValueEntries.push_back(jsonValue);
+
+		if (match(",", 1, tempCurrent))
+		{
+			continue;
+		}
+
+		if (match("]", 1, tempCurrent))
+		{
+			break;
+		}
+
 		return VK_FALSE;
 	}
 
-	while (decodeWhitespace(tempIndex));
+	jsonArray.setValues(&allValueEntries[firstValueEntry], (uint32_t)(allValueEntries.size() - firstValueEntry));
+
+	allValueEntries.resize(firstValueEntry);
 
-	if (decodeRightSquareBracket(tempIndex))
+	current = tempCurrent;
+
+	return VK_TRUE;
+}
+
+VkBool32 JsonDecoder::decodeObject(const char*& current, JSONvalue*& jsonValue)
+{
+	const char* tempCurrent = current;
+
+	if (lazy)
 	{
-		//
+		if (!skipContainer(tempCurrent))
+		{
+			return VK_FALSE;
+		}
+
+		// Content without the curly brackets.
+		jsonValue = document->createLazyObject((uint32_t)(current + 1 - jsonBegin), (uint32_t)(tempCurrent - 1 - jsonBegin));
 	}
 	else
 	{
-		while (decodeWhitespace(tempIndex));
-
-		while (loop)
-		{
-			JSONvalueSP jsonValue;
+		JSONobject* jsonObject = document->createObject();
 
-			loop = VK_FALSE;
+		tempCurrent++;
 
-			if (!decodeValue(tempIndex, jsonValue))
-			{
-				return VK_FALSE;
-			}
+		if (!decodeMembers(tempCurrent, *jsonObject))
+		{
+			return VK_FALSE;
+		}
 
-			tempJsonArray->addValue(jsonValue);
+		jsonValue = jsonObject;
+	}
 
-			while (decodeWhitespace(tempIndex));
+	current = tempCurrent;
 
-			if (decodeComma(tempIndex))
-			{
-				loop = VK_TRUE;
-			}
+	return VK_TRUE;
+}
 
-			while (decodeWhitespace(tempIndex));
-		}
+VkBool32 JsonDecoder::decodeArray(const char*& current, JSONvalue*& jsonValue)
+{
+	const char* tempCurrent = current;
 
-		if (!decodeRightSquareBracket(tempIndex))
+	if (lazy)
+	{
+		if (!skipContainer(tempCurrent))
 		{
 			return VK_FALSE;
 		}
+
+		// Content without the square brackets.
+		jsonValue = document->createLazyArray((uint32_t)(current + 1 - jsonBegin), (uint32_t)(tempCurrent - 1 - jsonBegin));
 	}
+	else
+	{
+		JSONarray* jsonArray = document->createArray();
 
-	while (decodeWhitespace(tempIndex));
+		tempCurrent++;
 
-	jsonArray = tempJsonArray;
+		if (!decodeElements(tempCurrent, *jsonArray))
+		{
+			return VK_FALSE;
+		}
+
+		jsonValue = jsonArray;
+	}
 
-	index = tempIndex;
+	current = tempCurrent;
 
 	return VK_TRUE;
 }
 
-VkBool32 JsonDecoder::decodeNumber(uint32_t& index, JSONnumberSP& jsonNumber)
+VkBool32 JsonDecoder::decodeNumber(const char*& current, JSONvalue*& jsonValue)
 {
-	std::string tempString = "";
-	int32_t dummy;
-
-	uint32_t tempIndex = index;
+	const char* tempCurrent = current;
 
 	VkBool32 isFloat = VK_FALSE;
 
-	while (decodeWhitespace(tempIndex));
+	VkBool32 isNegative = VK_FALSE;
+
+	int64_t integerValue = 0;
 
-	if (decodeMinus(tempIndex, tempString))
+	if (tempCurrent < jsonEnd && *tempCurrent == '-')
 	{
-		//
+		isNegative = VK_TRUE;
+
+		tempCurrent++;
 	}
 
-	if (decodeDigit_0(tempIndex, tempString, dummy))
+	if (tempCurrent < jsonEnd && *tempCurrent == '0')
 	{
-		//
+		tempCurrent++;
 	}
-	else if (decodeDigit_1_9(tempIndex, tempString, dummy))
+	else if (tempCurrent < jsonEnd && jsonIsDigit(*tempCurrent))
 	{
-		VkBool32 loop = VK_TRUE;
-
-		while (loop)
+		while (tempCurrent < jsonEnd && jsonIsDigit(*tempCurrent))
 		{
-			loop = decodeDigit(tempIndex, tempString, dummy);
+			// Out of range values are clamped later on.
+			if (integerValue <= (int64_t)INT32_MAX + 1)
+			{
+				integerValue = integerValue * 10 + (int64_t)(*tempCurrent - '0');
+			}
+
+			tempCurrent++;
 		}
 	}
 	else
@@ -518,241 +692,244 @@ VkBool32 JsonDecoder::decodeNumber(uint32_t& index, JSONnumberSP& jsonNumber)
 		return VK_FALSE;
 	}
 
-	if (decodePoint(tempIndex, tempString))
+	if (tempCurrent < jsonEnd && *tempCurrent == '.')
 	{
 		isFloat = VK_TRUE;
 
-		VkBool32 loop = VK_TRUE;
+		tempCurrent++;
 
-		if (!decodeDigit(tempIndex, tempString, dummy))
+		if (tempCurrent == jsonEnd || !jsonIsDigit(*tempCurrent))
 		{
 			return VK_FALSE;
 		}
 
-		while (loop)
+		while (tempCurrent < jsonEnd && jsonIsDigit(*tempCurrent))
 		{
-			loop = decodeDigit(tempIndex, tempString, dummy);
+			tempCurrent++;
 		}
 	}
 
-	if (decodeExponent(tempIndex, tempString))
+	if (tempCurrent < jsonEnd && (*tempCurrent == 'e' || *tempCurrent == 'E'))
 	{
-		VkBool32 loop = VK_TRUE;
+		isFloat = VK_TRUE;
 
-		if (decodePlus(tempIndex, tempString) || decodeMinus(tempIndex, tempString))
+		tempCurrent++;
+
+		if (tempCurrent < jsonEnd && (*tempCurrent == '+' || *tempCurrent == '-'))
 		{
-			//
+			tempCurrent++;
 		}
 
-		if (!decodeDigit(tempIndex, tempString, dummy))
+		if (tempCurrent == jsonEnd || !jsonIsDigit(*tempCurrent))
 		{
 			return VK_FALSE;
 		}
 
-		while (loop)
+		while (tempCurrent < jsonEnd && jsonIsDigit(*tempCurrent))
 		{
-			loop = decodeDigit(tempIndex, tempString, dummy);
+			tempCurrent++;
 		}
 	}
 
-	while (decodeWhitespace(tempIndex));
-
 	if (isFloat)
 	{
-		jsonNumber = JSONfloatSP(new JSONfloat(tempString));
+		// Text is not null terminated, so the number is copied.
+
+		char buffer[VKTS_MAX_TOKEN_CHARS];
+
+		const size_t length = (size_t)(tempCurrent - current);
+
+		if (length >= VKTS_MAX_TOKEN_CHARS)
+		{
+			return VK_FALSE;
+		}
+
+		memcpy(buffer, current, length);
+		buffer[length] = '\0';
+
+		jsonValue = document->createFloat(static_cast<float>(strtod(buffer, nullptr)));
 	}
 	else
 	{
-		jsonNumber = JSONintegerSP(new JSONinteger(tempString));
+		integerValue = glm::clamp(isNegative ? -integerValue : integerValue, (int64_t)INT32_MIN, (int64_t)INT32_MAX);
+
+		jsonValue = document->createInteger(static_cast<int32_t>(integerValue));
+	}
+
+	current = tempCurrent;
+
+	return VK_TRUE;
+}
+
+VkBool32 JsonDecoder::decodeString(const char*& current, JSONvalue*& jsonValue)
+{
+	const char* characters;
+	uint32_t length;
+
+	if (!decodeCharacters(current, characters, length))
+	{
+		return VK_FALSE;
 	}
 
-	index = tempIndex;
+	jsonValue = new (document->allocate(sizeof(JSONstring))) JSONstring(characters, length);
 
 	return VK_TRUE;
 }
 
-VkBool32 JsonDecoder::decodeString(uint32_t& index, JSONstringSP& jsonString)
+//
+
+VkBool32 JsonDecoder::decodeValue(const char*& current, JSONvalue*& jsonValue)
 {
-	std::string dummyString = "";
-	std::string tempString = "";
+	const char* tempCurrent = current;
 
-	uint32_t tempIndex = index;
+	VkBool32 result = VK_FALSE;
 
-	VkBool32 loop = VK_TRUE;
+	jsonValue = nullptr;
 
-	while (decodeWhitespace(tempIndex));
+	decodeWhitespace(tempCurrent);
 
-	if (!decodeQuotationMark(tempIndex, dummyString))
+	if (tempCurrent == jsonEnd)
 	{
 		return VK_FALSE;
 	}
 
-	while (loop)
+	// First character decides about the type.
+	switch (*tempCurrent)
 	{
-		loop = VK_FALSE;
-
-		if (decodeQuotationMark(tempIndex, dummyString))
-		{
+		case '{':
+			result = decodeObject(tempCurrent, jsonValue);
 			break;
-		}
+		case '[':
+			result = decodeArray(tempCurrent, jsonValue);
+			break;
+		case '"':
+			result = decodeString(tempCurrent, jsonValue);
+			break;
+		case 't':
+			result = match("true", 4, tempCurrent);
 
-		if (decodeReverseSolidus(tempIndex, tempString))
-		{
-			if (decodeQuotationMark(tempIndex, tempString) || decodeReverseSolidus(tempIndex, tempString) || decodeSolidus(tempIndex, tempString) || decodeBackspace(tempIndex, tempString) || decodeSolidus(tempIndex, tempString) || decodeFormFeed(tempIndex, tempString) || decodeLineFeed(tempIndex, tempString) || decodeCarriageReturn(tempIndex, tempString) || decodeCharacterTabulation(tempIndex, tempString) || decodeHexadecimalNumber(tempIndex, tempString))
+			if (result)
 			{
-				loop = VK_TRUE;
+				jsonValue = document->createTrue();
 			}
-			else
+			break;
+		case 'f':
+			result = match("false", 5, tempCurrent);
+
+			if (result)
 			{
-				return VK_FALSE;
+				jsonValue = document->createFalse();
 			}
-		}
-		else
-		{
-			tempString += jsonText.substr(tempIndex, 1);
+			break;
+		case 'n':
+			result = match("null", 4, tempCurrent);
 
-			if (tempIndex + 1 < jsonText.length())
+			if (result)
 			{
-				tempIndex++;
-
-				loop = VK_TRUE;
+				jsonValue = document->createNull();
 			}
-			else
-			{
-				return VK_FALSE;
-			}
-		}
+			break;
+		default:
+			result = decodeNumber(tempCurrent, jsonValue);
+			break;
 	}
 
-	while (decodeWhitespace(tempIndex));
+	if (!result)
+	{
+		return VK_FALSE;
+	}
 
-	jsonString = JSONstringSP(new JSONstring(tempString));
+	decodeWhitespace(tempCurrent);
 
-	index = tempIndex;
+	current = tempCurrent;
 
 	return VK_TRUE;
 }
 
+//
 
-VkBool32 JsonDecoder::decodeTrue(uint32_t& index, JSONtrueSP& jsonTrue)
+JSONvalue* JsonDecoder::decode(const char* jsonText, const size_t length)
 {
-	VkBool32 result;
+	if (!jsonText || !document)
+	{
+		return nullptr;
+	}
 
-	while (decodeWhitespace(index));
+	jsonBegin = jsonText;
+	jsonEnd = jsonText + length;
 
-	result = match(JSON_true, index);
+	lazy = VK_FALSE;
 
-	while (decodeWhitespace(index));
+	const char* current = jsonBegin;
+	JSONvalue* jsonValue;
 
-	if (result)
+	if (!decodeValue(current, jsonValue))
 	{
-		jsonTrue = JSONtrueSP(new JSONtrue());
+		return nullptr;
 	}
 
-	return result;
+	return jsonValue;
 }
 
-VkBool32 JsonDecoder::decodeFalse(uint32_t& index, JSONfalseSP& jsonFalse)
+JSONvalue* JsonDecoder::decodeLazy()
 {
-	VkBool32 result;
+	if (!document)
+	{
+		return nullptr;
+	}
 
-	while (decodeWhitespace(index));
+	jsonBegin = document->getJsonCharacters();
+	jsonEnd = jsonBegin + document->getJsonLength();
 
-	result = match(JSON_false, index);
+	lazy = VK_TRUE;
 
-	while (decodeWhitespace(index));
+	const char* current = jsonBegin;
+	JSONvalue* jsonValue;
 
-	if (result)
+	if (!decodeValue(current, jsonValue))
 	{
-		jsonFalse = JSONfalseSP(new JSONfalse());
+		return nullptr;
 	}
 
-	return result;
+	return jsonValue;
 }
 
-VkBool32 JsonDecoder::decodeNull(uint32_t& index, JSONnullSP& jsonNull)
+VkBool32 JsonDecoder::decodeLazyMembers(const uint32_t begin, const uint32_t end, const JSONobject& jsonObject)
 {
-	VkBool32 result;
-
-	while (decodeWhitespace(index));
-
-	result =  match(JSON_null, index);
-
-	while (decodeWhitespace(index));
-
-	if (result)
+	if (!document || (size_t)end >= document->getJsonLength())
 	{
-		jsonNull = JSONnullSP(new JSONnull());
+		return VK_FALSE;
 	}
 
-	return result;
-}
+	// Range includes the closing curly bracket.
 
-//
+	jsonBegin = document->getJsonCharacters();
+	jsonEnd = jsonBegin + end + 1;
 
-VkBool32 JsonDecoder::decodeValue(uint32_t& index, JSONvalueSP& jsonValue)
-{
-	JSONobjectSP jsonObject;
-	JSONarraySP jsonArray;
-	JSONnumberSP jsonNumber;
-	JSONstringSP jsonString;
-	JSONtrueSP jsonTrue;
-	JSONfalseSP jsonFalse;
-	JSONnullSP jsonNull;
+	lazy = VK_TRUE;
 
-	jsonValue = JSONvalueSP();
+	const char* current = jsonBegin + begin;
 
-	while (decodeWhitespace(index));
+	return decodeMembers(current, jsonObject);
+}
 
-	if (decodeObject(index, jsonObject))
-	{
-		jsonValue = jsonObject;
-	}
-	else if (decodeArray(index, jsonArray))
-	{
-		jsonValue = jsonArray;
-	}
-	else if (decodeNumber(index, jsonNumber))
-	{
-		jsonValue = jsonNumber;
-	}
-	else if (decodeString(index, jsonString))
-	{
-		jsonValue = jsonString;
-	}
-	else if (decodeTrue(index, jsonTrue))
-	{
-		jsonValue = jsonTrue;
-	}
-	else if (decodeFalse(index, jsonFalse))
-	{
-		jsonValue = jsonFalse;
-	}
-	else if (decodeNull(index, jsonNull))
+VkBool32 JsonDecoder::decodeLazyElements(const uint32_t begin, const uint32_t end, const JSONarray& jsonArray)
+{
+	if (!document || (size_t)end >= document->getJsonLength())
 	{
-		jsonValue = jsonNull;
+		return VK_FALSE;
 	}
 
-	while (decodeWhitespace(index));
+	// Range includes the closing square bracket.
 
-	return jsonValue.get() != nullptr;
-}
+	jsonBegin = document->getJsonCharacters();
+	jsonEnd = jsonBegin + end + 1;
 
-//
+	lazy = VK_TRUE;
 
-JSONvalueSP JsonDecoder::decode(const std::string& jsonText)
-{
-	this->jsonText = jsonText;
+	const char* current = jsonBegin + begin;
 
-	uint32_t index = 0;
-	JSONvalueSP jsonValue;
-
-	if (!decodeValue(index, jsonValue))
-	{
-		return JSONvalueSP();
-	}
-
-	return jsonValue;
+	return decodeElements(current, jsonArray);
 }
 
 }
@@ -34,74 +34,82 @@
 namespace vkts
 {
 
+/**
+ * Single pass decoder, working directly on the characters. All values and characters are allocated from the document.
+ *
+ * In lazy mode, objects and arrays are only skipped and keep a reference to the text.
+ * Their content is decoded, when accessed the first time.
+ */
 class JsonDecoder
 {
 
 private:
 
-	std::string jsonText;
+	JsonDocument* document;
 
-	//
+	const char* jsonBegin;
+	const char* jsonEnd;
 
-	VkBool32 match(const std::string& token, uint32_t& index);
+	VkBool32 lazy;
 
-	//
+	// Shared by all nesting levels. Each level uses the entries above the size it started with.
+	std::vector<JsonMember> allMemberEntries;
+	std::vector<JSONvalue*> allValueEntries;
 
-	VkBool32 decodeWhitespace(uint32_t& index);
+	// Only used for characters with escapes.
+	std::string escapedCharacters;
 
 	//
 
-	VkBool32 decodeLeftSquareBracket(uint32_t& index);
-	VkBool32 decodeLeftCurlyBracket(uint32_t& index);
-	VkBool32 decodeRightSquareBracket(uint32_t& index);
-	VkBool32 decodeRightCurlyBracket(uint32_t& index);
-	VkBool32 decodeColon(uint32_t& index);
-	VkBool32 decodeComma(uint32_t& index);
+	void decodeWhitespace(const char*& current) const;
 
-	//
+	VkBool32 match(const char* token, const size_t length, const char*& current) const;
+
+	const char* findQuotationMarkOrReverseSolidus(const char* current) const;
 
-	VkBool32 decodePlus(uint32_t& index, std::string& characters);
-	VkBool32 decodeMinus(uint32_t& index, std::string& characters);
-	VkBool32 decodePoint(uint32_t& index, std::string& characters);
+	const char* findStructuralOrQuotationMark(const char* current) const;
 
-	VkBool32 decodeHexadecimalDigit(uint32_t& index, std::string& characters, int32_t& value);
+	VkBool32 skipString(const char*& current) const;
 
-	VkBool32 decodeDigit_0(uint32_t& index, std::string& characters, int32_t& value);
-	VkBool32 decodeDigit_1_9(uint32_t& index, std::string& characters, int32_t& value);
-	VkBool32 decodeDigit(uint32_t& index, std::string& characters, int32_t& value);
+	VkBool32 skipContainer(const char*& current) const;
 
-	VkBool32 decodeExponent(uint32_t& index, std::string& characters);
+	//
+
+	VkBool32 decodeHexadecimalNumber(const char*& current, uint32_t& value) const;
 
-	VkBool32 decodeQuotationMark(uint32_t& index, std::string& characters);
-	VkBool32 decodeReverseSolidus(uint32_t& index, std::string& characters);
-	VkBool32 decodeSolidus(uint32_t& index, std::string& characters);
-	VkBool32 decodeBackspace(uint32_t& index, std::string& characters);
-	VkBool32 decodeFormFeed(uint32_t& index, std::string& characters);
-	VkBool32 decodeLineFeed(uint32_t& index, std::string& characters);
-	VkBool32 decodeCarriageReturn(uint32_t& index, std::string& characters);
-	VkBool32 decodeCharacterTabulation(uint32_t& index, std::string& characters);
-	VkBool32 decodeHexadecimalNumber(uint32_t& index, std::string& characters);
+	VkBool32 decodeCharacters(const char*& current, std::string& characters) const;
+
+	VkBool32 decodeCharacters(const char*& current, const char*& characters, uint32_t& length);
 
 	//
 
-	VkBool32 decodeObject(uint32_t& index, JSONobjectSP& jsonObject);
-	VkBool32 decodeArray(uint32_t& index, JSONarraySP& jsonArray);
-	VkBool32 decodeNumber(uint32_t& index, JSONnumberSP& jsonNumber);
-	VkBool32 decodeString(uint32_t& index, JSONstringSP& jsonString);
-	VkBool32 decodeTrue(uint32_t& index, JSONtrueSP& jsonTrue);
-	VkBool32 decodeFalse(uint32_t& index, JSONfalseSP& jsonFalse);
-	VkBool32 decodeNull(uint32_t& index, JSONnullSP& jsonNull);
+	VkBool32 decodeMembers(const char*& current, const JSONobject& jsonObject);
+	VkBool32 decodeElements(const char*& current, const JSONarray& jsonArray);
+
+	VkBool32 decodeObject(const char*& current, JSONvalue*& jsonValue);
+	VkBool32 decodeArray(const char*& current, JSONvalue*& jsonValue);
+	VkBool32 decodeNumber(const char*& current, JSONvalue*& jsonValue);
+	VkBool32 decodeString(const char*& current, JSONvalue*& jsonValue);
 
 	//
 
-	VkBool32 decodeValue(uint32_t& index, JSONvalueSP& jsonValue);
+	VkBool32 decodeValue(const char*& current, JSONvalue*& jsonValue);
 
 public:
 
-	JsonDecoder();
+	JsonDecoder(JsonDocument* document);
 	~JsonDecoder();
 
-	JSONvalueSP decode(const std::string& jsonText);
+	JSONvalue* decode(const char* jsonText, const size_t length);
+
+	/**
+	 * Decodes the text of the document.
+	 */
+	JSONvalue* decodeLazy();
+
+	VkBool32 decodeLazyMembers(const uint32_t begin, const uint32_t end, const JSONobject& jsonObject);
+
+	VkBool32 decodeLazyElements(const uint32_t begin, const uint32_t end, const JSONarray& jsonArray);
 
 };
 
@@ -0,0 +1,209 @@
+/**
+ * VKTS - VulKan ToolS.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) since 2014 Norbert Nopper
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <vkts/core/vkts_core.hpp>
+
+namespace vkts
+{
+
+JsonDocument::JsonDocument() :
+	allBlocks(), currentBlock(nullptr), currentBlockOffset(0), currentBlockSize(0), allocatedBytes(0), reservedBytes(0), jsonText(), jsonTextBuffer(), jsonCharacters(""), jsonLength(0), jsonTrue(nullptr), jsonFalse(nullptr), jsonNull(nullptr)
+{
+}
+
+JsonDocument::~JsonDocument()
+{
+	// Values do only have trivial members, so no destructor has to be called.
+
+	for (size_t i = 0; i < allBlocks.size(); i++)
+	{
+		delete[] allBlocks[i];
+	}
+
+	allBlocks.clear();
+}
+
+void* JsonDocument::allocate(const size_t size)
+{
+	const size_t alignedSize = (size + VKTS_JSON_DOCUMENT_ALIGNMENT - 1) & ~((size_t)VKTS_JSON_DOCUMENT_ALIGNMENT - 1);
+
+	allocatedBytes += alignedSize;
+
+	if (!currentBlock || currentBlockOffset + alignedSize > currentBlockSize)
+	{
+		// Large allocations get their own block, so the current one can still be used.
+
+		if (alignedSize > VKTS_JSON_DOCUMENT_BLOCK_SIZE / 4)
+		{
+			uint8_t* block = new uint8_t[alignedSize];
+
+			allBlocks.push_back(block);
+
+			reservedBytes += alignedSize;
+
+			return block;
+		}
+
+		currentBlock = new uint8_t[VKTS_JSON_DOCUMENT_BLOCK_SIZE];
+		currentBlockOffset = 0;
+		currentBlockSize = VKTS_JSON_DOCUMENT_BLOCK_SIZE;
+
+		allBlocks.push_back(currentBlock);
+
+		reservedBytes += VKTS_JSON_DOCUMENT_BLOCK_SIZE;
+	}
+
+	void* memory = currentBlock + currentBlockOffset;
+
+	currentBlockOffset += alignedSize;
+
+	return memory;
+}
+
+const char* JsonDocument::allocateCharacters(const char* characters, const size_t length)
+{
+	char* copy = static_cast<char*>(allocate(length + 1));
+
+	if (length > 0)
+	{
+		memcpy(copy, characters, length);
+	}
+	copy[length] = '\0';
+
+	return copy;
+}
+
+JSONobject* JsonDocument::createObject()
+{
+	return new (allocate(sizeof(JSONobject))) JSONobject(this);
+}
+
+JSONobject* JsonDocument::createLazyObject(const uint32_t lazyBegin, const uint32_t lazyEnd)
+{
+	return new (allocate(sizeof(JSONobject))) JSONobject(this, lazyBegin, lazyEnd);
+}
+
+JSONarray* JsonDocument::createArray()
+{
+	return new (allocate(sizeof(JSONarray))) JSONarray(this);
+}
+
+JSONarray* JsonDocument::createLazyArray(const uint32_t lazyBegin, const uint32_t lazyEnd)
+{
+	return new (allocate(sizeof(JSONarray))) JSONarray(this, lazyBegin, lazyEnd);
+}
+
+JSONstring* JsonDocument::createString(const char* characters, const size_t length)
+{
+	const char* copy = allocateCharacters(characters, length);
+
+	return new (allocate(sizeof(JSONstring))) JSONstring(copy, (uint32_t)length);
+}
+
+JSONstring* JsonDocument::createString(const std::string& value)
+{
+	return createString(value.c_str(), value.length());
+}
+
+JSONinteger* JsonDocument::createInteger(const int32_t value)
+{
+	return new (allocate(sizeof(JSONinteger))) JSONinteger(value);
+}
+
+JSONfloat* JsonDocument::createFloat(const float value)
+{
+	return new (allocate(sizeof(JSONfloat))) JSONfloat(value);
+}
+
+JSONtrue* JsonDocument::createTrue()
+{
+	if (!jsonTrue)
+	{
+		jsonTrue = new (allocate(sizeof(JSONtrue))) JSONtrue();
+	}
+
+	return jsonTrue;
+}
+
+JSONfalse* JsonDocument::createFalse()
+{
+	if (!jsonFalse)
+	{
+		jsonFalse = new (allocate(sizeof(JSONfalse))) JSONfalse();
+	}
+
+	return jsonFalse;
+}
+
+JSONnull* JsonDocument::createNull()
+{
+	if (!jsonNull)
+	{
+		jsonNull = new (allocate(sizeof(JSONnull))) JSONnull();
+	}
+
+	return jsonNull;
+}
+
+const char* JsonDocument::getJsonCharacters() const
+{
+	return jsonCharacters;
+}
+
+size_t JsonDocument::getJsonLength() const
+{
+	return jsonLength;
+}
+
+void JsonDocument::setJsonText(const std::string& jsonText)
+{
+	this->jsonText = jsonText;
+	this->jsonTextBuffer = ITextBufferSP();
+
+	this->jsonCharacters = this->jsonText.c_str();
+	this->jsonLength = this->jsonText.length();
+}
+
+void JsonDocument::setJsonText(const ITextBufferSP& jsonTextBuffer)
+{
+	this->jsonText.clear();
+	this->jsonTextBuffer = jsonTextBuffer;
+
+	this->jsonCharacters = jsonTextBuffer.get() ? jsonTextBuffer->getString() : "";
+	this->jsonLength = jsonTextBuffer.get() ? (size_t)jsonTextBuffer->getLength() : 0;
+}
+
+size_t JsonDocument::getAllocatedBytes() const
+{
+	return allocatedBytes;
+}
+
+size_t JsonDocument::getReservedBytes() const
+{
+	return reservedBytes;
+}
+
+}
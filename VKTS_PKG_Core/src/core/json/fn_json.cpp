@@ -33,9 +33,62 @@ namespace vkts
 
 JSONvalueSP VKTS_APIENTRY jsonDecode(const std::string& jsonText)
 {
-	JsonDecoder decoder;
+	JsonDocumentSP document = JsonDocumentSP(new JsonDocument());
 
-	return decoder.decode(jsonText);
+	JsonDecoder decoder(document.get());
+
+	JSONvalue* jsonValue = decoder.decode(jsonText.c_str(), jsonText.length());
+
+	if (!jsonValue)
+	{
+		return JSONvalueSP();
+	}
+
+	// Shares the ownership of the document, so all values are released at once.
+	return JSONvalueSP(document, jsonValue);
+}
+
+JSONvalueSP VKTS_APIENTRY jsonDecodeLazy(const std::string& jsonText)
+{
+	JsonDocumentSP document = JsonDocumentSP(new JsonDocument());
+
+	// Objects and arrays are decoded from the documents text, when accessed.
+	document->setJsonText(jsonText);
+
+	JsonDecoder decoder(document.get());
+
+	JSONvalue* jsonValue = decoder.decodeLazy();
+
+	if (!jsonValue)
+	{
+		return JSONvalueSP();
+	}
+
+	return JSONvalueSP(document, jsonValue);
+}
+
+JSONvalueSP VKTS_APIENTRY jsonDecodeLazy(const ITextBufferSP& jsonTextBuffer)
+{
+	if (!jsonTextBuffer.get())
+	{
+		return JSONvalueSP();
+	}
+
+	JsonDocumentSP document = JsonDocumentSP(new JsonDocument());
+
+	// Decoding directly from the text buffer, which is e.g. a mapped file.
+	document->setJsonText(jsonTextBuffer);
+
+	JsonDecoder decoder(document.get());
+
+	JSONvalue* jsonValue = decoder.decodeLazy();
+
+	if (!jsonValue)
+	{
+		return JSONvalueSP();
+	}
+
+	return JSONvalueSP(document, jsonValue);
 }
 
 std::string VKTS_APIENTRY jsonEncode(const JSONvalueSP& value)
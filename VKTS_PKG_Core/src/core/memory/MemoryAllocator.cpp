@@ -0,0 +1,459 @@
+/**
+ * VKTS - VulKan ToolS.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) since 2014 Norbert Nopper
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <vkts/core/vkts_core.hpp>
+
+namespace vkts
+{
+
+int32_t MemoryAllocator::createBlock(const uint32_t memoryTypeIndex, const VkDeviceSize size, const VkBool32 linear, const VkBool32 dedicated)
+{
+	VkDeviceSize blockSize = dedicated ? size : allBlockSizes[memoryTypeIndex];
+
+	// If the heap is exhausted, retry with smaller blocks, as long as the resource fits.
+	while (!blockAllocator->allocateBlock(memoryTypeIndex, blockSize, nextBlockId))
+	{
+		if (dedicated || blockSize / 2 < size)
+		{
+			return -1;
+		}
+
+		blockSize /= 2;
+	}
+
+	MemoryBlock memoryBlock;
+
+	memoryBlock.blockId = nextBlockId;
+	memoryBlock.linear = linear;
+	memoryBlock.dedicated = dedicated;
+	memoryBlock.allocator = TlsfAllocatorSP(new TlsfAllocator(blockSize));
+
+	nextBlockId++;
+
+	allBlocks[memoryTypeIndex].push_back(memoryBlock);
+
+	return (int32_t)allBlocks[memoryTypeIndex].size() - 1;
+}
+
+void MemoryAllocator::releaseBlock(const uint32_t memoryTypeIndex, const uint32_t blockIndex)
+{
+	blockAllocator->freeBlock(memoryTypeIndex, allBlocks[memoryTypeIndex][blockIndex].blockId);
+
+	allBlocks[memoryTypeIndex].erase(allBlocks[memoryTypeIndex].begin() + blockIndex);
+}
+
+int32_t MemoryAllocator::findBlock(const uint32_t memoryTypeIndex, const uint32_t blockId) const
+{
+	for (size_t i = 0; i < allBlocks[memoryTypeIndex].size(); i++)
+	{
+		if (allBlocks[memoryTypeIndex][i].blockId == blockId)
+		{
+			return (int32_t)i;
+		}
+	}
+
+	return -1;
+}
+
+VkBool32 MemoryAllocator::allocateInBlocks(VkTsMemoryAllocation& memoryAllocation, uint32_t& blockAllocation, const uint32_t memoryTypeIndex, const VkDeviceSize size, const VkDeviceSize alignment, const VkBool32 linear, const int32_t excludeBlockIndex)
+{
+	for (size_t i = 0; i < allBlocks[memoryTypeIndex].size(); i++)
+	{
+		const auto& currentBlock = allBlocks[memoryTypeIndex][i];
+
+		if ((int32_t)i == excludeBlockIndex || currentBlock.dedicated || currentBlock.linear != linear)
+		{
+			continue;
+		}
+
+		if (currentBlock.allocator->allocate(memoryAllocation.offset, blockAllocation, size, alignment))
+		{
+			memoryAllocation.memoryTypeIndex = memoryTypeIndex;
+			memoryAllocation.blockId = currentBlock.blockId;
+			memoryAllocation.size = size;
+			memoryAllocation.linear = linear;
+			memoryAllocation.dedicated = VK_FALSE;
+
+			return VK_TRUE;
+		}
+	}
+
+	return VK_FALSE;
+}
+
+void MemoryAllocator::freeRecord(const uint32_t allocation)
+{
+	auto& currentRecord = allRecords[allocation];
+
+	const uint32_t memoryTypeIndex = currentRecord.memoryAllocation.memoryTypeIndex;
+
+	const int32_t blockIndex = findBlock(memoryTypeIndex, currentRecord.memoryAllocation.blockId);
+
+	if (blockIndex >= 0)
+	{
+		const auto& currentBlock = allBlocks[memoryTypeIndex][blockIndex];
+
+		currentBlock.allocator->free(currentRecord.blockAllocation);
+
+		if (currentBlock.allocator->isEmpty())
+		{
+			// Keep one empty block per memory type and kind, so allocating and freeing one resource does not allocate a block each time.
+
+			uint32_t sameKindCount = 0;
+
+			for (const auto& otherBlock : allBlocks[memoryTypeIndex])
+			{
+				if (!otherBlock.dedicated && otherBlock.linear == currentBlock.linear)
+				{
+					sameKindCount++;
+				}
+			}
+
+			if (currentBlock.dedicated || sameKindCount > 1)
+			{
+				releaseBlock(memoryTypeIndex, (uint32_t)blockIndex);
+			}
+		}
+	}
+
+	currentRecord.used = VK_FALSE;
+
+	allFreeRecords.push_back(allocation);
+}
+
+MemoryAllocator::MemoryAllocator(const IMemoryBlockAllocatorSP& blockAllocator, const VkPhysicalDeviceMemoryProperties& memoryProperties, const VkDeviceSize bufferImageGranularity, const VkDeviceSize blockSize) :
+	IDestroyable(), blockAllocator(blockAllocator), memoryProperties(memoryProperties), bufferImageGranularity(bufferImageGranularity), allRecords(), allFreeRecords(), nextBlockId(0), mutex()
+{
+	for (uint32_t i = 0; i < VK_MAX_MEMORY_TYPES; i++)
+	{
+		allBlockSizes[i] = 0;
+
+		if (i >= memoryProperties.memoryTypeCount || memoryProperties.memoryTypes[i].heapIndex >= memoryProperties.memoryHeapCount)
+		{
+			continue;
+		}
+
+		const VkDeviceSize heapSize = memoryProperties.memoryHeaps[memoryProperties.memoryTypes[i].heapIndex].size;
+
+		if (blockSize > 0)
+		{
+			allBlockSizes[i] = glm::min(blockSize, heapSize);
+		}
+		else if (heapSize <= VKTS_MEMORY_SMALL_HEAP_SIZE)
+		{
+			allBlockSizes[i] = heapSize / 8;
+		}
+		else
+		{
+			allBlockSizes[i] = VKTS_MEMORY_BLOCK_SIZE;
+		}
+	}
+}
+
+MemoryAllocator::~MemoryAllocator()
+{
+	destroy();
+}
+
+VkBool32 MemoryAllocator::allocate(uint32_t& allocation, const uint32_t memoryTypeIndex, const VkDeviceSize size, const VkDeviceSize alignment, const VkBool32 linear)
+{
+	if (!blockAllocator.get() || memoryTypeIndex >= memoryProperties.memoryTypeCount || allBlockSizes[memoryTypeIndex] == 0 || size == 0)
+	{
+		return VK_FALSE;
+	}
+
+	std::lock_guard<std::mutex> lock(mutex);
+
+	// Without a granularity, linear and non-linear resources can share blocks.
+	const VkBool32 blockLinear = bufferImageGranularity > 1 ? linear : VK_TRUE;
+
+	const VkDeviceSize blockAlignment = glm::max(alignment, (VkDeviceSize)1);
+
+	MemoryRecord memoryRecord;
+
+	memoryRecord.alignment = blockAlignment;
+	memoryRecord.used = VK_TRUE;
+
+	if (size > allBlockSizes[memoryTypeIndex] / 2)
+	{
+		const int32_t blockIndex = createBlock(memoryTypeIndex, size, blockLinear, VK_TRUE);
+
+		if (blockIndex < 0)
+		{
+			return VK_FALSE;
+		}
+
+		const auto& currentBlock = allBlocks[memoryTypeIndex][blockIndex];
+
+		currentBlock.allocator->allocate(memoryRecord.memoryAllocation.offset, memoryRecord.blockAllocation, size, 1);
+
+		memoryRecord.memoryAllocation.memoryTypeIndex = memoryTypeIndex;
+		memoryRecord.memoryAllocation.blockId = currentBlock.blockId;
+		memoryRecord.memoryAllocation.size = size;
+		memoryRecord.memoryAllocation.linear = blockLinear;
+		memoryRecord.memoryAllocation.dedicated = VK_TRUE;
+	}
+	else if (!allocateInBlocks(memoryRecord.memoryAllocation, memoryRecord.blockAllocation, memoryTypeIndex, size, blockAlignment, blockLinear, -1))
+	{
+		const int32_t blockIndex = createBlock(memoryTypeIndex, size, blockLinear, VK_FALSE);
+
+		if (blockIndex < 0 || !allocateInBlocks(memoryRecord.memoryAllocation, memoryRecord.blockAllocation, memoryTypeIndex, size, blockAlignment, blockLinear, -1))
+		{
+			return VK_FALSE;
+		}
+	}
+
+	if (allFreeRecords.size() > 0)
+	{
+		allocation = allFreeRecords.back();
+
+		allFreeRecords.pop_back();
+
+		allRecords[allocation] = memoryRecord;
+	}
+	else
+	{
+		allocation = (uint32_t)allRecords.size();
+
+		allRecords.push_back(memoryRecord);
+	}
+
+	return VK_TRUE;
+}
+
+void MemoryAllocator::free(const uint32_t allocation)
+{
+	std::lock_guard<std::mutex> lock(mutex);
+
+	if (allocation >= (uint32_t)allRecords.size() || !allRecords[allocation].used)
+	{
+		return;
+	}
+
+	freeRecord(allocation);
+}
+
+VkBool32 MemoryAllocator::getAllocation(VkTsMemoryAllocation& memoryAllocation, const uint32_t allocation) const
+{
+	std::lock_guard<std::mutex> lock(mutex);
+
+	if (allocation >= (uint32_t)allRecords.size() || !allRecords[allocation].used)
+	{
+		return VK_FALSE;
+	}
+
+	memoryAllocation = allRecords[allocation].memoryAllocation;
+
+	return VK_TRUE;
+}
+
+uint32_t MemoryAllocator::defragment(const uint32_t memoryTypeIndex, const uint32_t maxMoves, const MemoryMoveFunction& moveFunction)
+{
+	if (memoryTypeIndex >= memoryProperties.memoryTypeCount || maxMoves == 0 || !moveFunction)
+	{
+		return 0;
+	}
+
+	std::lock_guard<std::mutex> lock(mutex);
+
+	// Dedicated blocks can not be merged, so only the least used shared block is emptied.
+
+	int32_t sourceBlockIndex = -1;
+
+	for (size_t i = 0; i < allBlocks[memoryTypeIndex].size(); i++)
+	{
+		const auto& currentBlock = allBlocks[memoryTypeIndex][i];
+
+		if (currentBlock.dedicated || currentBlock.allocator->isEmpty())
+		{
+			continue;
+		}
+
+		if (sourceBlockIndex < 0 || currentBlock.allocator->getUsedSize() < allBlocks[memoryTypeIndex][sourceBlockIndex].allocator->getUsedSize())
+		{
+			sourceBlockIndex = (int32_t)i;
+		}
+	}
+
+	if (sourceBlockIndex < 0)
+	{
+		return 0;
+	}
+
+	const uint32_t sourceBlockId = allBlocks[memoryTypeIndex][sourceBlockIndex].blockId;
+
+	uint32_t moves = 0;
+
+	for (uint32_t allocation = 0; allocation < (uint32_t)allRecords.size() && moves < maxMoves; allocation++)
+	{
+		auto& currentRecord = allRecords[allocation];
+
+		if (!currentRecord.used || currentRecord.memoryAllocation.memoryTypeIndex != memoryTypeIndex || currentRecord.memoryAllocation.blockId != sourceBlockId)
+		{
+			continue;
+		}
+
+		VkTsMemoryAllocation destination;
+		uint32_t destinationAllocation;
+
+		if (!allocateInBlocks(destination, destinationAllocation, memoryTypeIndex, currentRecord.memoryAllocation.size, currentRecord.alignment, currentRecord.memoryAllocation.linear, sourceBlockIndex))
+		{
+			break;
+		}
+
+		const int32_t destinationBlockIndex = findBlock(memoryTypeIndex, destination.blockId);
+
+		if (!moveFunction(currentRecord.memoryAllocation, destination))
+		{
+			allBlocks[memoryTypeIndex][destinationBlockIndex].allocator->free(destinationAllocation);
+
+			break;
+		}
+
+		allBlocks[memoryTypeIndex][sourceBlockIndex].allocator->free(currentRecord.blockAllocation);
+
+		currentRecord.memoryAllocation = destination;
+		currentRecord.blockAllocation = destinationAllocation;
+
+		moves++;
+	}
+
+	if (allBlocks[memoryTypeIndex][sourceBlockIndex].allocator->isEmpty())
+	{
+		releaseBlock(memoryTypeIndex, (uint32_t)sourceBlockIndex);
+	}
+
+	return moves;
+}
+
+VkDeviceSize MemoryAllocator::getBlockSize(const uint32_t memoryTypeIndex) const
+{
+	if (memoryTypeIndex >= VK_MAX_MEMORY_TYPES)
+	{
+		return 0;
+	}
+
+	return allBlockSizes[memoryTypeIndex];
+}
+
+uint32_t MemoryAllocator::getBlockCount() const
+{
+	std::lock_guard<std::mutex> lock(mutex);
+
+	uint32_t blockCount = 0;
+
+	for (uint32_t i = 0; i < VK_MAX_MEMORY_TYPES; i++)
+	{
+		blockCount += (uint32_t)allBlocks[i].size();
+	}
+
+	return blockCount;
+}
+
+uint32_t MemoryAllocator::getAllocationCount() const
+{
+	std::lock_guard<std::mutex> lock(mutex);
+
+	return (uint32_t)(allRecords.size() - allFreeRecords.size());
+}
+
+VkDeviceSize MemoryAllocator::getUsedSize() const
+{
+	std::lock_guard<std::mutex> lock(mutex);
+
+	VkDeviceSize usedSize = 0;
+
+	for (uint32_t i = 0; i < VK_MAX_MEMORY_TYPES; i++)
+	{
+		for (const auto& currentBlock : allBlocks[i])
+		{
+			usedSize += currentBlock.allocator->getUsedSize();
+		}
+	}
+
+	return usedSize;
+}
+
+VkDeviceSize MemoryAllocator::getReservedSize() const
+{
+	std::lock_guard<std::mutex> lock(mutex);
+
+	VkDeviceSize reservedSize = 0;
+
+	for (uint32_t i = 0; i < VK_MAX_MEMORY_TYPES; i++)
+	{
+		for (const auto& currentBlock : allBlocks[i])
+		{
+			reservedSize += currentBlock.allocator->getSize();
+		}
+	}
+
+	return reservedSize;
+}
+
+VkDeviceSize MemoryAllocator::getLargestFreeSize(const uint32_t memoryTypeIndex) const
+{
+	if (memoryTypeIndex >= VK_MAX_MEMORY_TYPES)
+	{
+		return 0;
+	}
+
+	std::lock_guard<std::mutex> lock(mutex);
+
+	VkDeviceSize largestFreeSize = 0;
+
+	for (const auto& currentBlock : allBlocks[memoryTypeIndex])
+	{
+		if (!currentBlock.dedicated)
+		{
+			largestFreeSize = glm::max(largestFreeSize, currentBlock.allocator->getLargestFreeSize());
+		}
+	}
+
+	return largestFreeSize;
+}
+
+//
+// IDestroyable
+//
+
+void MemoryAllocator::destroy()
+{
+	std::lock_guard<std::mutex> lock(mutex);
+
+	for (uint32_t i = 0; i < VK_MAX_MEMORY_TYPES; i++)
+	{
+		while (allBlocks[i].size() > 0)
+		{
+			releaseBlock(i, (uint32_t)allBlocks[i].size() - 1);
+		}
+	}
+
+	allRecords.clear();
+	allFreeRecords.clear();
+}
+
+} /* namespace vkts */
@@ -0,0 +1,374 @@
+/**
+ * VKTS - VulKan ToolS.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) since 2014 Norbert Nopper
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <vkts/core/vkts_core.hpp>
+
+namespace vkts
+{
+
+void TlsfAllocator::mapping(const VkDeviceSize size, uint32_t& firstLevel, uint32_t& secondLevel)
+{
+	const int32_t mostSignificantBit = (int32_t)glm::findMSB((uint64_t)size);
+
+	// Small sizes do have an exact list.
+	if (mostSignificantBit < VKTS_TLSF_SECOND_LEVEL_LOG2)
+	{
+		firstLevel = 0;
+		secondLevel = (uint32_t)size;
+
+		return;
+	}
+
+	firstLevel = (uint32_t)(mostSignificantBit - VKTS_TLSF_SECOND_LEVEL_LOG2 + 1);
+	secondLevel = (uint32_t)(size >> (mostSignificantBit - VKTS_TLSF_SECOND_LEVEL_LOG2)) & (VKTS_TLSF_SECOND_LEVEL_COUNT - 1);
+}
+
+uint32_t TlsfAllocator::createNode(const VkDeviceSize offset, const VkDeviceSize size)
+{
+	uint32_t node;
+
+	if (allUnusedNodes.size() > 0)
+	{
+		node = allUnusedNodes.back();
+
+		allUnusedNodes.pop_back();
+	}
+	else
+	{
+		node = (uint32_t)allNodes.size();
+
+		allNodes.push_back(TlsfNode());
+	}
+
+	allNodes[node].offset = offset;
+	allNodes[node].size = size;
+	allNodes[node].previousPhysical = VKTS_TLSF_NO_NODE;
+	allNodes[node].nextPhysical = VKTS_TLSF_NO_NODE;
+	allNodes[node].previousFree = VKTS_TLSF_NO_NODE;
+	allNodes[node].nextFree = VKTS_TLSF_NO_NODE;
+	allNodes[node].free = VK_FALSE;
+
+	return node;
+}
+
+void TlsfAllocator::insertFree(const uint32_t node)
+{
+	uint32_t firstLevel;
+	uint32_t secondLevel;
+
+	mapping(allNodes[node].size, firstLevel, secondLevel);
+
+	const uint32_t head = allFreeLists[firstLevel][secondLevel];
+
+	allNodes[node].previousFree = VKTS_TLSF_NO_NODE;
+	allNodes[node].nextFree = head;
+	allNodes[node].free = VK_TRUE;
+
+	if (head != VKTS_TLSF_NO_NODE)
+	{
+		allNodes[head].previousFree = node;
+	}
+
+	allFreeLists[firstLevel][secondLevel] = node;
+
+	firstLevelBitmap |= (uint64_t)1 << firstLevel;
+	allSecondLevelBitmaps[firstLevel] |= 1u << secondLevel;
+}
+
+void TlsfAllocator::removeFree(const uint32_t node)
+{
+	uint32_t firstLevel;
+	uint32_t secondLevel;
+
+	mapping(allNodes[node].size, firstLevel, secondLevel);
+
+	const uint32_t previousFree = allNodes[node].previousFree;
+	const uint32_t nextFree = allNodes[node].nextFree;
+
+	if (previousFree != VKTS_TLSF_NO_NODE)
+	{
+		allNodes[previousFree].nextFree = nextFree;
+	}
+	else
+	{
+		allFreeLists[firstLevel][secondLevel] = nextFree;
+	}
+
+	if (nextFree != VKTS_TLSF_NO_NODE)
+	{
+		allNodes[nextFree].previousFree = previousFree;
+	}
+
+	if (allFreeLists[firstLevel][secondLevel] == VKTS_TLSF_NO_NODE)
+	{
+		allSecondLevelBitmaps[firstLevel] &= ~(1u << secondLevel);
+
+		if (allSecondLevelBitmaps[firstLevel] == 0)
+		{
+			firstLevelBitmap &= ~((uint64_t)1 << firstLevel);
+		}
+	}
+
+	allNodes[node].previousFree = VKTS_TLSF_NO_NODE;
+	allNodes[node].nextFree = VKTS_TLSF_NO_NODE;
+	allNodes[node].free = VK_FALSE;
+}
+
+uint32_t TlsfAllocator::findFree(const VkDeviceSize size) const
+{
+	// Round up to the next list, so every node of the found list is large enough.
+
+	VkDeviceSize searchSize = size;
+
+	const int32_t mostSignificantBit = (int32_t)glm::findMSB((uint64_t)size);
+
+	if (mostSignificantBit >= VKTS_TLSF_SECOND_LEVEL_LOG2)
+	{
+		searchSize += ((VkDeviceSize)1 << (mostSignificantBit - VKTS_TLSF_SECOND_LEVEL_LOG2)) - 1;
+	}
+
+	uint32_t firstLevel;
+	uint32_t secondLevel;
+
+	mapping(searchSize, firstLevel, secondLevel);
+
+	if (firstLevel >= VKTS_TLSF_FIRST_LEVEL_COUNT)
+	{
+		return VKTS_TLSF_NO_NODE;
+	}
+
+	uint32_t secondLevelBitmap = allSecondLevelBitmaps[firstLevel] & (~0u << secondLevel);
+
+	if (secondLevelBitmap == 0)
+	{
+		const uint64_t remainingFirstLevelBitmap = (firstLevel + 1 < VKTS_TLSF_FIRST_LEVEL_COUNT) ? firstLevelBitmap & (~(uint64_t)0 << (firstLevel + 1)) : 0;
+
+		if (remainingFirstLevelBitmap == 0)
+		{
+			return VKTS_TLSF_NO_NODE;
+		}
+
+		firstLevel = (uint32_t)glm::findLSB(remainingFirstLevelBitmap);
+
+		secondLevelBitmap = allSecondLevelBitmaps[firstLevel];
+	}
+
+	secondLevel = (uint32_t)glm::findLSB(secondLevelBitmap);
+
+	return allFreeLists[firstLevel][secondLevel];
+}
+
+uint32_t TlsfAllocator::split(const uint32_t node, const VkDeviceSize size)
+{
+	const uint32_t newNode = createNode(allNodes[node].offset + size, allNodes[node].size - size);
+
+	const uint32_t nextPhysical = allNodes[node].nextPhysical;
+
+	allNodes[newNode].previousPhysical = node;
+	allNodes[newNode].nextPhysical = nextPhysical;
+
+	if (nextPhysical != VKTS_TLSF_NO_NODE)
+	{
+		allNodes[nextPhysical].previousPhysical = newNode;
+	}
+
+	allNodes[node].nextPhysical = newNode;
+	allNodes[node].size = size;
+
+	return newNode;
+}
+
+void TlsfAllocator::merge(const uint32_t node, const uint32_t nextNode)
+{
+	const uint32_t nextPhysical = allNodes[nextNode].nextPhysical;
+
+	allNodes[node].size += allNodes[nextNode].size;
+	allNodes[node].nextPhysical = nextPhysical;
+
+	if (nextPhysical != VKTS_TLSF_NO_NODE)
+	{
+		allNodes[nextPhysical].previousPhysical = node;
+	}
+
+	// Marked as free, so it can not be freed twice.
+	allNodes[nextNode].free = VK_TRUE;
+
+	allUnusedNodes.push_back(nextNode);
+}
+
+TlsfAllocator::TlsfAllocator(const VkDeviceSize size) :
+	size(size), allNodes(), allUnusedNodes(), firstLevelBitmap(0), usedSize(0), allocationCount(0)
+{
+	for (uint32_t firstLevel = 0; firstLevel < VKTS_TLSF_FIRST_LEVEL_COUNT; firstLevel++)
+	{
+		allSecondLevelBitmaps[firstLevel] = 0;
+
+		for (uint32_t secondLevel = 0; secondLevel < VKTS_TLSF_SECOND_LEVEL_COUNT; secondLevel++)
+		{
+			allFreeLists[firstLevel][secondLevel] = VKTS_TLSF_NO_NODE;
+		}
+	}
+
+	if (size > 0)
+	{
+		insertFree(createNode(0, size));
+	}
+}
+
+TlsfAllocator::~TlsfAllocator()
+{
+}
+
+VkBool32 TlsfAllocator::allocate(VkDeviceSize& offset, uint32_t& allocation, const VkDeviceSize size, const VkDeviceSize alignment)
+{
+	if (size == 0 || alignment == 0 || (alignment & (alignment - 1)) != 0)
+	{
+		return VK_FALSE;
+	}
+
+	uint32_t node = findFree(size);
+
+	// Try the good fit first. Only if the alignment does not fit, search for a range, which always fits.
+	if (node == VKTS_TLSF_NO_NODE || ((allNodes[node].offset + alignment - 1) & ~(alignment - 1)) + size > allNodes[node].offset + allNodes[node].size)
+	{
+		node = findFree(size + alignment - 1);
+
+		if (node == VKTS_TLSF_NO_NODE)
+		{
+			return VK_FALSE;
+		}
+	}
+
+	removeFree(node);
+
+	const VkDeviceSize padding = ((allNodes[node].offset + alignment - 1) & ~(alignment - 1)) - allNodes[node].offset;
+
+	if (padding > 0)
+	{
+		const uint32_t alignedNode = split(node, padding);
+
+		insertFree(node);
+
+		node = alignedNode;
+	}
+
+	if (allNodes[node].size > size)
+	{
+		insertFree(split(node, size));
+	}
+
+	usedSize += size;
+
+	allocationCount++;
+
+	offset = allNodes[node].offset;
+	allocation = node;
+
+	return VK_TRUE;
+}
+
+void TlsfAllocator::free(const uint32_t allocation)
+{
+	if (allocation >= (uint32_t)allNodes.size() || allNodes[allocation].free)
+	{
+		return;
+	}
+
+	usedSize -= allNodes[allocation].size;
+
+	allocationCount--;
+
+	uint32_t node = allocation;
+
+	const uint32_t previousPhysical = allNodes[node].previousPhysical;
+
+	if (previousPhysical != VKTS_TLSF_NO_NODE && allNodes[previousPhysical].free)
+	{
+		removeFree(previousPhysical);
+
+		merge(previousPhysical, node);
+
+		node = previousPhysical;
+	}
+
+	const uint32_t nextPhysical = allNodes[node].nextPhysical;
+
+	if (nextPhysical != VKTS_TLSF_NO_NODE && allNodes[nextPhysical].free)
+	{
+		removeFree(nextPhysical);
+
+		merge(node, nextPhysical);
+	}
+
+	insertFree(node);
+}
+
+VkDeviceSize TlsfAllocator::getSize() const
+{
+	return size;
+}
+
+VkDeviceSize TlsfAllocator::getUsedSize() const
+{
+	return usedSize;
+}
+
+VkDeviceSize TlsfAllocator::getFreeSize() const
+{
+	return size - usedSize;
+}
+
+VkDeviceSize TlsfAllocator::getLargestFreeSize() const
+{
+	if (firstLevelBitmap == 0)
+	{
+		return 0;
+	}
+
+	const uint32_t firstLevel = (uint32_t)glm::findMSB(firstLevelBitmap);
+	const uint32_t secondLevel = (uint32_t)glm::findMSB(allSecondLevelBitmaps[firstLevel]);
+
+	VkDeviceSize largestFreeSize = 0;
+
+	for (uint32_t node = allFreeLists[firstLevel][secondLevel]; node != VKTS_TLSF_NO_NODE; node = allNodes[node].nextFree)
+	{
+		largestFreeSize = glm::max(largestFreeSize, allNodes[node].size);
+	}
+
+	return largestFreeSize;
+}
+
+uint32_t TlsfAllocator::getAllocationCount() const
+{
+	return allocationCount;
+}
+
+VkBool32 TlsfAllocator::isEmpty() const
+{
+	return allocationCount == 0;
+}
+
+} /* namespace vkts */
@@ -0,0 +1,165 @@
+/**
+ * VKTS - VulKan ToolS.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) since 2014 Norbert Nopper
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <vkts/core/vkts_core.hpp>
+
+namespace vkts
+{
+
+UploadRing::UploadRing(const VkDeviceSize frameSize, const uint32_t frameCount, const VkDeviceSize atomSize) :
+	frameSize(frameSize), frameCount(frameCount), atomSize(glm::max(atomSize, (VkDeviceSize)1)), currentFrame(0), head(0), allDirtyRanges(), frameBytes(0), frameFlushRanges(0)
+{
+}
+
+UploadRing::~UploadRing()
+{
+}
+
+void UploadRing::reset(const uint32_t frame)
+{
+	currentFrame = frameCount > 0 ? frame % frameCount : 0;
+
+	head = 0;
+
+	frameBytes = 0;
+	frameFlushRanges = 0;
+}
+
+VkBool32 UploadRing::allocate(VkDeviceSize& offset, const VkDeviceSize size, const VkDeviceSize alignment)
+{
+	if (size == 0 || alignment == 0 || (alignment & (alignment - 1)) != 0)
+	{
+		return VK_FALSE;
+	}
+
+	const VkDeviceSize frameOffset = (VkDeviceSize)currentFrame * frameSize;
+
+	// Aligned relative to the memory, as the segments do not need to be aligned.
+	const VkDeviceSize alignedOffset = (frameOffset + head + alignment - 1) & ~(alignment - 1);
+
+	if (alignedOffset + size > frameOffset + frameSize)
+	{
+		return VK_FALSE;
+	}
+
+	head = alignedOffset + size - frameOffset;
+
+	offset = alignedOffset;
+
+	return VK_TRUE;
+}
+
+void UploadRing::addDirtyRange(const VkDeviceSize offset, const VkDeviceSize size)
+{
+	if (size == 0)
+	{
+		return;
+	}
+
+	frameBytes += size;
+
+	VkTsMemoryRange dirtyRange;
+
+	dirtyRange.offset = (offset / atomSize) * atomSize;
+	dirtyRange.size = ((offset + size + atomSize - 1) / atomSize) * atomSize - dirtyRange.offset;
+
+	// Writes are mostly consecutive, so they are merged with the last range at once.
+	if (allDirtyRanges.size() > 0)
+	{
+		VkTsMemoryRange& lastRange = allDirtyRanges.back();
+
+		if (dirtyRange.offset <= lastRange.offset + lastRange.size && dirtyRange.offset + dirtyRange.size >= lastRange.offset)
+		{
+			const VkDeviceSize end = glm::max(lastRange.offset + lastRange.size, dirtyRange.offset + dirtyRange.size);
+
+			lastRange.offset = glm::min(lastRange.offset, dirtyRange.offset);
+			lastRange.size = end - lastRange.offset;
+
+			return;
+		}
+	}
+
+	allDirtyRanges.push_back(dirtyRange);
+}
+
+VkBool32 UploadRing::isDirty() const
+{
+	return allDirtyRanges.size() > 0;
+}
+
+void UploadRing::getFlushRanges(std::vector<VkTsMemoryRange>& allFlushRanges)
+{
+	allFlushRanges.clear();
+
+	std::sort(allDirtyRanges.begin(), allDirtyRanges.end(), [](const VkTsMemoryRange& a, const VkTsMemoryRange& b) {
+		return a.offset < b.offset;
+	});
+
+	for (const auto& currentRange : allDirtyRanges)
+	{
+		if (allFlushRanges.size() > 0 && currentRange.offset <= allFlushRanges.back().offset + allFlushRanges.back().size)
+		{
+			VkTsMemoryRange& lastRange = allFlushRanges.back();
+
+			lastRange.size = glm::max(lastRange.offset + lastRange.size, currentRange.offset + currentRange.size) - lastRange.offset;
+
+			continue;
+		}
+
+		allFlushRanges.push_back(currentRange);
+	}
+
+	allDirtyRanges.clear();
+
+	frameFlushRanges += (uint32_t)allFlushRanges.size();
+}
+
+VkDeviceSize UploadRing::getFrameSize() const
+{
+	return frameSize;
+}
+
+uint32_t UploadRing::getFrameCount() const
+{
+	return frameCount;
+}
+
+uint32_t UploadRing::getCurrentFrame() const
+{
+	return currentFrame;
+}
+
+uint64_t UploadRing::getFrameBytes() const
+{
+	return frameBytes;
+}
+
+uint32_t UploadRing::getFrameFlushRanges() const
+{
+	return frameFlushRanges;
+}
+
+} /* namespace vkts */
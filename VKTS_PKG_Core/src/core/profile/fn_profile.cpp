@@ -34,6 +34,15 @@ namespace vkts
 static double g_totalTime;
 static uint32_t g_fps;
 
+static std::atomic<uint64_t> g_uploads(0);
+static std::atomic<uint64_t> g_uploadSize(0);
+
+static std::atomic<uint64_t> g_flushes(0);
+static std::atomic<uint64_t> g_flushRanges(0);
+
+static std::atomic<uint64_t> g_pipelinesCreated(0);
+static std::atomic<uint64_t> g_pipelinesReused(0);
+
 VkBool32 VKTS_APIENTRY profileInit()
 {
 	g_totalTime = 0.0f;
@@ -95,6 +104,48 @@ VkBool32 VKTS_APIENTRY profileApplicationGetFps(uint32_t& fps, const double delt
 	return VK_FALSE;
 }
 
+void VKTS_APIENTRY profileAddUpload(const uint64_t size)
+{
+	g_uploads.fetch_add(1, std::memory_order_relaxed);
+	g_uploadSize.fetch_add(size, std::memory_order_relaxed);
+}
+
+void VKTS_APIENTRY profileGetUploads(uint64_t& uploads, uint64_t& size)
+{
+	uploads = g_uploads.exchange(0, std::memory_order_relaxed);
+	size = g_uploadSize.exchange(0, std::memory_order_relaxed);
+}
+
+void VKTS_APIENTRY profileAddFlush(const uint64_t ranges)
+{
+	g_flushes.fetch_add(1, std::memory_order_relaxed);
+	g_flushRanges.fetch_add(ranges, std::memory_order_relaxed);
+}
+
+void VKTS_APIENTRY profileGetFlushes(uint64_t& flushes, uint64_t& ranges)
+{
+	flushes = g_flushes.exchange(0, std::memory_order_relaxed);
+	ranges = g_flushRanges.exchange(0, std::memory_order_relaxed);
+}
+
+void VKTS_APIENTRY profileAddPipeline(const VkBool32 reused)
+{
+	if (reused)
+	{
+		g_pipelinesReused.fetch_add(1, std::memory_order_relaxed);
+	}
+	else
+	{
+		g_pipelinesCreated.fetch_add(1, std::memory_order_relaxed);
+	}
+}
+
+void VKTS_APIENTRY profileGetPipelines(uint64_t& created, uint64_t& reused)
+{
+	created = g_pipelinesCreated.exchange(0, std::memory_order_relaxed);
+	reused = g_pipelinesReused.exchange(0, std::memory_order_relaxed);
+}
+
 void VKTS_APIENTRY profileTerminate()
 {
     _profileTerminate();
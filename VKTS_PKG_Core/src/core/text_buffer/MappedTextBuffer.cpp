@@ -0,0 +1,183 @@
+/**
+ * VKTS - VulKan ToolS.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) since 2014 Norbert Nopper
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "MappedTextBuffer.hpp"
+
+#include "TextBuffer.hpp"
+
+namespace vkts
+{
+
+MappedTextBuffer::MappedTextBuffer(const std::shared_ptr<const uint8_t>& memory, const uint32_t length) :
+    ITextBuffer(), memory(memory), length(memory.get() ? length : 0), pos(0)
+{
+}
+
+MappedTextBuffer::~MappedTextBuffer()
+{
+}
+
+const char* MappedTextBuffer::getString() const
+{
+    if (!memory.get())
+    {
+        return "";
+    }
+
+    return reinterpret_cast<const char*>(memory.get());
+}
+
+uint32_t MappedTextBuffer::getLength() const
+{
+    return length;
+}
+
+VkBool32 MappedTextBuffer::seek(const int64_t offset, const VkTsSearch search)
+{
+    switch (search)
+    {
+        case VKTS_SEARCH_ABSOLUTE:
+        {
+            if (offset < 0 || offset > static_cast<int64_t>(length))
+            {
+                return VK_FALSE;
+            }
+
+            pos = static_cast<uint32_t>(offset);
+
+            return VK_TRUE;
+        }
+        break;
+        case VKTS_SEARCH_RELATVE:
+        {
+            if (offset < 0)
+            {
+                if (static_cast<int64_t>(pos) < -offset)
+                {
+                    return VK_FALSE;
+                }
+
+                pos -= static_cast<uint32_t>(-offset);
+            }
+            else if (offset > 0)
+            {
+                if (static_cast<int64_t>(length - pos) < offset)
+                {
+                    return VK_FALSE;
+                }
+
+                pos += static_cast<uint32_t>(offset);
+            }
+
+            return VK_TRUE;
+        }
+        break;
+    }
+
+    return VK_FALSE;
+}
+
+const char* MappedTextBuffer::gets(char* str, const uint32_t num)
+{
+    if (!str || num == 0)
+    {
+        return nullptr;
+    }
+
+    if (pos >= length)
+    {
+        return nullptr;
+    }
+
+    const char* text = getString();
+
+    uint32_t strIndex = 0;
+
+    while (strIndex < num)
+    {
+        str[strIndex] = text[pos];
+
+        pos++;
+
+        // End of line.
+        if (str[strIndex] == '\r')
+        {
+            str[strIndex] = '\0';
+
+            if (pos < length && text[pos] == '\n')
+            {
+            	pos++;
+            }
+
+            return str;
+        }
+        else if (str[strIndex] == '\n')
+        {
+            str[strIndex] = '\0';
+
+            return str;
+        }
+
+        strIndex++;
+
+        // Not enough space in target buffer.
+        if (strIndex == num)
+        {
+            str[strIndex - 1] = '\0';
+
+            return str;
+        }
+
+        // End of buffer.
+        if (pos == length)
+        {
+			str[strIndex] = '\0';
+
+			return str;
+        }
+    }
+
+    return str;
+}
+
+VkBool32 MappedTextBuffer::puts(const char* /*str*/)
+{
+    // Mapped memory is read only. Clone the buffer for writing.
+
+    return VK_FALSE;
+}
+
+//
+// ICloneable
+//
+
+ITextBufferSP MappedTextBuffer::clone() const
+{
+	// The clone owns a writable copy of the text.
+    return ITextBufferSP(new TextBuffer(std::string(getString(), length)));
+}
+
+} /* namespace vkts */
@@ -178,7 +178,7 @@ IFontSP VKTS_APIENTRY loadFont(const char* filename, const IGuiManagerSP& guiMan
         return IFontSP();
     }
 
-    auto textBuffer = fileLoadText(filename);
+    auto textBuffer = fileMapText(filename);
 
     if (!textBuffer.get())
     {
@@ -291,23 +291,16 @@ IFontSP VKTS_APIENTRY loadFont(const char* filename, const IGuiManagerSP& guiMan
 
 					//
 
-					auto mipMappedImageData = imageDataMipmap(imageData, VK_TRUE, imageData->getName());
+					// Format conversion is only possible for one mip level, so it is done before.
 
-					if (mipMappedImageData.size() == 0)
-					{
-						return IFontSP();
-					}
-
-					imageData = imageDataMerge(mipMappedImageData, imageData->getName(), mipMappedImageData.size(), 1);
+					imageData = createDeviceImageData(guiManager->getAssetManager(), imageData);
 
 					if (!imageData.get())
 					{
 						return IFontSP();
 					}
 
-					//
-
-					imageData = createDeviceImageData(guiManager->getAssetManager(), imageData);
+					imageData = imageDataMipmap(imageData, imageData->getName());
 
 					//
 
@@ -78,7 +78,7 @@ void VKTS_APIENTRY cacheSetEnabled(const VkBool32 enabled)
 	g_cacheEnabled = enabled;
 }
 
-VkBool32 VKTS_APIENTRY cacheSaveImageData(const IImageDataSP& imageData, const std::string& filename)
+VkBool32 VKTS_APIENTRY cacheSaveImageData(const IImageDataSP& imageData, const std::string& filename, const uint32_t mipLevel, const uint32_t arrayLayer)
 {
 	if (!imageData.get())
 	{
@@ -103,7 +103,7 @@ VkBool32 VKTS_APIENTRY cacheSaveImageData(const IImageDataSP& imageData, const s
 
 	std::string cacheFilename = cacheGetFilename(finalFilename.c_str());
 
-	if (!imageDataSave(cacheFilename.c_str(), imageData))
+	if (!imageDataSave(cacheFilename.c_str(), imageData, mipLevel, arrayLayer))
 	{
 		return VK_FALSE;
 	}
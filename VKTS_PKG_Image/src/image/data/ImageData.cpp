@@ -493,7 +493,7 @@ const std::vector<uint32_t>& ImageData::getAllOffsets() const
 
 void ImageData::setTexel(const glm::vec4& rgba, const uint32_t x, const uint32_t y, const uint32_t z, const uint32_t mipLevel, const uint32_t arrayLayer)
 {
-    if (x >= extent.width || y >= extent.height || z >= extent.depth || mipLevel >= mipLevels || arrayLayer >= arrayLayers || BLOCK || !getData())
+    if (mipLevel >= mipLevels || arrayLayer >= arrayLayers || BLOCK || !getData())
     {
         return;
     }
@@ -501,14 +501,14 @@ void ImageData::setTexel(const glm::vec4& rgba, const uint32_t x, const uint32_t
 	VkExtent3D currentExtent;
 	uint32_t offset;
 
-    if (!getExtentAndOffset(currentExtent, offset, mipLevel, arrayLayer))
+    if (!getExtentAndOffset(currentExtent, offset, mipLevel, arrayLayer) || x >= currentExtent.width || y >= currentExtent.height || z >= currentExtent.depth)
     {
     	return;
     }
 
     //
 
-    if (!buffer->seek((int64_t)offset + (int64_t)numberChannels * (int64_t)bytesPerChannel * (int64_t)x + (int64_t)numberChannels * (int64_t)bytesPerChannel * (int64_t)y * (int64_t)extent.width + (int64_t)numberChannels * (int64_t)bytesPerChannel * (int64_t)z * (int64_t)extent.width * (int64_t)extent.height, VKTS_SEARCH_ABSOLUTE))
+    if (!buffer->seek((int64_t)offset + (int64_t)numberChannels * (int64_t)bytesPerChannel * (int64_t)x + (int64_t)numberChannels * (int64_t)bytesPerChannel * (int64_t)y * (int64_t)currentExtent.width + (int64_t)numberChannels * (int64_t)bytesPerChannel * (int64_t)z * (int64_t)currentExtent.width * (int64_t)currentExtent.height, VKTS_SEARCH_ABSOLUTE))
     {
     	return;
     }
@@ -553,7 +553,7 @@ void ImageData::setTexel(const glm::vec4& rgba, const uint32_t x, const uint32_t
 
 glm::vec4 ImageData::getTexel(const uint32_t x, const uint32_t y, const uint32_t z, const uint32_t mipLevel, const uint32_t arrayLayer) const
 {
-    if (x >= extent.width || y >= extent.height || z >= extent.depth || mipLevel >= mipLevels || arrayLayer >= arrayLayers || BLOCK || !getData())
+    if (mipLevel >= mipLevels || arrayLayer >= arrayLayers || BLOCK || !getData())
     {
         return glm::vec4(NAN, NAN, NAN, NAN);
     }
@@ -563,9 +563,14 @@ glm::vec4 ImageData::getTexel(const uint32_t x, const uint32_t y, const uint32_t
 
     getExtentAndOffset(currentExtent, offset, mipLevel, arrayLayer);
 
+    if (x >= currentExtent.width || y >= currentExtent.height || z >= currentExtent.depth)
+    {
+        return glm::vec4(NAN, NAN, NAN, NAN);
+    }
+
     //
 
-    if (!buffer->seek((int64_t)offset + (int64_t)numberChannels * (int64_t)bytesPerChannel * (int64_t)x + (int64_t)numberChannels * (int64_t)bytesPerChannel * (int64_t)y * (int64_t)extent.width + (int64_t)numberChannels * (int64_t)bytesPerChannel * (int64_t)z * (int64_t)extent.width * (int64_t)extent.height, VKTS_SEARCH_ABSOLUTE))
+    if (!buffer->seek((int64_t)offset + (int64_t)numberChannels * (int64_t)bytesPerChannel * (int64_t)x + (int64_t)numberChannels * (int64_t)bytesPerChannel * (int64_t)y * (int64_t)currentExtent.width + (int64_t)numberChannels * (int64_t)bytesPerChannel * (int64_t)z * (int64_t)currentExtent.width * (int64_t)currentExtent.height, VKTS_SEARCH_ABSOLUTE))
     {
     	 return glm::vec4(NAN, NAN, NAN, NAN);
     }
@@ -614,7 +619,10 @@ glm::vec4 ImageData::getTexel(const uint32_t x, const uint32_t y, const uint32_t
 
 glm::vec4 ImageData::getSample(const float x, const VkFilter filterX, const VkSamplerAddressMode addressModeX, const float y, const VkFilter filterY, const VkSamplerAddressMode addressModeY, const float z, const VkFilter filterZ, const VkSamplerAddressMode addressModeZ, const uint32_t mipLevel, const uint32_t arrayLayer) const
 {
-	if (BLOCK)
+	VkExtent3D currentExtent;
+	uint32_t currentOffset;
+
+	if (BLOCK || !getExtentAndOffset(currentExtent, currentOffset, mipLevel, arrayLayer))
 	{
 		return glm::vec4(NAN, NAN, NAN, NAN);
 	}
@@ -629,15 +637,15 @@ glm::vec4 ImageData::getSample(const float x, const VkFilter filterX, const VkSa
 	float fractionY;
 	float fractionZ;
 
-	int32_t texelX = getTexelLocation(fractionX, x, (int32_t)extent.width, addressModeX);
-	int32_t texelY = getTexelLocation(fractionY, y, (int32_t)extent.height, addressModeY);
-	int32_t texelZ = getTexelLocation(fractionZ, z, (int32_t)extent.depth, addressModeZ);
+	int32_t texelX = getTexelLocation(fractionX, x, (int32_t)currentExtent.width, addressModeX);
+	int32_t texelY = getTexelLocation(fractionY, y, (int32_t)currentExtent.height, addressModeY);
+	int32_t texelZ = getTexelLocation(fractionZ, z, (int32_t)currentExtent.depth, addressModeZ);
 
 	//
 
-	float stepX = 1.0f / (float)extent.width;
-	float stepY = 1.0f / (float)extent.height;
-	float stepZ = 1.0f / (float)extent.depth;
+	float stepX = 1.0f / (float)currentExtent.width;
+	float stepY = 1.0f / (float)currentExtent.height;
+	float stepZ = 1.0f / (float)currentExtent.depth;
 
 	//
 
@@ -659,7 +667,7 @@ glm::vec4 ImageData::getSample(const float x, const VkFilter filterX, const VkSa
 			{
 				currentWeightZ = weightZ;
 
-				texelZ = getTexelLocation(dummy, z, (int32_t)extent.depth, addressModeZ);
+				texelZ = getTexelLocation(dummy, z, (int32_t)currentExtent.depth, addressModeZ);
 			}
 			else
 			{
@@ -667,11 +675,11 @@ glm::vec4 ImageData::getSample(const float x, const VkFilter filterX, const VkSa
 
 				if (fractionZ >= 0.5f)
 				{
-					texelZ = getTexelLocation(dummy, z + stepZ, (int32_t)extent.depth, addressModeZ);
+					texelZ = getTexelLocation(dummy, z + stepZ, (int32_t)currentExtent.depth, addressModeZ);
 				}
 				else
 				{
-					texelZ = getTexelLocation(dummy, z - stepZ, (int32_t)extent.depth, addressModeZ);
+					texelZ = getTexelLocation(dummy, z - stepZ, (int32_t)currentExtent.depth, addressModeZ);
 				}
 			}
 		}
@@ -690,7 +698,7 @@ glm::vec4 ImageData::getSample(const float x, const VkFilter filterX, const VkSa
 				{
 					currentWeightY = weightY;
 
-					texelY = getTexelLocation(dummy, y, (int32_t)extent.height, addressModeY);
+					texelY = getTexelLocation(dummy, y, (int32_t)currentExtent.height, addressModeY);
 				}
 				else
 				{
@@ -698,11 +706,11 @@ glm::vec4 ImageData::getSample(const float x, const VkFilter filterX, const VkSa
 
 					if (fractionY >= 0.5f)
 					{
-						texelY = getTexelLocation(dummy, y + stepY, (int32_t)extent.height, addressModeY);
+						texelY = getTexelLocation(dummy, y + stepY, (int32_t)currentExtent.height, addressModeY);
 					}
 					else
 					{
-						texelY = getTexelLocation(dummy, y - stepY, (int32_t)extent.height, addressModeY);
+						texelY = getTexelLocation(dummy, y - stepY, (int32_t)currentExtent.height, addressModeY);
 					}
 				}
 			}
@@ -721,7 +729,7 @@ glm::vec4 ImageData::getSample(const float x, const VkFilter filterX, const VkSa
 					{
 						currentWeightX = weightX;
 
-						texelX = getTexelLocation(dummy, x, (int32_t)extent.width, addressModeX);
+						texelX = getTexelLocation(dummy, x, (int32_t)currentExtent.width, addressModeX);
 					}
 					else
 					{
@@ -729,11 +737,11 @@ glm::vec4 ImageData::getSample(const float x, const VkFilter filterX, const VkSa
 
 						if (fractionX >= 0.5f)
 						{
-							texelX = getTexelLocation(dummy, x + stepX, (int32_t)extent.width, addressModeX);
+							texelX = getTexelLocation(dummy, x + stepX, (int32_t)currentExtent.width, addressModeX);
 						}
 						else
 						{
-							texelX = getTexelLocation(dummy, x - stepX, (int32_t)extent.width, addressModeX);
+							texelX = getTexelLocation(dummy, x - stepX, (int32_t)currentExtent.width, addressModeX);
 						}
 					}
 				}
@@ -782,14 +790,22 @@ glm::vec4 ImageData::getSampleCubeMap(const float x, const float y, const float
 
 	// Get three more samples. Not seamless.
 
-	float stepS = 1.0f / (float)extent.width;
-	float stepT = 1.0f / (float)extent.height;
+	VkExtent3D currentExtent;
+	uint32_t currentOffset;
+
+	if (!getExtentAndOffset(currentExtent, currentOffset, mipLevel, faceLayer))
+	{
+		return glm::vec4(NAN, NAN, NAN, NAN);
+	}
+
+	float stepS = 1.0f / (float)currentExtent.width;
+	float stepT = 1.0f / (float)currentExtent.height;
 
 	float fractionS;
 	float fractionT;
 
-	getTexelLocation(fractionS, s, (int32_t)extent.width, VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE);
-	getTexelLocation(fractionT, t, (int32_t)extent.height, VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE);
+	getTexelLocation(fractionS, s, (int32_t)currentExtent.width, VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE);
+	getTexelLocation(fractionT, t, (int32_t)currentExtent.height, VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE);
 
 	if (fractionS < 0.5f)
 	{
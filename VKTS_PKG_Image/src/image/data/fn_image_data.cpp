@@ -25,6 +25,7 @@
  */
 
 #include <vkts/image/vkts_image.hpp>
+#include <vkts/runtime/vkts_runtime.hpp>
 
 #include "fn_image_data_internal.hpp"
 #include "ImageData.hpp"
@@ -38,6 +39,7 @@ static PFN_imageDataLoadFunction g_loadFunction = nullptr;
 static VkBool32 g_loadFallback = VK_TRUE;
 static PFN_imageDataSaveFunction g_saveFunction = nullptr;
 static VkBool32 g_saveFallback = VK_TRUE;
+static ImageDataParallelForFunction g_parallelForFunction;
 
 template<typename T>
 static void imageDataSwapRedBlueChannel(const uint32_t numberChannels, T* data, const uint32_t length)
@@ -593,6 +595,21 @@ void VKTS_APIENTRY imageDataSetSaveFunction(const PFN_imageDataSaveFunction save
 	g_saveFallback = fallback;
 }
 
+void VKTS_APIENTRY imageDataSetParallelForFunction(const ImageDataParallelForFunction& parallelForFunction)
+{
+	g_parallelForFunction = parallelForFunction;
+}
+
+VkBool32 VKTS_APIENTRY imageDataParallelFor(const uint32_t count, const uint32_t grainSize, const ImageDataRangeFunction& rangeFunction)
+{
+	if (g_parallelForFunction)
+	{
+		return g_parallelForFunction(count, grainSize, rangeFunction);
+	}
+
+	return taskParallelFor(count, grainSize, rangeFunction);
+}
+
 IImageDataSP VKTS_APIENTRY imageDataLoad(const char* filename)
 {
 	if (g_loadFunction)
@@ -617,7 +634,7 @@ IImageDataSP VKTS_APIENTRY imageDataLoad(const char* filename)
         return IImageDataSP();
     }
 
-    auto buffer = fileLoadBinary(filename);
+    auto buffer = fileMapBinary(filename);
 
     if (!buffer.get())
     {
@@ -667,7 +684,7 @@ IImageDataSP VKTS_APIENTRY imageDataLoadRaw(const char* filename, const uint32_t
     	return IImageDataSP();
     }
 
-    auto buffer = fileLoadBinary(filename);
+    auto buffer = fileMapBinary(filename);
 
     if (!buffer.get())
     {
@@ -32,6 +32,11 @@
 namespace vkts
 {
 
+/**
+ * Processes [0, count) by the function set with imageDataSetParallelForFunction or by the task executors of the running engine.
+ */
+VKTS_APICALL VkBool32 VKTS_APIENTRY imageDataParallelFor(const uint32_t count, const uint32_t grainSize, const ImageDataRangeFunction& rangeFunction);
+
 VKTS_APICALL glm::vec3 VKTS_APIENTRY imageDataGetScanVector(const uint32_t x, const uint32_t y, const uint32_t side, const float step, const float offset);
 
 /**
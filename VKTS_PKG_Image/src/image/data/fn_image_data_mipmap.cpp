@@ -26,118 +26,476 @@
 
 #include <vkts/image/vkts_image.hpp>
 
+#include "fn_image_data_internal.hpp"
+#include "ImageData.hpp"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define VKTS_MIPMAP_SSE2
+#include <emmintrin.h>
+#endif
+
+// Radius of the windowed sinc filters, in texels of the target level.
+#define VKTS_MIPMAP_FILTER_RADIUS 3.0f
+
+#define VKTS_MIPMAP_KAISER_ALPHA 4.0f
+
+// Number of target texels, which are processed at least by one range.
+#define VKTS_MIPMAP_GRAIN_TEXELS 4096
+
 namespace vkts
 {
 
-SmartPointerVector<IImageDataSP> VKTS_APIENTRY imageDataMipmap(const IImageDataSP& sourceImage, VkBool32 const addSourceAsCopy, const std::string& name)
+typedef struct _MipmapAxis {
+    uint32_t taps;
+    std::vector<uint32_t> allIndices;
+    std::vector<float> allWeights;
+} MipmapAxis;
+
+typedef struct _MipmapFormat {
+    uint32_t numberChannels;
+    uint32_t bytesPerTexel;
+    VkBool32 SFLOAT;
+    // Color channels of SRGB formats are converted to linear space before filtering.
+    VkBool32 allGamma[4];
+    float allToLinear[256];
+    float allToUnorm[256];
+    // Linear values, where the next 8 bit SRGB value starts.
+    float allToGamma[255];
+} MipmapFormat;
+
+static float imageDataMipmapSinc(const float x)
+{
+    if (fabsf(x) < 1e-6f)
+    {
+        return 1.0f;
+    }
+
+    return sinf(VKTS_MATH_PI * x) / (VKTS_MATH_PI * x);
+}
+
+static float imageDataMipmapBessel0(const float x)
+{
+    // Power series of the modified Bessel function of the first kind.
+    float result = 1.0f;
+    float term = 1.0f;
+
+    for (uint32_t k = 1; k < 32; k++)
+    {
+        term *= (x * 0.5f / (float)k) * (x * 0.5f / (float)k);
+
+        result += term;
+
+        if (term < result * 1e-7f)
+        {
+            break;
+        }
+    }
+
+    return result;
+}
+
+static float imageDataMipmapKernel(const enum VkTsMipmapFilter filter, const float x)
+{
+    if (fabsf(x) >= VKTS_MIPMAP_FILTER_RADIUS)
+    {
+        return 0.0f;
+    }
+
+    if (filter == VKTS_MIPMAP_FILTER_KAISER)
+    {
+        float t = x / VKTS_MIPMAP_FILTER_RADIUS;
+
+        return imageDataMipmapSinc(x) * imageDataMipmapBessel0(VKTS_MIPMAP_KAISER_ALPHA * sqrtf(1.0f - t * t)) / imageDataMipmapBessel0(VKTS_MIPMAP_KAISER_ALPHA);
+    }
+
+    return imageDataMipmapSinc(x) * imageDataMipmapSinc(x / VKTS_MIPMAP_FILTER_RADIUS);
+}
+
+static void imageDataMipmapGetAxis(MipmapAxis& axis, const uint32_t sourceLength, const uint32_t targetLength, const enum VkTsMipmapFilter filter)
+{
+    std::vector<std::vector<std::pair<uint32_t, float>>> allTaps(targetLength);
+
+    const float scale = (float)sourceLength / (float)targetLength;
+
+    axis.taps = 1;
+
+    for (uint32_t i = 0; i < targetLength; i++)
+    {
+        if (sourceLength == targetLength)
+        {
+            allTaps[i].push_back(std::make_pair(i, 1.0f));
+        }
+        else if (filter == VKTS_MIPMAP_FILTER_BOX)
+        {
+            // Weighted by the covered area, so odd lengths do not drop the last texel.
+            float start = (float)i * scale;
+            float end = (float)(i + 1) * scale;
+
+            for (int32_t j = (int32_t)floorf(start); j < (int32_t)ceilf(end); j++)
+            {
+                float weight = (glm::min(end, (float)(j + 1)) - glm::max(start, (float)j)) / scale;
+
+                if (weight > 0.0f)
+                {
+                    allTaps[i].push_back(std::make_pair((uint32_t)glm::min(j, (int32_t)sourceLength - 1), weight));
+                }
+            }
+        }
+        else
+        {
+            float center = ((float)i + 0.5f) * scale;
+
+            float sum = 0.0f;
+
+            for (int32_t j = (int32_t)floorf(center - VKTS_MIPMAP_FILTER_RADIUS * scale); j <= (int32_t)ceilf(center + VKTS_MIPMAP_FILTER_RADIUS * scale); j++)
+            {
+                float weight = imageDataMipmapKernel(filter, ((float)j + 0.5f - center) / scale);
+
+                if (weight != 0.0f)
+                {
+                    // Clamp to edge.
+                    allTaps[i].push_back(std::make_pair((uint32_t)glm::clamp(j, 0, (int32_t)sourceLength - 1), weight));
+
+                    sum += weight;
+                }
+            }
+
+            for (auto& currentTap : allTaps[i])
+            {
+                currentTap.second /= sum;
+            }
+        }
+
+        axis.taps = glm::max(axis.taps, (uint32_t)allTaps[i].size());
+    }
+
+    // Same number of taps for every texel, padded with zero weights.
+
+    axis.allIndices.assign((size_t)targetLength * (size_t)axis.taps, 0);
+    axis.allWeights.assign((size_t)targetLength * (size_t)axis.taps, 0.0f);
+
+    for (uint32_t i = 0; i < targetLength; i++)
+    {
+        for (uint32_t k = 0; k < (uint32_t)allTaps[i].size(); k++)
+        {
+            axis.allIndices[i * axis.taps + k] = allTaps[i][k].first;
+            axis.allWeights[i * axis.taps + k] = allTaps[i][k].second;
+        }
+    }
+}
+
+static VkBool32 imageDataMipmapGetFormat(MipmapFormat& format, const IImageDataSP& sourceImage)
 {
-    if (name.size() == 0 || !sourceImage.get())
+    if (sourceImage->isBLOCK() || !(sourceImage->isUNORM() || sourceImage->isSRGB() || sourceImage->isSFLOAT()))
     {
-        return SmartPointerVector<IImageDataSP>();
+        return VK_FALSE;
     }
 
-    std::string sourceImageFilename = name;
+    format.numberChannels = sourceImage->getNumberChannels();
+    format.bytesPerTexel = sourceImage->getBytesPerTexel();
+    format.SFLOAT = sourceImage->isSFLOAT();
 
-    auto dotIndex = sourceImageFilename.rfind(".");
+    if (format.numberChannels == 0 || format.numberChannels > 4 || format.bytesPerTexel != format.numberChannels * (format.SFLOAT ? sizeof(float) : 1))
+    {
+        return VK_FALSE;
+    }
+
+    for (uint32_t channel = 0; channel < 4; channel++)
+    {
+        // Alpha is always linear.
+        format.allGamma[channel] = sourceImage->isSRGB() && channel < 3;
+    }
+
+    for (uint32_t i = 0; i < 256; i++)
+    {
+        format.allToLinear[i] = powf((float)i / 255.0f, VKTS_GAMMA);
+        format.allToUnorm[i] = (float)i / 255.0f;
+    }
 
-    if (dotIndex == sourceImageFilename.npos)
+    for (uint32_t i = 0; i < 255; i++)
     {
-        return SmartPointerVector<IImageDataSP>();
+        format.allToGamma[i] = powf(((float)i + 0.5f) / 255.0f, VKTS_GAMMA);
     }
 
-    auto sourceImageName = sourceImageFilename.substr(0, dotIndex);
-    auto sourceImageExtension = sourceImageFilename.substr(dotIndex);
+    return VK_TRUE;
+}
+
+static void imageDataMipmapDecode(float* target, const uint8_t* source, const uint32_t width, const MipmapFormat& format)
+{
+    if (format.SFLOAT)
+    {
+        const float* sourceFloat = reinterpret_cast<const float*>(source);
+
+        if (format.numberChannels == 4)
+        {
+            memcpy(target, sourceFloat, (size_t)width * 4 * sizeof(float));
+
+            return;
+        }
 
-    IImageDataSP currentSourceImage = sourceImage;
-    int32_t width = currentSourceImage->getWidth();
-    int32_t height = currentSourceImage->getHeight();
-    int32_t depth = currentSourceImage->getDepth();
+        for (uint32_t x = 0; x < width; x++)
+        {
+            for (uint32_t channel = 0; channel < 4; channel++)
+            {
+                target[x * 4 + channel] = channel < format.numberChannels ? sourceFloat[x * format.numberChannels + channel] : 0.0f;
+            }
+        }
 
-    IImageDataSP currentTargetImage;
-    std::string targetImageFilename;
+        return;
+    }
 
-    int32_t level = 0;
+    const float* allTables[4];
 
-    SmartPointerVector<IImageDataSP> result;
+    for (uint32_t channel = 0; channel < 4; channel++)
+    {
+        allTables[channel] = format.allGamma[channel] ? format.allToLinear : format.allToUnorm;
+    }
 
-    if (addSourceAsCopy)
+    // Missing channels are never encoded, so they are not written.
+    for (uint32_t x = 0; x < width; x++)
     {
-        targetImageFilename = sourceImageName + "_LEVEL" + std::to_string(level++) + sourceImageExtension;
+        for (uint32_t channel = 0; channel < format.numberChannels; channel++)
+        {
+            target[x * 4 + channel] = allTables[channel][source[x * format.numberChannels + channel]];
+        }
+    }
+}
 
-        currentTargetImage = imageDataCopy(sourceImage, targetImageFilename);
+static void imageDataMipmapEncode(uint8_t* target, const float* source, const uint32_t width, const MipmapFormat& format)
+{
+    if (format.SFLOAT)
+    {
+        float* targetFloat = reinterpret_cast<float*>(target);
 
-        if (!currentTargetImage.get())
+        for (uint32_t x = 0; x < width; x++)
         {
-            return SmartPointerVector<IImageDataSP>();
+            for (uint32_t channel = 0; channel < format.numberChannels; channel++)
+            {
+                targetFloat[x * format.numberChannels + channel] = source[x * 4 + channel];
+            }
         }
 
-        result.append(currentTargetImage);
+        return;
     }
-    else
+
+    for (uint32_t x = 0; x < width; x++)
     {
-        result.append(sourceImage);
+        for (uint32_t channel = 0; channel < format.numberChannels; channel++)
+        {
+            float value = glm::clamp(source[x * 4 + channel], 0.0f, 1.0f);
 
-        level++;
+            if (format.allGamma[channel])
+            {
+                // Rounds in SRGB space without evaluating the power function.
+                target[x * format.numberChannels + channel] = (uint8_t)(std::upper_bound(format.allToGamma, format.allToGamma + 255, value) - format.allToGamma);
+            }
+            else
+            {
+                target[x * format.numberChannels + channel] = (uint8_t)(value * 255.0f + 0.5f);
+            }
+        }
     }
+}
+
+#ifdef VKTS_MIPMAP_SSE2
 
-    while (width > 1 || height > 1 || depth > 1)
+static void imageDataMipmapAccumulate(float* target, const float* source, const float weight, const uint32_t width)
+{
+    const __m128 weight4 = _mm_set1_ps(weight);
+
+    for (uint32_t x = 0; x < width; x++)
     {
-        width = glm::max(width / 2, 1);
-        height = glm::max(height / 2, 1);
-        depth = glm::max(depth / 2, 1);
+        _mm_storeu_ps(&target[x * 4], _mm_add_ps(_mm_loadu_ps(&target[x * 4]), _mm_mul_ps(_mm_loadu_ps(&source[x * 4]), weight4)));
+    }
+}
 
-        targetImageFilename = sourceImageName + "_LEVEL" + std::to_string(level++) + sourceImageExtension;
+static void imageDataMipmapFilterRow(float* target, const float* source, const MipmapAxis& axis, const uint32_t width)
+{
+    for (uint32_t x = 0; x < width; x++)
+    {
+        const uint32_t* indices = &axis.allIndices[x * axis.taps];
+        const float* weights = &axis.allWeights[x * axis.taps];
 
-        currentTargetImage = imageDataCreate(targetImageFilename, width, height, depth, 0.0f, 0.0f, 0.0f, 0.0f, sourceImage->getImageType(), sourceImage->getFormat());
+        __m128 sum = _mm_setzero_ps();
 
-        if (!currentTargetImage.get())
+        for (uint32_t tap = 0; tap < axis.taps; tap++)
         {
-            return SmartPointerVector<IImageDataSP>();
+            sum = _mm_add_ps(sum, _mm_mul_ps(_mm_loadu_ps(&source[indices[tap] * 4]), _mm_set1_ps(weights[tap])));
         }
 
-        for (int32_t z = 0; z < depth; z++)
+        _mm_storeu_ps(&target[x * 4], sum);
+    }
+}
+
+#else
+
+static void imageDataMipmapAccumulate(float* target, const float* source, const float weight, const uint32_t width)
+{
+    for (uint32_t i = 0; i < width * 4; i++)
+    {
+        target[i] += source[i] * weight;
+    }
+}
+
+static void imageDataMipmapFilterRow(float* target, const float* source, const MipmapAxis& axis, const uint32_t width)
+{
+    for (uint32_t x = 0; x < width; x++)
+    {
+        const uint32_t* indices = &axis.allIndices[x * axis.taps];
+        const float* weights = &axis.allWeights[x * axis.taps];
+
+        for (uint32_t channel = 0; channel < 4; channel++)
+        {
+            float sum = 0.0f;
+
+            for (uint32_t tap = 0; tap < axis.taps; tap++)
+            {
+                sum += source[indices[tap] * 4 + channel] * weights[tap];
+            }
+
+            target[x * 4 + channel] = sum;
+        }
+    }
+}
+
+#endif
+
+static VkBool32 imageDataMipmapLevel(uint8_t* data, const std::vector<uint32_t>& allOffsets, const MipmapFormat& format, const VkExtent3D& extent, const uint32_t mipLevel, const uint32_t mipLevels, const uint32_t arrayLayers, const enum VkTsMipmapFilter filter)
+{
+    const VkExtent3D sourceExtent = {glm::max(extent.width >> (mipLevel - 1), 1u), glm::max(extent.height >> (mipLevel - 1), 1u), glm::max(extent.depth >> (mipLevel - 1), 1u)};
+    const VkExtent3D targetExtent = {glm::max(extent.width >> mipLevel, 1u), glm::max(extent.height >> mipLevel, 1u), glm::max(extent.depth >> mipLevel, 1u)};
+
+    MipmapAxis axisX;
+    MipmapAxis axisY;
+    MipmapAxis axisZ;
+
+    imageDataMipmapGetAxis(axisX, sourceExtent.width, targetExtent.width, filter);
+    imageDataMipmapGetAxis(axisY, sourceExtent.height, targetExtent.height, filter);
+    imageDataMipmapGetAxis(axisZ, sourceExtent.depth, targetExtent.depth, filter);
+
+    const size_t sourceRowSize = (size_t)sourceExtent.width * (size_t)format.bytesPerTexel;
+    const size_t targetRowSize = (size_t)targetExtent.width * (size_t)format.bytesPerTexel;
+
+    // Every target row is filtered vertically into one source row and then horizontally.
+    // Rows do write to different texels, so no synchronization is needed.
+    auto rangeFunction = [&](const uint32_t first, const uint32_t last) -> VkBool32
+    {
+        std::vector<float> decodedRow((size_t)sourceExtent.width * 4);
+        std::vector<float> filteredRow((size_t)sourceExtent.width * 4);
+        std::vector<float> targetRow((size_t)targetExtent.width * 4);
+
+        for (uint32_t row = first; row < last; row++)
         {
-            for (int32_t y = 0; y < height; y++)
+            const uint32_t arrayLayer = row / (targetExtent.depth * targetExtent.height);
+            const uint32_t z = (row / targetExtent.height) % targetExtent.depth;
+            const uint32_t y = row % targetExtent.height;
+
+            const uint8_t* sourceLevel = &data[allOffsets[arrayLayer * mipLevels + mipLevel - 1]];
+            uint8_t* targetLevel = &data[allOffsets[arrayLayer * mipLevels + mipLevel]];
+
+            std::fill(filteredRow.begin(), filteredRow.end(), 0.0f);
+
+            for (uint32_t tapZ = 0; tapZ < axisZ.taps; tapZ++)
             {
-                for (int32_t x = 0; x < width; x++)
+                for (uint32_t tapY = 0; tapY < axisY.taps; tapY++)
                 {
-                    glm::vec4 rgba = glm::vec4(0.0f, 0.0f, 0.0f, 0.0f);
-                    float sampleCount = 0.0f;
+                    float weight = axisZ.allWeights[z * axisZ.taps + tapZ] * axisY.allWeights[y * axisY.taps + tapY];
 
-                    for (int32_t iz = z * 2; iz < z * 2 + 1; iz++)
+                    if (weight == 0.0f)
                     {
-                        for (int32_t iy = y * 2; iy < y * 2 + 1; iy++)
-                        {
-                            for (int32_t ix = x * 2; ix < x * 2 + 1; ix++)
-                            {
-                                rgba += currentSourceImage->getTexel(ix, iy, iz, 0, 0);
-
-                                sampleCount += 1.0f;
-                            }
-                        }
+                        continue;
                     }
 
-                    if (sampleCount > 0.0f)
-                    {
-                        rgba /= sampleCount;
+                    const uint32_t sourceZ = axisZ.allIndices[z * axisZ.taps + tapZ];
+                    const uint32_t sourceY = axisY.allIndices[y * axisY.taps + tapY];
 
-                        currentTargetImage->setTexel(rgba, x, y, z, 0, 0);
-                    }
+                    imageDataMipmapDecode(&decodedRow[0], &sourceLevel[((size_t)sourceZ * (size_t)sourceExtent.height + (size_t)sourceY) * sourceRowSize], sourceExtent.width, format);
+
+                    imageDataMipmapAccumulate(&filteredRow[0], &decodedRow[0], weight, sourceExtent.width);
                 }
             }
+
+            imageDataMipmapFilterRow(&targetRow[0], &filteredRow[0], axisX, targetExtent.width);
+
+            imageDataMipmapEncode(&targetLevel[((size_t)z * (size_t)targetExtent.height + (size_t)y) * targetRowSize], &targetRow[0], targetExtent.width, format);
         }
 
-        result.append(currentTargetImage);
+        return VK_TRUE;
+    };
 
-        //
+    return imageDataParallelFor(arrayLayers * targetExtent.depth * targetExtent.height, glm::max(VKTS_MIPMAP_GRAIN_TEXELS / targetExtent.width, 1u), rangeFunction);
+}
 
-        currentSourceImage = currentTargetImage;
-        width = currentSourceImage->getWidth();
-        height = currentSourceImage->getHeight();
-        depth = currentSourceImage->getDepth();
+IImageDataSP VKTS_APIENTRY imageDataMipmap(const IImageDataSP& sourceImage, const std::string& name, const enum VkTsMipmapFilter filter)
+{
+    if (name.size() == 0 || !sourceImage.get() || !sourceImage->getData())
+    {
+        return IImageDataSP();
     }
 
-    return result;
+    MipmapFormat format;
+
+    if (!imageDataMipmapGetFormat(format, sourceImage))
+    {
+        logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Format not supported for mip maps '%s'", name.c_str());
+
+        return IImageDataSP();
+    }
+
+    const VkExtent3D& extent = sourceImage->getExtent3D();
+
+    const uint32_t arrayLayers = sourceImage->getArrayLayers();
+
+    uint32_t mipLevels = 1;
+
+    while ((extent.width >> mipLevels) > 0 || (extent.height >> mipLevels) > 0 || (extent.depth >> mipLevels) > 0)
+    {
+        mipLevels++;
+    }
+
+    // Same layout as merged images: All mip levels of the first array layer, then of the next one.
+
+    std::vector<uint32_t> allOffsets;
+
+    uint32_t size = 0;
+
+    for (uint32_t arrayLayer = 0; arrayLayer < arrayLayers; arrayLayer++)
+    {
+        for (uint32_t mipLevel = 0; mipLevel < mipLevels; mipLevel++)
+        {
+            allOffsets.push_back(size);
+
+            size += glm::max(extent.width >> mipLevel, 1u) * glm::max(extent.height >> mipLevel, 1u) * glm::max(extent.depth >> mipLevel, 1u) * format.bytesPerTexel;
+        }
+    }
+
+    std::vector<uint8_t> data(size);
+
+    // Only the first mip level of the source is used.
+
+    const uint32_t levelSize = extent.width * extent.height * extent.depth * format.bytesPerTexel;
+
+    for (uint32_t arrayLayer = 0; arrayLayer < arrayLayers; arrayLayer++)
+    {
+        uint32_t sourceOffset = sourceImage->getAllOffsets()[arrayLayer * sourceImage->getMipLevels()];
+
+        if ((size_t)sourceOffset + (size_t)levelSize > (size_t)sourceImage->getSize())
+        {
+            return IImageDataSP();
+        }
+
+        memcpy(&data[allOffsets[arrayLayer * mipLevels]], &sourceImage->getByteData()[sourceOffset], levelSize);
+    }
+
+    for (uint32_t mipLevel = 1; mipLevel < mipLevels; mipLevel++)
+    {
+        if (!imageDataMipmapLevel(&data[0], allOffsets, format, extent, mipLevel, mipLevels, arrayLayers, filter))
+        {
+            return IImageDataSP();
+        }
+    }
+
+    return IImageDataSP(new ImageData(name, sourceImage->getImageType(), sourceImage->getFormat(), extent, mipLevels, arrayLayers, allOffsets, &data[0], size, sourceImage->getMaxLuminance()));
 }
 
 }
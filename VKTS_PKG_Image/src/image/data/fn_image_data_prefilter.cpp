@@ -26,9 +26,49 @@
 
 #include <vkts/image/vkts_image.hpp>
 
+#include "fn_image_data_internal.hpp"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define VKTS_PREFILTER_SSE2
+#include <emmintrin.h>
+#endif
+
+// Edge length of the square texel tiles, which are processed in parallel.
+#define VKTS_PREFILTER_TILE_SIZE 16
+
 namespace vkts
 {
 
+typedef struct _PrefilterCubeMap {
+	const float* allFaces[6];
+	int32_t length;
+	std::vector<float> allConvertedTexels;
+} PrefilterCubeMap;
+
+// Directions are shared by all texels of one roughness and are stored as structure of arrays.
+// They are padded to a multiple of four, the padding has a weight of zero.
+typedef struct _PrefilterDirections {
+	std::vector<float> x;
+	std::vector<float> y;
+	std::vector<float> z;
+	std::vector<float> weight;
+	float divisor;
+	VkBool32 reflect;
+} PrefilterDirections;
+
+typedef struct _PrefilterTarget {
+	uint32_t side;
+	uint32_t length;
+	const PrefilterDirections* directions;
+	std::vector<float> allTexels;
+} PrefilterTarget;
+
+typedef struct _PrefilterTile {
+	uint32_t targetIndex;
+	uint32_t x;
+	uint32_t y;
+} PrefilterTile;
+
 VKTS_APICALL glm::vec3 VKTS_APIENTRY imageDataGetScanVector(const uint32_t x, const uint32_t y, const uint32_t side, const float step, const float offset)
 {
 	glm::vec3 scanVector;
@@ -80,6 +120,445 @@ VKTS_APICALL glm::vec3 VKTS_APIENTRY imageDataGetScanVector(const uint32_t x, co
 	return glm::normalize(scanVector);
 }
 
+static VkBool32 imageDataPrefilterGetCubeMap(PrefilterCubeMap& cubeMap, const IImageDataSP& sourceImage)
+{
+	if (!sourceImage->getData() || sourceImage->isBLOCK())
+	{
+		return VK_FALSE;
+	}
+
+	cubeMap.length = (int32_t)sourceImage->getWidth();
+
+	VkExtent3D currentExtent;
+	uint32_t currentOffset;
+
+	// RGBA floats are sampled directly, all other formats are converted once.
+	if (sourceImage->isSFLOAT() && sourceImage->getNumberChannels() == 4 && sourceImage->getBytesPerChannel() == sizeof(float))
+	{
+		for (uint32_t side = 0; side < 6; side++)
+		{
+			if (!sourceImage->getExtentAndOffset(currentExtent, currentOffset, 0, side))
+			{
+				return VK_FALSE;
+			}
+
+			cubeMap.allFaces[side] = reinterpret_cast<const float*>(sourceImage->getByteData() + currentOffset);
+		}
+
+		return VK_TRUE;
+	}
+
+	const size_t faceSize = (size_t)cubeMap.length * (size_t)cubeMap.length * 4;
+
+	cubeMap.allConvertedTexels.resize(faceSize * 6);
+
+	for (uint32_t side = 0; side < 6; side++)
+	{
+		float* currentTexel = &cubeMap.allConvertedTexels[faceSize * side];
+
+		for (int32_t y = 0; y < cubeMap.length; y++)
+		{
+			for (int32_t x = 0; x < cubeMap.length; x++)
+			{
+				glm::vec4 texel = sourceImage->getTexel((uint32_t)x, (uint32_t)y, 0, 0, side);
+
+				for (uint32_t channel = 0; channel < 4; channel++)
+				{
+					*currentTexel++ = texel[channel];
+				}
+			}
+		}
+
+		cubeMap.allFaces[side] = &cubeMap.allConvertedTexels[faceSize * side];
+	}
+
+	return VK_TRUE;
+}
+
+static void imageDataPrefilterAddDirection(PrefilterDirections& directions, const glm::vec3& direction, const float weight)
+{
+	// Invalid samples are not counted, as they would be skipped for every texel.
+	if (std::isnan(direction.x) || std::isnan(direction.y) || std::isnan(direction.z) || std::isnan(weight))
+	{
+		return;
+	}
+
+	directions.x.push_back(direction.x);
+	directions.y.push_back(direction.y);
+	directions.z.push_back(direction.z);
+	directions.weight.push_back(weight);
+
+	directions.divisor += 1.0f;
+}
+
+static void imageDataPrefilterPadDirections(PrefilterDirections& directions)
+{
+	while (directions.x.size() % 4 != 0)
+	{
+		directions.x.push_back(0.0f);
+		directions.y.push_back(0.0f);
+		directions.z.push_back(1.0f);
+		directions.weight.push_back(0.0f);
+	}
+}
+
+#ifndef VKTS_PREFILTER_SSE2
+
+static int32_t imageDataPrefilterGetCoordinate(const float a, const int32_t length)
+{
+	return (int32_t)glm::clamp(a, 0.0f, (float)(length - 1));
+}
+
+// Same as the linear filtered IImageData::getSampleCubeMap of mip level zero, but without virtual calls.
+static glm::vec4 imageDataPrefilterSample(const PrefilterCubeMap& cubeMap, const float directionX, const float directionY, const float directionZ)
+{
+	// Normalized as well, so the same texels are selected at the texel borders.
+	glm::vec3 normalized = glm::normalize(glm::vec3(directionX, directionY, directionZ));
+
+	float x = normalized.x;
+	float y = normalized.y;
+	float z = normalized.z;
+
+	float absX = fabsf(x);
+	float absY = fabsf(y);
+	float absZ = fabsf(z);
+
+	uint32_t side;
+
+	float sc;
+	float tc;
+	float rc;
+
+	if (absX > absY && absX > absZ)
+	{
+		side = x > 0.0f ? 0 : 1;
+
+		sc = x > 0.0f ? -z : z;
+		tc = -y;
+		rc = x;
+	}
+	else if (absY >= absX && absY > absZ)
+	{
+		side = y > 0.0f ? 2 : 3;
+
+		sc = x;
+		tc = y > 0.0f ? z : -z;
+		rc = y;
+	}
+	else
+	{
+		side = z > 0.0f ? 4 : 5;
+
+		sc = z > 0.0f ? x : -x;
+		tc = -y;
+		rc = z;
+	}
+
+	float s = (0.5f * sc / fabsf(rc) + 0.5f) * (float)cubeMap.length;
+	float t = (0.5f * tc / fabsf(rc) + 0.5f) * (float)cubeMap.length;
+
+	// Three more texels in the direction of the nearest neighbours. Not seamless.
+	int32_t s0 = imageDataPrefilterGetCoordinate(s, cubeMap.length);
+	int32_t s1 = imageDataPrefilterGetCoordinate(s - floorf(s) < 0.5f ? s - 1.0f : s + 1.0f, cubeMap.length);
+	int32_t t0 = imageDataPrefilterGetCoordinate(t, cubeMap.length);
+	int32_t t1 = imageDataPrefilterGetCoordinate(t - floorf(t) < 0.5f ? t - 1.0f : t + 1.0f, cubeMap.length);
+
+	const float* face = cubeMap.allFaces[side];
+
+	glm::vec4 result = glm::make_vec4(&face[(t0 * cubeMap.length + s0) * 4]);
+	result += glm::make_vec4(&face[(t0 * cubeMap.length + s1) * 4]);
+	result += glm::make_vec4(&face[(t1 * cubeMap.length + s0) * 4]);
+	result += glm::make_vec4(&face[(t1 * cubeMap.length + s1) * 4]);
+
+	return result * 0.25f;
+}
+
+#else
+
+static inline __m128 imageDataPrefilterSelect(const __m128 mask, const __m128 a, const __m128 b)
+{
+	return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b));
+}
+
+static inline __m128 imageDataPrefilterFloor(const __m128 a)
+{
+	__m128 truncated = _mm_cvtepi32_ps(_mm_cvttps_epi32(a));
+
+	return _mm_sub_ps(truncated, _mm_and_ps(_mm_cmpgt_ps(truncated, a), _mm_set1_ps(1.0f)));
+}
+
+// Four directions at once. The weighted sum of the four samples is returned.
+static __m128 imageDataPrefilterSample4(const PrefilterCubeMap& cubeMap, const __m128 directionX, const __m128 directionY, const __m128 directionZ, const float* weight)
+{
+	const __m128 signMask = _mm_set1_ps(-0.0f);
+	const __m128 zero = _mm_setzero_ps();
+	const __m128 half = _mm_set1_ps(0.5f);
+	const __m128 one = _mm_set1_ps(1.0f);
+
+	// Normalized as well, so the same texels are selected at the texel borders.
+	__m128 inverseLength = _mm_div_ps(one, _mm_sqrt_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(directionX, directionX), _mm_mul_ps(directionY, directionY)), _mm_mul_ps(directionZ, directionZ))));
+
+	__m128 x = _mm_mul_ps(directionX, inverseLength);
+	__m128 y = _mm_mul_ps(directionY, inverseLength);
+	__m128 z = _mm_mul_ps(directionZ, inverseLength);
+
+	__m128 absX = _mm_andnot_ps(signMask, x);
+	__m128 absY = _mm_andnot_ps(signMask, y);
+	__m128 absZ = _mm_andnot_ps(signMask, z);
+
+	__m128 isX = _mm_and_ps(_mm_cmpgt_ps(absX, absY), _mm_cmpgt_ps(absX, absZ));
+	__m128 isY = _mm_andnot_ps(isX, _mm_and_ps(_mm_cmpge_ps(absY, absX), _mm_cmpgt_ps(absY, absZ)));
+
+	__m128 positiveX = _mm_cmpgt_ps(x, zero);
+	__m128 positiveY = _mm_cmpgt_ps(y, zero);
+	__m128 positiveZ = _mm_cmpgt_ps(z, zero);
+
+	__m128 negativeX = _mm_xor_ps(x, signMask);
+	__m128 negativeY = _mm_xor_ps(y, signMask);
+	__m128 negativeZ = _mm_xor_ps(z, signMask);
+
+	__m128 sc = imageDataPrefilterSelect(isX, imageDataPrefilterSelect(positiveX, negativeZ, z), imageDataPrefilterSelect(isY, x, imageDataPrefilterSelect(positiveZ, x, negativeX)));
+	__m128 tc = imageDataPrefilterSelect(isY, imageDataPrefilterSelect(positiveY, z, negativeZ), negativeY);
+	__m128 rc = _mm_andnot_ps(signMask, imageDataPrefilterSelect(isX, x, imageDataPrefilterSelect(isY, y, z)));
+
+	__m128 side = imageDataPrefilterSelect(isX, imageDataPrefilterSelect(positiveX, zero, one), imageDataPrefilterSelect(isY, imageDataPrefilterSelect(positiveY, _mm_set1_ps(2.0f), _mm_set1_ps(3.0f)), imageDataPrefilterSelect(positiveZ, _mm_set1_ps(4.0f), _mm_set1_ps(5.0f))));
+
+	const __m128 length = _mm_set1_ps((float)cubeMap.length);
+
+	__m128 s = _mm_mul_ps(_mm_add_ps(_mm_mul_ps(half, _mm_div_ps(sc, rc)), half), length);
+	__m128 t = _mm_mul_ps(_mm_add_ps(_mm_mul_ps(half, _mm_div_ps(tc, rc)), half), length);
+
+	__m128 neighbourS = imageDataPrefilterSelect(_mm_cmplt_ps(_mm_sub_ps(s, imageDataPrefilterFloor(s)), half), _mm_sub_ps(s, one), _mm_add_ps(s, one));
+	__m128 neighbourT = imageDataPrefilterSelect(_mm_cmplt_ps(_mm_sub_ps(t, imageDataPrefilterFloor(t)), half), _mm_sub_ps(t, one), _mm_add_ps(t, one));
+
+	const __m128 maxCoordinate = _mm_set1_ps((float)(cubeMap.length - 1));
+
+	int32_t allS0[4];
+	int32_t allS1[4];
+	int32_t allT0[4];
+	int32_t allT1[4];
+	int32_t allSides[4];
+
+	_mm_storeu_si128((__m128i*)allS0, _mm_cvttps_epi32(_mm_min_ps(_mm_max_ps(s, zero), maxCoordinate)));
+	_mm_storeu_si128((__m128i*)allS1, _mm_cvttps_epi32(_mm_min_ps(_mm_max_ps(neighbourS, zero), maxCoordinate)));
+	_mm_storeu_si128((__m128i*)allT0, _mm_cvttps_epi32(_mm_min_ps(_mm_max_ps(t, zero), maxCoordinate)));
+	_mm_storeu_si128((__m128i*)allT1, _mm_cvttps_epi32(_mm_min_ps(_mm_max_ps(neighbourT, zero), maxCoordinate)));
+	_mm_storeu_si128((__m128i*)allSides, _mm_cvttps_epi32(side));
+
+	__m128 result = zero;
+
+	for (uint32_t i = 0; i < 4; i++)
+	{
+		if (weight[i] == 0.0f)
+		{
+			continue;
+		}
+
+		const float* face = cubeMap.allFaces[allSides[i]];
+
+		const int32_t row0 = allT0[i] * cubeMap.length;
+		const int32_t row1 = allT1[i] * cubeMap.length;
+
+		__m128 texels = _mm_add_ps(_mm_add_ps(_mm_loadu_ps(&face[(row0 + allS0[i]) * 4]), _mm_loadu_ps(&face[(row0 + allS1[i]) * 4])), _mm_add_ps(_mm_loadu_ps(&face[(row1 + allS0[i]) * 4]), _mm_loadu_ps(&face[(row1 + allS1[i]) * 4])));
+
+		result = _mm_add_ps(result, _mm_mul_ps(texels, _mm_set1_ps(weight[i] * 0.25f)));
+	}
+
+	return result;
+}
+
+#endif
+
+static glm::vec4 imageDataPrefilterIntegrate(const PrefilterCubeMap& cubeMap, const PrefilterDirections& directions, const glm::mat3& basis, const glm::vec3& V)
+{
+	if (directions.divisor == 0.0f)
+	{
+		return glm::vec4(0.0f, 0.0f, 0.0f, 1.0f);
+	}
+
+	glm::vec4 result;
+
+#ifdef VKTS_PREFILTER_SSE2
+
+	const __m128 basis0X = _mm_set1_ps(basis[0].x);
+	const __m128 basis0Y = _mm_set1_ps(basis[0].y);
+	const __m128 basis0Z = _mm_set1_ps(basis[0].z);
+	const __m128 basis1X = _mm_set1_ps(basis[1].x);
+	const __m128 basis1Y = _mm_set1_ps(basis[1].y);
+	const __m128 basis1Z = _mm_set1_ps(basis[1].z);
+	const __m128 basis2X = _mm_set1_ps(basis[2].x);
+	const __m128 basis2Y = _mm_set1_ps(basis[2].y);
+	const __m128 basis2Z = _mm_set1_ps(basis[2].z);
+
+	const __m128 VX = _mm_set1_ps(V.x);
+	const __m128 VY = _mm_set1_ps(V.y);
+	const __m128 VZ = _mm_set1_ps(V.z);
+
+	__m128 sum = _mm_setzero_ps();
+
+	for (size_t i = 0; i < directions.x.size(); i += 4)
+	{
+		__m128 tangentX = _mm_loadu_ps(&directions.x[i]);
+		__m128 tangentY = _mm_loadu_ps(&directions.y[i]);
+		__m128 tangentZ = _mm_loadu_ps(&directions.z[i]);
+
+		// Transform to world space.
+		__m128 x = _mm_add_ps(_mm_add_ps(_mm_mul_ps(basis0X, tangentX), _mm_mul_ps(basis1X, tangentY)), _mm_mul_ps(basis2X, tangentZ));
+		__m128 y = _mm_add_ps(_mm_add_ps(_mm_mul_ps(basis0Y, tangentX), _mm_mul_ps(basis1Y, tangentY)), _mm_mul_ps(basis2Y, tangentZ));
+		__m128 z = _mm_add_ps(_mm_add_ps(_mm_mul_ps(basis0Z, tangentX), _mm_mul_ps(basis1Z, tangentY)), _mm_mul_ps(basis2Z, tangentZ));
+
+		if (directions.reflect)
+		{
+			// L = reflect(-V, H)
+			__m128 twoVdotH = _mm_mul_ps(_mm_set1_ps(2.0f), _mm_add_ps(_mm_add_ps(_mm_mul_ps(x, VX), _mm_mul_ps(y, VY)), _mm_mul_ps(z, VZ)));
+
+			x = _mm_sub_ps(_mm_mul_ps(twoVdotH, x), VX);
+			y = _mm_sub_ps(_mm_mul_ps(twoVdotH, y), VY);
+			z = _mm_sub_ps(_mm_mul_ps(twoVdotH, z), VZ);
+		}
+
+		sum = _mm_add_ps(sum, imageDataPrefilterSample4(cubeMap, x, y, z, &directions.weight[i]));
+	}
+
+	_mm_storeu_ps(&result[0], sum);
+
+#else
+
+	result = glm::vec4(0.0f, 0.0f, 0.0f, 0.0f);
+
+	for (size_t i = 0; i < directions.x.size(); i++)
+	{
+		if (directions.weight[i] == 0.0f)
+		{
+			continue;
+		}
+
+		glm::vec3 L = basis * glm::vec3(directions.x[i], directions.y[i], directions.z[i]);
+
+		if (directions.reflect)
+		{
+			L = glm::reflect(-V, L);
+		}
+
+		result += imageDataPrefilterSample(cubeMap, L.x, L.y, L.z) * directions.weight[i];
+	}
+
+#endif
+
+	return glm::vec4(glm::vec3(result) / directions.divisor, 1.0f);
+}
+
+static VkBool32 imageDataPrefilterProcessTile(const PrefilterCubeMap& cubeMap, PrefilterTarget& target, const uint32_t startX, const uint32_t startY)
+{
+	// 0.5 as step goes form -1.0 to 1.0 and not just 0.0 to 1.0
+	float step = 2.0f / (float)target.length;
+	float offset = step * 0.5f;
+
+	uint32_t endX = glm::min(startX + VKTS_PREFILTER_TILE_SIZE, target.length);
+	uint32_t endY = glm::min(startY + VKTS_PREFILTER_TILE_SIZE, target.length);
+
+	for (uint32_t y = startY; y < endY; y++)
+	{
+		for (uint32_t x = startX; x < endX; x++)
+		{
+			// N = V
+			glm::vec3 scanVector = imageDataGetScanVector(x, y, target.side, step, offset);
+
+			glm::vec4 color = imageDataPrefilterIntegrate(cubeMap, *target.directions, renderGetBasis(scanVector), scanVector);
+
+			memcpy(&target.allTexels[(y * target.length + x) * 4], &color[0], sizeof(float) * 4);
+		}
+	}
+
+	return VK_TRUE;
+}
+
+static VkBool32 imageDataPrefilterProcess(const PrefilterCubeMap& cubeMap, std::vector<PrefilterTarget>& allTargets)
+{
+	std::vector<PrefilterTile> allTiles;
+
+	for (uint32_t targetIndex = 0; targetIndex < (uint32_t)allTargets.size(); targetIndex++)
+	{
+		allTargets[targetIndex].allTexels.resize((size_t)allTargets[targetIndex].length * (size_t)allTargets[targetIndex].length * 4);
+
+		for (uint32_t y = 0; y < allTargets[targetIndex].length; y += VKTS_PREFILTER_TILE_SIZE)
+		{
+			for (uint32_t x = 0; x < allTargets[targetIndex].length; x += VKTS_PREFILTER_TILE_SIZE)
+			{
+				allTiles.push_back(PrefilterTile{targetIndex, x, y});
+			}
+		}
+	}
+
+	// Tiles do write to different texels, so no synchronization is needed.
+	auto rangeFunction = [&cubeMap, &allTargets, &allTiles](const uint32_t first, const uint32_t last) -> VkBool32
+	{
+		for (uint32_t i = first; i < last; i++)
+		{
+			if (!imageDataPrefilterProcessTile(cubeMap, allTargets[allTiles[i].targetIndex], allTiles[i].x, allTiles[i].y))
+			{
+				return VK_FALSE;
+			}
+		}
+
+		return VK_TRUE;
+	};
+
+	return imageDataParallelFor((uint32_t)allTiles.size(), 1, rangeFunction);
+}
+
+static VkBool32 imageDataPrefilterStore(const IImageDataSP& targetImage, const PrefilterTarget& target)
+{
+	// RGBA floats are uploaded at once, all other formats are converted per texel.
+	if (targetImage->isSFLOAT() && targetImage->getNumberChannels() == 4 && targetImage->getBytesPerChannel() == sizeof(float))
+	{
+		VkSubresourceLayout subresourceLayout;
+
+		subresourceLayout.offset = 0;
+		subresourceLayout.size = (VkDeviceSize)(target.allTexels.size() * sizeof(float));
+		subresourceLayout.rowPitch = (VkDeviceSize)(target.length * 4 * sizeof(float));
+		subresourceLayout.arrayPitch = subresourceLayout.size;
+		subresourceLayout.depthPitch = subresourceLayout.size;
+
+		return targetImage->upload(&target.allTexels[0], 0, 0, subresourceLayout);
+	}
+
+	for (uint32_t y = 0; y < target.length; y++)
+	{
+		for (uint32_t x = 0; x < target.length; x++)
+		{
+			targetImage->setTexel(glm::make_vec4(&target.allTexels[(y * target.length + x) * 4]), x, y, 0, 0, 0);
+		}
+	}
+
+	return VK_TRUE;
+}
+
+static VkBool32 imageDataPrefilterRun(const IImageDataSP& sourceImage, const SmartPointerVector<IImageDataSP>& allTargetImages, std::vector<PrefilterTarget>& allTargets)
+{
+	PrefilterCubeMap cubeMap;
+
+	if (!imageDataPrefilterGetCubeMap(cubeMap, sourceImage))
+	{
+		return VK_FALSE;
+	}
+
+	if (!imageDataPrefilterProcess(cubeMap, allTargets))
+	{
+		return VK_FALSE;
+	}
+
+	for (uint32_t i = 0; i < (uint32_t)allTargets.size(); i++)
+	{
+		if (!imageDataPrefilterStore(allTargetImages[i], allTargets[i]))
+		{
+			return VK_FALSE;
+		}
+	}
+
+	return VK_TRUE;
+}
+
 SmartPointerVector<IImageDataSP> VKTS_APIENTRY imageDataPrefilterCookTorrance(const IImageDataSP& sourceImage, const uint32_t samples, const std::string& name)
 {
     if (name.size() == 0 || !sourceImage.get() || sourceImage->getArrayLayers() != 6 || sourceImage->getDepth() != 1 || sourceImage->getWidth() != sourceImage->getHeight() || samples == 0 || sourceImage->getWidth() < 2)
@@ -138,66 +617,43 @@ SmartPointerVector<IImageDataSP> VKTS_APIENTRY imageDataPrefilterCookTorrance(co
 
     uint32_t roughnessSamples = result.size() / 6;
 
-    for (uint32_t side = 0; side < 6; side++)
-    {
-    	for (uint32_t roughnessSampleIndex = 0; roughnessSampleIndex < roughnessSamples; roughnessSampleIndex++)
-    	{
-    		uint32_t length = sourceImage->getWidth() / (1 << roughnessSampleIndex);
-
-    		// 0.5 as step goes form -1.0 to 1.0 and not just 0.0 to 1.0
-    		float step = 2.0f / (float)length;
-    		float offset = step * 0.5f;
-
-    		//
-
-    		float roughness = (float)roughnessSampleIndex / (float)(roughnessSamples - 1);
-
-    		//
-
-    		glm::vec3 scanVector;
-
-    		for (uint32_t y = 0; y < length; y++)
-    		{
-    			for (uint32_t x = 0; x < length; x++)
-    			{
-    				scanVector = imageDataGetScanVector(x, y, side, step, offset);
-
-    				//
-
-    				glm::mat3 basis = renderGetBasis(scanVector);
-
-    				glm::vec3 colorCookTorrance = glm::vec3(0.0f, 0.0f, 0.0f);
-
-    				float sampleDivisior = 0.0f;
+    // The half vectors only depend on the roughness, so they are shared by all sides and texels.
+    std::vector<PrefilterDirections> allDirections(roughnessSamples);
 
-    				for (uint32_t sampleIndex = 0; sampleIndex < samples; sampleIndex++)
-    				{
-    					glm::vec2 randomPoint = randomHammersley(sampleIndex, samples);
+	for (uint32_t roughnessSampleIndex = 0; roughnessSampleIndex < roughnessSamples; roughnessSampleIndex++)
+	{
+		float roughness = (float)roughnessSampleIndex / (float)(roughnessSamples - 1);
 
-    					// N = V
-    					auto currentColorCookTorrance = renderCookTorrance(sourceImage, VK_FILTER_LINEAR, 0, randomPoint, basis, scanVector, roughness);
+		allDirections[roughnessSampleIndex].divisor = 0.0f;
+		allDirections[roughnessSampleIndex].reflect = VK_TRUE;
 
-    					if (!std::isnan(currentColorCookTorrance.x) && !std::isnan(currentColorCookTorrance.y) && !std::isnan(currentColorCookTorrance.z))
-    					{
-    						colorCookTorrance += currentColorCookTorrance;
+		for (uint32_t sampleIndex = 0; sampleIndex < samples; sampleIndex++)
+		{
+			imageDataPrefilterAddDirection(allDirections[roughnessSampleIndex], renderGetGGXWeightedVector(randomHammersley(sampleIndex, samples), roughness), 1.0f);
+		}
 
-    						sampleDivisior += 1.0f;
-    					}
-    				}
+		imageDataPrefilterPadDirections(allDirections[roughnessSampleIndex]);
+	}
 
-    				//
+    std::vector<PrefilterTarget> allTargets(result.size());
 
-    				if (sampleDivisior > 0.0f)
-    				{
-    					colorCookTorrance = colorCookTorrance / sampleDivisior;
-    				}
+    for (uint32_t side = 0; side < 6; side++)
+    {
+    	for (uint32_t roughnessSampleIndex = 0; roughnessSampleIndex < roughnessSamples; roughnessSampleIndex++)
+    	{
+    		auto& currentTarget = allTargets[side * roughnessSamples + roughnessSampleIndex];
 
-    				result[side * roughnessSamples + roughnessSampleIndex]->setTexel(glm::vec4(colorCookTorrance, 1.0f), x, y, 0, 0, 0);
-    			}
-    		}
+    		currentTarget.side = side;
+    		currentTarget.length = sourceImage->getWidth() / (1 << roughnessSampleIndex);
+    		currentTarget.directions = &allDirections[roughnessSampleIndex];
     	}
     }
 
+    if (!imageDataPrefilterRun(sourceImage, result, allTargets))
+    {
+    	return SmartPointerVector<IImageDataSP>();
+    }
+
     //
 
     return result;
@@ -261,63 +717,50 @@ SmartPointerVector<IImageDataSP> VKTS_APIENTRY imageDataPrefilterOrenNayar(const
 
     uint32_t roughnessSamples = result.size() / 6;
 
-    uint32_t length = sourceImage->getWidth();
-
-    // 0.5 as step goes form -1.0 to 1.0 and not just 0.0 to 1.0
-	float step = 2.0f / (float)length;
-	float offset = step * 0.5f;
-
-    for (uint32_t side = 0; side < 6; side++)
-    {
-    	glm::vec3 scanVector;
-
-    	for (uint32_t y = 0; y < length; y++)
-    	{
-    		for (uint32_t x = 0; x < length; x++)
-    		{
-    			scanVector = imageDataGetScanVector(x, y, side, step, offset);
-
-    			//
-
-    			glm::mat3 basis = renderGetBasis(scanVector);
-
-    			for (uint32_t roughnessSampleIndex = 0; roughnessSampleIndex < roughnessSamples; roughnessSampleIndex++)
-    			{
-    				glm::vec3 colorOrenNayar = glm::vec3(0.0f, 0.0f, 0.0f);
+    // The light vectors only depend on the roughness, so they are shared by all sides and texels.
+    std::vector<PrefilterDirections> allDirections(roughnessSamples);
 
-    				float roughness = (float)roughnessSampleIndex / (float)(roughnessSamples - 1);
+	for (uint32_t roughnessSampleIndex = 0; roughnessSampleIndex < roughnessSamples; roughnessSampleIndex++)
+	{
+		float roughness = roughnessSamples > 1 ? (float)roughnessSampleIndex / (float)(roughnessSamples - 1) : 0.0f;
 
-    				float sampleDivisior = 0.0f;
+		float roughnessSquared = roughness * roughness;
 
-    				for (uint32_t sampleIndex = 0; sampleIndex < samples; sampleIndex++)
-    				{
-    					glm::vec2 randomPoint = randomHammersley(sampleIndex, samples);
+		float A = 1.0f - 0.5f * (roughnessSquared / (roughnessSquared + 0.57f));
 
-    					// N = V
-    					auto currentColorOrenNayar = renderOrenNayar(sourceImage, VK_FILTER_LINEAR, 0, randomPoint, basis, scanVector, scanVector, roughness);
+		allDirections[roughnessSampleIndex].divisor = 0.0f;
+		allDirections[roughnessSampleIndex].reflect = VK_FALSE;
 
-    					if (!std::isnan(currentColorOrenNayar.x) && !std::isnan(currentColorOrenNayar.y) && !std::isnan(currentColorOrenNayar.z))
-    					{
-    						colorOrenNayar += currentColorOrenNayar;
+		for (uint32_t sampleIndex = 0; sampleIndex < samples; sampleIndex++)
+		{
+			glm::vec3 LtangentSpace = renderGetCosineWeightedVector(randomHammersley(sampleIndex, samples));
 
-    						sampleDivisior += 1.0f;
-    					}
+			// N = V, so gamma and C are zero and only A is left. NdotL is z in tangent space.
+			imageDataPrefilterAddDirection(allDirections[roughnessSampleIndex], LtangentSpace, glm::max(0.0f, LtangentSpace.z) * A);
+		}
 
-    				}
+		imageDataPrefilterPadDirections(allDirections[roughnessSampleIndex]);
+	}
 
-    				//
+    std::vector<PrefilterTarget> allTargets(result.size());
 
-    				if (sampleDivisior > 0.0f)
-    				{
-    					colorOrenNayar = colorOrenNayar / sampleDivisior;
-    				}
+    for (uint32_t side = 0; side < 6; side++)
+    {
+    	for (uint32_t roughnessSampleIndex = 0; roughnessSampleIndex < roughnessSamples; roughnessSampleIndex++)
+    	{
+    		auto& currentTarget = allTargets[side * roughnessSamples + roughnessSampleIndex];
 
-    				result[side * roughnessSamples + roughnessSampleIndex]->setTexel(glm::vec4(colorOrenNayar, 1.0f), x, y, 0, 0, 0);
-    			}
-    		}
+    		currentTarget.side = side;
+    		currentTarget.length = result[side * roughnessSamples + roughnessSampleIndex]->getWidth();
+    		currentTarget.directions = &allDirections[roughnessSampleIndex];
     	}
     }
 
+    if (!imageDataPrefilterRun(sourceImage, result, allTargets))
+    {
+    	return SmartPointerVector<IImageDataSP>();
+    }
+
     //
 
     return result;
@@ -366,54 +809,30 @@ SmartPointerVector<IImageDataSP> VKTS_APIENTRY imageDataPrefilterLambert(const I
     // Lambert diffuse.
     //
 
-    uint32_t length = sourceImage->getWidth();
+    PrefilterDirections directions;
 
-    // 0.5 as step goes form -1.0 to 1.0 and not just 0.0 to 1.0
-	float step = 2.0f / (float)length;
-	float offset = step * 0.5f;
+    directions.divisor = 0.0f;
+    directions.reflect = VK_FALSE;
 
-    for (uint32_t side = 0; side < 6; side++)
+    for (uint32_t sampleIndex = 0; sampleIndex < samples; sampleIndex++)
     {
-    	glm::vec3 scanVector;
-
-    	for (uint32_t y = 0; y < length; y++)
-    	{
-    		for (uint32_t x = 0; x < length; x++)
-    		{
-    			scanVector = imageDataGetScanVector(x, y, side, step, offset);
-
-    			//
-
-    			glm::mat3 basis = renderGetBasis(scanVector);
-
-    			glm::vec3 colorLambert = glm::vec3(0.0f, 0.0f, 0.0f);
-
-    			float sampleDivisior = 0.0f;
-
-    			for (uint32_t sampleIndex = 0; sampleIndex < samples; sampleIndex++)
-    			{
-    				glm::vec2 randomPoint = randomHammersley(sampleIndex, samples);
-
-    				auto currentColorLambert = renderLambert(sourceImage, VK_FILTER_LINEAR, 0, randomPoint, basis);
-
-    				if (!std::isnan(currentColorLambert.x) && !std::isnan(currentColorLambert.y) && !std::isnan(currentColorLambert.z))
-    				{
-    					colorLambert += currentColorLambert;
+    	imageDataPrefilterAddDirection(directions, renderGetCosineWeightedVector(randomHammersley(sampleIndex, samples)), 1.0f);
+    }
 
-    					sampleDivisior += 1.0f;
-    				}
-    			}
+    imageDataPrefilterPadDirections(directions);
 
-    			//
+    std::vector<PrefilterTarget> allTargets(6);
 
-    			if (sampleDivisior > 0.0f)
-    			{
-    				colorLambert = colorLambert / sampleDivisior;
-    			}
+    for (uint32_t side = 0; side < 6; side++)
+    {
+    	allTargets[side].side = side;
+    	allTargets[side].length = sourceImage->getWidth();
+    	allTargets[side].directions = &directions;
+    }
 
-    			result[side]->setTexel(glm::vec4(colorLambert, 1.0f), x, y, 0, 0, 0);
-    		}
-    	}
+    if (!imageDataPrefilterRun(sourceImage, result, allTargets))
+    {
+    	return SmartPointerVector<IImageDataSP>();
     }
 
     //
@@ -218,4 +218,19 @@ Aabb& Aabb::operator +=(const Aabb& other)
 	return *this;
 }
 
+//
+
+Aabb operator *(const glm::mat4& transform, const Aabb& box)
+{
+	// Transformed center and extent, without transforming all eight corners.
+
+	glm::vec3 center = glm::vec3(box.getCorner(0) + box.getCorner(1)) * 0.5f;
+	glm::vec3 extent = glm::vec3(box.getCorner(1) - box.getCorner(0)) * 0.5f;
+
+	glm::vec3 transformedCenter = glm::vec3(transform * glm::vec4(center, 1.0f));
+	glm::vec3 transformedExtent = glm::abs(glm::vec3(transform[0])) * extent.x + glm::abs(glm::vec3(transform[1])) * extent.y + glm::abs(glm::vec3(transform[2])) * extent.z;
+
+	return Aabb(glm::vec4(transformedCenter - transformedExtent, 1.0f), glm::vec4(transformedCenter + transformedExtent, 1.0f));
+}
+
 } /* namespace vkts */
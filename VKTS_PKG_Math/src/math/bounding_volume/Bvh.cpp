@@ -0,0 +1,618 @@
+/**
+ * VKTS - VulKan ToolS.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) since 2014 Norbert Nopper
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <vkts/math/vkts_math.hpp>
+
+namespace vkts
+{
+
+static float bvhArea(const glm::vec3& min, const glm::vec3& max)
+{
+	glm::vec3 extent = glm::max(max - min, glm::vec3(0.0f, 0.0f, 0.0f));
+
+	return extent.x * extent.y + extent.y * extent.z + extent.z * extent.x;
+}
+
+// Returns -1 for outside, 1 for completely inside and 0 for intersecting the plane.
+static int32_t bvhClassify(const Plane& plane, const glm::vec3& min, const glm::vec3& max)
+{
+	const glm::vec3& normal = plane.getNormal();
+
+	glm::vec3 positive = glm::vec3(normal.x >= 0.0f ? max.x : min.x, normal.y >= 0.0f ? max.y : min.y, normal.z >= 0.0f ? max.z : min.z);
+
+	if (glm::dot(normal, positive) + plane.getD() < 0.0f)
+	{
+		return -1;
+	}
+
+	glm::vec3 negative = glm::vec3(normal.x >= 0.0f ? min.x : max.x, normal.y >= 0.0f ? min.y : max.y, normal.z >= 0.0f ? min.z : max.z);
+
+	if (glm::dot(normal, negative) + plane.getD() >= 0.0f)
+	{
+		return 1;
+	}
+
+	return 0;
+}
+
+// Returns VK_FALSE, if outside. Planes, which contain the box completely, are removed from the mask.
+static VkBool32 bvhCull(const Frustum& frustum, const glm::vec3& min, const glm::vec3& max, uint32_t& planeMask)
+{
+	for (uint32_t i = 0; i < 6; i++)
+	{
+		if (!(planeMask & (1 << i)))
+		{
+			continue;
+		}
+
+		int32_t result = bvhClassify(frustum.getSide(i), min, max);
+
+		if (result < 0)
+		{
+			return VK_FALSE;
+		}
+
+		if (result > 0)
+		{
+			planeMask &= ~(1 << i);
+		}
+	}
+
+	return VK_TRUE;
+}
+
+static VkBool32 bvhIntersect(const glm::vec3& min, const glm::vec3& max, const glm::vec3& otherMin, const glm::vec3& otherMax)
+{
+	return !(max.x < otherMin.x || max.y < otherMin.y || max.z < otherMin.z || min.x > otherMax.x || min.y > otherMax.y || min.z > otherMax.z);
+}
+
+static VkBool32 bvhIntersectRay(const glm::vec3& min, const glm::vec3& max, const glm::vec3& origin, const glm::vec3& inverseDirection)
+{
+	// Slab test.
+
+	glm::vec3 t0 = (min - origin) * inverseDirection;
+	glm::vec3 t1 = (max - origin) * inverseDirection;
+
+	glm::vec3 tNear = glm::min(t0, t1);
+	glm::vec3 tFar = glm::max(t0, t1);
+
+	float enter = glm::max(glm::max(tNear.x, tNear.y), glm::max(tNear.z, 0.0f));
+	float exit = glm::min(glm::min(tFar.x, tFar.y), tFar.z);
+
+	return enter <= exit;
+}
+
+void Bvh::buildRecursive(const uint32_t nodeIndex, const uint32_t first, const uint32_t count)
+{
+	glm::vec3 min = allItemMins[allItemIndices[first]];
+	glm::vec3 max = allItemMaxs[allItemIndices[first]];
+
+	glm::vec3 centroidMin = (min + max) * 0.5f;
+	glm::vec3 centroidMax = centroidMin;
+
+	for (uint32_t i = first + 1; i < first + count; i++)
+	{
+		const uint32_t item = allItemIndices[i];
+
+		min = glm::min(min, allItemMins[item]);
+		max = glm::max(max, allItemMaxs[item]);
+
+		glm::vec3 centroid = (allItemMins[item] + allItemMaxs[item]) * 0.5f;
+
+		centroidMin = glm::min(centroidMin, centroid);
+		centroidMax = glm::max(centroidMax, centroid);
+	}
+
+	allNodes[nodeIndex].min = min;
+	allNodes[nodeIndex].max = max;
+
+	allNodes[nodeIndex].first = first;
+	allNodes[nodeIndex].count = count;
+
+	for (uint32_t i = first; i < first + count; i++)
+	{
+		allItemLeaves[allItemIndices[i]] = nodeIndex;
+	}
+
+	if (count <= VKTS_BVH_MAX_LEAF_ITEMS)
+	{
+		return;
+	}
+
+	// Split along the largest extent of the centroids.
+
+	glm::vec3 centroidExtent = centroidMax - centroidMin;
+
+	int32_t axis = 0;
+
+	if (centroidExtent.y > centroidExtent[axis])
+	{
+		axis = 1;
+	}
+	if (centroidExtent.z > centroidExtent[axis])
+	{
+		axis = 2;
+	}
+
+	uint32_t middle = first + count / 2;
+
+	if (centroidExtent[axis] > 0.0f)
+	{
+		// Binned surface area heuristic.
+
+		uint32_t binCounts[VKTS_BVH_BINS] = {0};
+		glm::vec3 binMins[VKTS_BVH_BINS];
+		glm::vec3 binMaxs[VKTS_BVH_BINS];
+
+		const float binScale = (float)VKTS_BVH_BINS / centroidExtent[axis];
+
+		for (uint32_t i = first; i < first + count; i++)
+		{
+			const uint32_t item = allItemIndices[i];
+
+			float centroid = (allItemMins[item][axis] + allItemMaxs[item][axis]) * 0.5f;
+
+			uint32_t bin = glm::min((uint32_t)((centroid - centroidMin[axis]) * binScale), (uint32_t)VKTS_BVH_BINS - 1);
+
+			if (binCounts[bin] == 0)
+			{
+				binMins[bin] = allItemMins[item];
+				binMaxs[bin] = allItemMaxs[item];
+			}
+			else
+			{
+				binMins[bin] = glm::min(binMins[bin], allItemMins[item]);
+				binMaxs[bin] = glm::max(binMaxs[bin], allItemMaxs[item]);
+			}
+
+			binCounts[bin]++;
+		}
+
+		// Sweep from the right, afterwards from the left to find the cheapest split.
+
+		float rightCosts[VKTS_BVH_BINS];
+
+		uint32_t rightCount = 0;
+		glm::vec3 rightMin;
+		glm::vec3 rightMax;
+
+		for (int32_t bin = VKTS_BVH_BINS - 1; bin > 0; bin--)
+		{
+			if (binCounts[bin] > 0)
+			{
+				rightMin = rightCount == 0 ? binMins[bin] : glm::min(rightMin, binMins[bin]);
+				rightMax = rightCount == 0 ? binMaxs[bin] : glm::max(rightMax, binMaxs[bin]);
+
+				rightCount += binCounts[bin];
+			}
+
+			rightCosts[bin] = rightCount > 0 ? (float)rightCount * bvhArea(rightMin, rightMax) : 0.0f;
+		}
+
+		float bestCost = (float)count * bvhArea(min, max);
+		int32_t bestBin = -1;
+
+		uint32_t leftCount = 0;
+		glm::vec3 leftMin;
+		glm::vec3 leftMax;
+
+		for (int32_t bin = 0; bin < VKTS_BVH_BINS - 1; bin++)
+		{
+			if (binCounts[bin] > 0)
+			{
+				leftMin = leftCount == 0 ? binMins[bin] : glm::min(leftMin, binMins[bin]);
+				leftMax = leftCount == 0 ? binMaxs[bin] : glm::max(leftMax, binMaxs[bin]);
+
+				leftCount += binCounts[bin];
+			}
+
+			if (leftCount == 0 || leftCount == count)
+			{
+				continue;
+			}
+
+			float cost = (float)leftCount * bvhArea(leftMin, leftMax) + rightCosts[bin + 1];
+
+			if (cost < bestCost)
+			{
+				bestCost = cost;
+				bestBin = bin;
+			}
+		}
+
+		if (bestBin >= 0)
+		{
+			auto splitIterator = std::partition(allItemIndices.begin() + first, allItemIndices.begin() + first + count, [&](const uint32_t item) {
+				float centroid = (allItemMins[item][axis] + allItemMaxs[item][axis]) * 0.5f;
+
+				return (int32_t)glm::min((uint32_t)((centroid - centroidMin[axis]) * binScale), (uint32_t)VKTS_BVH_BINS - 1) <= bestBin;
+			});
+
+			middle = (uint32_t)(splitIterator - allItemIndices.begin());
+		}
+		else if (count <= VKTS_BVH_BINS)
+		{
+			// Splitting is more expensive than testing all items.
+
+			return;
+		}
+		else
+		{
+			std::nth_element(allItemIndices.begin() + first, allItemIndices.begin() + middle, allItemIndices.begin() + first + count, [&](const uint32_t left, const uint32_t right) {
+				return allItemMins[left][axis] + allItemMaxs[left][axis] < allItemMins[right][axis] + allItemMaxs[right][axis];
+			});
+		}
+	}
+
+	// Children are stored next to each other.
+
+	const uint32_t childIndex = (uint32_t)allNodes.size();
+
+	allNodes.resize(childIndex + 2);
+	allParents.resize(childIndex + 2, nodeIndex);
+
+	allNodes[nodeIndex].first = childIndex;
+	allNodes[nodeIndex].count = 0;
+
+	buildRecursive(childIndex, first, middle - first);
+	buildRecursive(childIndex + 1, middle, first + count - middle);
+}
+
+void Bvh::gatherRecursive(const uint32_t nodeIndex, std::vector<uint32_t>& allItems) const
+{
+	const BvhNode& node = allNodes[nodeIndex];
+
+	if (node.count > 0)
+	{
+		allItems.insert(allItems.end(), allItemIndices.begin() + node.first, allItemIndices.begin() + node.first + node.count);
+
+		return;
+	}
+
+	gatherRecursive(node.first, allItems);
+	gatherRecursive(node.first + 1, allItems);
+}
+
+Bvh::Bvh() :
+	allNodes(), allParents(), allNodesDirty(), allItemIndices(), allItemMins(), allItemMaxs(), allItemSlots(), allItemLeaves(), anyNodeDirty(VK_FALSE)
+{
+}
+
+Bvh::~Bvh()
+{
+}
+
+void Bvh::reset()
+{
+	allNodes.clear();
+	allParents.clear();
+	allNodesDirty.clear();
+
+	allItemIndices.clear();
+
+	allItemMins.clear();
+	allItemMaxs.clear();
+
+	allItemSlots.clear();
+	allItemLeaves.clear();
+
+	anyNodeDirty = VK_FALSE;
+}
+
+void Bvh::build(const std::vector<Aabb>& allBoxes)
+{
+	reset();
+
+	if (allBoxes.size() == 0)
+	{
+		return;
+	}
+
+	const uint32_t count = (uint32_t)allBoxes.size();
+
+	allItemIndices.resize(count);
+
+	allItemMins.resize(count);
+	allItemMaxs.resize(count);
+
+	allItemSlots.resize(count);
+	allItemLeaves.resize(count);
+
+	for (uint32_t i = 0; i < count; i++)
+	{
+		allItemIndices[i] = i;
+
+		allItemMins[i] = glm::vec3(allBoxes[i].getCorner(0));
+		allItemMaxs[i] = glm::vec3(allBoxes[i].getCorner(1));
+	}
+
+	allNodes.reserve(2 * (count / VKTS_BVH_MAX_LEAF_ITEMS + 1));
+	allParents.reserve(allNodes.capacity());
+
+	allNodes.resize(1);
+	allParents.resize(1, UINT32_MAX);
+
+	buildRecursive(0, 0, count);
+
+	allNodesDirty.resize(allNodes.size(), 0);
+
+	// Store the boxes in leaf order.
+
+	std::vector<glm::vec3> allLeafMins(count);
+	std::vector<glm::vec3> allLeafMaxs(count);
+
+	for (uint32_t slot = 0; slot < count; slot++)
+	{
+		const uint32_t item = allItemIndices[slot];
+
+		allLeafMins[slot] = allItemMins[item];
+		allLeafMaxs[slot] = allItemMaxs[item];
+
+		allItemSlots[item] = slot;
+	}
+
+	allItemMins.swap(allLeafMins);
+	allItemMaxs.swap(allLeafMaxs);
+}
+
+uint32_t Bvh::getSize() const
+{
+	return (uint32_t)allItemMins.size();
+}
+
+uint32_t Bvh::getNodeCount() const
+{
+	return (uint32_t)allNodes.size();
+}
+
+void Bvh::setBox(const uint32_t item, const Aabb& box)
+{
+	if (item >= getSize())
+	{
+		return;
+	}
+
+	glm::vec3 min = glm::vec3(box.getCorner(0));
+	glm::vec3 max = glm::vec3(box.getCorner(1));
+
+	const uint32_t slot = allItemSlots[item];
+
+	if (min == allItemMins[slot] && max == allItemMaxs[slot])
+	{
+		return;
+	}
+
+	allItemMins[slot] = min;
+	allItemMaxs[slot] = max;
+
+	// Mark the path to the root.
+
+	uint32_t nodeIndex = allItemLeaves[item];
+
+	while (nodeIndex != UINT32_MAX && !allNodesDirty[nodeIndex])
+	{
+		allNodesDirty[nodeIndex] = 1;
+
+		nodeIndex = allParents[nodeIndex];
+	}
+
+	anyNodeDirty = VK_TRUE;
+}
+
+void Bvh::refit()
+{
+	if (!anyNodeDirty)
+	{
+		return;
+	}
+
+	// Children are always stored after their parent.
+
+	for (uint32_t nodeIndex = (uint32_t)allNodes.size(); nodeIndex-- > 0;)
+	{
+		if (!allNodesDirty[nodeIndex])
+		{
+			continue;
+		}
+
+		BvhNode& node = allNodes[nodeIndex];
+
+		if (node.count > 0)
+		{
+			node.min = allItemMins[node.first];
+			node.max = allItemMaxs[node.first];
+
+			for (uint32_t i = node.first + 1; i < node.first + node.count; i++)
+			{
+				node.min = glm::min(node.min, allItemMins[i]);
+				node.max = glm::max(node.max, allItemMaxs[i]);
+			}
+		}
+		else
+		{
+			node.min = glm::min(allNodes[node.first].min, allNodes[node.first + 1].min);
+			node.max = glm::max(allNodes[node.first].max, allNodes[node.first + 1].max);
+		}
+
+		allNodesDirty[nodeIndex] = 0;
+	}
+
+	anyNodeDirty = VK_FALSE;
+}
+
+void Bvh::cull(const Frustum& frustum, std::vector<uint32_t>& allVisibleItems) const
+{
+	if (allNodes.size() == 0)
+	{
+		return;
+	}
+
+	uint32_t nodeStack[64];
+	uint32_t planeMaskStack[64];
+	uint32_t stackSize = 0;
+
+	nodeStack[stackSize] = 0;
+	planeMaskStack[stackSize] = 0x3F;
+	stackSize++;
+
+	while (stackSize > 0)
+	{
+		stackSize--;
+
+		const BvhNode& node = allNodes[nodeStack[stackSize]];
+		uint32_t planeMask = planeMaskStack[stackSize];
+
+		if (!bvhCull(frustum, node.min, node.max, planeMask))
+		{
+			continue;
+		}
+
+		if (planeMask == 0)
+		{
+			// Completely inside, so no more tests are needed.
+
+			gatherRecursive(nodeStack[stackSize], allVisibleItems);
+
+			continue;
+		}
+
+		if (node.count > 0)
+		{
+			for (uint32_t i = node.first; i < node.first + node.count; i++)
+			{
+				uint32_t itemPlaneMask = planeMask;
+
+				if (bvhCull(frustum, allItemMins[i], allItemMaxs[i], itemPlaneMask))
+				{
+					allVisibleItems.push_back(allItemIndices[i]);
+				}
+			}
+
+			continue;
+		}
+
+		// Tree depth is limited by the number of items, so the stack can only overflow for degenerated trees.
+
+		if (stackSize + 2 > 64)
+		{
+			gatherRecursive(nodeStack[stackSize], allVisibleItems);
+
+			continue;
+		}
+
+		nodeStack[stackSize] = node.first + 1;
+		planeMaskStack[stackSize] = planeMask;
+		stackSize++;
+
+		nodeStack[stackSize] = node.first;
+		planeMaskStack[stackSize] = planeMask;
+		stackSize++;
+	}
+}
+
+void Bvh::intersect(const Aabb& box, std::vector<uint32_t>& allItems) const
+{
+	if (allNodes.size() == 0)
+	{
+		return;
+	}
+
+	const glm::vec3 min = glm::vec3(box.getCorner(0));
+	const glm::vec3 max = glm::vec3(box.getCorner(1));
+
+	std::vector<uint32_t> nodeStack;
+	nodeStack.push_back(0);
+
+	while (nodeStack.size() > 0)
+	{
+		const BvhNode& node = allNodes[nodeStack.back()];
+		nodeStack.pop_back();
+
+		if (!bvhIntersect(node.min, node.max, min, max))
+		{
+			continue;
+		}
+
+		if (node.count > 0)
+		{
+			for (uint32_t i = node.first; i < node.first + node.count; i++)
+			{
+				if (bvhIntersect(allItemMins[i], allItemMaxs[i], min, max))
+				{
+					allItems.push_back(allItemIndices[i]);
+				}
+			}
+
+			continue;
+		}
+
+		nodeStack.push_back(node.first + 1);
+		nodeStack.push_back(node.first);
+	}
+}
+
+void Bvh::intersect(const glm::vec3& origin, const glm::vec3& direction, std::vector<uint32_t>& allItems) const
+{
+	if (allNodes.size() == 0)
+	{
+		return;
+	}
+
+	// Division by zero results in infinity, which is handled by the slab test.
+	const glm::vec3 inverseDirection = glm::vec3(1.0f / direction.x, 1.0f / direction.y, 1.0f / direction.z);
+
+	std::vector<uint32_t> nodeStack;
+	nodeStack.push_back(0);
+
+	while (nodeStack.size() > 0)
+	{
+		const BvhNode& node = allNodes[nodeStack.back()];
+		nodeStack.pop_back();
+
+		if (!bvhIntersectRay(node.min, node.max, origin, inverseDirection))
+		{
+			continue;
+		}
+
+		if (node.count > 0)
+		{
+			for (uint32_t i = node.first; i < node.first + node.count; i++)
+			{
+				if (bvhIntersectRay(allItemMins[i], allItemMaxs[i], origin, inverseDirection))
+				{
+					allItems.push_back(allItemIndices[i]);
+				}
+			}
+
+			continue;
+		}
+
+		nodeStack.push_back(node.first + 1);
+		nodeStack.push_back(node.first);
+	}
+}
+
+} /* namespace vkts */
@@ -26,6 +26,14 @@
 
 #include <vkts/math/vkts_math.hpp>
 
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define VKTS_FRUSTUM_SSE2
+#include <emmintrin.h>
+#endif
+
+// Objects gathered on the stack, before they are culled as structure of arrays.
+#define VKTS_FRUSTUM_CULL_BLOCK 64
+
 namespace vkts
 {
 
@@ -54,6 +62,12 @@ void Frustum::toWorldSpace(const glm::mat4& projectionMatrix, const glm::mat4& v
 	}
 }
 
+const Plane& Frustum::getSide(const uint32_t i) const
+{
+	// No check by purpose.
+	return sidesWorld[i];
+}
+
 VkBool32 Frustum::isVisible(const glm::vec4& pointWorld) const
 {
 	for (auto& currentSide : sidesWorld)
@@ -84,7 +98,19 @@ VkBool32 Frustum::isVisible(const Sphere& sphereWorld) const
 
 VkBool32 Frustum::isVisible(const Aabb& aabbWorld) const
 {
-	return isVisible(aabbWorld.getObb());
+	const glm::vec3 center = glm::vec3(aabbWorld.getCorner(0) + aabbWorld.getCorner(1)) * 0.5f;
+	const glm::vec3 extent = glm::vec3(aabbWorld.getCorner(1) - aabbWorld.getCorner(0)) * 0.5f;
+
+	for (auto& currentSide : sidesWorld)
+	{
+		// Projected extent is the distance of the corner, which is the farthest in normal direction.
+		if (glm::dot(currentSide.getNormal(), center) + currentSide.getD() + glm::dot(glm::abs(currentSide.getNormal()), extent) < 0.0f)
+		{
+			return VK_FALSE;
+		}
+	}
+
+	return VK_TRUE;
 }
 
 VkBool32 Frustum::isVisible(const Obb& obbWorld) const
@@ -112,4 +138,225 @@ VkBool32 Frustum::isVisible(const Obb& obbWorld) const
 	return VK_TRUE;
 }
 
+void Frustum::cull(const Sphere* spheresWorld, const Aabb* aabbsWorld, const uint32_t count, uint8_t* visibleMask) const
+{
+	const Frustum* frustum = this;
+
+	cull(&frustum, 1, spheresWorld, aabbsWorld, count, visibleMask);
+}
+
+void Frustum::cull(const Frustum* const* allFrusta, const uint32_t frustumCount, const Sphere* spheresWorld, const Aabb* aabbsWorld, const uint32_t count, uint8_t* visibleMask)
+{
+	if (!visibleMask)
+	{
+		return;
+	}
+
+	if (!spheresWorld && !aabbsWorld)
+	{
+		memset(visibleMask, (1 << glm::min(frustumCount, (uint32_t)VKTS_MAX_CULL_FRUSTA)) - 1, count);
+
+		return;
+	}
+
+	float centerX[VKTS_FRUSTUM_CULL_BLOCK];
+	float centerY[VKTS_FRUSTUM_CULL_BLOCK];
+	float centerZ[VKTS_FRUSTUM_CULL_BLOCK];
+	float extentX[VKTS_FRUSTUM_CULL_BLOCK];
+	float extentY[VKTS_FRUSTUM_CULL_BLOCK];
+	float extentZ[VKTS_FRUSTUM_CULL_BLOCK];
+	float radius[VKTS_FRUSTUM_CULL_BLOCK];
+
+	uint8_t boxVisibleMask[VKTS_FRUSTUM_CULL_BLOCK];
+
+	for (uint32_t first = 0; first < count; first += VKTS_FRUSTUM_CULL_BLOCK)
+	{
+		const uint32_t blockCount = glm::min(count - first, (uint32_t)VKTS_FRUSTUM_CULL_BLOCK);
+
+		if (spheresWorld)
+		{
+			for (uint32_t i = 0; i < blockCount; i++)
+			{
+				const Sphere& currentSphere = spheresWorld[first + i];
+
+				centerX[i] = currentSphere.getCenter().x;
+				centerY[i] = currentSphere.getCenter().y;
+				centerZ[i] = currentSphere.getCenter().z;
+				radius[i] = currentSphere.getRadius();
+			}
+
+			VkTsCullBounds sphereBounds = {centerX, centerY, centerZ, nullptr, nullptr, nullptr, radius};
+
+			cull(allFrusta, frustumCount, sphereBounds, blockCount, visibleMask + first);
+		}
+
+		if (aabbsWorld)
+		{
+			for (uint32_t i = 0; i < blockCount; i++)
+			{
+				const glm::vec4& minCorner = aabbsWorld[first + i].getCorner(0);
+				const glm::vec4& maxCorner = aabbsWorld[first + i].getCorner(1);
+
+				centerX[i] = (minCorner.x + maxCorner.x) * 0.5f;
+				centerY[i] = (minCorner.y + maxCorner.y) * 0.5f;
+				centerZ[i] = (minCorner.z + maxCorner.z) * 0.5f;
+				extentX[i] = (maxCorner.x - minCorner.x) * 0.5f;
+				extentY[i] = (maxCorner.y - minCorner.y) * 0.5f;
+				extentZ[i] = (maxCorner.z - minCorner.z) * 0.5f;
+			}
+
+			VkTsCullBounds boxBounds = {centerX, centerY, centerZ, extentX, extentY, extentZ, nullptr};
+
+			if (spheresWorld)
+			{
+				cull(allFrusta, frustumCount, boxBounds, blockCount, boxVisibleMask);
+
+				for (uint32_t i = 0; i < blockCount; i++)
+				{
+					visibleMask[first + i] &= boxVisibleMask[i];
+				}
+			}
+			else
+			{
+				cull(allFrusta, frustumCount, boxBounds, blockCount, visibleMask + first);
+			}
+		}
+	}
+}
+
+void Frustum::cull(const Frustum* const* allFrusta, const uint32_t frustumCount, const VkTsCullBounds& boundsWorld, const uint32_t count, uint8_t* visibleMask)
+{
+	if (!allFrusta || !visibleMask || !boundsWorld.centerX || !boundsWorld.centerY || !boundsWorld.centerZ)
+	{
+		return;
+	}
+
+	if (frustumCount > VKTS_MAX_CULL_FRUSTA)
+	{
+		logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Too many frusta: %u > %d", frustumCount, VKTS_MAX_CULL_FRUSTA);
+
+		return;
+	}
+
+	const VkBool32 hasExtent = boundsWorld.extentX && boundsWorld.extentY && boundsWorld.extentZ;
+	const VkBool32 hasRadius = boundsWorld.radius != nullptr;
+
+	// Absolute normal gives the projected extent without selecting a corner per plane.
+	// Layout per plane: normal, absolute normal and d.
+
+	float allPlanes[VKTS_MAX_CULL_FRUSTA][6][7];
+
+	for (uint32_t f = 0; f < frustumCount; f++)
+	{
+		for (uint32_t p = 0; p < 6; p++)
+		{
+			const Plane& currentSide = allFrusta[f]->getSide(p);
+
+			allPlanes[f][p][0] = currentSide.getNormal().x;
+			allPlanes[f][p][1] = currentSide.getNormal().y;
+			allPlanes[f][p][2] = currentSide.getNormal().z;
+			allPlanes[f][p][3] = glm::abs(currentSide.getNormal().x);
+			allPlanes[f][p][4] = glm::abs(currentSide.getNormal().y);
+			allPlanes[f][p][5] = glm::abs(currentSide.getNormal().z);
+			allPlanes[f][p][6] = currentSide.getD();
+		}
+	}
+
+	uint32_t i = 0;
+
+#ifdef VKTS_FRUSTUM_SSE2
+
+	const __m128 zero = _mm_setzero_ps();
+
+	for (; i + 4 <= count; i += 4)
+	{
+		const __m128 cx = _mm_loadu_ps(boundsWorld.centerX + i);
+		const __m128 cy = _mm_loadu_ps(boundsWorld.centerY + i);
+		const __m128 cz = _mm_loadu_ps(boundsWorld.centerZ + i);
+
+		const __m128 ex = hasExtent ? _mm_loadu_ps(boundsWorld.extentX + i) : zero;
+		const __m128 ey = hasExtent ? _mm_loadu_ps(boundsWorld.extentY + i) : zero;
+		const __m128 ez = hasExtent ? _mm_loadu_ps(boundsWorld.extentZ + i) : zero;
+
+		const __m128 r = hasRadius ? _mm_loadu_ps(boundsWorld.radius + i) : zero;
+
+		uint8_t laneMask[4] = {0, 0, 0, 0};
+
+		for (uint32_t f = 0; f < frustumCount; f++)
+		{
+			__m128 outside = zero;
+
+			for (uint32_t p = 0; p < 6; p++)
+			{
+				const float* plane = allPlanes[f][p];
+
+				__m128 distance = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(plane[0]), cx), _mm_mul_ps(_mm_set1_ps(plane[1]), cy));
+				distance = _mm_add_ps(distance, _mm_mul_ps(_mm_set1_ps(plane[2]), cz));
+				distance = _mm_add_ps(distance, _mm_set1_ps(plane[6]));
+
+				__m128 projectedExtent = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(plane[3]), ex), _mm_mul_ps(_mm_set1_ps(plane[4]), ey));
+				projectedExtent = _mm_add_ps(projectedExtent, _mm_mul_ps(_mm_set1_ps(plane[5]), ez));
+				projectedExtent = _mm_add_ps(projectedExtent, r);
+
+				outside = _mm_or_ps(outside, _mm_cmplt_ps(_mm_add_ps(distance, projectedExtent), zero));
+
+				// Most objects are outside of a side plane, so stop as soon as all four are.
+				if (_mm_movemask_ps(outside) == 0xF)
+				{
+					break;
+				}
+			}
+
+			const int outsideBits = _mm_movemask_ps(outside);
+
+			for (uint32_t lane = 0; lane < 4; lane++)
+			{
+				if (!(outsideBits & (1 << lane)))
+				{
+					laneMask[lane] |= (uint8_t)(1 << f);
+				}
+			}
+		}
+
+		visibleMask[i + 0] = laneMask[0];
+		visibleMask[i + 1] = laneMask[1];
+		visibleMask[i + 2] = laneMask[2];
+		visibleMask[i + 3] = laneMask[3];
+	}
+
+#endif
+
+	for (; i < count; i++)
+	{
+		const float ex = hasExtent ? boundsWorld.extentX[i] : 0.0f;
+		const float ey = hasExtent ? boundsWorld.extentY[i] : 0.0f;
+		const float ez = hasExtent ? boundsWorld.extentZ[i] : 0.0f;
+
+		const float r = hasRadius ? boundsWorld.radius[i] : 0.0f;
+
+		uint8_t currentMask = 0;
+
+		for (uint32_t f = 0; f < frustumCount; f++)
+		{
+			VkBool32 outside = VK_FALSE;
+
+			for (uint32_t p = 0; p < 6 && !outside; p++)
+			{
+				const float* plane = allPlanes[f][p];
+
+				float distance = plane[0] * boundsWorld.centerX[i] + plane[1] * boundsWorld.centerY[i] + plane[2] * boundsWorld.centerZ[i] + plane[6];
+
+				outside = distance + (plane[3] * ex + plane[4] * ey + plane[5] * ez + r) < 0.0f;
+			}
+
+			if (!outside)
+			{
+				currentMask |= (uint8_t)(1 << f);
+			}
+		}
+
+		visibleMask[i] = currentMask;
+	}
+}
+
 } /* namespace vkts */
@@ -0,0 +1,568 @@
+/**
+ * VKTS - VulKan ToolS.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) since 2014 Norbert Nopper
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <vkts/math/vkts_math.hpp>
+
+#define VKTS_ANIMATION_CLIP_QUANTISATION 65535.0f
+#define VKTS_ANIMATION_CLIP_ROTATION_QUANTISATION 32767.0f
+#define VKTS_ANIMATION_CLIP_ROTATION_RANGE 0.70710678f
+
+namespace vkts
+{
+
+static void animationClipQuantise(uint16_t* data, const glm::vec3& value, const glm::vec3& minimum, const glm::vec3& step)
+{
+	for (uint32_t i = 0; i < 3; i++)
+	{
+		data[i] = step[i] > 0.0f ? (uint16_t)glm::clamp((value[i] - minimum[i]) / step[i] + 0.5f, 0.0f, VKTS_ANIMATION_CLIP_QUANTISATION) : 0;
+	}
+}
+
+static glm::vec3 animationClipDequantise(const uint16_t* data, const glm::vec3& minimum, const glm::vec3& step)
+{
+	return minimum + step * glm::vec3((float)data[0], (float)data[1], (float)data[2]);
+}
+
+static void animationClipQuantise(uint16_t* data, const Quat& rotation)
+{
+	// The largest component is left out and recalculated, so the other three are in the range of plus minus one divided by the square root of two.
+
+	uint32_t largest = 0;
+
+	for (uint32_t i = 1; i < 4; i++)
+	{
+		if (glm::abs(rotation[i]) > glm::abs(rotation[largest]))
+		{
+			largest = i;
+		}
+	}
+
+	const float sign = rotation[largest] < 0.0f ? -1.0f : 1.0f;
+
+	uint32_t index = 0;
+
+	for (uint32_t i = 0; i < 4; i++)
+	{
+		if (i == largest)
+		{
+			continue;
+		}
+
+		const float value = (sign * rotation[i] + VKTS_ANIMATION_CLIP_ROTATION_RANGE) / (2.0f * VKTS_ANIMATION_CLIP_ROTATION_RANGE);
+
+		data[index] = (uint16_t)glm::clamp(value * VKTS_ANIMATION_CLIP_ROTATION_QUANTISATION + 0.5f, 0.0f, VKTS_ANIMATION_CLIP_ROTATION_QUANTISATION);
+
+		index++;
+	}
+
+	// Index of the largest component is stored in the highest bits.
+
+	data[0] |= (uint16_t)((largest & 1) << 15);
+	data[1] |= (uint16_t)((largest & 2) << 14);
+}
+
+static Quat animationClipDequantise(const uint16_t* data)
+{
+	const uint32_t largest = (uint32_t)(data[0] >> 15) | ((uint32_t)(data[1] >> 15) << 1);
+
+	Quat result;
+
+	float sum = 0.0f;
+
+	uint32_t index = 0;
+
+	for (uint32_t i = 0; i < 4; i++)
+	{
+		if (i == largest)
+		{
+			continue;
+		}
+
+		const float value = (float)(data[index] & 0x7FFF) * (2.0f * VKTS_ANIMATION_CLIP_ROTATION_RANGE / VKTS_ANIMATION_CLIP_ROTATION_QUANTISATION) - VKTS_ANIMATION_CLIP_ROTATION_RANGE;
+
+		result[i] = value;
+
+		sum += value * value;
+
+		index++;
+	}
+
+	result[largest] = sqrtf(glm::max(1.0f - sum, 0.0f));
+
+	return result;
+}
+
+static Quat animationClipNlerp(const Quat& q0, const Quat& q1, const float t)
+{
+	// Shortest path, as q and -q are the same rotation.
+
+	const float s0 = 1.0f - t;
+	const float s1 = (q0.x * q1.x + q0.y * q1.y + q0.z * q1.z + q0.w * q1.w) < 0.0f ? -t : t;
+
+	const float x = q0.x * s0 + q1.x * s1;
+	const float y = q0.y * s0 + q1.y * s1;
+	const float z = q0.z * s0 + q1.z * s1;
+	const float w = q0.w * s0 + q1.w * s1;
+
+	const float length = sqrtf(x * x + y * y + z * z + w * w);
+
+	if (length == 0.0f)
+	{
+		return q0;
+	}
+
+	return Quat(x / length, y / length, z / length, w / length);
+}
+
+static float animationClipDifference(const Quat& q0, const Quat& q1)
+{
+	const float sign = dot(q0, q1) < 0.0f ? -1.0f : 1.0f;
+
+	return glm::max(glm::max(glm::abs(q0.x - sign * q1.x), glm::abs(q0.y - sign * q1.y)), glm::max(glm::abs(q0.z - sign * q1.z), glm::abs(q0.w - sign * q1.w)));
+}
+
+static float animationClipDifference(const glm::vec3& v0, const glm::vec3& v1)
+{
+	const glm::vec3 difference = glm::abs(v0 - v1);
+
+	return glm::max(glm::max(difference.x, difference.y), difference.z);
+}
+
+void AnimationClip::sampleTrack(glm::vec3& translate, Quat& rotation, glm::vec3& scale, const uint32_t track, const uint16_t* frame0, const uint16_t* frame1, const float t) const
+{
+	if (allTranslateOffsets[track] != UINT32_MAX)
+	{
+		const uint32_t offset = allTranslateOffsets[track];
+
+		translate = glm::mix(animationClipDequantise(frame0 + offset, allTranslateMinimums[track], allTranslateSteps[track]), animationClipDequantise(frame1 + offset, allTranslateMinimums[track], allTranslateSteps[track]), t);
+	}
+	else
+	{
+		translate = allTranslateMinimums[track];
+	}
+
+	if (allRotationOffsets[track] != UINT32_MAX)
+	{
+		const uint32_t offset = allRotationOffsets[track];
+
+		rotation = animationClipNlerp(animationClipDequantise(frame0 + offset), animationClipDequantise(frame1 + offset), t);
+	}
+	else
+	{
+		rotation = allConstantRotations[track];
+	}
+
+	if (allScaleOffsets[track] != UINT32_MAX)
+	{
+		const uint32_t offset = allScaleOffsets[track];
+
+		scale = glm::mix(animationClipDequantise(frame0 + offset, allScaleMinimums[track], allScaleSteps[track]), animationClipDequantise(frame1 + offset, allScaleMinimums[track], allScaleSteps[track]), t);
+	}
+	else
+	{
+		scale = allScaleMinimums[track];
+	}
+}
+
+AnimationClip::AnimationClip() :
+	trackCount(0), startTime(0.0f), sampleRate(0.0f), sampleCount(0), allFrameTimes(), allTranslateOffsets(), allRotationOffsets(), allScaleOffsets(), allTranslateMinimums(), allTranslateSteps(), allConstantRotations(), allScaleMinimums(), allScaleSteps(), frameStride(0), allFrameData()
+{
+}
+
+AnimationClip::AnimationClip(const AnimationClip& other) :
+	trackCount(other.trackCount), startTime(other.startTime), sampleRate(other.sampleRate), sampleCount(other.sampleCount), allFrameTimes(other.allFrameTimes), allTranslateOffsets(other.allTranslateOffsets), allRotationOffsets(other.allRotationOffsets), allScaleOffsets(other.allScaleOffsets), allTranslateMinimums(other.allTranslateMinimums), allTranslateSteps(other.allTranslateSteps), allConstantRotations(other.allConstantRotations), allScaleMinimums(other.allScaleMinimums), allScaleSteps(other.allScaleSteps), frameStride(other.frameStride), allFrameData(other.allFrameData)
+{
+}
+
+AnimationClip::~AnimationClip()
+{
+}
+
+void AnimationClip::reset()
+{
+	trackCount = 0;
+	startTime = 0.0f;
+	sampleRate = 0.0f;
+	sampleCount = 0;
+
+	allFrameTimes.clear();
+
+	allTranslateOffsets.clear();
+	allRotationOffsets.clear();
+	allScaleOffsets.clear();
+
+	allTranslateMinimums.clear();
+	allTranslateSteps.clear();
+	allConstantRotations.clear();
+	allScaleMinimums.clear();
+	allScaleSteps.clear();
+
+	frameStride = 0;
+
+	allFrameData.clear();
+}
+
+VkBool32 AnimationClip::bake(const uint32_t trackCount, const uint32_t sampleCount, const float startTime, const float sampleRate, const std::vector<glm::vec3>& allTranslates, const std::vector<Quat>& allRotations, const std::vector<glm::vec3>& allScales, const float maxError)
+{
+	const size_t valueCount = (size_t)trackCount * (size_t)sampleCount;
+
+	if (trackCount == 0 || sampleCount == 0 || sampleRate <= 0.0f || allTranslates.size() != valueCount || allRotations.size() != valueCount || allScales.size() != valueCount)
+	{
+		return VK_FALSE;
+	}
+
+	reset();
+
+	this->trackCount = trackCount;
+	this->startTime = startTime;
+	this->sampleRate = sampleRate;
+	this->sampleCount = sampleCount;
+
+	// Rotations are normalized and flipped to the side of the previous frame, so neighbours can be interpolated.
+
+	std::vector<Quat> allAlignedRotations(valueCount);
+
+	for (size_t i = 0; i < valueCount; i++)
+	{
+		allAlignedRotations[i] = normalize(allRotations[i]);
+
+		if (i >= trackCount && dot(allAlignedRotations[i], allAlignedRotations[i - trackCount]) < 0.0f)
+		{
+			allAlignedRotations[i] = -allAlignedRotations[i];
+		}
+	}
+
+	// Keep the frame before the first one, which can not be interpolated anymore.
+
+	std::vector<uint32_t> allKeptFrames;
+
+	allKeptFrames.push_back(0);
+
+	if (maxError > 0.0f)
+	{
+		uint32_t anchor = 0;
+
+		for (uint32_t candidate = 2; candidate < sampleCount; candidate++)
+		{
+			VkBool32 withinError = VK_TRUE;
+
+			for (uint32_t frame = anchor + 1; frame < candidate && withinError; frame++)
+			{
+				const float t = (float)(frame - anchor) / (float)(candidate - anchor);
+
+				const size_t index0 = (size_t)anchor * trackCount;
+				const size_t index1 = (size_t)candidate * trackCount;
+				const size_t index = (size_t)frame * trackCount;
+
+				for (uint32_t track = 0; track < trackCount; track++)
+				{
+					if (animationClipDifference(glm::mix(allTranslates[index0 + track], allTranslates[index1 + track], t), allTranslates[index + track]) > maxError ||
+						animationClipDifference(animationClipNlerp(allAlignedRotations[index0 + track], allAlignedRotations[index1 + track], t), allAlignedRotations[index + track]) > maxError ||
+						animationClipDifference(glm::mix(allScales[index0 + track], allScales[index1 + track], t), allScales[index + track]) > maxError)
+					{
+						withinError = VK_FALSE;
+
+						break;
+					}
+				}
+			}
+
+			if (!withinError)
+			{
+				anchor = candidate - 1;
+
+				allKeptFrames.push_back(anchor);
+			}
+		}
+
+		if (sampleCount > 1)
+		{
+			allKeptFrames.push_back(sampleCount - 1);
+		}
+	}
+	else
+	{
+		for (uint32_t frame = 1; frame < sampleCount; frame++)
+		{
+			allKeptFrames.push_back(frame);
+		}
+	}
+
+	for (uint32_t i = 0; i < (uint32_t)allKeptFrames.size(); i++)
+	{
+		allFrameTimes.push_back(startTime + (float)allKeptFrames[i] / sampleRate);
+	}
+
+	// Ranges of the kept frames. Values, which stay within the error, are stored once.
+
+	allTranslateOffsets.resize(trackCount, UINT32_MAX);
+	allRotationOffsets.resize(trackCount, UINT32_MAX);
+	allScaleOffsets.resize(trackCount, UINT32_MAX);
+
+	allTranslateMinimums.resize(trackCount);
+	allTranslateSteps.resize(trackCount, glm::vec3(0.0f, 0.0f, 0.0f));
+	allConstantRotations.resize(trackCount);
+	allScaleMinimums.resize(trackCount);
+	allScaleSteps.resize(trackCount, glm::vec3(0.0f, 0.0f, 0.0f));
+
+	frameStride = 0;
+
+	for (uint32_t track = 0; track < trackCount; track++)
+	{
+		glm::vec3 translateMinimum = allTranslates[track];
+		glm::vec3 translateMaximum = allTranslates[track];
+		glm::vec3 scaleMinimum = allScales[track];
+		glm::vec3 scaleMaximum = allScales[track];
+
+		float rotationDifference = 0.0f;
+
+		for (uint32_t i = 1; i < (uint32_t)allKeptFrames.size(); i++)
+		{
+			const size_t index = (size_t)allKeptFrames[i] * trackCount + track;
+
+			translateMinimum = glm::min(translateMinimum, allTranslates[index]);
+			translateMaximum = glm::max(translateMaximum, allTranslates[index]);
+			scaleMinimum = glm::min(scaleMinimum, allScales[index]);
+			scaleMaximum = glm::max(scaleMaximum, allScales[index]);
+
+			rotationDifference = glm::max(rotationDifference, animationClipDifference(allAlignedRotations[index], allAlignedRotations[track]));
+		}
+
+		if (animationClipDifference(translateMaximum, translateMinimum) > maxError)
+		{
+			allTranslateOffsets[track] = frameStride;
+			allTranslateMinimums[track] = translateMinimum;
+			allTranslateSteps[track] = (translateMaximum - translateMinimum) / VKTS_ANIMATION_CLIP_QUANTISATION;
+
+			frameStride += 3;
+		}
+		else
+		{
+			allTranslateMinimums[track] = (translateMinimum + translateMaximum) * 0.5f;
+		}
+
+		if (rotationDifference > maxError)
+		{
+			allRotationOffsets[track] = frameStride;
+
+			frameStride += 3;
+		}
+
+		allConstantRotations[track] = allAlignedRotations[track];
+
+		if (animationClipDifference(scaleMaximum, scaleMinimum) > maxError)
+		{
+			allScaleOffsets[track] = frameStride;
+			allScaleMinimums[track] = scaleMinimum;
+			allScaleSteps[track] = (scaleMaximum - scaleMinimum) / VKTS_ANIMATION_CLIP_QUANTISATION;
+
+			frameStride += 3;
+		}
+		else
+		{
+			allScaleMinimums[track] = (scaleMinimum + scaleMaximum) * 0.5f;
+		}
+	}
+
+	//
+
+	allFrameData.resize(allKeptFrames.size() * (size_t)frameStride, 0);
+
+	for (uint32_t i = 0; i < (uint32_t)allKeptFrames.size(); i++)
+	{
+		uint16_t* frame = &allFrameData[(size_t)i * frameStride];
+
+		for (uint32_t track = 0; track < trackCount; track++)
+		{
+			const size_t index = (size_t)allKeptFrames[i] * trackCount + track;
+
+			if (allTranslateOffsets[track] != UINT32_MAX)
+			{
+				animationClipQuantise(frame + allTranslateOffsets[track], allTranslates[index], allTranslateMinimums[track], allTranslateSteps[track]);
+			}
+
+			if (allRotationOffsets[track] != UINT32_MAX)
+			{
+				animationClipQuantise(frame + allRotationOffsets[track], allAlignedRotations[index]);
+			}
+
+			if (allScaleOffsets[track] != UINT32_MAX)
+			{
+				animationClipQuantise(frame + allScaleOffsets[track], allScales[index], allScaleMinimums[track], allScaleSteps[track]);
+			}
+		}
+	}
+
+	return VK_TRUE;
+}
+
+uint32_t AnimationClip::getNumberTracks() const
+{
+	return trackCount;
+}
+
+uint32_t AnimationClip::getNumberFrames() const
+{
+	return (uint32_t)allFrameTimes.size();
+}
+
+float AnimationClip::getStartTime() const
+{
+	return startTime;
+}
+
+float AnimationClip::getStopTime() const
+{
+	if (sampleCount == 0)
+	{
+		return startTime;
+	}
+
+	return startTime + (float)(sampleCount - 1) / sampleRate;
+}
+
+float AnimationClip::getSampleRate() const
+{
+	return sampleRate;
+}
+
+size_t AnimationClip::getMemorySize() const
+{
+	size_t result = sizeof(AnimationClip);
+
+	result += allFrameTimes.size() * sizeof(float);
+
+	result += trackCount * (3 * sizeof(uint32_t) + 4 * sizeof(glm::vec3) + sizeof(Quat));
+
+	result += allFrameData.size() * sizeof(uint16_t);
+
+	return result;
+}
+
+uint32_t AnimationClip::findFrame(const float time, uint32_t& cursor) const
+{
+	const uint32_t frameCount = (uint32_t)allFrameTimes.size();
+
+	if (frameCount < 2)
+	{
+		cursor = 0;
+
+		return cursor;
+	}
+
+	const uint32_t segmentCount = frameCount - 1;
+
+	// Without removed frames, the frame is calculated.
+
+	if (frameCount == sampleCount)
+	{
+		cursor = (uint32_t)glm::clamp((time - startTime) * sampleRate, 0.0f, (float)(segmentCount - 1));
+
+		return cursor;
+	}
+
+	if (cursor < segmentCount && allFrameTimes[cursor] <= time)
+	{
+		if (time < allFrameTimes[cursor + 1])
+		{
+			return cursor;
+		}
+
+		if (cursor + 1 < segmentCount && time < allFrameTimes[cursor + 2])
+		{
+			cursor++;
+
+			return cursor;
+		}
+	}
+
+	uint32_t index = (uint32_t)(std::upper_bound(allFrameTimes.begin(), allFrameTimes.end(), time) - allFrameTimes.begin());
+
+	cursor = index > 0 ? glm::min(index - 1, segmentCount - 1) : 0;
+
+	return cursor;
+}
+
+void AnimationClip::sample(glm::vec3& translate, Quat& rotation, glm::vec3& scale, const uint32_t track, const float time, uint32_t& cursor) const
+{
+	if (track >= trackCount || allFrameTimes.size() == 0)
+	{
+		return;
+	}
+
+	const uint32_t frame = findFrame(time, cursor);
+
+	const uint32_t nextFrame = glm::min(frame + 1, (uint32_t)allFrameTimes.size() - 1);
+
+	const float deltaTime = allFrameTimes[nextFrame] - allFrameTimes[frame];
+
+	const float t = deltaTime > 0.0f ? glm::clamp((time - allFrameTimes[frame]) / deltaTime, 0.0f, 1.0f) : 0.0f;
+
+	sampleTrack(translate, rotation, scale, track, allFrameData.data() + (size_t)frame * frameStride, allFrameData.data() + (size_t)nextFrame * frameStride, t);
+}
+
+void AnimationClip::samplePose(std::vector<glm::vec3>& allTranslates, std::vector<Quat>& allRotations, std::vector<glm::vec3>& allScales, const float time, uint32_t& cursor) const
+{
+	if (allTranslates.size() != trackCount)
+	{
+		allTranslates.resize(trackCount);
+	}
+
+	if (allRotations.size() != trackCount)
+	{
+		allRotations.resize(trackCount);
+	}
+
+	if (allScales.size() != trackCount)
+	{
+		allScales.resize(trackCount);
+	}
+
+	if (allFrameTimes.size() == 0)
+	{
+		return;
+	}
+
+	// Frames and the interpolation factor are the same for all tracks.
+
+	const uint32_t frame = findFrame(time, cursor);
+
+	const uint32_t nextFrame = glm::min(frame + 1, (uint32_t)allFrameTimes.size() - 1);
+
+	const float deltaTime = allFrameTimes[nextFrame] - allFrameTimes[frame];
+
+	const float t = deltaTime > 0.0f ? glm::clamp((time - allFrameTimes[frame]) / deltaTime, 0.0f, 1.0f) : 0.0f;
+
+	const uint16_t* frame0 = allFrameData.data() + (size_t)frame * frameStride;
+	const uint16_t* frame1 = allFrameData.data() + (size_t)nextFrame * frameStride;
+
+	for (uint32_t track = 0; track < trackCount; track++)
+	{
+		sampleTrack(allTranslates[track], allRotations[track], allScales[track], track, frame0, frame1, t);
+	}
+}
+
+} /* namespace vkts */
@@ -0,0 +1,350 @@
+/**
+ * VKTS - VulKan ToolS.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) since 2014 Norbert Nopper
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <vkts/math/vkts_math.hpp>
+
+#define VKTS_KEYFRAME_CURVE_NEWTON_LOOPS 8
+#define VKTS_KEYFRAME_CURVE_BISECTION_LOOPS 24
+#define VKTS_KEYFRAME_CURVE_TOLERANCE 0.00001f
+
+namespace vkts
+{
+
+void KeyframeCurve::updateSegment(const uint32_t index)
+{
+	if (index + 1 >= (uint32_t)allKeys.size())
+	{
+		return;
+	}
+
+	VkTsInterpolator interpolator = allInterpolators[index];
+
+	// Bezier needs the handles of both keys.
+	if (interpolator == VKTS_INTERPOLATOR_BEZIER && allInterpolators[index + 1] != VKTS_INTERPOLATOR_BEZIER)
+	{
+		interpolator = VKTS_INTERPOLATOR_LINEAR;
+	}
+
+	if (allKeys[index + 1] - allKeys[index] == 0.0f)
+	{
+		interpolator = VKTS_INTERPOLATOR_CONSTANT;
+	}
+
+	allSegmentInterpolators[index] = interpolator;
+
+	if (interpolator != VKTS_INTERPOLATOR_BEZIER)
+	{
+		allKeyCoefficients[index] = glm::vec4(0.0f, 0.0f, 0.0f, 0.0f);
+		allValueCoefficients[index] = glm::vec4(0.0f, 0.0f, 0.0f, 0.0f);
+
+		return;
+	}
+
+	// Control points are the keys and the right handle of the first and the left handle of the second key.
+	// They are relative to the first key, as absolute keys lose precision.
+
+	const glm::vec2 p0 = glm::vec2(allKeys[index], allValues[index]);
+	const glm::vec2 p1 = glm::vec2(allHandles[index].z, allHandles[index].w) - p0;
+	const glm::vec2 p2 = glm::vec2(allHandles[index + 1].x, allHandles[index + 1].y) - p0;
+	const glm::vec2 p3 = glm::vec2(allKeys[index + 1], allValues[index + 1]) - p0;
+
+	const glm::vec2 a = p3 - 3.0f * p2 + 3.0f * p1;
+	const glm::vec2 b = 3.0f * p2 - 6.0f * p1;
+	const glm::vec2 c = 3.0f * p1;
+
+	allKeyCoefficients[index] = glm::vec4(a.x, b.x, c.x, 0.0f);
+	allValueCoefficients[index] = glm::vec4(a.y, b.y, c.y, p0.y);
+}
+
+float KeyframeCurve::sampleSegment(const uint32_t index, const float key) const
+{
+	switch (allSegmentInterpolators[index])
+	{
+		case VKTS_INTERPOLATOR_CONSTANT:
+			return allValues[index];
+		case VKTS_INTERPOLATOR_LINEAR:
+			return (allValues[index + 1] - allValues[index]) * (key - allKeys[index]) / (allKeys[index + 1] - allKeys[index]) + allValues[index];
+		case VKTS_INTERPOLATOR_BEZIER:
+			break;
+	}
+
+	const glm::vec4& keyCoefficients = allKeyCoefficients[index];
+
+	const float deltaKey = allKeys[index + 1] - allKeys[index];
+
+	const float segmentKey = key - allKeys[index];
+
+	const float tolerance = VKTS_KEYFRAME_CURVE_TOLERANCE * deltaKey;
+
+	// Invert the key curve with Newton's method, starting at the linear guess.
+
+	float t = segmentKey / deltaKey;
+
+	VkBool32 converged = VK_FALSE;
+
+	for (uint32_t i = 0; i < VKTS_KEYFRAME_CURVE_NEWTON_LOOPS; i++)
+	{
+		float difference = ((keyCoefficients.x * t + keyCoefficients.y) * t + keyCoefficients.z) * t - segmentKey;
+
+		if (glm::abs(difference) <= tolerance)
+		{
+			converged = VK_TRUE;
+
+			break;
+		}
+
+		float derivative = (3.0f * keyCoefficients.x * t + 2.0f * keyCoefficients.y) * t + keyCoefficients.z;
+
+		if (glm::abs(derivative) < 1e-6f)
+		{
+			break;
+		}
+
+		t -= difference / derivative;
+
+		if (t < 0.0f || t > 1.0f)
+		{
+			break;
+		}
+	}
+
+	if (!converged)
+	{
+		// Flat handles or overshooting, so fall back to bisection.
+
+		float low = 0.0f;
+		float high = 1.0f;
+
+		t = 0.5f;
+
+		for (uint32_t i = 0; i < VKTS_KEYFRAME_CURVE_BISECTION_LOOPS; i++)
+		{
+			float difference = ((keyCoefficients.x * t + keyCoefficients.y) * t + keyCoefficients.z) * t - segmentKey;
+
+			if (glm::abs(difference) <= tolerance)
+			{
+				break;
+			}
+
+			if (difference < 0.0f)
+			{
+				low = t;
+			}
+			else
+			{
+				high = t;
+			}
+
+			t = (low + high) * 0.5f;
+		}
+	}
+
+	const glm::vec4& valueCoefficients = allValueCoefficients[index];
+
+	return ((valueCoefficients.x * t + valueCoefficients.y) * t + valueCoefficients.z) * t + valueCoefficients.w;
+}
+
+KeyframeCurve::KeyframeCurve() :
+	allKeys(), allValues(), allHandles(), allInterpolators(), allSegmentInterpolators(), allKeyCoefficients(), allValueCoefficients()
+{
+}
+
+KeyframeCurve::KeyframeCurve(const KeyframeCurve& other) :
+	allKeys(other.allKeys), allValues(other.allValues), allHandles(other.allHandles), allInterpolators(other.allInterpolators), allSegmentInterpolators(other.allSegmentInterpolators), allKeyCoefficients(other.allKeyCoefficients), allValueCoefficients(other.allValueCoefficients)
+{
+}
+
+KeyframeCurve::~KeyframeCurve()
+{
+}
+
+void KeyframeCurve::reset()
+{
+	allKeys.clear();
+	allValues.clear();
+	allHandles.clear();
+	allInterpolators.clear();
+
+	allSegmentInterpolators.clear();
+	allKeyCoefficients.clear();
+	allValueCoefficients.clear();
+}
+
+VkBool32 KeyframeCurve::addEntry(const float key, const float value, const glm::vec4& handles, const VkTsInterpolator interpolator)
+{
+	auto keyIterator = std::lower_bound(allKeys.begin(), allKeys.end(), key);
+
+	if (keyIterator != allKeys.end() && *keyIterator == key)
+	{
+		return VK_FALSE;
+	}
+
+	const uint32_t index = (uint32_t)(keyIterator - allKeys.begin());
+
+	allKeys.insert(keyIterator, key);
+	allValues.insert(allValues.begin() + index, value);
+	allHandles.insert(allHandles.begin() + index, handles);
+	allInterpolators.insert(allInterpolators.begin() + index, interpolator);
+
+	// New key splits a segment or appends one.
+
+	const uint32_t segmentCount = (uint32_t)allKeys.size() - 1;
+
+	if (segmentCount > 0)
+	{
+		const uint32_t segmentIndex = glm::min(index, segmentCount - 1);
+
+		allSegmentInterpolators.insert(allSegmentInterpolators.begin() + segmentIndex, VKTS_INTERPOLATOR_CONSTANT);
+		allKeyCoefficients.insert(allKeyCoefficients.begin() + segmentIndex, glm::vec4(0.0f, 0.0f, 0.0f, 0.0f));
+		allValueCoefficients.insert(allValueCoefficients.begin() + segmentIndex, glm::vec4(0.0f, 0.0f, 0.0f, 0.0f));
+	}
+
+	if (index > 0)
+	{
+		updateSegment(index - 1);
+	}
+
+	updateSegment(index);
+
+	return VK_TRUE;
+}
+
+VkBool32 KeyframeCurve::removeEntry(const float key)
+{
+	auto keyIterator = std::lower_bound(allKeys.begin(), allKeys.end(), key);
+
+	if (keyIterator == allKeys.end() || *keyIterator != key)
+	{
+		return VK_FALSE;
+	}
+
+	const uint32_t index = (uint32_t)(keyIterator - allKeys.begin());
+
+	allKeys.erase(keyIterator);
+	allValues.erase(allValues.begin() + index);
+	allHandles.erase(allHandles.begin() + index);
+	allInterpolators.erase(allInterpolators.begin() + index);
+
+	// Segments before and after the key are merged.
+
+	if (allSegmentInterpolators.size() > 0)
+	{
+		const uint32_t segmentIndex = glm::min(index, (uint32_t)allSegmentInterpolators.size() - 1);
+
+		allSegmentInterpolators.erase(allSegmentInterpolators.begin() + segmentIndex);
+		allKeyCoefficients.erase(allKeyCoefficients.begin() + segmentIndex);
+		allValueCoefficients.erase(allValueCoefficients.begin() + segmentIndex);
+	}
+
+	if (index > 0)
+	{
+		updateSegment(index - 1);
+	}
+
+	return VK_TRUE;
+}
+
+uint32_t KeyframeCurve::getNumberEntries() const
+{
+	return (uint32_t)allKeys.size();
+}
+
+const std::vector<float>& KeyframeCurve::getKeys() const
+{
+	return allKeys;
+}
+
+const std::vector<float>& KeyframeCurve::getValues() const
+{
+	return allValues;
+}
+
+const std::vector<glm::vec4>& KeyframeCurve::getHandles() const
+{
+	return allHandles;
+}
+
+const std::vector<VkTsInterpolator>& KeyframeCurve::getInterpolators() const
+{
+	return allInterpolators;
+}
+
+uint32_t KeyframeCurve::findSegment(const float key, uint32_t& cursor) const
+{
+	const uint32_t segmentCount = (uint32_t)allKeys.size() - 1;
+
+	// Playback usually stays in the same segment or moves to the next one.
+
+	if (cursor < segmentCount && allKeys[cursor] <= key)
+	{
+		if (key < allKeys[cursor + 1])
+		{
+			return cursor;
+		}
+
+		if (cursor + 1 < segmentCount && key < allKeys[cursor + 2])
+		{
+			cursor++;
+
+			return cursor;
+		}
+	}
+
+	uint32_t index = (uint32_t)(std::upper_bound(allKeys.begin(), allKeys.end(), key) - allKeys.begin());
+
+	cursor = index > 0 ? glm::min(index - 1, segmentCount - 1) : 0;
+
+	return cursor;
+}
+
+float KeyframeCurve::sample(const float key, uint32_t& cursor) const
+{
+	if (allKeys.size() == 0)
+	{
+		return 0.0f;
+	}
+
+	if (allKeys.size() == 1 || key <= allKeys.front())
+	{
+		return allValues.front();
+	}
+
+	if (key >= allKeys.back())
+	{
+		return allValues.back();
+	}
+
+	return sampleSegment(findSegment(key, cursor), key);
+}
+
+float KeyframeCurve::sample(const float key) const
+{
+	uint32_t cursor = UINT32_MAX;
+
+	return sample(key, cursor);
+}
+
+} /* namespace vkts */
@@ -26,6 +26,11 @@
 
 #include <vkts/math/vkts_math.hpp>
 
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define VKTS_MATRIX_SSE2
+#include <emmintrin.h>
+#endif
+
 namespace vkts
 {
 
@@ -649,4 +654,45 @@ glm::vec2 VKTS_APIENTRY decomposeScale(const glm::mat2& matrix)
 	return scale;
 }
 
+void VKTS_APIENTRY multiplyMat4(glm::mat4& result, const glm::mat4& left, const glm::mat4& right)
+{
+#ifdef VKTS_MATRIX_SSE2
+	const __m128 leftColumn0 = _mm_loadu_ps(&left[0][0]);
+	const __m128 leftColumn1 = _mm_loadu_ps(&left[1][0]);
+	const __m128 leftColumn2 = _mm_loadu_ps(&left[2][0]);
+	const __m128 leftColumn3 = _mm_loadu_ps(&left[3][0]);
+
+	for (int32_t column = 0; column < 4; column++)
+	{
+		__m128 sum = _mm_mul_ps(leftColumn0, _mm_set1_ps(right[column][0]));
+		sum = _mm_add_ps(sum, _mm_mul_ps(leftColumn1, _mm_set1_ps(right[column][1])));
+		sum = _mm_add_ps(sum, _mm_mul_ps(leftColumn2, _mm_set1_ps(right[column][2])));
+		sum = _mm_add_ps(sum, _mm_mul_ps(leftColumn3, _mm_set1_ps(right[column][3])));
+
+		_mm_storeu_ps(&result[column][0], sum);
+	}
+#else
+	result = left * right;
+#endif
+}
+
+void VKTS_APIENTRY normalMat3(glm::mat3& result, const glm::mat4& matrix)
+{
+	const glm::vec3 column0 = glm::vec3(matrix[0]);
+	const glm::vec3 column1 = glm::vec3(matrix[1]);
+	const glm::vec3 column2 = glm::vec3(matrix[2]);
+
+	// Transposed inverse is the cofactor matrix divided by the determinant.
+
+	const glm::vec3 cross12 = glm::cross(column1, column2);
+
+	const float determinant = glm::dot(column0, cross12);
+
+	const float inverseDeterminant = determinant != 0.0f ? 1.0f / determinant : 0.0f;
+
+	result[0] = cross12 * inverseDeterminant;
+	result[1] = glm::cross(column2, column0) * inverseDeterminant;
+	result[2] = glm::cross(column0, column1) * inverseDeterminant;
+}
+
 }
@@ -0,0 +1,206 @@
+/**
+ * VKTS - VulKan ToolS.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) since 2014 Norbert Nopper
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <vkts/math/vkts_math.hpp>
+
+#define VKTS_RENDER_QUEUE_PIPELINE_BITS 10
+#define VKTS_RENDER_QUEUE_MATERIAL_BITS 12
+#define VKTS_RENDER_QUEUE_DESCRIPTOR_SET_BITS 16
+#define VKTS_RENDER_QUEUE_MESH_BITS 16
+#define VKTS_RENDER_QUEUE_DEPTH_BITS 10
+
+#define VKTS_RENDER_QUEUE_RADIX_BITS 8
+#define VKTS_RENDER_QUEUE_RADIX_SIZE (1 << VKTS_RENDER_QUEUE_RADIX_BITS)
+#define VKTS_RENDER_QUEUE_RADIX_PASSES (64 / VKTS_RENDER_QUEUE_RADIX_BITS)
+
+namespace vkts
+{
+
+uint64_t RenderQueue::getKey(const VkTsRenderItem& renderItem)
+{
+	// Positive floats keep their order as integers. The upper bits are used, as the sign bit is always zero.
+
+	uint32_t depthBits = 0;
+
+	if (renderItem.depth > 0.0f)
+	{
+		memcpy(&depthBits, &renderItem.depth, sizeof(uint32_t));
+	}
+
+	uint64_t key = (uint64_t)(renderItem.pipeline & ((1u << VKTS_RENDER_QUEUE_PIPELINE_BITS) - 1));
+
+	key = (key << VKTS_RENDER_QUEUE_MATERIAL_BITS) | (uint64_t)(renderItem.material & ((1u << VKTS_RENDER_QUEUE_MATERIAL_BITS) - 1));
+	key = (key << VKTS_RENDER_QUEUE_DESCRIPTOR_SET_BITS) | (uint64_t)(renderItem.descriptorSet & ((1u << VKTS_RENDER_QUEUE_DESCRIPTOR_SET_BITS) - 1));
+	key = (key << VKTS_RENDER_QUEUE_MESH_BITS) | (uint64_t)(renderItem.mesh & ((1u << VKTS_RENDER_QUEUE_MESH_BITS) - 1));
+	key = (key << VKTS_RENDER_QUEUE_DEPTH_BITS) | (uint64_t)(depthBits >> (31 - VKTS_RENDER_QUEUE_DEPTH_BITS));
+
+	return key;
+}
+
+RenderQueue::RenderQueue() :
+	allRenderItems(), allOrder(), allTempOrder(), allKeys(), allTempKeys(), sorted(VK_FALSE)
+{
+}
+
+RenderQueue::~RenderQueue()
+{
+}
+
+void RenderQueue::reset()
+{
+	allRenderItems.clear();
+	allOrder.clear();
+
+	sorted = VK_FALSE;
+}
+
+void RenderQueue::add(const VkTsRenderItem& renderItem)
+{
+	allOrder.push_back((uint32_t)allRenderItems.size());
+
+	allRenderItems.push_back(renderItem);
+
+	sorted = VK_FALSE;
+}
+
+uint32_t RenderQueue::getNumberItems() const
+{
+	return (uint32_t)allRenderItems.size();
+}
+
+const VkTsRenderItem& RenderQueue::getItem(const uint32_t index) const
+{
+	return allRenderItems[allOrder[index]];
+}
+
+void RenderQueue::sort()
+{
+	const uint32_t count = (uint32_t)allRenderItems.size();
+
+	allKeys.resize(count);
+	allTempKeys.resize(count);
+	allTempOrder.resize(count);
+
+	// All histograms are gathered in one pass over the keys.
+
+	uint32_t allCounts[VKTS_RENDER_QUEUE_RADIX_PASSES][VKTS_RENDER_QUEUE_RADIX_SIZE];
+
+	memset(allCounts, 0, sizeof(allCounts));
+
+	for (uint32_t i = 0; i < count; i++)
+	{
+		allOrder[i] = i;
+
+		allKeys[i] = getKey(allRenderItems[i]);
+
+		for (uint32_t pass = 0; pass < VKTS_RENDER_QUEUE_RADIX_PASSES; pass++)
+		{
+			allCounts[pass][(allKeys[i] >> (pass * VKTS_RENDER_QUEUE_RADIX_BITS)) & (VKTS_RENDER_QUEUE_RADIX_SIZE - 1)]++;
+		}
+	}
+
+	// Least significant digit first, so each pass keeps the order of the previous ones.
+
+	for (uint32_t pass = 0; pass < VKTS_RENDER_QUEUE_RADIX_PASSES; pass++)
+	{
+		const uint32_t shift = pass * VKTS_RENDER_QUEUE_RADIX_BITS;
+
+		// Digits, which are the same for all items, e.g. unused pipeline bits, do not change the order.
+		if (count == 0 || allCounts[pass][(allKeys[0] >> shift) & (VKTS_RENDER_QUEUE_RADIX_SIZE - 1)] == count)
+		{
+			continue;
+		}
+
+		uint32_t offset = 0;
+
+		for (uint32_t digit = 0; digit < VKTS_RENDER_QUEUE_RADIX_SIZE; digit++)
+		{
+			const uint32_t digitCount = allCounts[pass][digit];
+
+			allCounts[pass][digit] = offset;
+
+			offset += digitCount;
+		}
+
+		for (uint32_t i = 0; i < count; i++)
+		{
+			const uint32_t target = allCounts[pass][(allKeys[i] >> shift) & (VKTS_RENDER_QUEUE_RADIX_SIZE - 1)]++;
+
+			allTempKeys[target] = allKeys[i];
+			allTempOrder[target] = allOrder[i];
+		}
+
+		allKeys.swap(allTempKeys);
+		allOrder.swap(allTempOrder);
+	}
+
+	sorted = VK_TRUE;
+}
+
+void RenderQueue::record(IRenderCommandStream& commandStream)
+{
+	if (!sorted)
+	{
+		sort();
+	}
+
+	uint32_t currentPipeline = UINT32_MAX;
+	uint32_t currentDescriptorSet = UINT32_MAX;
+	uint32_t currentMesh = UINT32_MAX;
+
+	for (uint32_t i = 0; i < allOrder.size(); i++)
+	{
+		const VkTsRenderItem& renderItem = allRenderItems[allOrder[i]];
+
+		if (renderItem.pipeline != currentPipeline)
+		{
+			commandStream.bindPipeline(renderItem.pipeline);
+
+			currentPipeline = renderItem.pipeline;
+
+			currentDescriptorSet = UINT32_MAX;
+		}
+
+		if (renderItem.descriptorSet != currentDescriptorSet)
+		{
+			commandStream.bindDescriptorSet(renderItem.pipeline, renderItem.descriptorSet);
+
+			currentDescriptorSet = renderItem.descriptorSet;
+		}
+
+		// Vertex and index buffers do not depend on the pipeline.
+		if (renderItem.mesh != currentMesh)
+		{
+			commandStream.bindMesh(renderItem.mesh);
+
+			currentMesh = renderItem.mesh;
+		}
+
+		commandStream.draw(renderItem);
+	}
+}
+
+} /* namespace vkts */
@@ -0,0 +1,180 @@
+/**
+ * VKTS - VulKan ToolS.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) since 2014 Norbert Nopper
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <vkts/math/vkts_math.hpp>
+
+// Parent matrix followed by the parent normal matrix.
+#define VKTS_JOINT_PALETTE_JOINTS_OFFSET (16 + 12)
+
+namespace vkts
+{
+
+void JointPalette::writeNormalMatrix(const uint32_t normalOffset, const uint32_t matrixOffset)
+{
+	glm::mat3 normalMatrix;
+
+	normalMat3(normalMatrix, glm::make_mat4(&allData[matrixOffset]));
+
+	for (uint32_t column = 0; column < 3; column++)
+	{
+		allData[normalOffset + column * 4 + 0] = normalMatrix[column][0];
+		allData[normalOffset + column * 4 + 1] = normalMatrix[column][1];
+		allData[normalOffset + column * 4 + 2] = normalMatrix[column][2];
+		allData[normalOffset + column * 4 + 3] = 0.0f;
+	}
+}
+
+JointPalette::JointPalette() :
+	maxJoints(0), jointCount(0), allData(), allDirtyJoints(), allDirty(), parentDirty(VK_FALSE)
+{
+	reset(0);
+}
+
+JointPalette::~JointPalette()
+{
+}
+
+void JointPalette::reset(const uint32_t maxJoints)
+{
+	this->maxJoints = maxJoints;
+
+	jointCount = 0;
+
+	allData.assign(VKTS_JOINT_PALETTE_JOINTS_OFFSET + maxJoints * (16 + 12), 0.0f);
+
+	const glm::mat4 identity(1.0f);
+
+	memcpy(&allData[0], glm::value_ptr(identity), sizeof(float) * 16);
+
+	for (uint32_t jointIndex = 0; jointIndex < maxJoints; jointIndex++)
+	{
+		memcpy(&allData[VKTS_JOINT_PALETTE_JOINTS_OFFSET + jointIndex * 16], glm::value_ptr(identity), sizeof(float) * 16);
+	}
+
+	allDirtyJoints.clear();
+	allDirty.assign(maxJoints, 0);
+
+	// Normal matrices of the identity.
+
+	parentDirty = VK_TRUE;
+
+	for (uint32_t jointIndex = 0; jointIndex < maxJoints; jointIndex++)
+	{
+		allDirtyJoints.push_back(jointIndex);
+
+		allDirty[jointIndex] = 1;
+	}
+
+	update();
+}
+
+uint32_t JointPalette::getMaxJoints() const
+{
+	return maxJoints;
+}
+
+uint32_t JointPalette::getNumberJoints() const
+{
+	return jointCount;
+}
+
+void JointPalette::setParent(const glm::mat4& transformMatrix)
+{
+	memcpy(&allData[0], glm::value_ptr(transformMatrix), sizeof(float) * 16);
+
+	parentDirty = VK_TRUE;
+}
+
+VkBool32 JointPalette::setJoint(const uint32_t jointIndex, const glm::mat4& transformMatrix)
+{
+	if (jointIndex >= maxJoints)
+	{
+		return VK_FALSE;
+	}
+
+	memcpy(&allData[VKTS_JOINT_PALETTE_JOINTS_OFFSET + jointIndex * 16], glm::value_ptr(transformMatrix), sizeof(float) * 16);
+
+	if (!allDirty[jointIndex])
+	{
+		allDirty[jointIndex] = 1;
+
+		allDirtyJoints.push_back(jointIndex);
+	}
+
+	jointCount = glm::max(jointCount, jointIndex + 1);
+
+	return VK_TRUE;
+}
+
+glm::mat4 JointPalette::getJoint(const uint32_t jointIndex) const
+{
+	if (jointIndex >= maxJoints)
+	{
+		return glm::mat4(1.0f);
+	}
+
+	return glm::make_mat4(&allData[VKTS_JOINT_PALETTE_JOINTS_OFFSET + jointIndex * 16]);
+}
+
+void JointPalette::update()
+{
+	if (parentDirty)
+	{
+		writeNormalMatrix(16, 0);
+
+		parentDirty = VK_FALSE;
+	}
+
+	const uint32_t normalsOffset = VKTS_JOINT_PALETTE_JOINTS_OFFSET + maxJoints * 16;
+
+	for (uint32_t i = 0; i < (uint32_t)allDirtyJoints.size(); i++)
+	{
+		const uint32_t jointIndex = allDirtyJoints[i];
+
+		writeNormalMatrix(normalsOffset + jointIndex * 12, VKTS_JOINT_PALETTE_JOINTS_OFFSET + jointIndex * 16);
+
+		allDirty[jointIndex] = 0;
+	}
+
+	allDirtyJoints.clear();
+}
+
+const float* JointPalette::getData() const
+{
+	return allData.data();
+}
+
+uint32_t JointPalette::getSize() const
+{
+	if (jointCount == 0)
+	{
+		return sizeof(float) * VKTS_JOINT_PALETTE_JOINTS_OFFSET;
+	}
+
+	return (uint32_t)sizeof(float) * (VKTS_JOINT_PALETTE_JOINTS_OFFSET + maxJoints * 16 + jointCount * 12);
+}
+
+} /* namespace vkts */
@@ -0,0 +1,223 @@
+/**
+ * VKTS - VulKan ToolS.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) since 2014 Norbert Nopper
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <vkts/math/vkts_math.hpp>
+
+namespace vkts
+{
+
+static void transformHierarchyLocal(glm::mat4& result, const glm::vec3& translate, const VkTsRotationMode rotationMode, const glm::vec3& rotate, const glm::vec3& scale)
+{
+	switch (rotationMode)
+	{
+		case VKTS_EULER_YXZ:
+			result = rotateRzRxRyMat4(rotate.z, rotate.x, rotate.y);
+			break;
+		case VKTS_EULER_XYZ:
+			result = rotateRzRyRxMat4(rotate.z, rotate.y, rotate.x);
+			break;
+		case VKTS_EULER_XZY:
+			result = rotateRyRzRxMat4(rotate.y, rotate.z, rotate.x);
+			break;
+		default:
+			result = glm::mat4(1.0f);
+			break;
+	}
+
+	// Same as translate * rotate * scale, without the full matrix multiplications.
+
+	result[0] *= scale.x;
+	result[1] *= scale.y;
+	result[2] *= scale.z;
+	result[3] = glm::vec4(translate, 1.0f);
+}
+
+TransformHierarchy::TransformHierarchy() :
+	allParentIndices(), allTranslates(), allRotationModes(), allRotates(), allScales(), allLocalMatrices(), allWorldMatrices(), allNormalMatrices(), allDirty(), allUpdated()
+{
+}
+
+TransformHierarchy::~TransformHierarchy()
+{
+}
+
+void TransformHierarchy::reset()
+{
+	allParentIndices.clear();
+
+	allTranslates.clear();
+	allRotationModes.clear();
+	allRotates.clear();
+	allScales.clear();
+
+	allLocalMatrices.clear();
+	allWorldMatrices.clear();
+	allNormalMatrices.clear();
+
+	allDirty.clear();
+	allUpdated.clear();
+}
+
+int32_t TransformHierarchy::addTransform(const int32_t parentIndex, const glm::vec3& translate, const VkTsRotationMode rotationMode, const glm::vec3& rotate, const glm::vec3& scale)
+{
+	const int32_t index = (int32_t)allParentIndices.size();
+
+	// Parents have to be stored before their children.
+	if (parentIndex < -1 || parentIndex >= index)
+	{
+		return -1;
+	}
+
+	allParentIndices.push_back(parentIndex);
+
+	allTranslates.push_back(translate);
+	allRotationModes.push_back(rotationMode);
+	allRotates.push_back(rotate);
+	allScales.push_back(scale);
+
+	allLocalMatrices.push_back(glm::mat4(1.0f));
+	allWorldMatrices.push_back(glm::mat4(1.0f));
+	allNormalMatrices.push_back(glm::mat3(1.0f));
+
+	allDirty.push_back(1);
+	allUpdated.push_back(0);
+
+	return index;
+}
+
+uint32_t TransformHierarchy::getSize() const
+{
+	return (uint32_t)allParentIndices.size();
+}
+
+int32_t TransformHierarchy::getParentIndex(const uint32_t index) const
+{
+	return allParentIndices[index];
+}
+
+const glm::vec3& TransformHierarchy::getTranslate(const uint32_t index) const
+{
+	return allTranslates[index];
+}
+
+void TransformHierarchy::setTranslate(const uint32_t index, const glm::vec3& translate)
+{
+	allTranslates[index] = translate;
+
+	allDirty[index] = 1;
+}
+
+VkTsRotationMode TransformHierarchy::getRotationMode(const uint32_t index) const
+{
+	return allRotationModes[index];
+}
+
+void TransformHierarchy::setRotationMode(const uint32_t index, const VkTsRotationMode rotationMode)
+{
+	allRotationModes[index] = rotationMode;
+
+	allDirty[index] = 1;
+}
+
+const glm::vec3& TransformHierarchy::getRotate(const uint32_t index) const
+{
+	return allRotates[index];
+}
+
+void TransformHierarchy::setRotate(const uint32_t index, const glm::vec3& rotate)
+{
+	allRotates[index] = rotate;
+
+	allDirty[index] = 1;
+}
+
+const glm::vec3& TransformHierarchy::getScale(const uint32_t index) const
+{
+	return allScales[index];
+}
+
+void TransformHierarchy::setScale(const uint32_t index, const glm::vec3& scale)
+{
+	allScales[index] = scale;
+
+	allDirty[index] = 1;
+}
+
+void TransformHierarchy::setTransform(const uint32_t index, const glm::vec3& translate, const glm::vec3& rotate, const glm::vec3& scale)
+{
+	allTranslates[index] = translate;
+	allRotates[index] = rotate;
+	allScales[index] = scale;
+
+	allDirty[index] = 1;
+}
+
+const glm::mat4& TransformHierarchy::getWorldMatrix(const uint32_t index) const
+{
+	return allWorldMatrices[index];
+}
+
+const glm::mat3& TransformHierarchy::getNormalMatrix(const uint32_t index) const
+{
+	return allNormalMatrices[index];
+}
+
+VkBool32 TransformHierarchy::isUpdated(const uint32_t index) const
+{
+	return allUpdated[index] ? VK_TRUE : VK_FALSE;
+}
+
+void TransformHierarchy::update(const glm::mat4& rootMatrix, const VkBool32 rootDirty)
+{
+	const uint32_t size = getSize();
+
+	for (uint32_t index = 0; index < size; index++)
+	{
+		const int32_t parentIndex = allParentIndices[index];
+
+		const uint8_t parentUpdated = parentIndex >= 0 ? allUpdated[parentIndex] : (rootDirty ? 1 : 0);
+
+		if (allDirty[index])
+		{
+			transformHierarchyLocal(allLocalMatrices[index], allTranslates[index], allRotationModes[index], allRotates[index], allScales[index]);
+		}
+		else if (!parentUpdated)
+		{
+			allUpdated[index] = 0;
+
+			continue;
+		}
+
+		multiplyMat4(allWorldMatrices[index], parentIndex >= 0 ? allWorldMatrices[parentIndex] : rootMatrix, allLocalMatrices[index]);
+
+		normalMat3(allNormalMatrices[index], allWorldMatrices[index]);
+
+		allDirty[index] = 0;
+		allUpdated[index] = 1;
+	}
+}
+
+} /* namespace vkts */
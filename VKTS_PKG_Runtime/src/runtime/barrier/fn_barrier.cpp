@@ -26,92 +26,294 @@
 
 #include <vkts/runtime/vkts_runtime.hpp>
 
+#include "fn_barrier_internal.hpp"
+
 namespace vkts
 {
 
+// Sense reversing barrier: The last arriving thread flips the sense, which releases the waiting ones.
+
+static std::atomic<int32_t> g_barrierPendingUpdateThreads(0);
+
+static int32_t g_barrierUpdateThreads = 0;
+
+static std::atomic<uint32_t> g_barrierSense(0);
+
+static std::atomic<VkBool32> g_barrierKilled(VK_FALSE);
+
+// Parking, after spinning was not successful.
+
 static std::mutex g_barrierMutex;
 
 static std::condition_variable g_barrierConditionVariable;
 
-static int32_t g_barrierExecutingUpdateThreads = 0;
+static std::atomic<int32_t> g_barrierParkedUpdateThreads(0);
+
+static uint32_t g_barrierSpinCount = VKTS_BARRIER_SPIN_COUNT;
+
+static uint32_t g_barrierUsedSpinCount = VKTS_BARRIER_SPIN_COUNT;
 
-static int32_t g_barrierGeneration = 0;
+// Phases and statistics.
+
+static std::mutex g_barrierPhaseMutex;
+
+static std::string g_barrierPhaseNames[VKTS_MAX_BARRIER_PHASES] = {"default"};
+
+static int32_t g_barrierPhaseCount = 1;
+
+static double g_barrierArrivalTime[VKTS_MAX_UPDATE_THREADS];
+
+static VkTsBarrierStatistics g_barrierStatistics[VKTS_MAX_BARRIER_PHASES][VKTS_MAX_UPDATE_THREADS];
+
+static thread_local int32_t g_barrierThreadIndex = -1;
+
+static void barrierUpdateStatistics(const int32_t phase, const double releaseTime)
+{
+    double firstArrivalTime = releaseTime;
+
+    for (int32_t i = 0; i < g_barrierUpdateThreads; i++)
+    {
+        firstArrivalTime = glm::min(firstArrivalTime, g_barrierArrivalTime[i]);
+    }
+
+    for (int32_t i = 0; i < g_barrierUpdateThreads; i++)
+    {
+        auto& statistics = g_barrierStatistics[phase][i];
+
+        const double lateTime = g_barrierArrivalTime[i] - firstArrivalTime;
+        const double waitTime = releaseTime - g_barrierArrivalTime[i];
+
+        statistics.syncCount++;
+
+        statistics.totalLateTime += lateTime;
+        statistics.maxLateTime = glm::max(statistics.maxLateTime, lateTime);
+
+        statistics.totalWaitTime += waitTime;
+        statistics.maxWaitTime = glm::max(statistics.maxWaitTime, waitTime);
+    }
+
+    if (g_barrierThreadIndex >= 0 && g_barrierThreadIndex < g_barrierUpdateThreads)
+    {
+        g_barrierStatistics[phase][g_barrierThreadIndex].lastCount++;
+    }
+}
 
 VkBool32 VKTS_APIENTRY barrierInit()
 {
-	std::lock_guard<std::mutex> barrierLockGuard(g_barrierMutex);
+    std::lock_guard<std::mutex> barrierLockGuard(g_barrierMutex);
+
+    // Number of update threads is only queried once per run.
+    g_barrierUpdateThreads = engineGetNumberUpdateThreads();
 
-    g_barrierExecutingUpdateThreads = 0;
+    g_barrierPendingUpdateThreads = g_barrierUpdateThreads;
 
-    g_barrierGeneration = 0;
+    g_barrierKilled = VK_FALSE;
+
+    // Spinning makes no sense, if there is no other processor, which could release the barrier.
+    g_barrierUsedSpinCount = processorGetNumber() > 1 ? g_barrierSpinCount : 0;
+
+    for (int32_t i = 0; i < VKTS_MAX_UPDATE_THREADS; i++)
+    {
+        g_barrierArrivalTime[i] = 0.0;
+    }
 
     return VK_TRUE;
 }
 
+void VKTS_APIENTRY barrierSetSpinCount(const uint32_t spinCount)
+{
+    g_barrierSpinCount = spinCount;
+
+    g_barrierUsedSpinCount = processorGetNumber() > 1 ? g_barrierSpinCount : 0;
+}
+
+uint32_t VKTS_APIENTRY barrierGetSpinCount()
+{
+    return g_barrierSpinCount;
+}
+
+int32_t VKTS_APIENTRY barrierAddPhase(const std::string& name)
+{
+    std::lock_guard<std::mutex> barrierPhaseLockGuard(g_barrierPhaseMutex);
+
+    for (int32_t i = 0; i < g_barrierPhaseCount; i++)
+    {
+        if (g_barrierPhaseNames[i] == name)
+        {
+            return i;
+        }
+    }
+
+    if (g_barrierPhaseCount == VKTS_MAX_BARRIER_PHASES)
+    {
+        logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Could not add barrier phase '%s'. Too many phases.", name.c_str());
+
+        return -1;
+    }
+
+    g_barrierPhaseNames[g_barrierPhaseCount] = name;
+
+    g_barrierPhaseCount++;
+
+    return g_barrierPhaseCount - 1;
+}
+
+const char* VKTS_APIENTRY barrierGetPhaseName(const int32_t phase)
+{
+    if (phase < 0 || phase >= g_barrierPhaseCount)
+    {
+        return nullptr;
+    }
+
+    return g_barrierPhaseNames[phase].c_str();
+}
+
 VkBool32 VKTS_APIENTRY barrierSync()
 {
-    std::unique_lock<std::mutex> barrierUniqueLock(g_barrierMutex);
+    return barrierSyncPhase(VKTS_BARRIER_DEFAULT_PHASE);
+}
 
-    if (g_barrierGeneration < 0)
+VkBool32 VKTS_APIENTRY barrierSyncPhase(const int32_t phase)
+{
+    if (g_barrierKilled)
     {
         return VK_FALSE;
     }
 
-    // If there is no executing thread, start new barrier ...
-    if (g_barrierExecutingUpdateThreads == 0)
+    // Error case, so just return.
+    if (g_barrierUpdateThreads < VKTS_MIN_UPDATE_THREADS || phase < 0 || phase >= g_barrierPhaseCount)
     {
-        // ... by setting the total number of threads.
-        g_barrierExecutingUpdateThreads = engineGetNumberUpdateThreads();
+        return VK_FALSE;
+    }
+
+    // As the barrier can not be released without this thread, the sense is the one of the current barrier.
+    const uint32_t releaseSense = g_barrierSense.load() ^ 1u;
+
+    const double arrivalTime = timeGetRaw();
+
+    if (g_barrierThreadIndex >= 0 && g_barrierThreadIndex < g_barrierUpdateThreads)
+    {
+        g_barrierArrivalTime[g_barrierThreadIndex] = arrivalTime;
+    }
 
-        // Error case, so just return.
-        if (g_barrierExecutingUpdateThreads < VKTS_MIN_UPDATE_THREADS)
+    // Remove this executing thread. Are there any executing threads?
+    if (g_barrierPendingUpdateThreads.fetch_sub(1) == 1)
+    {
+        // No, so all have reached the barrier.
+
+        barrierUpdateStatistics(phase, arrivalTime);
+
+        // Prepare the next barrier before releasing the others.
+        g_barrierPendingUpdateThreads = g_barrierUpdateThreads;
+
+        g_barrierSense = releaseSense;
+
+        // Wake up the rest, if needed.
+        if (g_barrierParkedUpdateThreads > 0)
         {
-            return VK_FALSE;
+            std::lock_guard<std::mutex> barrierLockGuard(g_barrierMutex);
+
+            g_barrierConditionVariable.notify_all();
         }
+
+        return VK_TRUE;
     }
 
-    // Remove this executing thread.
-    g_barrierExecutingUpdateThreads--;
+    // Yes, so wait until all have reached the barrier. First spin ...
 
-    // Are there any executing threads?
-    if (g_barrierExecutingUpdateThreads > 0)
+    for (uint32_t spin = 0; spin < g_barrierUsedSpinCount; spin++)
     {
-        int32_t currentBarrierGeneration = g_barrierGeneration;
+        if (g_barrierSense == releaseSense)
+        {
+            return VK_TRUE;
+        }
 
-        // Yes, so wait until all have reached the barrier.
-        do
+        if (g_barrierKilled)
         {
-            g_barrierConditionVariable.wait(barrierUniqueLock);
+            return VK_FALSE;
         }
-        while (currentBarrierGeneration == g_barrierGeneration);
+
+        std::this_thread::yield();
     }
-    else
+
+    // ... and then park.
+
+    std::unique_lock<std::mutex> barrierUniqueLock(g_barrierMutex);
+
+    g_barrierParkedUpdateThreads++;
+
+    g_barrierConditionVariable.wait(barrierUniqueLock, [releaseSense] {return g_barrierSense == releaseSense || g_barrierKilled;});
+
+    g_barrierParkedUpdateThreads--;
+
+    if (g_barrierSense != releaseSense)
     {
-        // No, so all have reached the barrier.
+        return VK_FALSE;
+    }
 
-        // Initiate next barrier generation. This allows the other threads to proceed.
-        g_barrierGeneration++;
-        if (g_barrierGeneration < 0)
+    return VK_TRUE;
+}
+
+VkBool32 VKTS_APIENTRY barrierGetStatistics(const int32_t phase, const int32_t threadIndex, VkTsBarrierStatistics& statistics)
+{
+    if (phase < 0 || phase >= g_barrierPhaseCount || threadIndex < 0 || threadIndex >= VKTS_MAX_UPDATE_THREADS)
+    {
+        return VK_FALSE;
+    }
+
+    statistics = g_barrierStatistics[phase][threadIndex];
+
+    return VK_TRUE;
+}
+
+void VKTS_APIENTRY barrierResetStatistics()
+{
+    for (int32_t phase = 0; phase < VKTS_MAX_BARRIER_PHASES; phase++)
+    {
+        for (int32_t threadIndex = 0; threadIndex < VKTS_MAX_UPDATE_THREADS; threadIndex++)
         {
-            g_barrierGeneration = 0;
+            g_barrierStatistics[phase][threadIndex] = VkTsBarrierStatistics{};
         }
+    }
+}
 
-        // Wake up the rest.
-        g_barrierConditionVariable.notify_all();
+void VKTS_APIENTRY barrierLogStatistics()
+{
+    for (int32_t phase = 0; phase < g_barrierPhaseCount; phase++)
+    {
+        int32_t slowestThreadIndex = -1;
 
-        return VK_TRUE;
-    }
+        for (int32_t threadIndex = 0; threadIndex < g_barrierUpdateThreads; threadIndex++)
+        {
+            const auto& statistics = g_barrierStatistics[phase][threadIndex];
 
-    return VK_TRUE;
+            if (statistics.syncCount == 0)
+            {
+                continue;
+            }
+
+            logPrint(VKTS_LOG_INFO, __FILE__, __LINE__, "Barrier phase '%s' thread %d: %" PRIu64 " syncs, late average %f max %f, wait average %f max %f, arrived last %" PRIu64 " times.", g_barrierPhaseNames[phase].c_str(), threadIndex, statistics.syncCount, statistics.totalLateTime / (double)statistics.syncCount, statistics.maxLateTime, statistics.totalWaitTime / (double)statistics.syncCount, statistics.maxWaitTime, statistics.lastCount);
+
+            if (slowestThreadIndex < 0 || statistics.lastCount > g_barrierStatistics[phase][slowestThreadIndex].lastCount)
+            {
+                slowestThreadIndex = threadIndex;
+            }
+        }
+
+        if (slowestThreadIndex >= 0)
+        {
+            logPrint(VKTS_LOG_INFO, __FILE__, __LINE__, "Barrier phase '%s': Thread %d is holding up the others most of the time.", g_barrierPhaseNames[phase].c_str(), slowestThreadIndex);
+        }
+    }
 }
 
 void VKTS_APIENTRY barrierKill()
 {
     std::lock_guard<std::mutex> barrierLockGuard(g_barrierMutex);
 
-    g_barrierExecutingUpdateThreads = 0;
+    g_barrierPendingUpdateThreads = 0;
 
-    g_barrierGeneration = -1;
+    g_barrierKilled = VK_TRUE;
 
     g_barrierConditionVariable.notify_all();
 }
@@ -121,4 +323,9 @@ void VKTS_APIENTRY barrierTerminate()
     // Nothing for now.
 }
 
+void VKTS_APIENTRY _barrierSetThreadIndex(const int32_t threadIndex)
+{
+    g_barrierThreadIndex = threadIndex;
+}
+
 }
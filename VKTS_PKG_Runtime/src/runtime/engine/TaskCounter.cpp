@@ -0,0 +1,101 @@
+/**
+ * VKTS - VulKan ToolS.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) since 2014 Norbert Nopper
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <vkts/runtime/vkts_runtime.hpp>
+
+#define VKTS_TASK_COUNTER_SPIN_COUNT 64
+
+namespace vkts
+{
+
+TaskCounter::TaskCounter() :
+    TaskCounter(0)
+{
+}
+
+TaskCounter::TaskCounter(const int32_t count) :
+    count(count), failed(VK_FALSE), mutex(), conditionVariable()
+{
+}
+
+TaskCounter::~TaskCounter()
+{
+}
+
+void TaskCounter::add(const int32_t count)
+{
+    this->count.fetch_add(count);
+}
+
+void TaskCounter::decrement()
+{
+    if (count.fetch_sub(1) == 1)
+    {
+        // Taking the lock guarantees, that no waiting thread misses the notification.
+        std::lock_guard<std::mutex> lockGuard(mutex);
+
+        conditionVariable.notify_all();
+    }
+}
+
+void TaskCounter::setFailed()
+{
+    failed.store(VK_TRUE);
+}
+
+int32_t TaskCounter::getCount() const
+{
+    return count.load();
+}
+
+VkBool32 TaskCounter::isDone() const
+{
+    return count.load() <= 0;
+}
+
+VkBool32 TaskCounter::hasFailed() const
+{
+    return failed.load();
+}
+
+void TaskCounter::wait()
+{
+    for (uint32_t spin = 0; spin < VKTS_TASK_COUNTER_SPIN_COUNT; spin++)
+    {
+        if (isDone())
+        {
+            return;
+        }
+
+        std::this_thread::yield();
+    }
+
+    std::unique_lock<std::mutex> uniqueLock(mutex);
+
+    conditionVariable.wait(uniqueLock, [this] {return isDone() == VK_TRUE;});
+}
+
+} /* namespace vkts */
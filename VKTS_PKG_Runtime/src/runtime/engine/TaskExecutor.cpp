@@ -29,7 +29,9 @@
 namespace vkts
 {
 
-TaskExecutor::TaskExecutor(const int32_t index, ExecutorSync& sync, const TaskQueueSP& sendTaskQueue, const TaskQueueSP& executedTaskQueue) :
+static thread_local VkBool32 g_isExecutorThread = VK_FALSE;
+
+TaskExecutor::TaskExecutor(const int32_t index, ExecutorSync& sync, const TaskSchedulerSP& sendTaskQueue, const TaskSchedulerSP& executedTaskQueue) :
     index(index), sync(sync), sendTaskQueue(sendTaskQueue), executedTaskQueue(executedTaskQueue)
 {
 }
@@ -47,13 +49,15 @@ void TaskExecutor::run() const
 {
     logPrint(VKTS_LOG_SEVERE, __FILE__, __LINE__, "TaskExecutor %d started.", index);
 
+    g_isExecutorThread = VK_TRUE;
+
     ITaskSP task;
 
     auto doRun = VK_TRUE;
 
     while (doRun && sync.doAllRun())
     {
-        doRun = sendTaskQueue->receiveTask(task);
+        doRun = sendTaskQueue->receiveTask(static_cast<uint32_t>(index), task);
 
         if (!task.get())
         {
@@ -64,7 +68,35 @@ void TaskExecutor::run() const
         {
             doRun = task->run();
 
-            doRun = doRun && executedTaskQueue->addTask(task);
+            if (task->taskCounter.get())
+            {
+                // Part of a task graph, so release the successors and signal the counter.
+
+                for (uint32_t i = 0; i < task->allSuccessors.size(); i++)
+                {
+                    const auto& successor = task->allSuccessors[i];
+
+                    if (successor->predecessorExecuted())
+                    {
+                        // Prepare the successor for the next time the graph is sent.
+                        successor->resetPredecessors();
+
+                        sendTaskQueue->addTask(successor);
+                    }
+                }
+
+                if (!doRun)
+                {
+                    task->taskCounter->setFailed();
+                }
+
+                // Decrement even on failure, so no one waits forever.
+                task->taskCounter->decrement();
+            }
+            else
+            {
+                doRun = doRun && executedTaskQueue->addTask(task);
+            }
         }
 
         if (doRun)
@@ -75,11 +107,14 @@ void TaskExecutor::run() const
         {
             sync.setDoAllRunFalse();
         }
-
-        std::this_thread::yield();
     }
 
     logPrint(VKTS_LOG_SEVERE, __FILE__, __LINE__, "TaskExecutor %d terminated.", index);
 }
 
+VkBool32 TaskExecutor::isExecutorThread()
+{
+    return g_isExecutorThread;
+}
+
 } /* namespace vkts */
@@ -30,7 +30,7 @@
 #include <vkts/runtime/vkts_runtime.hpp>
 
 #include "ExecutorSync.hpp"
-#include "TaskQueue.hpp"
+#include "TaskScheduler.hpp"
 
 namespace vkts
 {
@@ -44,15 +44,15 @@ private:
 
     ExecutorSync& sync;
 
-    TaskQueueSP sendTaskQueue;
-    TaskQueueSP executedTaskQueue;
+    TaskSchedulerSP sendTaskQueue;
+    TaskSchedulerSP executedTaskQueue;
 
 public:
 
     TaskExecutor() = delete;
     TaskExecutor(const TaskExecutor& other) = delete;
     TaskExecutor(TaskExecutor&& other) = delete;
-    TaskExecutor(const int32_t index, ExecutorSync& sync, const TaskQueueSP& sendTaskQueue, const TaskQueueSP& executedTaskQueue);
+    TaskExecutor(const int32_t index, ExecutorSync& sync, const TaskSchedulerSP& sendTaskQueue, const TaskSchedulerSP& executedTaskQueue);
     virtual ~TaskExecutor();
 
     TaskExecutor& operator =(const TaskExecutor& other) = delete;
@@ -63,6 +63,11 @@ public:
 
     void run() const;
 
+    /**
+     * Returns VK_TRUE, if the calling thread is running a task executor.
+     */
+    static VkBool32 isExecutorThread();
+
 };
 
 typedef std::shared_ptr<TaskExecutor> TaskExecutorSP;
@@ -0,0 +1,264 @@
+/**
+ * VKTS - VulKan ToolS.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) since 2014 Norbert Nopper
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <vkts/runtime/vkts_runtime.hpp>
+
+// Items never become free, otherwise their measured time could not correct them.
+#define VKTS_TASK_PARTITION_MIN_COST 0.001f
+
+// Limits the correction of one process, so a single disturbed measurement does not move the partition too far.
+#define VKTS_TASK_PARTITION_MIN_FACTOR 0.25
+#define VKTS_TASK_PARTITION_MAX_FACTOR 4.0
+
+namespace vkts
+{
+
+VkBool32 TaskPartition::feedback()
+{
+    double totalCost = 0.0;
+    double totalTime = 0.0;
+
+    for (uint32_t i = 0; i < allChunkCosts.size(); i++)
+    {
+        totalCost += allChunkCosts[i];
+        totalTime += allChunkTimes[i];
+    }
+
+    if (totalCost <= 0.0 || totalTime <= 0.0)
+    {
+        return VK_FALSE;
+    }
+
+    const double averageTime = totalTime / totalCost;
+
+    double correctedCost = 0.0;
+
+    for (uint32_t chunk = 0; chunk < allChunkCosts.size(); chunk++)
+    {
+        double factor = glm::clamp((allChunkTimes[chunk] / allChunkCosts[chunk]) / averageTime, VKTS_TASK_PARTITION_MIN_FACTOR, VKTS_TASK_PARTITION_MAX_FACTOR);
+
+        // Only half of the correction is applied, which damps the noise of the measurements.
+        factor = 0.5 + 0.5 * factor;
+
+        for (uint32_t i = allChunkFirsts[chunk]; i < allChunkFirsts[chunk + 1]; i++)
+        {
+            allCosts[i] = glm::max((float)((double)allCosts[i] * factor), VKTS_TASK_PARTITION_MIN_COST);
+
+            correctedCost += (double)allCosts[i];
+        }
+    }
+
+    // Only the relation between the costs matters, so the total is kept to avoid drifting.
+
+    const double scale = totalCost / correctedCost;
+
+    for (uint32_t i = 0; i < allCosts.size(); i++)
+    {
+        allCosts[i] = glm::max((float)((double)allCosts[i] * scale), VKTS_TASK_PARTITION_MIN_COST);
+    }
+
+    return VK_TRUE;
+}
+
+TaskPartition::TaskPartition() :
+    allCosts(), allChunkFirsts(), allChunkOrder(), allChunkCosts(), allChunkTimes()
+{
+}
+
+TaskPartition::~TaskPartition()
+{
+}
+
+void TaskPartition::setCount(const uint32_t count)
+{
+    allCosts.resize(count, 1.0f);
+}
+
+uint32_t TaskPartition::getCount() const
+{
+    return (uint32_t)allCosts.size();
+}
+
+void TaskPartition::setCost(const uint32_t index, const float cost)
+{
+    if (index >= allCosts.size())
+    {
+        return;
+    }
+
+    allCosts[index] = glm::max(cost, VKTS_TASK_PARTITION_MIN_COST);
+}
+
+float TaskPartition::getCost(const uint32_t index) const
+{
+    if (index >= allCosts.size())
+    {
+        return 0.0f;
+    }
+
+    return allCosts[index];
+}
+
+VkBool32 TaskPartition::partition(const uint32_t chunkCount)
+{
+    allChunkFirsts.clear();
+    allChunkOrder.clear();
+    allChunkCosts.clear();
+    allChunkTimes.clear();
+
+    const uint32_t count = (uint32_t)allCosts.size();
+
+    if (count == 0)
+    {
+        return VK_TRUE;
+    }
+
+    if (chunkCount == 0)
+    {
+        logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "No chunks for %u items.", count);
+
+        return VK_FALSE;
+    }
+
+    const uint32_t currentChunkCount = glm::min(chunkCount, count);
+
+    double totalCost = 0.0;
+
+    for (uint32_t i = 0; i < count; i++)
+    {
+        totalCost += (double)allCosts[i];
+    }
+
+    const double chunkCost = totalCost / (double)currentChunkCount;
+
+    // A chunk ends after the item, which center passes the next multiple of the chunk cost.
+
+    allChunkFirsts.push_back(0);
+
+    double currentCost = 0.0;
+
+    for (uint32_t i = 0; i + 1 < count && allChunkFirsts.size() < currentChunkCount; i++)
+    {
+        currentCost += (double)allCosts[i];
+
+        if (currentCost - 0.5 * (double)allCosts[i] >= chunkCost * (double)allChunkFirsts.size())
+        {
+            allChunkFirsts.push_back(i + 1);
+        }
+    }
+
+    allChunkFirsts.push_back(count);
+
+    //
+
+    const uint32_t numberChunks = (uint32_t)allChunkFirsts.size() - 1;
+
+    allChunkCosts.resize(numberChunks, 0.0);
+    allChunkTimes.resize(numberChunks, 0.0);
+
+    for (uint32_t chunk = 0; chunk < numberChunks; chunk++)
+    {
+        for (uint32_t i = allChunkFirsts[chunk]; i < allChunkFirsts[chunk + 1]; i++)
+        {
+            allChunkCosts[chunk] += (double)allCosts[i];
+        }
+
+        allChunkOrder.push_back(chunk);
+    }
+
+    std::stable_sort(allChunkOrder.begin(), allChunkOrder.end(), [this](const uint32_t a, const uint32_t b) { return allChunkCosts[a] > allChunkCosts[b]; });
+
+    return VK_TRUE;
+}
+
+uint32_t TaskPartition::getNumberChunks() const
+{
+    return (uint32_t)allChunkOrder.size();
+}
+
+VkBool32 TaskPartition::getChunk(const uint32_t index, uint32_t& first, uint32_t& last) const
+{
+    if (index >= allChunkOrder.size())
+    {
+        return VK_FALSE;
+    }
+
+    first = allChunkFirsts[allChunkOrder[index]];
+    last = allChunkFirsts[allChunkOrder[index] + 1];
+
+    return VK_TRUE;
+}
+
+double TaskPartition::getChunkTime(const uint32_t index) const
+{
+    if (index >= allChunkOrder.size())
+    {
+        return 0.0;
+    }
+
+    return allChunkTimes[allChunkOrder[index]];
+}
+
+VkBool32 TaskPartition::process(const IUpdateThreadContext& updateContext, const uint32_t chunkCount, const TaskRangeFunction& rangeFunction)
+{
+    if (!partition(chunkCount))
+    {
+        return VK_FALSE;
+    }
+
+    // Each chunk is one range, so idle task executors pick up the next chunk.
+    // Every chunk writes only its own time, so no synchronization is needed.
+
+    auto chunkFunction = [this, &rangeFunction](const uint32_t first, const uint32_t last) -> VkBool32
+    {
+        for (uint32_t index = first; index < last; index++)
+        {
+            const uint32_t chunk = allChunkOrder[index];
+
+            const double startTime = timeGetRaw();
+
+            if (!rangeFunction(allChunkFirsts[chunk], allChunkFirsts[chunk + 1]))
+            {
+                return VK_FALSE;
+            }
+
+            allChunkTimes[chunk] = timeGetRaw() - startTime;
+        }
+
+        return VK_TRUE;
+    };
+
+    if (!taskParallelFor(updateContext, getNumberChunks(), 1, chunkFunction))
+    {
+        return VK_FALSE;
+    }
+
+    feedback();
+
+    return VK_TRUE;
+}
+
+} /* namespace vkts */
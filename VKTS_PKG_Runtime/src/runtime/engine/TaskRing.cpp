@@ -0,0 +1,136 @@
+/**
+ * VKTS - VulKan ToolS.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) since 2014 Norbert Nopper
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "TaskRing.hpp"
+
+namespace vkts
+{
+
+TaskRing::TaskRing() :
+    allTaskRingElements(), padding0(), enqueuePosition(0), padding1(), dequeuePosition(0), padding2()
+{
+    for (uint64_t i = 0; i < VKTS_MAX_TASK_RING_ELEMENT; i++)
+    {
+        allTaskRingElements[i].sequence.store(i, std::memory_order_relaxed);
+    }
+}
+
+TaskRing::~TaskRing()
+{
+}
+
+VkBool32 TaskRing::push(const ITaskSP& task)
+{
+    TaskRingElement* taskRingElement;
+
+    uint64_t position = enqueuePosition.load(std::memory_order_relaxed);
+
+    while (VK_TRUE)
+    {
+        taskRingElement = &allTaskRingElements[position & (VKTS_MAX_TASK_RING_ELEMENT - 1)];
+
+        const uint64_t sequence = taskRingElement->sequence.load(std::memory_order_acquire);
+
+        const int64_t difference = static_cast<int64_t>(sequence) - static_cast<int64_t>(position);
+
+        if (difference == 0)
+        {
+            // Element is free, so try to claim it.
+            if (enqueuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+            {
+                break;
+            }
+        }
+        else if (difference < 0)
+        {
+            // Ring is full.
+            return VK_FALSE;
+        }
+        else
+        {
+            // Another producer was faster.
+            position = enqueuePosition.load(std::memory_order_relaxed);
+        }
+    }
+
+    taskRingElement->task = task;
+
+    // Publish the element to the consumers.
+    taskRingElement->sequence.store(position + 1, std::memory_order_release);
+
+    return VK_TRUE;
+}
+
+VkBool32 TaskRing::pop(ITaskSP& task)
+{
+    TaskRingElement* taskRingElement;
+
+    uint64_t position = dequeuePosition.load(std::memory_order_relaxed);
+
+    while (VK_TRUE)
+    {
+        taskRingElement = &allTaskRingElements[position & (VKTS_MAX_TASK_RING_ELEMENT - 1)];
+
+        const uint64_t sequence = taskRingElement->sequence.load(std::memory_order_acquire);
+
+        const int64_t difference = static_cast<int64_t>(sequence) - static_cast<int64_t>(position + 1);
+
+        if (difference == 0)
+        {
+            // Element is published, so try to claim it.
+            if (dequeuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+            {
+                break;
+            }
+        }
+        else if (difference < 0)
+        {
+            // Ring is empty.
+            return VK_FALSE;
+        }
+        else
+        {
+            // Another consumer was faster.
+            position = dequeuePosition.load(std::memory_order_relaxed);
+        }
+    }
+
+    task = std::move(taskRingElement->task);
+
+    taskRingElement->task = ITaskSP();
+
+    // Hand the element back to the producers for the next round.
+    taskRingElement->sequence.store(position + VKTS_MAX_TASK_RING_ELEMENT, std::memory_order_release);
+
+    return VK_TRUE;
+}
+
+VkBool32 TaskRing::empty() const
+{
+    return (VkBool32)(enqueuePosition.load(std::memory_order_acquire) == dequeuePosition.load(std::memory_order_acquire));
+}
+
+} /* namespace vkts */
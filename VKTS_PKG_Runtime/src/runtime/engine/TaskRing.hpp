@@ -24,86 +24,85 @@
  * THE SOFTWARE.
  */
 
-#ifndef VKTS_TASKQUEUE_HPP_
-#define VKTS_TASKQUEUE_HPP_
+#ifndef VKTS_TASKRING_HPP_
+#define VKTS_TASKRING_HPP_
 
 #include <vkts/runtime/vkts_runtime.hpp>
 
-#define VKTS_MAX_TASK_QUEUE_ELEMENT 1000
+// Has to be a power of two.
+#define VKTS_MAX_TASK_RING_ELEMENT 1024
+
+#define VKTS_CACHE_LINE_SIZE 64
 
 namespace vkts
 {
 
-class TaskQueueElement
+class TaskRingElement
 {
 
 public:
 
-	uint64_t index;
+    std::atomic<uint64_t> sequence;
 
     ITaskSP task;
 
-    double created;
-
-    double used;
-
-    double recycled;
-
-    double send;
-
-    double received;
-
-    TaskQueueElement() :
-        index(0), task(nullptr), created(0.0), used(-1.0), recycled(-1.0), send(-1.0f), received(-1.0f)
+    TaskRingElement() :
+        sequence(0), task(nullptr)
     {
     }
 
-    ~TaskQueueElement()
+    ~TaskRingElement()
     {
     }
 
 };
 
-class TaskQueue
+/**
+ * Bounded, lock free multi producer / multi consumer ring of tasks.
+ */
+class TaskRing
 {
 
 private:
 
-    TaskQueueElement taskQueueElementCache[VKTS_MAX_TASK_QUEUE_ELEMENT];
-    VkBool32 taskQueueElementCacheUsed[VKTS_MAX_TASK_QUEUE_ELEMENT];
+    TaskRingElement allTaskRingElements[VKTS_MAX_TASK_RING_ELEMENT];
 
-    ThreadsafeQueue<TaskQueueElement*> queue;
+    // Producers and consumers do work on separate cache lines.
 
-    mutable std::mutex mutex;
+    char padding0[VKTS_CACHE_LINE_SIZE];
 
-    std::condition_variable conditionVariable;
+    std::atomic<uint64_t> enqueuePosition;
 
-    uint64_t taskQueueElementCount;
+    char padding1[VKTS_CACHE_LINE_SIZE - sizeof(std::atomic<uint64_t>)];
 
-    TaskQueueElement* getTaskQueueElement();
+    std::atomic<uint64_t> dequeuePosition;
 
-    void recycleTaskQueueElement(TaskQueueElement* taskQueueElement);
+    char padding2[VKTS_CACHE_LINE_SIZE - sizeof(std::atomic<uint64_t>)];
 
 public:
 
-    TaskQueue();
-    TaskQueue(const TaskQueue& other) = delete;
-    TaskQueue(TaskQueue&& other) = delete;
-    virtual ~TaskQueue();
+    TaskRing();
+    TaskRing(const TaskRing& other) = delete;
+    TaskRing(TaskRing&& other) = delete;
+    ~TaskRing();
 
-    TaskQueue& operator =(const TaskQueue& other) = delete;
-    TaskQueue& operator =(TaskQueue && other) = delete;
+    TaskRing& operator =(const TaskRing& other) = delete;
+    TaskRing& operator =(TaskRing && other) = delete;
 
-    VkBool32 addTask(const ITaskSP& task);
+    /**
+     * Returns VK_FALSE, if the ring is full.
+     */
+    VkBool32 push(const ITaskSP& task);
 
-    VkBool32 receiveTask(ITaskSP& task, const VkBool32 wait = VK_TRUE);
+    /**
+     * Returns VK_FALSE, if the ring is empty.
+     */
+    VkBool32 pop(ITaskSP& task);
 
-    void reset();
+    VkBool32 empty() const;
 
 };
 
-typedef std::shared_ptr<TaskQueue> TaskQueueSP;
-
 } /* namespace vkts */
 
-#endif /* VKTS_TASKQUEUE_HPP_ */
+#endif /* VKTS_TASKRING_HPP_ */
@@ -0,0 +1,214 @@
+/**
+ * VKTS - VulKan ToolS.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) since 2014 Norbert Nopper
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "TaskScheduler.hpp"
+
+namespace vkts
+{
+
+void TaskScheduler::pushTask(const uint32_t taskRingIndex, const ITaskSP& task)
+{
+    while (VK_TRUE)
+    {
+        for (uint32_t i = 0; i < taskRingCount; i++)
+        {
+            if (allTaskRings[(taskRingIndex + i) % taskRingCount].push(task))
+            {
+                return;
+            }
+        }
+
+        // All rings are full, so give the consumers time to catch up.
+        std::this_thread::yield();
+    }
+}
+
+VkBool32 TaskScheduler::takeTask(const uint32_t taskRingIndex, ITaskSP& task)
+{
+    // Own ring first, afterwards steal from the others.
+    for (uint32_t i = 0; i < taskRingCount; i++)
+    {
+        if (allTaskRings[(taskRingIndex + i) % taskRingCount].pop(task))
+        {
+            pendingTaskCount.fetch_sub(1);
+
+            return VK_TRUE;
+        }
+    }
+
+    return VK_FALSE;
+}
+
+void TaskScheduler::wakeUp(const uint32_t count)
+{
+    // Only pay for the mutex, if someone is really sleeping.
+    if (parkedCount.load() == 0)
+    {
+        return;
+    }
+
+    std::lock_guard<std::mutex> parkLockGuard(parkMutex);
+
+    if (count == 1)
+    {
+        parkConditionVariable.notify_one();
+    }
+    else
+    {
+        parkConditionVariable.notify_all();
+    }
+}
+
+TaskScheduler::TaskScheduler(const uint32_t taskRingCount) :
+    taskRingCount(glm::max(taskRingCount, 1u)), spinCount(processorGetNumber() > 1 ? VKTS_TASK_SCHEDULER_SPIN_COUNT : 0), allTaskRings(new TaskRing[glm::max(taskRingCount, 1u)]), nextTaskRing(0), pendingTaskCount(0), parkedCount(0), parkMutex(), parkConditionVariable()
+{
+}
+
+TaskScheduler::~TaskScheduler()
+{
+    reset();
+}
+
+uint32_t TaskScheduler::getTaskRingCount() const
+{
+    return taskRingCount;
+}
+
+VkBool32 TaskScheduler::addTask(const ITaskSP& task)
+{
+    pushTask(nextTaskRing.fetch_add(1, std::memory_order_relaxed) % taskRingCount, task);
+
+    pendingTaskCount.fetch_add(1);
+
+    wakeUp(1);
+
+    return VK_TRUE;
+}
+
+VkBool32 TaskScheduler::addTasks(const SmartPointerVector<ITaskSP>& allTasks)
+{
+    if (allTasks.size() == 0)
+    {
+        return VK_TRUE;
+    }
+
+    const uint32_t firstTaskRing = nextTaskRing.fetch_add(allTasks.size(), std::memory_order_relaxed);
+
+    for (uint32_t i = 0; i < allTasks.size(); i++)
+    {
+        pushTask((firstTaskRing + i) % taskRingCount, allTasks[i]);
+    }
+
+    pendingTaskCount.fetch_add(static_cast<int64_t>(allTasks.size()));
+
+    wakeUp(allTasks.size());
+
+    return VK_TRUE;
+}
+
+VkBool32 TaskScheduler::receiveTask(const uint32_t taskRingIndex, ITaskSP& task, const VkBool32 wait)
+{
+    const uint32_t currentTaskRingIndex = taskRingIndex % taskRingCount;
+
+    while (!takeTask(currentTaskRingIndex, task))
+    {
+        if (!wait)
+        {
+            return VK_FALSE;
+        }
+
+        // Spin for a short time, as new tasks usually arrive in bursts.
+        // On a single processor, spinning only delays the producer.
+
+        VkBool32 taken = VK_FALSE;
+
+        for (uint32_t spin = 0; spin < spinCount; spin++)
+        {
+            std::this_thread::yield();
+
+            if (takeTask(currentTaskRingIndex, task))
+            {
+                taken = VK_TRUE;
+
+                break;
+            }
+        }
+
+        if (taken)
+        {
+            break;
+        }
+
+        // Park until a producer signals new tasks.
+
+        std::unique_lock<std::mutex> parkUniqueLock(parkMutex);
+
+        parkedCount.fetch_add(1);
+
+        parkConditionVariable.wait(parkUniqueLock, [this] {return pendingTaskCount.load() > 0;});
+
+        parkedCount.fetch_sub(1);
+    }
+
+    if (!task.get())
+    {
+        return VK_FALSE;
+    }
+
+    return VK_TRUE;
+}
+
+VkBool32 TaskScheduler::receiveTasks(const uint32_t taskRingIndex, SmartPointerVector<ITaskSP>& allTasks, const uint32_t count, const VkBool32 wait)
+{
+    ITaskSP task;
+
+    for (uint32_t i = 0; i < count; i++)
+    {
+        if (!receiveTask(taskRingIndex, task, wait))
+        {
+            return VK_FALSE;
+        }
+
+        allTasks.append(task);
+    }
+
+    return VK_TRUE;
+}
+
+void TaskScheduler::reset()
+{
+    ITaskSP task;
+
+    for (uint32_t i = 0; i < taskRingCount; i++)
+    {
+        while (allTaskRings[i].pop(task))
+        {
+            pendingTaskCount.fetch_sub(1);
+        }
+    }
+}
+
+} /* namespace vkts */
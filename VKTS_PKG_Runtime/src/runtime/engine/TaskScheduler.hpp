@@ -0,0 +1,100 @@
+/**
+ * VKTS - VulKan ToolS.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) since 2014 Norbert Nopper
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef VKTS_TASKSCHEDULER_HPP_
+#define VKTS_TASKSCHEDULER_HPP_
+
+#include <vkts/runtime/vkts_runtime.hpp>
+
+#include "TaskRing.hpp"
+
+#define VKTS_TASK_SCHEDULER_SPIN_COUNT 64
+
+namespace vkts
+{
+
+/**
+ * Every consumer owns one ring. Producers distribute the tasks round robin
+ * over all rings. A consumer takes from its own ring first and steals from the
+ * other rings, before it spins and finally parks.
+ */
+class TaskScheduler
+{
+
+private:
+
+    const uint32_t taskRingCount;
+
+    const uint32_t spinCount;
+
+    std::unique_ptr<TaskRing[]> allTaskRings;
+
+    std::atomic<uint32_t> nextTaskRing;
+
+    std::atomic<int64_t> pendingTaskCount;
+
+    std::atomic<int32_t> parkedCount;
+
+    std::mutex parkMutex;
+
+    std::condition_variable parkConditionVariable;
+
+    void pushTask(const uint32_t taskRingIndex, const ITaskSP& task);
+
+    VkBool32 takeTask(const uint32_t taskRingIndex, ITaskSP& task);
+
+    void wakeUp(const uint32_t count);
+
+public:
+
+    TaskScheduler() = delete;
+    TaskScheduler(const uint32_t taskRingCount);
+    TaskScheduler(const TaskScheduler& other) = delete;
+    TaskScheduler(TaskScheduler&& other) = delete;
+    virtual ~TaskScheduler();
+
+    TaskScheduler& operator =(const TaskScheduler& other) = delete;
+    TaskScheduler& operator =(TaskScheduler && other) = delete;
+
+    uint32_t getTaskRingCount() const;
+
+    VkBool32 addTask(const ITaskSP& task);
+
+    VkBool32 addTasks(const SmartPointerVector<ITaskSP>& allTasks);
+
+    VkBool32 receiveTask(const uint32_t taskRingIndex, ITaskSP& task, const VkBool32 wait = VK_TRUE);
+
+    VkBool32 receiveTasks(const uint32_t taskRingIndex, SmartPointerVector<ITaskSP>& allTasks, const uint32_t count, const VkBool32 wait = VK_TRUE);
+
+    void reset();
+
+};
+
+typedef std::shared_ptr<TaskScheduler> TaskSchedulerSP;
+
+} /* namespace vkts */
+
+#endif /* VKTS_TASKSCHEDULER_HPP_ */
@@ -29,7 +29,7 @@
 namespace vkts
 {
 
-UpdateThreadContext::UpdateThreadContext(const int32_t threadIndex, const int32_t threadCount, const double tickTime, const TaskQueueSP& sendTaskQueue, const TaskQueueSP& executedTaskQueue) :
+UpdateThreadContext::UpdateThreadContext(const int32_t threadIndex, const int32_t threadCount, const double tickTime, const TaskSchedulerSP& sendTaskQueue, const TaskSchedulerSP& executedTaskQueue) :
     IUpdateThreadContext(), threadIndex(threadIndex), threadCount(threadCount), sendTaskQueue(sendTaskQueue), executedTaskQueue(executedTaskQueue)
 {
     this->startTime = timeGetRaw();
@@ -107,6 +107,16 @@ VkBool32 UpdateThreadContext::sendTask(const ITaskSP& task) const
     return sendTaskQueue->addTask(task);
 }
 
+VkBool32 UpdateThreadContext::sendTasks(const SmartPointerVector<ITaskSP>& allTasks) const
+{
+    if (!sendTaskQueue.get())
+    {
+        return VK_FALSE;
+    }
+
+    return sendTaskQueue->addTasks(allTasks);
+}
+
 VkBool32 UpdateThreadContext::receiveExecutedTask(ITaskSP& task, const VkBool32 wait) const
 {
     if (!executedTaskQueue.get())
@@ -114,7 +124,17 @@ VkBool32 UpdateThreadContext::receiveExecutedTask(ITaskSP& task, const VkBool32
         return VK_FALSE;
     }
 
-    return executedTaskQueue->receiveTask(task, wait);
+    return executedTaskQueue->receiveTask(static_cast<uint32_t>(threadIndex), task, wait);
+}
+
+VkBool32 UpdateThreadContext::receiveExecutedTasks(SmartPointerVector<ITaskSP>& allTasks, const uint32_t count, const VkBool32 wait) const
+{
+    if (!executedTaskQueue.get())
+    {
+        return VK_FALSE;
+    }
+
+    return executedTaskQueue->receiveTasks(static_cast<uint32_t>(threadIndex), allTasks, count, wait);
 }
 
 void UpdateThreadContext::resetSendTasks() const
@@ -29,7 +29,7 @@
 
 #include <vkts/runtime/vkts_runtime.hpp>
 
-#include "TaskQueue.hpp"
+#include "TaskScheduler.hpp"
 
 namespace vkts
 {
@@ -49,8 +49,8 @@ private:
 
     double tickTime;
 
-    TaskQueueSP sendTaskQueue;
-    TaskQueueSP executedTaskQueue;
+    TaskSchedulerSP sendTaskQueue;
+    TaskSchedulerSP executedTaskQueue;
 
     uint64_t lastTicks;
     uint64_t currentTicks;
@@ -60,7 +60,7 @@ public:
     UpdateThreadContext() = delete;
     UpdateThreadContext(const UpdateThreadContext& other) = delete;
     UpdateThreadContext(UpdateThreadContext&& other) = delete;
-    UpdateThreadContext(const int32_t threadIndex, const int32_t threadCount, const double tickTime, const TaskQueueSP& sendTaskQueue, const TaskQueueSP& executedTaskQueue);
+    UpdateThreadContext(const int32_t threadIndex, const int32_t threadCount, const double tickTime, const TaskSchedulerSP& sendTaskQueue, const TaskSchedulerSP& executedTaskQueue);
     virtual ~UpdateThreadContext();
 
     UpdateThreadContext& operator =(const UpdateThreadContext& other) = delete;
@@ -94,8 +94,12 @@ public:
 
     virtual VkBool32 sendTask(const ITaskSP& task) const override;
 
+    virtual VkBool32 sendTasks(const SmartPointerVector<ITaskSP>& allTasks) const override;
+
     virtual VkBool32 receiveExecutedTask(ITaskSP& task, const VkBool32 wait = VK_TRUE) const override;
 
+    virtual VkBool32 receiveExecutedTasks(SmartPointerVector<ITaskSP>& allTasks, const uint32_t count, const VkBool32 wait = VK_TRUE) const override;
+
     virtual void resetSendTasks() const override;
 
     virtual void resetExecutedTasks() const override;
@@ -26,6 +26,8 @@
 
 #include "UpdateThreadExecutor.hpp"
 
+#include "../barrier/fn_barrier_internal.hpp"
+
 namespace vkts
 {
 
@@ -47,6 +49,8 @@ void UpdateThreadExecutor::run() const
 {
     // Initialization.
 
+    _barrierSetThreadIndex(index);
+
     VkBool32 doRun = VK_TRUE;
 
     if (!updateThread->init(*updateThreadContext))
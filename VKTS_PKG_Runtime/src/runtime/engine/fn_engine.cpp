@@ -26,6 +26,7 @@
 
 #include <vkts/runtime/vkts_runtime.hpp>
 
+#include "fn_engine_internal.hpp"
 #include "TaskExecutor.hpp"
 #include "UpdateThreadExecutor.hpp"
 
@@ -49,6 +50,10 @@ static uint32_t g_taskExecutorCount = 0;
 
 static PFN_dispatchFunction g_dispatchFunction = nullptr;
 
+// Shared with the functions, which are not getting an update thread context.
+static std::mutex g_sendTaskQueueMutex;
+static TaskSchedulerSP g_sendTaskQueue;
+
 VkBool32 VKTS_APIENTRY engineInit(const PFN_dispatchFunction dispatchFunction)
 {
     if (!processorInit())
@@ -159,14 +164,23 @@ VkBool32 VKTS_APIENTRY engineRun()
 
     logPrint(VKTS_LOG_INFO, __FILE__, __LINE__, "Started.");
 
+    // Barrier caches the number of update threads, so it is prepared for every run.
+    if (!barrierInit())
+    {
+        logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Run failed! Could not initialize the barrier.");
+
+        return VK_FALSE;
+    }
+
     // Task queue creation.
 
-    TaskQueueSP sendTaskQueue;
-    TaskQueueSP executedTaskQueue;
+    TaskSchedulerSP sendTaskQueue;
+    TaskSchedulerSP executedTaskQueue;
 
     if (g_taskExecutorCount > 0)
     {
-        sendTaskQueue = TaskQueueSP(new TaskQueue);
+        // One ring per task executor, so idle executors can steal from the others.
+        sendTaskQueue = TaskSchedulerSP(new TaskScheduler(g_taskExecutorCount));
 
         if (!sendTaskQueue.get())
         {
@@ -175,7 +189,7 @@ VkBool32 VKTS_APIENTRY engineRun()
             return VK_FALSE;
         }
 
-        executedTaskQueue = TaskQueueSP(new TaskQueue);
+        executedTaskQueue = TaskSchedulerSP(new TaskScheduler(1));
 
         if (!executedTaskQueue.get())
         {
@@ -224,6 +238,12 @@ VkBool32 VKTS_APIENTRY engineRun()
         logPrint(VKTS_LOG_INFO, __FILE__, __LINE__, "Task %d started.", currentTaskExecutor->getIndex());
     }
 
+    {
+        std::lock_guard<std::mutex> sendTaskQueueLock(g_sendTaskQueueMutex);
+
+        g_sendTaskQueue = sendTaskQueue;
+    }
+
     //
     // Update Thread creation and launching.
     //
@@ -317,6 +337,12 @@ VkBool32 VKTS_APIENTRY engineRun()
     realUpdateThreadExecutors.clear();
     realUpdateThreads.clear();
 
+    {
+        std::lock_guard<std::mutex> sendTaskQueueLock(g_sendTaskQueueMutex);
+
+        g_sendTaskQueue = TaskSchedulerSP();
+    }
+
     //
 
     if (sendTaskQueue.get())
@@ -361,6 +387,13 @@ VkBool32 VKTS_APIENTRY engineRun()
     return VK_TRUE;
 }
 
+TaskSchedulerSP VKTS_APIENTRY engineGetSendTaskQueue()
+{
+    std::lock_guard<std::mutex> sendTaskQueueLock(g_sendTaskQueueMutex);
+
+    return g_sendTaskQueue;
+}
+
 int32_t VKTS_APIENTRY engineGetNumberUpdateThreads()
 {
     return static_cast<int32_t>(g_allUpdateThreads.size());
@@ -0,0 +1,187 @@
+/**
+ * VKTS - VulKan ToolS.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) since 2014 Norbert Nopper
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <vkts/runtime/vkts_runtime.hpp>
+
+#include "fn_engine_internal.hpp"
+#include "TaskExecutor.hpp"
+
+namespace vkts
+{
+
+class RangeTask : public ITask
+{
+
+private:
+
+    const TaskRangeFunction& rangeFunction;
+
+    const uint32_t first;
+
+    const uint32_t last;
+
+protected:
+
+    virtual VkBool32 execute() override
+    {
+        return rangeFunction(first, last);
+    }
+
+public:
+
+    RangeTask(const uint64_t id, const TaskRangeFunction& rangeFunction, const uint32_t first, const uint32_t last) :
+        ITask(id), rangeFunction(rangeFunction), first(first), last(last)
+    {
+    }
+
+    virtual ~RangeTask()
+    {
+    }
+
+};
+
+typedef std::function<VkBool32(const SmartPointerVector<ITaskSP>& allTasks)> TaskSendFunction;
+
+static TaskCounterSP taskFork(const TaskSendFunction& sendFunction, const SmartPointerVector<ITaskSP>& allTasks)
+{
+    auto taskCounter = TaskCounterSP(new TaskCounter(static_cast<int32_t>(allTasks.size())));
+
+    if (!taskCounter.get())
+    {
+        return TaskCounterSP();
+    }
+
+    SmartPointerVector<ITaskSP> allRootTasks;
+
+    for (uint32_t i = 0; i < allTasks.size(); i++)
+    {
+        allTasks[i]->setTaskCounter(taskCounter);
+
+        if (allTasks[i]->getPredecessorCount() == 0)
+        {
+            allRootTasks.append(allTasks[i]);
+        }
+    }
+
+    if (allTasks.size() > 0 && allRootTasks.size() == 0)
+    {
+        logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Task graph has no task without predecessor.");
+
+        return TaskCounterSP();
+    }
+
+    if (!sendFunction(allRootTasks))
+    {
+        return TaskCounterSP();
+    }
+
+    return taskCounter;
+}
+
+static VkBool32 taskParallelFor(const TaskSendFunction& sendFunction, const uint32_t count, const uint32_t grainSize, const TaskRangeFunction& rangeFunction)
+{
+    if (count == 0)
+    {
+        return VK_TRUE;
+    }
+
+    const uint32_t currentGrainSize = glm::max(grainSize, 1u);
+
+    const uint32_t rangeCount = (count + currentGrainSize - 1) / currentGrainSize;
+
+    if (rangeCount > 1)
+    {
+        SmartPointerVector<ITaskSP> allRangeTasks;
+
+        // First range is processed by the calling thread.
+        for (uint32_t i = 1; i < rangeCount; i++)
+        {
+            allRangeTasks.append(ITaskSP(new RangeTask(i, rangeFunction, i * currentGrainSize, glm::min((i + 1) * currentGrainSize, count))));
+        }
+
+        auto taskCounter = taskFork(sendFunction, allRangeTasks);
+
+        if (taskCounter.get())
+        {
+            VkBool32 result = rangeFunction(0, currentGrainSize);
+
+            // Always join, as the range tasks are still referencing the range function.
+            if (!taskJoin(taskCounter))
+            {
+                result = VK_FALSE;
+            }
+
+            return result;
+        }
+    }
+
+    // No task executors, so process everything here.
+
+    return rangeFunction(0, count);
+}
+
+TaskCounterSP VKTS_APIENTRY taskFork(const IUpdateThreadContext& updateContext, const SmartPointerVector<ITaskSP>& allTasks)
+{
+    return taskFork([&updateContext](const SmartPointerVector<ITaskSP>& allRootTasks) {
+        return updateContext.sendTasks(allRootTasks);
+    }, allTasks);
+}
+
+VkBool32 VKTS_APIENTRY taskJoin(const TaskCounterSP& taskCounter)
+{
+    if (!taskCounter.get())
+    {
+        return VK_FALSE;
+    }
+
+    taskCounter->wait();
+
+    return !taskCounter->hasFailed();
+}
+
+VkBool32 VKTS_APIENTRY taskParallelFor(const IUpdateThreadContext& updateContext, const uint32_t count, const uint32_t grainSize, const TaskRangeFunction& rangeFunction)
+{
+    return taskParallelFor([&updateContext](const SmartPointerVector<ITaskSP>& allRootTasks) {
+        return updateContext.sendTasks(allRootTasks);
+    }, count, grainSize, rangeFunction);
+}
+
+VkBool32 VKTS_APIENTRY taskParallelFor(const uint32_t count, const uint32_t grainSize, const TaskRangeFunction& rangeFunction)
+{
+    auto sendTaskQueue = engineGetSendTaskQueue();
+
+    // A waiting task executor could block the executors, the ranges are sent to.
+    if (!sendTaskQueue.get() || TaskExecutor::isExecutorThread())
+    {
+        return rangeFunction(0, count);
+    }
+
+    return taskParallelFor([&sendTaskQueue](const SmartPointerVector<ITaskSP>& allRootTasks) {
+        return sendTaskQueue->addTasks(allRootTasks);
+    }, count, grainSize, rangeFunction);
+}
+
+}
@@ -26,172 +26,59 @@
 
 #include <vkts/scenegraph/vkts_scenegraph.hpp>
 
-#define VKTS_BEZIER_TOLERANCE 0.1f
-#define VKTS_BEZIER_LOOPS 10
-
 namespace vkts
 {
 
-static float interpolateLinear(const uint32_t currentIndex, const float key, const IChannelSP& channel)
-{
-    float beforeKey = channel->getKeys()[currentIndex];
-    float beforeValue = channel->getValues()[currentIndex];
-
-    float afterKey = channel->getKeys()[currentIndex + 1];
-
-    float deltaKey = afterKey - beforeKey;
-    if (deltaKey == 0.0f)
-    {
-        return beforeValue;
-    }
-
-    float afterValue = channel->getValues()[currentIndex + 1];
-
-    return (afterValue - beforeValue) * (key - beforeKey) / deltaKey + beforeValue;
-}
-
-static float interpolateBezier(const uint32_t currentIndex, const float key, const IChannelSP& channel)
+float VKTS_APIENTRY interpolate(const float key, const IChannelSP& channel)
 {
-    float beforeKey = channel->getKeys()[currentIndex];
-    float beforeValue = channel->getValues()[currentIndex];
-
-    float afterKey = channel->getKeys()[currentIndex + 1];
-
-    float deltaKey = afterKey - beforeKey;
-    if (deltaKey == 0.0f)
-    {
-        return beforeValue;
-    }
-
-    float afterValue = channel->getValues()[currentIndex + 1];
-
-    float beforeRightHandleKey = channel->getHandles()[currentIndex].z;
-    float afterLeftHandleKey = channel->getHandles()[currentIndex + 1].x;
-
-    float t;
-    float t2;
-    float t3;
-    float ot;
-    float ot2;
-    float ot3;
-
-    float currentKey = key;
-
-    bool doBinarySearch = true;
-
-    int32_t counter = 0;
-
-    do
+    if (!channel.get())
     {
-        t = (currentKey - beforeKey) / deltaKey;
-        t2 = t * t;
-        t3 = t2 * t;
-        ot = 1.0f - t;
-        ot2 = ot * ot;
-        ot3 = ot2 * ot;
-
-        float newKey = ot3 * beforeKey + 3.0f * ot2 * t * beforeRightHandleKey + 3.0f * ot * t2 * afterLeftHandleKey + t3 * afterKey;
-
-        if (newKey > key + VKTS_BEZIER_TOLERANCE || newKey < key - VKTS_BEZIER_TOLERANCE)
-        {
-        	if ((newKey < currentKey && newKey > key) || (newKey > currentKey && newKey < key))
-        	{
-        		currentKey = (key + newKey) * 0.5f;
-        	}
-        	else if (newKey > currentKey)
-        	{
-        		currentKey -= VKTS_BEZIER_TOLERANCE;
-        	}
-        	else
-        	{
-        		currentKey += VKTS_BEZIER_TOLERANCE;
-        	}
-        }
-        else
-        {
-        	currentKey = newKey;
-
-            doBinarySearch = false;
-        }
-
-        counter++;
+        return 0.0f;
     }
-    while (doBinarySearch && counter < VKTS_BEZIER_LOOPS);
-
-    float beforeRightHandleValue = channel->getHandles()[currentIndex].w;
-    float afterLeftHandleValue = channel->getHandles()[currentIndex + 1].y;
 
-    t = (currentKey - beforeKey) / deltaKey;
-    t2 = t * t;
-    t3 = t2 * t;
-    ot = 1.0f - t;
-    ot2 = ot * ot;
-    ot3 = ot2 * ot;
-
-    return ot3 * beforeValue + 3.0f * ot2 * t * beforeRightHandleValue + 3.0f * ot * t2 * afterLeftHandleValue + t3 * afterValue;
+    return channel->getCurve().sample(key);
 }
 
-float VKTS_APIENTRY interpolate(const float key, const IChannelSP& channel)
+float VKTS_APIENTRY interpolate(const float key, const IChannelSP& channel, uint32_t& cursor)
 {
     if (!channel.get())
     {
         return 0.0f;
     }
 
-    if (channel->getNumberEntries() == 0)
-    {
-        return 0.0f;
-    }
-
-    if (channel->getNumberEntries() == 1)
-    {
-        return channel->getValues()[0];
-    }
+    return channel->getCurve().sample(key, cursor);
+}
 
-    if (key <= channel->getKeys()[0])
+VkBool32 VKTS_APIENTRY interpolateChannels(std::vector<float>& pose, std::vector<uint32_t>& cursors, const float key, const IAnimationSP& animation)
+{
+    if (!animation.get())
     {
-        return channel->getValues()[0];
+        return VK_FALSE;
     }
 
-    auto lastIndex = channel->getNumberEntries() - 1;
+    const auto& allChannels = animation->getChannels();
 
-    if (key >= channel->getKeys()[lastIndex])
+    if (pose.size() != allChannels.size())
     {
-        return channel->getValues()[lastIndex];
+        pose.resize(allChannels.size());
     }
 
-    // Key is in between the available keys now.
-
-    uint32_t currentIndex = 0;
-    while (currentIndex < channel->getNumberEntries())
+    if (cursors.size() != allChannels.size())
     {
-        if (key < channel->getKeys()[currentIndex])
-        {
-        	currentIndex--;
-
-            break;
-        }
-
-        currentIndex++;
+        cursors.resize(allChannels.size(), 0);
     }
 
-    if (channel->getInterpolators()[currentIndex] == VKTS_INTERPOLATOR_BEZIER)
+    for (uint32_t i = 0; i < allChannels.size(); i++)
     {
-        if (channel->getInterpolators()[currentIndex + 1] == VKTS_INTERPOLATOR_BEZIER)
+        if (!allChannels[i].get())
         {
-            return interpolateBezier(currentIndex, key, channel);
+            return VK_FALSE;
         }
 
-        return interpolateLinear(currentIndex, key, channel);
-    }
-
-    if (channel->getInterpolators()[currentIndex] == VKTS_INTERPOLATOR_LINEAR)
-    {
-        return interpolateLinear(currentIndex, key, channel);
+        pose[i] = allChannels[i]->getCurve().sample(key, cursors[i]);
     }
 
-    // VKTS_INTERPOLATOR_CONSTANT
-    return channel->getValues()[currentIndex];
+    return VK_TRUE;
 }
 
 VkBool32 VKTS_APIENTRY interpolateConvert(IChannelSP& converted, const IChannelSP& channel, const float sampleTime)
@@ -226,9 +113,11 @@ VkBool32 VKTS_APIENTRY interpolateConvert(IChannelSP& converted, const IChannelS
 
                 currentKey += sampleTime;
 
+                uint32_t cursor = i;
+
                 while (currentKey < nextKey)
                 {
-                    auto currentValue = interpolate(currentKey, channel);
+                    auto currentValue = interpolate(currentKey, channel, cursor);
 
                     converted->addEntry(currentKey, currentValue, glm::vec4(currentKey - 0.1f, currentValue, currentKey + 0.1f, currentValue), VKTS_INTERPOLATOR_LINEAR);
 
@@ -241,4 +130,166 @@ VkBool32 VKTS_APIENTRY interpolateConvert(IChannelSP& converted, const IChannelS
     return VK_TRUE;
 }
 
+static Quat interpolateRotation(const VkTsRotationMode rotationMode, const glm::vec3& rotate)
+{
+    switch (rotationMode)
+    {
+        case VKTS_EULER_YXZ:
+            return rotateRzRxRy(rotate.z, rotate.x, rotate.y);
+        case VKTS_EULER_XYZ:
+            return rotateRzRyRx(rotate.z, rotate.y, rotate.x);
+        case VKTS_EULER_XZY:
+            return rotateRyRzRx(rotate.y, rotate.z, rotate.x);
+    }
+
+    return Quat();
+}
+
+VkBool32 VKTS_APIENTRY interpolateBake(const AnimationClipSP& clip, const SmartPointerVector<INodeSP>& allNodes, const float sampleRate, const float maxError)
+{
+    if (!clip.get() || allNodes.size() == 0 || sampleRate <= 0.0f)
+    {
+        return VK_FALSE;
+    }
+
+    const uint32_t trackCount = allNodes.size();
+
+    // All tracks share the time range of the animations.
+
+    SmartPointerVector<IAnimationSP> allTrackAnimations;
+
+    float startTime = 0.0f;
+    float stopTime = 0.0f;
+
+    VkBool32 anyAnimation = VK_FALSE;
+
+    for (uint32_t track = 0; track < trackCount; track++)
+    {
+        if (!allNodes[track].get())
+        {
+            return VK_FALSE;
+        }
+
+        const int32_t currentAnimation = allNodes[track]->getCurrentAnimation();
+
+        if (currentAnimation < 0 || currentAnimation >= (int32_t)allNodes[track]->getNumberAnimations())
+        {
+            allTrackAnimations.append(IAnimationSP());
+
+            continue;
+        }
+
+        const IAnimationSP& animation = allNodes[track]->getAnimations()[currentAnimation];
+
+        if (!animation.get())
+        {
+            return VK_FALSE;
+        }
+
+        allTrackAnimations.append(animation);
+
+        if (!anyAnimation || animation->getStart() < startTime)
+        {
+            startTime = animation->getStart();
+        }
+
+        if (!anyAnimation || animation->getStop() > stopTime)
+        {
+            stopTime = animation->getStop();
+        }
+
+        anyAnimation = VK_TRUE;
+    }
+
+    if (!anyAnimation)
+    {
+        return VK_FALSE;
+    }
+
+    const uint32_t sampleCount = (uint32_t)ceilf((stopTime - startTime) * sampleRate) + 1;
+
+    std::vector<glm::vec3> allTranslates((size_t)sampleCount * trackCount);
+    std::vector<Quat> allRotations((size_t)sampleCount * trackCount);
+    std::vector<glm::vec3> allScales((size_t)sampleCount * trackCount);
+
+    std::vector<float> pose;
+    std::vector<uint32_t> cursors;
+
+    for (uint32_t track = 0; track < trackCount; track++)
+    {
+        const INodeSP& node = allNodes[track];
+
+        // Same rotation mode as used by the node for its transform.
+
+        const VkTsRotationMode rotationMode = node->isNode() ? node->getNodeRotationMode() : node->getBindRotationMode();
+
+        cursors.clear();
+
+        for (uint32_t frame = 0; frame < sampleCount; frame++)
+        {
+            glm::vec3 translate = node->getTranslate();
+            glm::vec3 rotate = node->getRotate();
+            glm::vec3 scale = node->getScale();
+
+            Quat quaternion;
+            VkBool32 quaternionDirty = VK_FALSE;
+
+            const IAnimationSP& animation = allTrackAnimations[track];
+
+            if (animation.get())
+            {
+                const float key = glm::min(startTime + (float)frame / sampleRate, stopTime);
+
+                if (!interpolateChannels(pose, cursors, key, animation))
+                {
+                    return VK_FALSE;
+                }
+
+                const auto& allChannels = animation->getChannels();
+
+                for (uint32_t i = 0; i < allChannels.size(); i++)
+                {
+                    switch (allChannels[i]->getTargetTransform())
+                    {
+                        case VKTS_TARGET_TRANSFORM_TRANSLATE:
+                            translate[allChannels[i]->getTargetTransformElement()] = pose[i];
+                            break;
+                        case VKTS_TARGET_TRANSFORM_ROTATE:
+                            rotate[allChannels[i]->getTargetTransformElement()] = pose[i];
+                            break;
+                        case VKTS_TARGET_TRANSFORM_QUATERNION_ROTATE:
+                            quaternion[allChannels[i]->getTargetTransformElement()] = pose[i];
+                            quaternionDirty = VK_TRUE;
+                            break;
+                        case VKTS_TARGET_TRANSFORM_SCALE:
+                            scale[allChannels[i]->getTargetTransformElement()] = pose[i];
+                            break;
+                    }
+                }
+            }
+
+            const size_t index = (size_t)frame * trackCount + track;
+
+            allTranslates[index] = translate;
+            allRotations[index] = quaternionDirty ? quaternion : interpolateRotation(rotationMode, rotate);
+            allScales[index] = scale;
+        }
+    }
+
+    if (!clip->bake(trackCount, sampleCount, startTime, sampleRate, allTranslates, allRotations, allScales, maxError))
+    {
+        return VK_FALSE;
+    }
+
+    for (uint32_t track = 0; track < trackCount; track++)
+    {
+        if (allTrackAnimations[track].get())
+        {
+            allTrackAnimations[track]->setClip(clip, track);
+        }
+    }
+
+    return VK_TRUE;
+}
+
 }
@@ -63,11 +63,11 @@ void GltfVisitor::visitBuffer(JSONobject& jsonObject)
 
 	std::string finalFilename = directory + gltfString;
 
-	auto binaryBuffer = fileLoadBinary(finalFilename.c_str());
+	auto binaryBuffer = fileMapBinary(finalFilename.c_str());
 
 	if (!binaryBuffer.get())
 	{
-		binaryBuffer = fileLoadBinary(gltfString.c_str());
+		binaryBuffer = fileMapBinary(gltfString.c_str());
 
 		if (!binaryBuffer.get())
 		{
@@ -1886,18 +1886,18 @@ void GltfVisitor::visitMesh_Primitive_Attributes(JSONobject& jsonObject)
 
 void GltfVisitor::visitAnimation_Sampler(JSONobject& jsonObject)
 {
-	const auto& allKeys = jsonObject.getAllKeys();
-
-	for (uint32_t i = 0; i < allKeys.size(); i++)
+	for (uint32_t i = 0; i < jsonObject.size(); i++)
 	{
+		const std::string currentKey = jsonObject.getKeyAt(i);
+
 		gltfAnimation_Sampler.input = nullptr;
 		gltfAnimation_Sampler.interpolation = "LINEAR";
 		gltfAnimation_Sampler.output = nullptr;
-		gltfAnimation_Sampler.name = allKeys[i];
+		gltfAnimation_Sampler.name = currentKey;
 
 		//
 
-		auto currentBuffer = jsonObject.getValue(allKeys[i]);
+		auto currentBuffer = jsonObject.getValueAt(i);
 
 		state.push(GltfState_Animation_Sampler_Properties);
 		currentBuffer->visit(*this);
@@ -1909,7 +1909,7 @@ void GltfVisitor::visitAnimation_Sampler(JSONobject& jsonObject)
 
 		//
 
-		gltfAnimation.samplers[allKeys[i]] = gltfAnimation_Sampler;
+		gltfAnimation.samplers[currentKey] = gltfAnimation_Sampler;
 	}
 }
 
@@ -2734,17 +2734,17 @@ void GltfVisitor::visit(JSONobject& jsonObject)
 	}
 	else if (gltfState == GltfState_Buffers)
 	{
-		const auto& allKeys = jsonObject.getAllKeys();
-
-		for (uint32_t i = 0; i < allKeys.size(); i++)
+		for (uint32_t i = 0; i < jsonObject.size(); i++)
 		{
+			const std::string currentKey = jsonObject.getKeyAt(i);
+
 			gltfBuffer.binaryBuffer = IBinaryBufferSP();
 			gltfBuffer.byteLength = 0;
-			gltfBuffer.name = allKeys[i];
+			gltfBuffer.name = currentKey;
 
 			//
 
-			auto currentBuffer = jsonObject.getValue(allKeys[i]);
+			auto currentBuffer = jsonObject.getValueAt(i);
 
 			state.push(GltfState_Buffer);
 			currentBuffer->visit(*this);
@@ -2756,23 +2756,23 @@ void GltfVisitor::visit(JSONobject& jsonObject)
 
 			//
 
-			allGltfBuffers[allKeys[i]] = gltfBuffer;
+			allGltfBuffers[currentKey] = gltfBuffer;
 		}
 	}
 	else if (gltfState == GltfState_BufferViews)
 	{
-		const auto& allKeys = jsonObject.getAllKeys();
-
-		for (uint32_t i = 0; i < allKeys.size(); i++)
+		for (uint32_t i = 0; i < jsonObject.size(); i++)
 		{
+			const std::string currentKey = jsonObject.getKeyAt(i);
+
 			gltfBufferView.buffer = nullptr;
 			gltfBufferView.byteOffset = 0;
 		    gltfBufferView.byteLength = 0;
-			gltfBufferView.name = allKeys[i];
+			gltfBufferView.name = currentKey;
 
 			//
 
-			auto currentBufferView = jsonObject.getValue(allKeys[i]);
+			auto currentBufferView = jsonObject.getValueAt(i);
 
 			state.push(GltfState_BufferView);
 			currentBufferView->visit(*this);
@@ -2784,15 +2784,15 @@ void GltfVisitor::visit(JSONobject& jsonObject)
 
 			//
 
-			allGltfBufferViews[allKeys[i]] = gltfBufferView;
+			allGltfBufferViews[currentKey] = gltfBufferView;
 		}
 	}
 	else if (gltfState == GltfState_Accessors)
 	{
-		const auto& allKeys = jsonObject.getAllKeys();
-
-		for (uint32_t i = 0; i < allKeys.size(); i++)
+		for (uint32_t i = 0; i < jsonObject.size(); i++)
 		{
+			const std::string currentKey = jsonObject.getKeyAt(i);
+
 			gltfAccessor.bufferView = nullptr;
 			gltfAccessor.byteOffset = 0;
 			gltfAccessor.byteStride = 0;
@@ -2814,11 +2814,11 @@ void GltfVisitor::visit(JSONobject& jsonObject)
 			gltfAccessor.maxUnsignedInteger.clear();
 			gltfAccessor.maxFloat.clear();
 
-			gltfAccessor.name = allKeys[i];
+			gltfAccessor.name = currentKey;
 
 			//
 
-			auto currentAccessor = jsonObject.getValue(allKeys[i]);
+			auto currentAccessor = jsonObject.getValueAt(i);
 
 			state.push(GltfState_Accessor);
 			currentAccessor->visit(*this);
@@ -2830,21 +2830,21 @@ void GltfVisitor::visit(JSONobject& jsonObject)
 
 			//
 
-			allGltfAccessors[allKeys[i]] = gltfAccessor;
+			allGltfAccessors[currentKey] = gltfAccessor;
 		}
 	}
 	else if (gltfState == GltfState_Images)
 	{
-		const auto& allKeys = jsonObject.getAllKeys();
-
-		for (uint32_t i = 0; i < allKeys.size(); i++)
+		for (uint32_t i = 0; i < jsonObject.size(); i++)
 		{
+			const std::string currentKey = jsonObject.getKeyAt(i);
+
 			gltfImage.imageData.reset();
-			gltfImage.name = allKeys[i];
+			gltfImage.name = currentKey;
 
 			//
 
-			auto currentImage = jsonObject.getValue(allKeys[i]);
+			auto currentImage = jsonObject.getValueAt(i);
 
 			state.push(GltfState_Image);
 			currentImage->visit(*this);
@@ -2856,24 +2856,24 @@ void GltfVisitor::visit(JSONobject& jsonObject)
 
 			//
 
-			allGltfImages[allKeys[i]] = gltfImage;
+			allGltfImages[currentKey] = gltfImage;
 		}
 	}
 	else if (gltfState == GltfState_Samplers)
 	{
-		const auto& allKeys = jsonObject.getAllKeys();
-
-		for (uint32_t i = 0; i < allKeys.size(); i++)
+		for (uint32_t i = 0; i < jsonObject.size(); i++)
 		{
+			const std::string currentKey = jsonObject.getKeyAt(i);
+
 			gltfSampler.magFilter = 9729;
 			gltfSampler.minFilter = 9986;
 			gltfSampler.wrapS = 10497;
 			gltfSampler.wrapT = 10497;
-			gltfSampler.name = allKeys[i];
+			gltfSampler.name = currentKey;
 
 			//
 
-			auto currentSampler = jsonObject.getValue(allKeys[i]);
+			auto currentSampler = jsonObject.getValueAt(i);
 
 			state.push(GltfState_Sampler);
 			currentSampler->visit(*this);
@@ -2885,26 +2885,26 @@ void GltfVisitor::visit(JSONobject& jsonObject)
 
 			//
 
-			allGltfSamplers[allKeys[i]] = gltfSampler;
+			allGltfSamplers[currentKey] = gltfSampler;
 		}
 	}
 	else if (gltfState == GltfState_Textures)
 	{
-		const auto& allKeys = jsonObject.getAllKeys();
-
-		for (uint32_t i = 0; i < allKeys.size(); i++)
+		for (uint32_t i = 0; i < jsonObject.size(); i++)
 		{
+			const std::string currentKey = jsonObject.getKeyAt(i);
+
 			gltfTexture.format = 6408;
 			gltfTexture.internalFormat = 6408;
 			gltfTexture.sampler = nullptr;
 			gltfTexture.source = nullptr;
 			gltfTexture.target = 3553;
 			gltfTexture.type = 5121;
-			gltfTexture.name = allKeys[i];
+			gltfTexture.name = currentKey;
 
 			//
 
-			auto currentTexture = jsonObject.getValue(allKeys[i]);
+			auto currentTexture = jsonObject.getValueAt(i);
 
 			state.push(GltfState_Texture);
 			currentTexture->visit(*this);
@@ -2916,15 +2916,15 @@ void GltfVisitor::visit(JSONobject& jsonObject)
 
 			//
 
-			allGltfTextures[allKeys[i]] = gltfTexture;
+			allGltfTextures[currentKey] = gltfTexture;
 		}
 	}
 	else if (gltfState == GltfState_Materials)
 	{
-		const auto& allKeys = jsonObject.getAllKeys();
-
-		for (uint32_t i = 0; i < allKeys.size(); i++)
+		for (uint32_t i = 0; i < jsonObject.size(); i++)
 		{
+			const std::string currentKey = jsonObject.getKeyAt(i);
+
 			gltfMaterial.materialModel = "";
 
 			gltfMaterial.baseColorFactor[0] = 1.0f;
@@ -2951,11 +2951,11 @@ void GltfVisitor::visit(JSONobject& jsonObject)
 			gltfMaterial.emissiveFactor[3] = 1.0f;
 			gltfMaterial.emissiveTexture = nullptr;
 
-			gltfMaterial.name = allKeys[i];
+			gltfMaterial.name = currentKey;
 
 			//
 
-			auto currentMaterial = jsonObject.getValue(allKeys[i]);
+			auto currentMaterial = jsonObject.getValueAt(i);
 
 			state.push(GltfState_Material);
 			currentMaterial->visit(*this);
@@ -2967,21 +2967,21 @@ void GltfVisitor::visit(JSONobject& jsonObject)
 
 			//
 
-			allGltfMaterials[allKeys[i]] = gltfMaterial;
+			allGltfMaterials[currentKey] = gltfMaterial;
 		}
 	}
 	else if (gltfState == GltfState_Meshes)
 	{
-		const auto& allKeys = jsonObject.getAllKeys();
-
-		for (uint32_t i = 0; i < allKeys.size(); i++)
+		for (uint32_t i = 0; i < jsonObject.size(); i++)
 		{
+			const std::string currentKey = jsonObject.getKeyAt(i);
+
 			gltfMesh.primitives.clear();
-			gltfMesh.name = allKeys[i];
+			gltfMesh.name = currentKey;
 
 			//
 
-			auto currentMesh = jsonObject.getValue(allKeys[i]);
+			auto currentMesh = jsonObject.getValueAt(i);
 
 			state.push(GltfState_Mesh);
 			currentMesh->visit(*this);
@@ -2993,15 +2993,15 @@ void GltfVisitor::visit(JSONobject& jsonObject)
 
 			//
 
-			allGltfMeshes[allKeys[i]] = gltfMesh;
+			allGltfMeshes[currentKey] = gltfMesh;
 		}
 	}
 	else if (gltfState == GltfState_Skins)
 	{
-		const auto& allKeys = jsonObject.getAllKeys();
-
-		for (uint32_t i = 0; i < allKeys.size(); i++)
+		for (uint32_t i = 0; i < jsonObject.size(); i++)
 		{
+			const std::string currentKey = jsonObject.getKeyAt(i);
+
 			for (int32_t k = 0; k < 16; k++)
 			{
 				if ((k % 4) - (k / 4) == 0)
@@ -3017,12 +3017,12 @@ void GltfVisitor::visit(JSONobject& jsonObject)
 			gltfSkin.inverseBindMatrices.clear();
 			gltfSkin.jointNames.clear();
 			gltfSkin.jointNodes.clear();
-			gltfSkin.name = allKeys[i];
+			gltfSkin.name = currentKey;
 
 
 			//
 
-			auto currentSKin = jsonObject.getValue(allKeys[i]);
+			auto currentSKin = jsonObject.getValueAt(i);
 
 			state.push(GltfState_Skin);
 			currentSKin->visit(*this);
@@ -3034,15 +3034,15 @@ void GltfVisitor::visit(JSONobject& jsonObject)
 
 			//
 
-			allGltfSkins[allKeys[i]] = gltfSkin;
+			allGltfSkins[currentKey] = gltfSkin;
 		}
 	}
 	else if (gltfState == GltfState_Nodes)
 	{
-		const auto& allKeys = jsonObject.getAllKeys();
-
-		for (uint32_t i = 0; i < allKeys.size(); i++)
+		for (uint32_t i = 0; i < jsonObject.size(); i++)
 		{
+			const std::string currentKey = jsonObject.getKeyAt(i);
+
 			gltfNode.children.clear();
 			gltfNode.skeletons.clear();
 			gltfNode.skin = nullptr;
@@ -3054,7 +3054,7 @@ void GltfVisitor::visit(JSONobject& jsonObject)
 			gltfNode.useRotation = VK_FALSE;
 			gltfNode.useScale = VK_FALSE;
 			gltfNode.useTranslation = VK_FALSE;
-			gltfNode.name = allKeys[i];
+			gltfNode.name = currentKey;
 
 			for (int32_t k = 0; k < 16; k++)
 			{
@@ -3085,7 +3085,7 @@ void GltfVisitor::visit(JSONobject& jsonObject)
 
 			//
 
-			auto currentNode = jsonObject.getValue(allKeys[i]);
+			auto currentNode = jsonObject.getValueAt(i);
 
 			state.push(GltfState_Node);
 			currentNode->visit(*this);
@@ -3097,22 +3097,22 @@ void GltfVisitor::visit(JSONobject& jsonObject)
 
 			//
 
-			allGltfNodes[allKeys[i]] = gltfNode;
+			allGltfNodes[currentKey] = gltfNode;
 		}
 	}
 	else if (gltfState == GltfState_Animations)
 	{
-		const auto& allKeys = jsonObject.getAllKeys();
-
-		for (uint32_t i = 0; i < allKeys.size(); i++)
+		for (uint32_t i = 0; i < jsonObject.size(); i++)
 		{
+			const std::string currentKey = jsonObject.getKeyAt(i);
+
 			gltfAnimation.samplers.clear();
 			gltfAnimation.channels.clear();
-			gltfAnimation.name = allKeys[i];
+			gltfAnimation.name = currentKey;
 
 			//
 
-			auto currentAnimation = jsonObject.getValue(allKeys[i]);
+			auto currentAnimation = jsonObject.getValueAt(i);
 
 			state.push(GltfState_Animation);
 			currentAnimation->visit(*this);
@@ -3124,21 +3124,21 @@ void GltfVisitor::visit(JSONobject& jsonObject)
 
 			//
 
-			allGltfAnimations[allKeys[i]] = gltfAnimation;
+			allGltfAnimations[currentKey] = gltfAnimation;
 		}
 	}
 	else if (gltfState == GltfState_Scenes)
 	{
-		const auto& allKeys = jsonObject.getAllKeys();
-
-		for (uint32_t i = 0; i < allKeys.size(); i++)
+		for (uint32_t i = 0; i < jsonObject.size(); i++)
 		{
+			const std::string currentKey = jsonObject.getKeyAt(i);
+
 			gltfScene.nodes.clear();
-			gltfScene.name = allKeys[i];
+			gltfScene.name = currentKey;
 
 			//
 
-			auto currentScene = jsonObject.getValue(allKeys[i]);
+			auto currentScene = jsonObject.getValueAt(i);
 
 			state.push(GltfState_Scene);
 			currentScene->visit(*this);
@@ -3150,7 +3150,7 @@ void GltfVisitor::visit(JSONobject& jsonObject)
 
 			//
 
-			allGltfScenes[allKeys[i]] = gltfScene;
+			allGltfScenes[currentKey] = gltfScene;
 		}
 	}
 	else if (gltfState == GltfState_Buffer)
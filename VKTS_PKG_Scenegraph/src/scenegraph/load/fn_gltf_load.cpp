@@ -1053,14 +1053,15 @@ ISceneSP VKTS_APIENTRY gltfLoad(const char* filename, const ISceneManagerSP& sce
         return ISceneSP();
     }
 
-	auto textFile = fileLoadText(filename);
+	auto textFile = fileMapText(filename);
 
 	if (!textFile.get())
 	{
 		return ISceneSP();
 	}
 
-	auto json = jsonDecode(textFile->getString());
+	// Parts not processed by the visitor e.g. shaders, techniques and extras are never decoded.
+	auto json = jsonDecodeLazy(textFile);
 
 	if (!json.get())
 	{
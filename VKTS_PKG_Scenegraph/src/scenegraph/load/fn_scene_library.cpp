@@ -0,0 +1,1230 @@
+/**
+ * VKTS - VulKan ToolS.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) since 2014 Norbert Nopper
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <vkts/scenegraph/vkts_scenegraph.hpp>
+
+#include "fn_scene_library_internal.hpp"
+
+namespace vkts
+{
+
+std::string VKTS_APIENTRY _sceneLibraryGetBinaryFilename(const char* filename)
+{
+    if (!filename)
+    {
+        return "";
+    }
+
+    std::string binaryFilename = filename;
+
+    const size_t dot = binaryFilename.rfind('.');
+    const size_t separator = binaryFilename.find_last_of("/\\");
+
+    if (dot != std::string::npos && (separator == std::string::npos || dot > separator))
+    {
+        binaryFilename.erase(dot);
+    }
+
+    return binaryFilename + VKTS_SCENE_LIBRARY_EXTENSION;
+}
+
+static IBinaryBufferSP sceneLibraryLoadBinary(const char* directory, const char* filename)
+{
+    const std::string binaryFilename = _sceneLibraryGetBinaryFilename(filename);
+
+    std::string finalFilename = std::string(directory) + binaryFilename;
+
+    auto binaryBuffer = fileMapBinary(finalFilename.c_str());
+
+    if (!binaryBuffer.get())
+    {
+        binaryBuffer = fileMapBinary(binaryFilename.c_str());
+    }
+
+    return binaryBuffer;
+}
+
+static ITextBufferSP sceneLibraryLoadText(const char* directory, const char* filename)
+{
+    std::string finalFilename = std::string(directory) + std::string(filename);
+
+    auto textBuffer = fileMapText(finalFilename.c_str());
+
+    if (!textBuffer.get())
+    {
+        textBuffer = fileMapText(filename);
+    }
+
+    return textBuffer;
+}
+
+//
+// Binary library decoding.
+//
+
+static const uint8_t* sceneLibraryDecodeHeader(const IBinaryBufferSP& binaryBuffer, const uint32_t libraryType, const uint32_t entrySize, VkTsSceneLibraryHeader& header)
+{
+    if (!binaryBuffer.get() || !binaryBuffer->getByteData() || binaryBuffer->getSize() < sizeof(VkTsSceneLibraryHeader))
+    {
+        return nullptr;
+    }
+
+    const uint8_t* data = binaryBuffer->getByteData();
+    const uint64_t size = (uint64_t)binaryBuffer->getSize();
+
+    memcpy(&header, data, sizeof(VkTsSceneLibraryHeader));
+
+    if (header.magic != VKTS_SCENE_LIBRARY_MAGIC)
+    {
+        return nullptr;
+    }
+
+    if (header.version != VKTS_SCENE_LIBRARY_VERSION || header.libraryType != libraryType)
+    {
+        logPrint(VKTS_LOG_WARNING, __FILE__, __LINE__, "Binary library has version %u and type %u", header.version, header.libraryType);
+
+        return nullptr;
+    }
+
+    // All sections have to be in order and inside of the file.
+
+    const uint64_t entriesEnd = (uint64_t)sizeof(VkTsSceneLibraryHeader) + (uint64_t)header.entryCount * (uint64_t)entrySize + (uint64_t)header.dependencyCount * sizeof(uint32_t);
+
+    if (entriesEnd > (uint64_t)header.stringsOffset || (uint64_t)header.stringsOffset + (uint64_t)header.stringsSize > (uint64_t)header.dataOffset || (uint64_t)header.dataOffset + (uint64_t)header.dataSize > size)
+    {
+        logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Binary library is truncated");
+
+        return nullptr;
+    }
+
+    if (header.stringsSize > 0 && data[header.stringsOffset + header.stringsSize - 1] != '\0')
+    {
+        logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Binary library has invalid strings");
+
+        return nullptr;
+    }
+
+    return data;
+}
+
+static VkBool32 sceneLibraryDecodeString(const uint8_t* data, const VkTsSceneLibraryHeader& header, const uint32_t offset, std::string& value)
+{
+    if (offset >= header.stringsSize)
+    {
+        return VK_FALSE;
+    }
+
+    value = (const char*)&data[header.stringsOffset + offset];
+
+    return VK_TRUE;
+}
+
+static VkBool32 sceneLibraryDecodeRange(const VkTsSceneLibraryHeader& header, const uint32_t offset, const uint64_t size)
+{
+    return (uint64_t)offset + size <= (uint64_t)header.dataSize;
+}
+
+//
+// Binary library encoding.
+//
+
+static uint32_t sceneLibraryEncodeString(std::vector<uint8_t>& allStrings, std::map<std::string, uint32_t>& allStringOffsets, const std::string& value)
+{
+    auto walker = allStringOffsets.find(value);
+
+    if (walker != allStringOffsets.end())
+    {
+        return walker->second;
+    }
+
+    const uint32_t offset = (uint32_t)allStrings.size();
+
+    allStrings.insert(allStrings.end(), value.begin(), value.end());
+    allStrings.push_back('\0');
+
+    allStringOffsets[value] = offset;
+
+    return offset;
+}
+
+static uint32_t sceneLibraryEncodeData(std::vector<uint8_t>& allData, const void* data, const size_t size)
+{
+    // Every block starts aligned, so it can be used directly.
+    while (allData.size() % VKTS_SCENE_LIBRARY_ALIGNMENT != 0)
+    {
+        allData.push_back(0);
+    }
+
+    const uint32_t offset = (uint32_t)allData.size();
+
+    if (size > 0)
+    {
+        allData.insert(allData.end(), (const uint8_t*)data, (const uint8_t*)data + size);
+    }
+
+    return offset;
+}
+
+static VkBool32 sceneLibrarySave(const char* filename, const uint32_t libraryType, const void* allEntries, const uint32_t entryCount, const uint32_t entrySize, const std::vector<uint32_t>& allDependencies, const std::vector<uint8_t>& allStrings, const std::vector<uint8_t>& allData)
+{
+    VkTsSceneLibraryHeader header;
+
+    header.magic = VKTS_SCENE_LIBRARY_MAGIC;
+    header.version = VKTS_SCENE_LIBRARY_VERSION;
+    header.libraryType = libraryType;
+    header.entryCount = entryCount;
+    header.dependencyCount = (uint32_t)allDependencies.size();
+    header.stringsOffset = (uint32_t)(sizeof(VkTsSceneLibraryHeader) + entryCount * entrySize + allDependencies.size() * sizeof(uint32_t));
+    header.stringsSize = (uint32_t)allStrings.size();
+    header.dataOffset = (header.stringsOffset + header.stringsSize + VKTS_SCENE_LIBRARY_ALIGNMENT - 1) & ~(VKTS_SCENE_LIBRARY_ALIGNMENT - 1);
+    header.dataSize = (uint32_t)allData.size();
+
+    std::vector<uint8_t> allBytes(header.dataOffset + header.dataSize, 0);
+
+    memcpy(&allBytes[0], &header, sizeof(VkTsSceneLibraryHeader));
+
+    if (entryCount > 0)
+    {
+        memcpy(&allBytes[sizeof(VkTsSceneLibraryHeader)], allEntries, entryCount * entrySize);
+    }
+
+    if (allDependencies.size() > 0)
+    {
+        memcpy(&allBytes[sizeof(VkTsSceneLibraryHeader) + entryCount * entrySize], &allDependencies[0], allDependencies.size() * sizeof(uint32_t));
+    }
+
+    if (allStrings.size() > 0)
+    {
+        memcpy(&allBytes[header.stringsOffset], &allStrings[0], allStrings.size());
+    }
+
+    if (allData.size() > 0)
+    {
+        memcpy(&allBytes[header.dataOffset], &allData[0], allData.size());
+    }
+
+    return fileSaveBinaryData(filename, &allBytes[0], (uint32_t)allBytes.size());
+}
+
+//
+// Sub meshes.
+//
+
+static void sceneLibraryInitSubMesh(VkTsSubMeshData& subMeshData, const char* name)
+{
+    subMeshData.name = name;
+    subMeshData.material = "";
+    subMeshData.doubleSided = VK_FALSE;
+
+    subMeshData.vertexBufferType = 0;
+    subMeshData.numberVertices = 0;
+    subMeshData.numberIndices = 0;
+    subMeshData.strideInBytes = 0;
+
+    for (uint32_t i = 0; i < VKTS_SCENE_LIBRARY_OFFSETS; i++)
+    {
+        subMeshData.offsets[i] = -1;
+    }
+
+    subMeshData.aabbMin = glm::vec4(0.0f, 0.0f, 0.0f, 1.0f);
+    subMeshData.aabbMax = glm::vec4(0.0f, 0.0f, 0.0f, 1.0f);
+
+    subMeshData.vertexBinaryBuffer = IBinaryBufferSP();
+    subMeshData.indicesBinaryBuffer = IBinaryBufferSP();
+}
+
+static VkBool32 sceneLibraryInterleaveSubMesh(VkTsSubMeshData& subMeshData, const std::vector<float>& vertex, const std::vector<float>& normal, const std::vector<float>& bitangent, const std::vector<float>& tangent, const std::vector<float>& texcoord, const std::vector<float>& boneIndices0, const std::vector<float>& boneIndices1, const std::vector<float>& boneWeights0, const std::vector<float>& boneWeights1, const std::vector<float>& numberBones, const std::vector<int32_t>& indices)
+{
+    subMeshData.numberVertices = (int32_t)(vertex.size() / 4);
+    subMeshData.numberIndices = (int32_t)indices.size();
+
+    int32_t totalSize = 0;
+    uint32_t strideInBytes = 0;
+
+    VkTsVertexBufferType vertexBufferType = 0;
+
+    if (vertex.size() > 0)
+    {
+        subMeshData.offsets[0] = strideInBytes;
+        strideInBytes += 4 * sizeof(float);
+
+        totalSize += 4 * sizeof(float) * subMeshData.numberVertices;
+
+        vertexBufferType |= VKTS_VERTEX_BUFFER_TYPE_VERTEX;
+    }
+
+    if (normal.size() > 0)
+    {
+        if (normal.size() / 3 != vertex.size() / 4)
+        {
+            logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Normal has different size");
+
+            return VK_FALSE;
+        }
+
+        subMeshData.offsets[1] = strideInBytes;
+        strideInBytes += 3 * sizeof(float);
+
+        totalSize += 3 * sizeof(float) * subMeshData.numberVertices;
+
+        vertexBufferType |= VKTS_VERTEX_BUFFER_TYPE_NORMAL;
+    }
+
+    if (normal.size() > 0 && bitangent.size() > 0 && tangent.size() > 0)
+    {
+        if (bitangent.size() / 3 != vertex.size() / 4)
+        {
+            logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Bitangent has different size");
+
+            return VK_FALSE;
+        }
+
+        subMeshData.offsets[2] = strideInBytes;
+        strideInBytes += 3 * sizeof(float);
+
+        totalSize += 3 * sizeof(float) * subMeshData.numberVertices;
+
+        //
+
+        if (tangent.size() / 3 != vertex.size() / 4)
+        {
+            logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Tangent has different size");
+
+            return VK_FALSE;
+        }
+
+        subMeshData.offsets[3] = strideInBytes;
+        strideInBytes += 3 * sizeof(float);
+
+        totalSize += 3 * sizeof(float) * subMeshData.numberVertices;
+
+        //
+
+        vertexBufferType |= VKTS_VERTEX_BUFFER_TYPE_TANGENTS;
+    }
+
+    if (texcoord.size() > 0)
+    {
+        if (texcoord.size() / 2 != vertex.size() / 4)
+        {
+            logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "TextureObject coordinate has different size");
+
+            return VK_FALSE;
+        }
+
+        subMeshData.offsets[4] = strideInBytes;
+        strideInBytes += 2 * sizeof(float);
+
+        totalSize += 2 * sizeof(float) * subMeshData.numberVertices;
+
+        vertexBufferType |= VKTS_VERTEX_BUFFER_TYPE_TEXCOORD;
+    }
+
+    if (boneIndices0.size() > 0 && boneIndices1.size() > 0 && boneWeights0.size() > 0 && boneWeights1.size() > 0 && numberBones.size() > 0)
+    {
+        if (boneIndices0.size() / 4 != vertex.size() / 4)
+        {
+            logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Bone indices0 has different size: %u != %u", boneIndices0.size(), vertex.size());
+
+            return VK_FALSE;
+        }
+
+        subMeshData.offsets[5] = strideInBytes;
+        strideInBytes += 4 * sizeof(float);
+
+        totalSize += 4 * sizeof(float) * subMeshData.numberVertices;
+
+        if (boneIndices1.size() / 4 != vertex.size() / 4)
+        {
+            logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Bone indices1 has different size %u != %u", boneIndices1.size(), vertex.size());
+
+            return VK_FALSE;
+        }
+
+        subMeshData.offsets[6] = strideInBytes;
+        strideInBytes += 4 * sizeof(float);
+
+        totalSize += 4 * sizeof(float) * subMeshData.numberVertices;
+
+        if (boneWeights0.size() / 4 != vertex.size() / 4)
+        {
+            logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Bone weights0 has different size");
+
+            return VK_FALSE;
+        }
+
+        subMeshData.offsets[7] = strideInBytes;
+        strideInBytes += 4 * sizeof(float);
+
+        totalSize += 4 * sizeof(float) * subMeshData.numberVertices;
+
+        if (boneWeights1.size() / 4 != vertex.size() / 4)
+        {
+            logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Bone weights has different size");
+
+            return VK_FALSE;
+        }
+
+        subMeshData.offsets[8] = strideInBytes;
+        strideInBytes += 4 * sizeof(float);
+
+        totalSize += 4 * sizeof(float) * subMeshData.numberVertices;
+
+        if (numberBones.size() != vertex.size() / 4)
+        {
+            logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Number bones has different size");
+
+            return VK_FALSE;
+        }
+
+        subMeshData.offsets[9] = strideInBytes;
+        strideInBytes += 1 * sizeof(float);
+
+        totalSize += 1 * sizeof(float) * subMeshData.numberVertices;
+
+        vertexBufferType |= VKTS_VERTEX_BUFFER_TYPE_BONES;
+    }
+
+    subMeshData.strideInBytes = strideInBytes;
+    subMeshData.vertexBufferType = vertexBufferType;
+
+    if (totalSize == 0 || indices.size() == 0)
+    {
+        logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Sub mesh incomplete");
+
+        return VK_FALSE;
+    }
+
+    auto vertexBinaryBuffer = binaryBufferCreate((uint32_t)totalSize);
+
+    if (!vertexBinaryBuffer.get() || vertexBinaryBuffer->getSize() != (uint32_t)totalSize)
+    {
+        logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Could not create vertex binary buffer");
+
+        return VK_FALSE;
+    }
+
+    for (int32_t currentVertexElement = 0; currentVertexElement < subMeshData.numberVertices; currentVertexElement++)
+    {
+        if (vertexBufferType & VKTS_VERTEX_BUFFER_TYPE_VERTEX)
+        {
+            vertexBinaryBuffer->write(reinterpret_cast<const uint8_t*>(&vertex[currentVertexElement * 4]), 1, 4 * sizeof(float));
+        }
+        if (vertexBufferType & VKTS_VERTEX_BUFFER_TYPE_NORMAL)
+        {
+            vertexBinaryBuffer->write(reinterpret_cast<const uint8_t*>(&normal[currentVertexElement * 3]), 1, 3 * sizeof(float));
+        }
+        if (vertexBufferType & VKTS_VERTEX_BUFFER_TYPE_BITANGENT)
+        {
+            vertexBinaryBuffer->write( reinterpret_cast<const uint8_t*>(&bitangent[currentVertexElement * 3]), 1, 3 * sizeof(float));
+        }
+        if (vertexBufferType & VKTS_VERTEX_BUFFER_TYPE_TANGENT)
+        {
+            vertexBinaryBuffer->write(reinterpret_cast<const uint8_t*>(&tangent[currentVertexElement * 3]), 1, 3 * sizeof(float));
+        }
+        if (vertexBufferType & VKTS_VERTEX_BUFFER_TYPE_TEXCOORD)
+        {
+            vertexBinaryBuffer->write(reinterpret_cast<const uint8_t*>(&texcoord[currentVertexElement * 2]), 1, 2 * sizeof(float));
+        }
+        if (vertexBufferType & VKTS_VERTEX_BUFFER_TYPE_BONE_INDICES0)
+        {
+            vertexBinaryBuffer->write(reinterpret_cast<const uint8_t*>(&boneIndices0[currentVertexElement * 4]), 1, 4 * sizeof(float));
+        }
+        if (vertexBufferType & VKTS_VERTEX_BUFFER_TYPE_BONE_INDICES1)
+        {
+            vertexBinaryBuffer->write(reinterpret_cast<const uint8_t*>(&boneIndices1[currentVertexElement * 4]), 1, 4 * sizeof(float));
+        }
+        if (vertexBufferType & VKTS_VERTEX_BUFFER_TYPE_BONE_WEIGHTS0)
+        {
+            vertexBinaryBuffer->write(reinterpret_cast<const uint8_t*>(&boneWeights0[currentVertexElement * 4]), 1, 4 * sizeof(float));
+        }
+        if (vertexBufferType & VKTS_VERTEX_BUFFER_TYPE_BONE_WEIGHTS1)
+        {
+            vertexBinaryBuffer->write(reinterpret_cast<const uint8_t*>(&boneWeights1[currentVertexElement * 4]), 1, 4 * sizeof(float));
+        }
+        if (vertexBufferType & VKTS_VERTEX_BUFFER_TYPE_BONE_NUMBERS)
+        {
+            vertexBinaryBuffer->write(reinterpret_cast<const uint8_t*>(&numberBones[currentVertexElement * 1]), 1, 1 * sizeof(float));
+        }
+    }
+
+    const Aabb box((const float*)vertexBinaryBuffer->getData(), subMeshData.numberVertices, subMeshData.strideInBytes);
+
+    subMeshData.aabbMin = box.getCorner(0);
+    subMeshData.aabbMax = box.getCorner(1);
+
+    subMeshData.vertexBinaryBuffer = vertexBinaryBuffer;
+
+    //
+
+    const uint32_t size = sizeof(int32_t) * subMeshData.numberIndices;
+
+    subMeshData.indicesBinaryBuffer = binaryBufferCreate(reinterpret_cast<const uint8_t*>(&indices[0]), size);
+
+    if (!subMeshData.indicesBinaryBuffer.get() || subMeshData.indicesBinaryBuffer->getSize() != size)
+    {
+        logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Could not create indices binary buffer");
+
+        return VK_FALSE;
+    }
+
+    return VK_TRUE;
+}
+
+static VkBool32 sceneLibraryParseSubMeshes(const ITextBufferSP& textBuffer, VkTsSubMeshLibrary& subMeshLibrary)
+{
+    char buffer[VKTS_MAX_BUFFER_CHARS + 1];
+    char sdata[VKTS_MAX_TOKEN_CHARS + 1];
+    float fdata[8];
+    int32_t idata[3];
+    VkBool32 bdata;
+
+    VkTsSubMeshData subMeshData;
+    VkBool32 hasSubMesh = VK_FALSE;
+
+    std::vector<float> vertex;
+    std::vector<float> normal;
+    std::vector<float> bitangent;
+    std::vector<float> tangent;
+    std::vector<float> texcoord;
+
+    std::vector<float> boneIndices0;
+    std::vector<float> boneIndices1;
+    std::vector<float> boneWeights0;
+    std::vector<float> boneWeights1;
+    std::vector<float> numberBones;
+
+    std::vector<int32_t> indices;
+
+    while (textBuffer->gets(buffer, VKTS_MAX_BUFFER_CHARS))
+    {
+        if (parseSkipBuffer(buffer))
+        {
+            continue;
+        }
+
+        if (parseIsToken(buffer, "material_library"))
+        {
+            if (!parseString(buffer, sdata, VKTS_MAX_TOKEN_CHARS))
+            {
+                return VK_FALSE;
+            }
+
+            subMeshLibrary.allMaterialLibraries.push_back(sdata);
+
+            continue;
+        }
+        else if (parseIsToken(buffer, "name"))
+        {
+            if (!parseString(buffer, sdata, VKTS_MAX_TOKEN_CHARS))
+            {
+                return VK_FALSE;
+            }
+
+            sceneLibraryInitSubMesh(subMeshData, sdata);
+
+            hasSubMesh = VK_TRUE;
+
+            continue;
+        }
+
+        // All other tokens belong to a sub mesh.
+
+        if (parseIsToken(buffer, "double_sided"))
+        {
+            if (!parseBool(buffer, &bdata))
+            {
+                return VK_FALSE;
+            }
+
+            subMeshData.doubleSided = bdata;
+        }
+        else if (parseIsToken(buffer, "vertex"))
+        {
+            if (!parseVec4(buffer, fdata))
+            {
+                return VK_FALSE;
+            }
+
+            vertex.insert(vertex.end(), fdata, fdata + 4);
+        }
+        else if (parseIsToken(buffer, "normal"))
+        {
+            if (!parseVec3(buffer, fdata))
+            {
+                return VK_FALSE;
+            }
+
+            normal.insert(normal.end(), fdata, fdata + 3);
+        }
+        else if (parseIsToken(buffer, "bitangent"))
+        {
+            if (!parseVec3(buffer, fdata))
+            {
+                return VK_FALSE;
+            }
+
+            bitangent.insert(bitangent.end(), fdata, fdata + 3);
+        }
+        else if (parseIsToken(buffer, "tangent"))
+        {
+            if (!parseVec3(buffer, fdata))
+            {
+                return VK_FALSE;
+            }
+
+            tangent.insert(tangent.end(), fdata, fdata + 3);
+        }
+        else if (parseIsToken(buffer, "texcoord"))
+        {
+            if (!parseVec2(buffer, fdata))
+            {
+                return VK_FALSE;
+            }
+
+            texcoord.insert(texcoord.end(), fdata, fdata + 2);
+        }
+        else if (parseIsToken(buffer, "boneIndex"))
+        {
+            if (!parseVec8(buffer, fdata))
+            {
+                return VK_FALSE;
+            }
+
+            boneIndices0.insert(boneIndices0.end(), fdata, fdata + 4);
+            boneIndices1.insert(boneIndices1.end(), fdata + 4, fdata + 8);
+        }
+        else if (parseIsToken(buffer, "boneWeight"))
+        {
+            if (!parseVec8(buffer, fdata))
+            {
+                return VK_FALSE;
+            }
+
+            boneWeights0.insert(boneWeights0.end(), fdata, fdata + 4);
+            boneWeights1.insert(boneWeights1.end(), fdata + 4, fdata + 8);
+        }
+        else if (parseIsToken(buffer, "numberBones"))
+        {
+            if (!parseFloat(buffer, fdata))
+            {
+                return VK_FALSE;
+            }
+
+            numberBones.push_back(fdata[0]);
+        }
+        else if (parseIsToken(buffer, "face"))
+        {
+            if (!parseIVec3(buffer, idata))
+            {
+                return VK_FALSE;
+            }
+
+            indices.insert(indices.end(), idata, idata + 3);
+        }
+        else if (parseIsToken(buffer, "material"))
+        {
+            if (!parseString(buffer, sdata, VKTS_MAX_TOKEN_CHARS))
+            {
+                return VK_FALSE;
+            }
+
+            if (!hasSubMesh)
+            {
+                logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "No sub mesh");
+
+                return VK_FALSE;
+            }
+
+            subMeshData.material = sdata;
+
+            //
+            // Material does complete the sub mesh.
+            //
+
+            if (!sceneLibraryInterleaveSubMesh(subMeshData, vertex, normal, bitangent, tangent, texcoord, boneIndices0, boneIndices1, boneWeights0, boneWeights1, numberBones, indices))
+            {
+                return VK_FALSE;
+            }
+
+            subMeshLibrary.allSubMeshes.push_back(subMeshData);
+
+            hasSubMesh = VK_FALSE;
+
+            vertex.clear();
+            normal.clear();
+            bitangent.clear();
+            tangent.clear();
+            texcoord.clear();
+
+            boneIndices0.clear();
+            boneIndices1.clear();
+            boneWeights0.clear();
+            boneWeights1.clear();
+            numberBones.clear();
+
+            indices.clear();
+
+            continue;
+        }
+        else
+        {
+            parseUnknownBuffer(buffer);
+
+            continue;
+        }
+
+        if (!hasSubMesh)
+        {
+            logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "No sub mesh");
+
+            return VK_FALSE;
+        }
+    }
+
+    return VK_TRUE;
+}
+
+static VkBool32 sceneLibraryDecodeSubMeshes(const IBinaryBufferSP& binaryBuffer, VkTsSubMeshLibrary& subMeshLibrary)
+{
+    VkTsSceneLibraryHeader header;
+
+    const uint8_t* data = sceneLibraryDecodeHeader(binaryBuffer, VKTS_SCENE_LIBRARY_TYPE_SUB_MESHES, sizeof(VkTsSceneLibrarySubMesh), header);
+
+    if (!data)
+    {
+        return VK_FALSE;
+    }
+
+    const uint8_t* allEntries = data + sizeof(VkTsSceneLibraryHeader);
+    const uint8_t* allDependencies = allEntries + header.entryCount * sizeof(VkTsSceneLibrarySubMesh);
+    const uint8_t* allData = data + header.dataOffset;
+
+    std::string value;
+
+    for (uint32_t i = 0; i < header.dependencyCount; i++)
+    {
+        uint32_t offset;
+
+        memcpy(&offset, allDependencies + i * sizeof(uint32_t), sizeof(uint32_t));
+
+        if (!sceneLibraryDecodeString(data, header, offset, value))
+        {
+            return VK_FALSE;
+        }
+
+        subMeshLibrary.allMaterialLibraries.push_back(value);
+    }
+
+    subMeshLibrary.allSubMeshes.resize(header.entryCount);
+
+    for (uint32_t i = 0; i < header.entryCount; i++)
+    {
+        VkTsSceneLibrarySubMesh entry;
+
+        memcpy(&entry, allEntries + i * sizeof(VkTsSceneLibrarySubMesh), sizeof(VkTsSceneLibrarySubMesh));
+
+        VkTsSubMeshData& subMeshData = subMeshLibrary.allSubMeshes[i];
+
+        if (!sceneLibraryDecodeString(data, header, entry.name, subMeshData.name) || !sceneLibraryDecodeString(data, header, entry.material, subMeshData.material))
+        {
+            return VK_FALSE;
+        }
+
+        if (!sceneLibraryDecodeRange(header, entry.verticesOffset, entry.verticesSize) || !sceneLibraryDecodeRange(header, entry.indicesOffset, entry.indicesSize))
+        {
+            return VK_FALSE;
+        }
+
+        if ((uint64_t)entry.numberVertices * (uint64_t)entry.strideInBytes != (uint64_t)entry.verticesSize || (uint64_t)entry.numberIndices * sizeof(int32_t) != (uint64_t)entry.indicesSize)
+        {
+            return VK_FALSE;
+        }
+
+        subMeshData.doubleSided = entry.doubleSided ? VK_TRUE : VK_FALSE;
+
+        subMeshData.vertexBufferType = entry.vertexBufferType;
+        subMeshData.numberVertices = (int32_t)entry.numberVertices;
+        subMeshData.numberIndices = (int32_t)entry.numberIndices;
+        subMeshData.strideInBytes = entry.strideInBytes;
+
+        for (uint32_t k = 0; k < VKTS_SCENE_LIBRARY_OFFSETS; k++)
+        {
+            subMeshData.offsets[k] = entry.offsets[k];
+        }
+
+        subMeshData.aabbMin = glm::make_vec4(entry.aabbMin);
+        subMeshData.aabbMax = glm::make_vec4(entry.aabbMax);
+
+        // Interleaved vertices and indices are copied at once.
+
+        subMeshData.vertexBinaryBuffer = binaryBufferCreate(allData + entry.verticesOffset, entry.verticesSize);
+        subMeshData.indicesBinaryBuffer = binaryBufferCreate(allData + entry.indicesOffset, entry.indicesSize);
+
+        if (!subMeshData.vertexBinaryBuffer.get() || !subMeshData.indicesBinaryBuffer.get())
+        {
+            return VK_FALSE;
+        }
+    }
+
+    return VK_TRUE;
+}
+
+VkBool32 VKTS_APIENTRY _sceneLibraryLoadSubMeshes(const char* directory, const char* filename, const VkBool32 allowBinary, VkTsSubMeshLibrary& subMeshLibrary)
+{
+    if (!directory || !filename)
+    {
+        return VK_FALSE;
+    }
+
+    subMeshLibrary.allMaterialLibraries.clear();
+    subMeshLibrary.allSubMeshes.clear();
+
+    if (allowBinary)
+    {
+        auto binaryBuffer = sceneLibraryLoadBinary(directory, filename);
+
+        if (binaryBuffer.get())
+        {
+            if (sceneLibraryDecodeSubMeshes(binaryBuffer, subMeshLibrary))
+            {
+                return VK_TRUE;
+            }
+
+            logPrint(VKTS_LOG_WARNING, __FILE__, __LINE__, "Invalid binary library: '%s'", filename);
+
+            subMeshLibrary.allMaterialLibraries.clear();
+            subMeshLibrary.allSubMeshes.clear();
+        }
+    }
+
+    auto textBuffer = sceneLibraryLoadText(directory, filename);
+
+    if (!textBuffer.get())
+    {
+        return VK_FALSE;
+    }
+
+    return sceneLibraryParseSubMeshes(textBuffer, subMeshLibrary);
+}
+
+VkBool32 VKTS_APIENTRY _sceneLibrarySaveSubMeshes(const char* filename, const VkTsSubMeshLibrary& subMeshLibrary)
+{
+    if (!filename)
+    {
+        return VK_FALSE;
+    }
+
+    std::vector<uint8_t> allStrings;
+    std::map<std::string, uint32_t> allStringOffsets;
+    std::vector<uint8_t> allData;
+
+    std::vector<uint32_t> allDependencies;
+
+    for (size_t i = 0; i < subMeshLibrary.allMaterialLibraries.size(); i++)
+    {
+        allDependencies.push_back(sceneLibraryEncodeString(allStrings, allStringOffsets, subMeshLibrary.allMaterialLibraries[i]));
+    }
+
+    std::vector<VkTsSceneLibrarySubMesh> allEntries(subMeshLibrary.allSubMeshes.size());
+
+    for (size_t i = 0; i < subMeshLibrary.allSubMeshes.size(); i++)
+    {
+        const VkTsSubMeshData& subMeshData = subMeshLibrary.allSubMeshes[i];
+
+        if (!subMeshData.vertexBinaryBuffer.get() || !subMeshData.indicesBinaryBuffer.get())
+        {
+            return VK_FALSE;
+        }
+
+        VkTsSceneLibrarySubMesh& entry = allEntries[i];
+
+        memset(&entry, 0, sizeof(VkTsSceneLibrarySubMesh));
+
+        entry.name = sceneLibraryEncodeString(allStrings, allStringOffsets, subMeshData.name);
+        entry.material = sceneLibraryEncodeString(allStrings, allStringOffsets, subMeshData.material);
+        entry.doubleSided = subMeshData.doubleSided ? 1 : 0;
+        entry.vertexBufferType = subMeshData.vertexBufferType;
+        entry.numberVertices = (uint32_t)subMeshData.numberVertices;
+        entry.numberIndices = (uint32_t)subMeshData.numberIndices;
+        entry.strideInBytes = subMeshData.strideInBytes;
+
+        for (uint32_t k = 0; k < VKTS_SCENE_LIBRARY_OFFSETS; k++)
+        {
+            entry.offsets[k] = subMeshData.offsets[k];
+        }
+
+        for (uint32_t k = 0; k < 4; k++)
+        {
+            entry.aabbMin[k] = subMeshData.aabbMin[k];
+            entry.aabbMax[k] = subMeshData.aabbMax[k];
+        }
+
+        entry.verticesOffset = sceneLibraryEncodeData(allData, subMeshData.vertexBinaryBuffer->getData(), subMeshData.vertexBinaryBuffer->getSize());
+        entry.verticesSize = subMeshData.vertexBinaryBuffer->getSize();
+
+        entry.indicesOffset = sceneLibraryEncodeData(allData, subMeshData.indicesBinaryBuffer->getData(), subMeshData.indicesBinaryBuffer->getSize());
+        entry.indicesSize = subMeshData.indicesBinaryBuffer->getSize();
+    }
+
+    return sceneLibrarySave(filename, VKTS_SCENE_LIBRARY_TYPE_SUB_MESHES, allEntries.size() > 0 ? &allEntries[0] : nullptr, (uint32_t)allEntries.size(), sizeof(VkTsSceneLibrarySubMesh), allDependencies, allStrings, allData);
+}
+
+//
+// Channels.
+//
+
+static VkBool32 sceneLibraryParseChannels(const ITextBufferSP& textBuffer, VkTsChannelLibrary& channelLibrary)
+{
+    char buffer[VKTS_MAX_BUFFER_CHARS + 1];
+    char sdata[VKTS_MAX_TOKEN_CHARS + 1];
+    float fdata[6];
+
+    VkTsChannelData* channelData = nullptr;
+
+    while (textBuffer->gets(buffer, VKTS_MAX_BUFFER_CHARS))
+    {
+        if (parseSkipBuffer(buffer))
+        {
+            continue;
+        }
+
+        if (parseIsToken(buffer, "name"))
+        {
+            if (!parseString(buffer, sdata, VKTS_MAX_TOKEN_CHARS))
+            {
+                return VK_FALSE;
+            }
+
+            channelLibrary.allChannels.push_back(VkTsChannelData());
+
+            channelData = &channelLibrary.allChannels.back();
+
+            channelData->name = sdata;
+            channelData->targetTransform = VKTS_TARGET_TRANSFORM_TRANSLATE;
+            channelData->targetTransformElement = VKTS_TARGET_TRANSFORM_ELEMENT_X;
+        }
+        else if (parseIsToken(buffer, "target_transform"))
+        {
+            if (!parseString(buffer, sdata, VKTS_MAX_TOKEN_CHARS))
+            {
+                return VK_FALSE;
+            }
+
+            if (!channelData)
+            {
+                logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "No channel");
+
+                return VK_FALSE;
+            }
+
+            if (strncmp(sdata, "TRANSLATE", 9) == 0)
+            {
+                channelData->targetTransform = VKTS_TARGET_TRANSFORM_TRANSLATE;
+            }
+            else if (strncmp(sdata, "ROTATE", 6) == 0)
+            {
+                channelData->targetTransform = VKTS_TARGET_TRANSFORM_ROTATE;
+            }
+            else if (strncmp(sdata, "QUATERNION_ROTATE", 17) == 0)
+            {
+                channelData->targetTransform = VKTS_TARGET_TRANSFORM_QUATERNION_ROTATE;
+            }
+            else if (strncmp(sdata, "SCALE", 5) == 0)
+            {
+                channelData->targetTransform = VKTS_TARGET_TRANSFORM_SCALE;
+            }
+            else
+            {
+                logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Unknown target transform: '%s'", sdata, VKTS_MAX_TOKEN_CHARS);
+
+                return VK_FALSE;
+            }
+        }
+        else if (parseIsToken(buffer, "target_element"))
+        {
+            if (!parseString(buffer, sdata, VKTS_MAX_TOKEN_CHARS))
+            {
+                return VK_FALSE;
+            }
+
+            if (!channelData)
+            {
+                logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "No channel");
+
+                return VK_FALSE;
+            }
+
+            if (strncmp(sdata, "X", 1) == 0)
+            {
+                channelData->targetTransformElement = VKTS_TARGET_TRANSFORM_ELEMENT_X;
+            }
+            else if (strncmp(sdata, "Y", 1) == 0)
+            {
+                channelData->targetTransformElement = VKTS_TARGET_TRANSFORM_ELEMENT_Y;
+            }
+            else if (strncmp(sdata, "Z", 1) == 0)
+            {
+                channelData->targetTransformElement = VKTS_TARGET_TRANSFORM_ELEMENT_Z;
+            }
+            else if (strncmp(sdata, "W", 1) == 0)
+            {
+                channelData->targetTransformElement = VKTS_TARGET_TRANSFORM_ELEMENT_W;
+            }
+            else
+            {
+                logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Unknown target transform element: '%s'", sdata, VKTS_MAX_TOKEN_CHARS);
+
+                return VK_FALSE;
+            }
+        }
+        else if (parseIsToken(buffer, "keyframe"))
+        {
+            char token[VKTS_MAX_TOKEN_CHARS + 1];
+
+            auto numberItems = sscanf(buffer, "%256s %f %f %256s %f %f %f %f", token, &fdata[0], &fdata[1], sdata, &fdata[2], &fdata[3], &fdata[4], &fdata[5]);
+
+            if (numberItems != 4 && numberItems != 8)
+            {
+                return VK_FALSE;
+            }
+
+            if (numberItems == 4)
+            {
+                fdata[2] = fdata[0] - 0.1f;
+                fdata[3] = fdata[1];
+                fdata[4] = fdata[0] + 0.1f;
+                fdata[5] = fdata[1];
+            }
+
+            if (!channelData)
+            {
+                logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "No channel");
+
+                return VK_FALSE;
+            }
+
+            VkTsInterpolator interpolator = VKTS_INTERPOLATOR_CONSTANT;
+
+            if (strncmp(sdata, "CONSTANT", 8) == 0)
+            {
+                // Do nothing.
+            }
+            else if (strncmp(sdata, "LINEAR", 6) == 0)
+            {
+                interpolator = VKTS_INTERPOLATOR_LINEAR;
+            }
+            else if (strncmp(sdata, "BEZIER", 6) == 0)
+            {
+                interpolator = VKTS_INTERPOLATOR_BEZIER;
+            }
+            else
+            {
+                logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Unknown interpolator: '%s'", sdata, VKTS_MAX_TOKEN_CHARS);
+
+                return VK_FALSE;
+            }
+
+            channelData->keys.push_back(fdata[0]);
+            channelData->values.push_back(fdata[1]);
+            channelData->handles.push_back(glm::vec4(fdata[2], fdata[3], fdata[4], fdata[5]));
+            channelData->interpolators.push_back(interpolator);
+        }
+        else
+        {
+            parseUnknownBuffer(buffer);
+        }
+    }
+
+    return VK_TRUE;
+}
+
+static VkBool32 sceneLibraryDecodeChannels(const IBinaryBufferSP& binaryBuffer, VkTsChannelLibrary& channelLibrary)
+{
+    VkTsSceneLibraryHeader header;
+
+    const uint8_t* data = sceneLibraryDecodeHeader(binaryBuffer, VKTS_SCENE_LIBRARY_TYPE_CHANNELS, sizeof(VkTsSceneLibraryChannel), header);
+
+    if (!data)
+    {
+        return VK_FALSE;
+    }
+
+    const uint8_t* allEntries = data + sizeof(VkTsSceneLibraryHeader);
+    const uint8_t* allData = data + header.dataOffset;
+
+    channelLibrary.allChannels.resize(header.entryCount);
+
+    for (uint32_t i = 0; i < header.entryCount; i++)
+    {
+        VkTsSceneLibraryChannel entry;
+
+        memcpy(&entry, allEntries + i * sizeof(VkTsSceneLibraryChannel), sizeof(VkTsSceneLibraryChannel));
+
+        VkTsChannelData& channelData = channelLibrary.allChannels[i];
+
+        if (!sceneLibraryDecodeString(data, header, entry.name, channelData.name))
+        {
+            return VK_FALSE;
+        }
+
+        if (entry.targetTransform > VKTS_TARGET_TRANSFORM_SCALE || entry.targetTransformElement > VKTS_TARGET_TRANSFORM_ELEMENT_W)
+        {
+            return VK_FALSE;
+        }
+
+        channelData.targetTransform = (VkTsTargetTransform)entry.targetTransform;
+        channelData.targetTransformElement = (VkTsTargetTransformElement)entry.targetTransformElement;
+
+        const uint64_t n = (uint64_t)entry.numberEntries;
+
+        if (!sceneLibraryDecodeRange(header, entry.entriesOffset, n * (2 * sizeof(float) + sizeof(glm::vec4) + sizeof(uint32_t))))
+        {
+            return VK_FALSE;
+        }
+
+        const uint8_t* current = allData + entry.entriesOffset;
+
+        channelData.keys.resize(entry.numberEntries);
+        channelData.values.resize(entry.numberEntries);
+        channelData.handles.resize(entry.numberEntries);
+        channelData.interpolators.resize(entry.numberEntries);
+
+        if (entry.numberEntries == 0)
+        {
+            continue;
+        }
+
+        memcpy(&channelData.keys[0], current, n * sizeof(float));
+        current += n * sizeof(float);
+
+        memcpy(&channelData.values[0], current, n * sizeof(float));
+        current += n * sizeof(float);
+
+        memcpy(&channelData.handles[0], current, n * sizeof(glm::vec4));
+        current += n * sizeof(glm::vec4);
+
+        for (uint32_t k = 0; k < entry.numberEntries; k++)
+        {
+            uint32_t interpolator;
+
+            memcpy(&interpolator, current + k * sizeof(uint32_t), sizeof(uint32_t));
+
+            if (interpolator > VKTS_INTERPOLATOR_BEZIER)
+            {
+                return VK_FALSE;
+            }
+
+            channelData.interpolators[k] = (VkTsInterpolator)interpolator;
+        }
+    }
+
+    return VK_TRUE;
+}
+
+VkBool32 VKTS_APIENTRY _sceneLibraryLoadChannels(const char* directory, const char* filename, const VkBool32 allowBinary, VkTsChannelLibrary& channelLibrary)
+{
+    if (!directory || !filename)
+    {
+        return VK_FALSE;
+    }
+
+    channelLibrary.allChannels.clear();
+
+    if (allowBinary)
+    {
+        auto binaryBuffer = sceneLibraryLoadBinary(directory, filename);
+
+        if (binaryBuffer.get())
+        {
+            if (sceneLibraryDecodeChannels(binaryBuffer, channelLibrary))
+            {
+                return VK_TRUE;
+            }
+
+            logPrint(VKTS_LOG_WARNING, __FILE__, __LINE__, "Invalid binary library: '%s'", filename);
+
+            channelLibrary.allChannels.clear();
+        }
+    }
+
+    auto textBuffer = sceneLibraryLoadText(directory, filename);
+
+    if (!textBuffer.get())
+    {
+        return VK_FALSE;
+    }
+
+    return sceneLibraryParseChannels(textBuffer, channelLibrary);
+}
+
+VkBool32 VKTS_APIENTRY _sceneLibrarySaveChannels(const char* filename, const VkTsChannelLibrary& channelLibrary)
+{
+    if (!filename)
+    {
+        return VK_FALSE;
+    }
+
+    std::vector<uint8_t> allStrings;
+    std::map<std::string, uint32_t> allStringOffsets;
+    std::vector<uint8_t> allData;
+
+    std::vector<VkTsSceneLibraryChannel> allEntries(channelLibrary.allChannels.size());
+
+    for (size_t i = 0; i < channelLibrary.allChannels.size(); i++)
+    {
+        const VkTsChannelData& channelData = channelLibrary.allChannels[i];
+
+        const uint32_t numberEntries = (uint32_t)channelData.keys.size();
+
+        if (channelData.values.size() != numberEntries || channelData.handles.size() != numberEntries || channelData.interpolators.size() != numberEntries)
+        {
+            return VK_FALSE;
+        }
+
+        VkTsSceneLibraryChannel& entry = allEntries[i];
+
+        entry.name = sceneLibraryEncodeString(allStrings, allStringOffsets, channelData.name);
+        entry.targetTransform = (uint32_t)channelData.targetTransform;
+        entry.targetTransformElement = (uint32_t)channelData.targetTransformElement;
+        entry.numberEntries = numberEntries;
+
+        std::vector<uint32_t> allInterpolators(channelData.interpolators.begin(), channelData.interpolators.end());
+
+        entry.entriesOffset = sceneLibraryEncodeData(allData, numberEntries > 0 ? &channelData.keys[0] : nullptr, numberEntries * sizeof(float));
+
+        if (numberEntries > 0)
+        {
+            allData.insert(allData.end(), (const uint8_t*)&channelData.values[0], (const uint8_t*)&channelData.values[0] + numberEntries * sizeof(float));
+            allData.insert(allData.end(), (const uint8_t*)&channelData.handles[0], (const uint8_t*)&channelData.handles[0] + numberEntries * sizeof(glm::vec4));
+            allData.insert(allData.end(), (const uint8_t*)&allInterpolators[0], (const uint8_t*)&allInterpolators[0] + numberEntries * sizeof(uint32_t));
+        }
+    }
+
+    return sceneLibrarySave(filename, VKTS_SCENE_LIBRARY_TYPE_CHANNELS, allEntries.size() > 0 ? &allEntries[0] : nullptr, (uint32_t)allEntries.size(), sizeof(VkTsSceneLibraryChannel), std::vector<uint32_t>(), allStrings, allData);
+}
+
+}
@@ -0,0 +1,180 @@
+/**
+ * VKTS - VulKan ToolS.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) since 2014 Norbert Nopper
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef VKTS_FN_SCENE_LIBRARY_INTERNAL_HPP_
+#define VKTS_FN_SCENE_LIBRARY_INTERNAL_HPP_
+
+#include <vkts/scenegraph/vkts_scenegraph.hpp>
+
+/**
+ * Binary library: Header, entries, dependency strings, string table and the 16 byte aligned data.
+ * All values are stored in little endian.
+ */
+
+#define VKTS_SCENE_LIBRARY_MAGIC 0x42544B56
+#define VKTS_SCENE_LIBRARY_VERSION 1
+#define VKTS_SCENE_LIBRARY_EXTENSION ".vktb"
+#define VKTS_SCENE_LIBRARY_ALIGNMENT 16
+
+#define VKTS_SCENE_LIBRARY_OFFSETS 10
+
+namespace vkts
+{
+
+typedef enum VkTsSceneLibraryType_
+{
+    VKTS_SCENE_LIBRARY_TYPE_SUB_MESHES = 1,
+    VKTS_SCENE_LIBRARY_TYPE_CHANNELS = 2
+} VkTsSceneLibraryType;
+
+typedef struct VkTsSceneLibraryHeader_
+{
+    uint32_t magic;
+    uint32_t version;
+    uint32_t libraryType;
+    uint32_t entryCount;
+    uint32_t dependencyCount;
+    uint32_t stringsOffset;
+    uint32_t stringsSize;
+    uint32_t dataOffset;
+    uint32_t dataSize;
+} VkTsSceneLibraryHeader;
+
+/**
+ * Strings are offsets into the string table. Data offsets are relative to the data.
+ */
+typedef struct VkTsSceneLibrarySubMesh_
+{
+    uint32_t name;
+    uint32_t material;
+    uint32_t doubleSided;
+    uint32_t vertexBufferType;
+    uint32_t numberVertices;
+    uint32_t numberIndices;
+    uint32_t strideInBytes;
+    int32_t offsets[VKTS_SCENE_LIBRARY_OFFSETS];
+    float aabbMin[4];
+    float aabbMax[4];
+    uint32_t verticesOffset;
+    uint32_t verticesSize;
+    uint32_t indicesOffset;
+    uint32_t indicesSize;
+} VkTsSceneLibrarySubMesh;
+
+/**
+ * Keys, values, handles and interpolators are stored one after the other.
+ */
+typedef struct VkTsSceneLibraryChannel_
+{
+    uint32_t name;
+    uint32_t targetTransform;
+    uint32_t targetTransformElement;
+    uint32_t numberEntries;
+    uint32_t entriesOffset;
+} VkTsSceneLibraryChannel;
+
+/**
+ * Sub mesh with the interleaved vertices in the layout given by the vertex buffer type.
+ */
+typedef struct VkTsSubMeshData_
+{
+    std::string name;
+    std::string material;
+    VkBool32 doubleSided;
+
+    VkTsVertexBufferType vertexBufferType;
+    int32_t numberVertices;
+    int32_t numberIndices;
+    uint32_t strideInBytes;
+
+    // Vertex, normal, bitangent, tangent, texcoord, bone indices 0 and 1, bone weights 0 and 1 and number bones.
+    int32_t offsets[VKTS_SCENE_LIBRARY_OFFSETS];
+
+    glm::vec4 aabbMin;
+    glm::vec4 aabbMax;
+
+    IBinaryBufferSP vertexBinaryBuffer;
+    IBinaryBufferSP indicesBinaryBuffer;
+} VkTsSubMeshData;
+
+typedef struct VkTsSubMeshLibrary_
+{
+    std::vector<std::string> allMaterialLibraries;
+
+    std::vector<VkTsSubMeshData> allSubMeshes;
+} VkTsSubMeshLibrary;
+
+typedef struct VkTsChannelData_
+{
+    std::string name;
+    VkTsTargetTransform targetTransform;
+    VkTsTargetTransformElement targetTransformElement;
+
+    std::vector<float> keys;
+    std::vector<float> values;
+    std::vector<glm::vec4> handles;
+    std::vector<VkTsInterpolator> interpolators;
+} VkTsChannelData;
+
+typedef struct VkTsChannelLibrary_
+{
+    std::vector<VkTsChannelData> allChannels;
+} VkTsChannelLibrary;
+
+/**
+ * Returns the filename of the binary library e.g. 'cube_submesh.vktb' for 'cube_submesh.vkts'.
+ */
+VKTS_APICALL std::string VKTS_APIENTRY _sceneLibraryGetBinaryFilename(const char* filename);
+
+/**
+ * Loads the binary library next to the given text library, if allowed and available. Otherwise, the text library is parsed.
+ *
+ * @ThreadSafe
+ */
+VKTS_APICALL VkBool32 VKTS_APIENTRY _sceneLibraryLoadSubMeshes(const char* directory, const char* filename, const VkBool32 allowBinary, VkTsSubMeshLibrary& subMeshLibrary);
+
+/**
+ *
+ * @ThreadSafe
+ */
+VKTS_APICALL VkBool32 VKTS_APIENTRY _sceneLibrarySaveSubMeshes(const char* filename, const VkTsSubMeshLibrary& subMeshLibrary);
+
+/**
+ * Loads the binary library next to the given text library, if allowed and available. Otherwise, the text library is parsed.
+ *
+ * @ThreadSafe
+ */
+VKTS_APICALL VkBool32 VKTS_APIENTRY _sceneLibraryLoadChannels(const char* directory, const char* filename, const VkBool32 allowBinary, VkTsChannelLibrary& channelLibrary);
+
+/**
+ *
+ * @ThreadSafe
+ */
+VKTS_APICALL VkBool32 VKTS_APIENTRY _sceneLibrarySaveChannels(const char* filename, const VkTsChannelLibrary& channelLibrary);
+
+}
+
+#endif /* VKTS_FN_SCENE_LIBRARY_INTERNAL_HPP_ */
@@ -26,6 +26,8 @@
 
 #include <vkts/scenegraph/vkts_scenegraph.hpp>
 
+#include "fn_scene_library_internal.hpp"
+
 namespace vkts
 {
 
@@ -38,11 +40,11 @@ static VkBool32 sceneLoadImageObjects(const char* directory, const char* filenam
 
     std::string finalFilename = std::string(directory) + std::string(filename);
 
-    auto textBuffer = fileLoadText(finalFilename.c_str());
+    auto textBuffer = fileMapText(finalFilename.c_str());
 
     if (!textBuffer.get())
     {
-        textBuffer = fileLoadText(filename);
+        textBuffer = fileMapText(filename);
 
         if (!textBuffer.get())
         {
@@ -227,9 +229,20 @@ static VkBool32 sceneLoadImageObjects(const char* directory, const char* filenam
 
 						if (allMipMaps.size() == 0)
 						{
-							allMipMaps = imageDataMipmap(imageData, VK_FALSE, finalImageDataFilename);
+							// Format conversion is only possible for one mip level, so it is done before.
+
+							imageData = createDeviceImageData(sceneManager->getAssetManager(), imageData);
 
-							if (allMipMaps.size() == 0)
+							if (!imageData.get())
+							{
+								logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "No device image for '%s'", finalImageDataFilename.c_str());
+
+								return VK_FALSE;
+							}
+
+							imageData = imageDataMipmap(imageData, finalImageDataFilename);
+
+							if (!imageData.get())
 							{
 								logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Could not create mip maps for '%s'", finalImageDataFilename.c_str());
 
@@ -241,29 +254,31 @@ static VkBool32 sceneLoadImageObjects(const char* directory, const char* filenam
 								logPrint(VKTS_LOG_INFO, __FILE__, __LINE__, "Storing cached data for '%s'", finalImageDataFilename.c_str());
 
 								// Only cache mip maps sub levels.
-								for (uint32_t i = 1; i < allMipMaps.size(); i++)
+								for (uint32_t i = 1; i < imageData->getMipLevels(); i++)
 								{
-									cacheSaveImageData(allMipMaps[i]);
+									auto targetImageFilename = sourceImageName + "_LEVEL" + std::to_string(i) + sourceImageExtension;
+
+									cacheSaveImageData(imageData, targetImageFilename, i);
 								}
 							}
 						}
 						else
 						{
 							logPrint(VKTS_LOG_INFO, __FILE__, __LINE__, "Using cached data for '%s'", finalImageDataFilename.c_str());
-						}
 
-						for (uint32_t i = 0; i < allMipMaps.size(); i++)
-						{
-							allMipMaps[i] = createDeviceImageData(sceneManager->getAssetManager(), allMipMaps[i]);
-						}
+							for (uint32_t i = 0; i < allMipMaps.size(); i++)
+							{
+								allMipMaps[i] = createDeviceImageData(sceneManager->getAssetManager(), allMipMaps[i]);
+							}
 
-						imageData = imageDataMerge(allMipMaps, finalImageDataFilename, allMipMaps.size(), 1);
+							imageData = imageDataMerge(allMipMaps, finalImageDataFilename, allMipMaps.size(), 1);
 
-						if (!imageData.get())
-						{
-							logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "No merged image for '%s'", finalImageDataFilename.c_str());
+							if (!imageData.get())
+							{
+								logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "No merged image for '%s'", finalImageDataFilename.c_str());
 
-							return VK_FALSE;
+								return VK_FALSE;
+							}
 						}
 					}
 					else if (environment)
@@ -328,54 +343,63 @@ static VkBool32 sceneLoadImageObjects(const char* directory, const char* filenam
 									return VK_FALSE;
 								}
 
+								// Format conversion is only possible for one mip level, so it is done before.
 						        for (uint32_t layer = 0; layer < 6; layer++)
 						        {
-									auto tempMipMaps = imageDataMipmap(oldAllCubeMaps[layer], VK_FALSE, finalImageDataFilename);
+									oldAllCubeMaps[layer] = createDeviceImageData(sceneManager->getAssetManager(), oldAllCubeMaps[layer]);
+						        }
 
-									if (tempMipMaps.size() == 0)
-									{
-										logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Could not create mip maps for '%s'", finalImageDataFilename.c_str());
+								imageData = imageDataMerge(oldAllCubeMaps, finalImageDataFilename, 1, 6);
 
-										return VK_FALSE;
-									}
+								if (!imageData.get())
+								{
+									logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "No merged image for '%s'", finalImageDataFilename.c_str());
 
-									for (uint32_t mipLevel = 0; mipLevel < tempMipMaps.size(); mipLevel++)
-									{
-										allCubeMaps.append(tempMipMaps[mipLevel]);
-									}
-						        }
+									return VK_FALSE;
+								}
+
+								// All six faces are filtered in one pass.
+								imageData = imageDataMipmap(imageData, finalImageDataFilename);
+
+								if (!imageData.get())
+								{
+									logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Could not create mip maps for '%s'", finalImageDataFilename.c_str());
+
+									return VK_FALSE;
+								}
 
 								if (cacheGetEnabled())
 								{
 									logPrint(VKTS_LOG_INFO, __FILE__, __LINE__, "Storing cached data for '%s'", finalImageDataFilename.c_str());
 
-									uint32_t mipLevels = allCubeMaps.size() / 6;
-
-									for (uint32_t i = 0; i < allCubeMaps.size(); i++)
+									for (uint32_t layer = 0; layer < 6; layer++)
 									{
-										auto targetImageFilename = sourceImageName + "_LEVEL" + std::to_string(i % mipLevels) + "_LAYER" + std::to_string(i / mipLevels) + sourceImageExtension;
+										for (uint32_t mipLevel = 0; mipLevel < imageData->getMipLevels(); mipLevel++)
+										{
+											auto targetImageFilename = sourceImageName + "_LEVEL" + std::to_string(mipLevel) + "_LAYER" + std::to_string(layer) + sourceImageExtension;
 
-										cacheSaveImageData(allCubeMaps[i], targetImageFilename);
+											cacheSaveImageData(imageData, targetImageFilename, mipLevel, layer);
+										}
 									}
 								}
 							}
 							else
 							{
 								logPrint(VKTS_LOG_INFO, __FILE__, __LINE__, "Using cached data for '%s'", finalImageDataFilename.c_str());
-							}
 
-							for (uint32_t i = 0; i < allCubeMaps.size(); i++)
-							{
-								allCubeMaps[i] = createDeviceImageData(sceneManager->getAssetManager(), allCubeMaps[i]);
-							}
+								for (uint32_t i = 0; i < allCubeMaps.size(); i++)
+								{
+									allCubeMaps[i] = createDeviceImageData(sceneManager->getAssetManager(), allCubeMaps[i]);
+								}
 
-							imageData = imageDataMerge(allCubeMaps, finalImageDataFilename, allCubeMaps.size() / 6, 6);
+								imageData = imageDataMerge(allCubeMaps, finalImageDataFilename, allCubeMaps.size() / 6, 6);
 
-							if (!imageData.get())
-							{
-								logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "No merged image for '%s'", finalImageDataFilename.c_str());
+								if (!imageData.get())
+								{
+									logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "No merged image for '%s'", finalImageDataFilename.c_str());
 
-								return VK_FALSE;
+									return VK_FALSE;
+								}
 							}
 						}
 
@@ -690,11 +714,11 @@ static VkBool32 sceneLoadTextureObjects(const char* directory, const char* filen
 
     std::string finalFilename = std::string(directory) + std::string(filename);
 
-    auto textBuffer = fileLoadText(finalFilename.c_str());
+    auto textBuffer = fileMapText(finalFilename.c_str());
 
     if (!textBuffer.get())
     {
-        textBuffer = fileLoadText(filename);
+        textBuffer = fileMapText(filename);
 
         if (!textBuffer.get())
         {
@@ -908,11 +932,11 @@ static VkBool32 sceneLoadMaterials(const char* directory, const char* filename,
 
     std::string finalFilename = std::string(directory) + std::string(filename);
 
-    auto textBuffer = fileLoadText(finalFilename.c_str());
+    auto textBuffer = fileMapText(finalFilename.c_str());
 
     if (!textBuffer.get())
     {
-        textBuffer = fileLoadText(filename);
+        textBuffer = fileMapText(filename);
 
         if (!textBuffer.get())
         {
@@ -1653,646 +1677,121 @@ static VkBool32 sceneLoadSubMeshes(const char* directory, const char* filename,
         return VK_FALSE;
     }
 
-    std::string finalFilename = std::string(directory) + std::string(filename);
-
-    auto textBuffer = fileLoadText(finalFilename.c_str());
+    VkTsSubMeshLibrary subMeshLibrary;
 
-    if (!textBuffer.get())
+    if (!_sceneLibraryLoadSubMeshes(directory, filename, VK_TRUE, subMeshLibrary))
     {
-        textBuffer = fileLoadText(filename);
-
-        if (!textBuffer.get())
-        {
-            return VK_FALSE;
-        }
+        return VK_FALSE;
     }
 
-    char buffer[VKTS_MAX_BUFFER_CHARS + 1];
-    char sdata[VKTS_MAX_TOKEN_CHARS + 1];
-    float fdata[8];
-    int32_t idata[3];
-    VkBool32 bdata;
-
-    auto subMesh = ISubMeshSP();
-
-    std::vector<float> vertex;
-    std::vector<float> normal;
-    std::vector<float> bitangent;
-    std::vector<float> tangent;
-    std::vector<float> texcoord;
-
-    std::vector<float> boneIndices0;
-    std::vector<float> boneIndices1;
-    std::vector<float> boneWeights0;
-    std::vector<float> boneWeights1;
-    std::vector<float> numberBones;
-
-    std::vector<int32_t> indices;
-
-    while (textBuffer->gets(buffer, VKTS_MAX_BUFFER_CHARS))
+    for (size_t i = 0; i < subMeshLibrary.allMaterialLibraries.size(); i++)
     {
-        if (parseSkipBuffer(buffer))
-        {
-            continue;
-        }
-
-        if (parseIsToken(buffer, "material_library"))
-        {
-            if (!parseString(buffer, sdata, VKTS_MAX_TOKEN_CHARS))
-            {
-                return VK_FALSE;
-            }
-
-            if (!sceneLoadMaterials(directory, sdata, sceneManager, sceneFactory))
-            {
-                logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Could not load materials: '%s'", sdata, VKTS_MAX_TOKEN_CHARS);
-
-                return VK_FALSE;
-            }
-        }
-        else if (parseIsToken(buffer, "name"))
-        {
-            if (!parseString(buffer, sdata, VKTS_MAX_TOKEN_CHARS))
-            {
-                return VK_FALSE;
-            }
-
-            subMesh = sceneFactory->createSubMesh(sceneManager);
-
-            if (!subMesh.get())
-            {
-                logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Sub mesh not created: '%s'", sdata, VKTS_MAX_TOKEN_CHARS);
-
-                return VK_FALSE;
-            }
-
-            subMesh->setName(sdata);
-        }
-        else if (parseIsToken(buffer, "double_sided"))
-        {
-            if (!parseBool(buffer, &bdata))
-            {
-                return VK_FALSE;
-            }
-
-            if (subMesh.get())
-            {
-            	subMesh->setDoubleSided(bdata);
-            }
-            else
-            {
-                logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "No sub mesh");
-
-                return VK_FALSE;
-            }
-        }
-        else if (parseIsToken(buffer, "vertex"))
-        {
-            if (!parseVec4(buffer, fdata))
-            {
-                return VK_FALSE;
-            }
-
-            if (subMesh.get())
-            {
-                for (int32_t i = 0; i < 4; i++)
-                {
-                    vertex.push_back(fdata[i]);
-                }
-            }
-            else
-            {
-                logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "No sub mesh");
+        const char* materialLibrary = subMeshLibrary.allMaterialLibraries[i].c_str();
 
-                return VK_FALSE;
-            }
-        }
-        else if (parseIsToken(buffer, "normal"))
+        if (!sceneLoadMaterials(directory, materialLibrary, sceneManager, sceneFactory))
         {
-            if (!parseVec3(buffer, fdata))
-            {
-                return VK_FALSE;
-            }
+            logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Could not load materials: '%s'", materialLibrary);
 
-            if (subMesh.get())
-            {
-                for (int32_t i = 0; i < 3; i++)
-                {
-                    normal.push_back(fdata[i]);
-                }
-            }
-            else
-            {
-                logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "No sub mesh");
-
-                return VK_FALSE;
-            }
-        }
-        else if (parseIsToken(buffer, "bitangent"))
-        {
-            if (!parseVec3(buffer, fdata))
-            {
-                return VK_FALSE;
-            }
-
-            if (subMesh.get())
-            {
-                for (int32_t i = 0; i < 3; i++)
-                {
-                    bitangent.push_back(fdata[i]);
-                }
-            }
-            else
-            {
-                logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "No sub mesh");
-
-                return VK_FALSE;
-            }
+            return VK_FALSE;
         }
-        else if (parseIsToken(buffer, "tangent"))
-        {
-            if (!parseVec3(buffer, fdata))
-            {
-                return VK_FALSE;
-            }
-
-            if (subMesh.get())
-            {
-                for (int32_t i = 0; i < 3; i++)
-                {
-                    tangent.push_back(fdata[i]);
-                }
-            }
-            else
-            {
-                logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "No sub mesh");
+    }
 
-                return VK_FALSE;
-            }
-        }
-        else if (parseIsToken(buffer, "texcoord"))
-        {
-            if (!parseVec2(buffer, fdata))
-            {
-                return VK_FALSE;
-            }
+    for (size_t i = 0; i < subMeshLibrary.allSubMeshes.size(); i++)
+    {
+        const VkTsSubMeshData& subMeshData = subMeshLibrary.allSubMeshes[i];
 
-            if (subMesh.get())
-            {
-                for (int32_t i = 0; i < 2; i++)
-                {
-                    texcoord.push_back(fdata[i]);
-                }
-            }
-            else
-            {
-                logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "No sub mesh");
+        auto subMesh = sceneFactory->createSubMesh(sceneManager);
 
-                return VK_FALSE;
-            }
-        }
-        else if (parseIsToken(buffer, "boneIndex"))
+        if (!subMesh.get())
         {
-            if (!parseVec8(buffer, fdata))
-            {
-                return VK_FALSE;
-            }
-
-            if (subMesh.get())
-            {
-                for (int32_t i = 0; i < 8; i++)
-                {
-                    if (i < 4)
-                    {
-                        boneIndices0.push_back(fdata[i]);
-                    }
-                    else
-                    {
-                        boneIndices1.push_back(fdata[i]);
-                    }
-                }
-            }
-            else
-            {
-                logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "No sub mesh");
+            logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Sub mesh not created: '%s'", subMeshData.name.c_str());
 
-                return VK_FALSE;
-            }
+            return VK_FALSE;
         }
-        else if (parseIsToken(buffer, "boneWeight"))
-        {
-            if (!parseVec8(buffer, fdata))
-            {
-                return VK_FALSE;
-            }
 
-            if (subMesh.get())
-            {
-                for (int32_t i = 0; i < 8; i++)
-                {
-                    if (i < 4)
-                    {
-                        boneWeights0.push_back(fdata[i]);
-                    }
-                    else
-                    {
-                        boneWeights1.push_back(fdata[i]);
-                    }
-                }
-            }
-            else
-            {
-                logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "No sub mesh");
+        subMesh->setName(subMeshData.name);
 
-                return VK_FALSE;
-            }
-        }
-        else if (parseIsToken(buffer, "numberBones"))
-        {
-            if (!parseFloat(buffer, fdata))
-            {
-                return VK_FALSE;
-            }
+        subMesh->setDoubleSided(subMeshData.doubleSided);
 
-            if (subMesh.get())
-            {
-                numberBones.push_back(fdata[0]);
-            }
-            else
-            {
-                logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "No sub mesh");
+        const auto phongMaterial = sceneManager->usePhongMaterial(subMeshData.material);
 
-                return VK_FALSE;
-            }
-        }
-        else if (parseIsToken(buffer, "face"))
+        if (phongMaterial.get())
         {
-            if (!parseIVec3(buffer, idata))
-            {
-                return VK_FALSE;
-            }
-
-            if (subMesh.get())
-            {
-                for (int32_t i = 0; i < 3; i++)
-                {
-                    indices.push_back(idata[i]);
-                }
-            }
-            else
-            {
-                logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "No sub mesh");
-
-                return VK_FALSE;
-            }
+            subMesh->setPhongMaterial(phongMaterial);
         }
-        else if (parseIsToken(buffer, "material"))
+        else
         {
-            if (!parseString(buffer, sdata, VKTS_MAX_TOKEN_CHARS))
-            {
-                return VK_FALSE;
-            }
+            const auto bsdfMaterial = sceneManager->useBSDFMaterial(subMeshData.material);
 
-            if (subMesh.get())
+            if (bsdfMaterial.get())
             {
-                const auto phongMaterial = sceneManager->usePhongMaterial(sdata);
-
-                if (phongMaterial.get())
-                {
-                    subMesh->setPhongMaterial(phongMaterial);
-                }
-                else
-                {
-                    const auto bsdfMaterial = sceneManager->useBSDFMaterial(sdata);
-
-                    if (bsdfMaterial.get())
-                    {
-                        subMesh->setBSDFMaterial(bsdfMaterial);
-                    }
-                    else
-                    {
-                        logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Material not found: '%s'", sdata, VKTS_MAX_TOKEN_CHARS);
-
-                        return VK_FALSE;
-                    }
-                }
+                subMesh->setBSDFMaterial(bsdfMaterial);
             }
             else
             {
-                logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "No sub mesh");
+                logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Material not found: '%s'", subMeshData.material.c_str());
 
                 return VK_FALSE;
             }
+        }
 
-            //
-            // Sub mesh creation.
-            //
-
-            if (subMesh.get())
-            {
-                subMesh->setNumberVertices((int32_t)(vertex.size() / 4));
-                subMesh->setNumberIndices((int32_t) indices.size());
-
-                int32_t totalSize = 0;
-                uint32_t strideInBytes = 0;
-
-                VkTsVertexBufferType vertexBufferType = 0;
-
-                if (vertex.size() > 0)
-                {
-                    subMesh->setVertexOffset(strideInBytes);
-                    strideInBytes += 4 * sizeof(float);
-
-                    totalSize += 4 * sizeof(float) * subMesh->getNumberVertices();
-
-                    vertexBufferType |= VKTS_VERTEX_BUFFER_TYPE_VERTEX;
-                }
-
-                if (normal.size() > 0)
-                {
-                    if (normal.size() / 3 != vertex.size() / 4)
-                    {
-                        logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Normal has different size");
-
-                        return VK_FALSE;
-                    }
-
-                    subMesh->setNormalOffset(strideInBytes);
-                    strideInBytes += 3 * sizeof(float);
-
-                    totalSize += 3 * sizeof(float) * subMesh->getNumberVertices();
-
-                    vertexBufferType |= VKTS_VERTEX_BUFFER_TYPE_NORMAL;
-                }
-
-                if (normal.size() > 0 && bitangent.size() > 0 && tangent.size() > 0)
-                {
-                    if (bitangent.size() / 3 != vertex.size() / 4)
-                    {
-                        logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Bitangent has different size");
-
-                        return VK_FALSE;
-                    }
-
-                    subMesh->setBitangentOffset(strideInBytes);
-                    strideInBytes += 3 * sizeof(float);
-
-                    totalSize += 3 * sizeof(float) * subMesh->getNumberVertices();
-
-                    //
-
-                    if (tangent.size() / 3 != vertex.size() / 4)
-                    {
-                        logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Tangent has different size");
-
-                        return VK_FALSE;
-                    }
-
-                    subMesh->setTangentOffset(strideInBytes);
-                    strideInBytes += 3 * sizeof(float);
-
-                    totalSize += 3 * sizeof(float) * subMesh->getNumberVertices();
-
-                    //
-
-                    vertexBufferType |= VKTS_VERTEX_BUFFER_TYPE_TANGENTS;
-                }
-
-                if (texcoord.size() > 0)
-                {
-                    if (texcoord.size() / 2 != vertex.size() / 4)
-                    {
-                        logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "TextureObject coordinate has different size");
-
-                        return VK_FALSE;
-                    }
-
-                    subMesh->setTexcoordOffset(strideInBytes);
-                    strideInBytes += 2 * sizeof(float);
-
-                    totalSize += 2 * sizeof(float) * subMesh->getNumberVertices();
-
-                    vertexBufferType |= VKTS_VERTEX_BUFFER_TYPE_TEXCOORD;
-                }
-
-                if (boneIndices0.size() > 0 && boneIndices1.size() > 0 && boneWeights0.size() > 0 && boneWeights1.size() > 0 && numberBones.size() > 0)
-                {
-                    if (boneIndices0.size() / 4 != vertex.size() / 4)
-                    {
-                        logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Bone indices0 has different size: %u != %u", boneIndices0.size(), vertex.size());
-
-                        return VK_FALSE;
-                    }
-
-                    subMesh->setBoneIndices0Offset(strideInBytes);
-                    strideInBytes += 4 * sizeof(float);
-
-                    totalSize += 4 * sizeof(float) * subMesh->getNumberVertices();
-
-                    if (boneIndices1.size() / 4 != vertex.size() / 4)
-                    {
-                        logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Bone indices1 has different size %u != %u", boneIndices1.size(), vertex.size());
-
-                        return VK_FALSE;
-                    }
-
-                    subMesh->setBoneIndices1Offset(strideInBytes);
-                    strideInBytes += 4 * sizeof(float);
-
-                    totalSize += 4 * sizeof(float) * subMesh->getNumberVertices();
-
-                    if (boneWeights0.size() / 4 != vertex.size() / 4)
-                    {
-                        logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Bone weights0 has different size");
-
-                        return VK_FALSE;
-                    }
-
-                    subMesh->setBoneWeights0Offset(strideInBytes);
-                    strideInBytes += 4 * sizeof(float);
-
-                    totalSize += 4 * sizeof(float) * subMesh->getNumberVertices();
-
-                    if (boneWeights1.size() / 4 != vertex.size() / 4)
-                    {
-                        logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Bone weights has different size");
-
-                        return VK_FALSE;
-                    }
-
-                    subMesh->setBoneWeights1Offset(strideInBytes);
-                    strideInBytes += 4 * sizeof(float);
-
-                    totalSize += 4 * sizeof(float) * subMesh->getNumberVertices();
-
-                    if (numberBones.size() != vertex.size() / 4)
-                    {
-                        logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Number bones has different size");
-
-                        return VK_FALSE;
-                    }
-
-                    subMesh->setNumberBonesOffset(strideInBytes);
-                    strideInBytes += 1 * sizeof(float);
-
-                    totalSize += 1 * sizeof(float) * subMesh->getNumberVertices();
-
-                    vertexBufferType |= VKTS_VERTEX_BUFFER_TYPE_BONES;
-                }
-
-                subMesh->setStrideInBytes(strideInBytes);
-
-                if (totalSize > 0)
-                {
-                    auto vertexBinaryBuffer = binaryBufferCreate((uint32_t)totalSize);
-
-                    if (!vertexBinaryBuffer.get() || vertexBinaryBuffer->getSize() != (uint32_t)totalSize)
-                    {
-                        logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Could not create vertex binary buffer");
-
-                        return VK_FALSE;
-                    }
-
-                    for (int32_t currentVertexElement = 0; currentVertexElement < subMesh->getNumberVertices(); currentVertexElement++)
-                    {
-                        if (vertexBufferType & VKTS_VERTEX_BUFFER_TYPE_VERTEX)
-                        {
-                            vertexBinaryBuffer->write(reinterpret_cast<const uint8_t*>(&vertex[currentVertexElement * 4]), 1, 4 * sizeof(float));
-                        }
-                        if (vertexBufferType & VKTS_VERTEX_BUFFER_TYPE_NORMAL)
-                        {
-                            vertexBinaryBuffer->write(reinterpret_cast<const uint8_t*>(&normal[currentVertexElement * 3]), 1, 3 * sizeof(float));
-                        }
-                        if (vertexBufferType & VKTS_VERTEX_BUFFER_TYPE_BITANGENT)
-                        {
-                            vertexBinaryBuffer->write( reinterpret_cast<const uint8_t*>(&bitangent[currentVertexElement * 3]), 1, 3 * sizeof(float));
-                        }
-                        if (vertexBufferType & VKTS_VERTEX_BUFFER_TYPE_TANGENT)
-                        {
-                            vertexBinaryBuffer->write(reinterpret_cast<const uint8_t*>(&tangent[currentVertexElement * 3]), 1, 3 * sizeof(float));
-                        }
-                        if (vertexBufferType & VKTS_VERTEX_BUFFER_TYPE_TEXCOORD)
-                        {
-                            vertexBinaryBuffer->write(reinterpret_cast<const uint8_t*>(&texcoord[currentVertexElement * 2]), 1, 2 * sizeof(float));
-                        }
-                        if (vertexBufferType & VKTS_VERTEX_BUFFER_TYPE_BONE_INDICES0)
-                        {
-                            vertexBinaryBuffer->write(reinterpret_cast<const uint8_t*>(&boneIndices0[currentVertexElement * 4]), 1, 4 * sizeof(float));
-                        }
-                        if (vertexBufferType & VKTS_VERTEX_BUFFER_TYPE_BONE_INDICES1)
-                        {
-                            vertexBinaryBuffer->write(reinterpret_cast<const uint8_t*>(&boneIndices1[currentVertexElement * 4]), 1, 4 * sizeof(float));
-                        }
-                        if (vertexBufferType & VKTS_VERTEX_BUFFER_TYPE_BONE_WEIGHTS0)
-                        {
-                            vertexBinaryBuffer->write(reinterpret_cast<const uint8_t*>(&boneWeights0[currentVertexElement * 4]), 1, 4 * sizeof(float));
-                        }
-                        if (vertexBufferType & VKTS_VERTEX_BUFFER_TYPE_BONE_WEIGHTS1)
-                        {
-                            vertexBinaryBuffer->write(reinterpret_cast<const uint8_t*>(&boneWeights1[currentVertexElement * 4]), 1, 4 * sizeof(float));
-                        }
-                        if (vertexBufferType & VKTS_VERTEX_BUFFER_TYPE_BONE_NUMBERS)
-                        {
-                            vertexBinaryBuffer->write(reinterpret_cast<const uint8_t*>(&numberBones[currentVertexElement * 1]), 1, 1 * sizeof(float));
-                        }
-                    }
-
-                    //
-
-                    auto vertexBuffer = createVertexBufferObject(sceneManager->getAssetManager(), vertexBinaryBuffer);
-
-                    if (!vertexBuffer.get())
-                    {
-                        logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Could not create vertex buffer");
-
-                        return VK_FALSE;
-                    }
-
-                    //
-
-                    subMesh->setVertexBuffer(vertexBuffer, vertexBufferType, Aabb((const float*)vertexBinaryBuffer->getData(), subMesh->getNumberVertices(), subMesh->getStrideInBytes()));
-                }
-                else
-                {
-                    logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Sub mesh incomplete");
-
-                    return VK_FALSE;
-                }
-
-                if (indices.size() > 0)
-                {
-                	uint32_t size = sizeof(int32_t) * subMesh->getNumberIndices();
-
-                    auto indicesBinaryBuffer = binaryBufferCreate(reinterpret_cast<const uint8_t*>(&indices[0]), size);
-
-                    if (!indicesBinaryBuffer.get() || indicesBinaryBuffer->getSize() != size)
-                    {
-                        logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Could not create indices binary buffer");
-
-                        return VK_FALSE;
-                    }
-
-                    //
+        //
+        // Sub mesh creation. Vertices are already interleaved.
+        //
 
-                    auto indexVertexBuffer = createIndexBufferObject(sceneManager->getAssetManager(), indicesBinaryBuffer);
+        subMesh->setNumberVertices(subMeshData.numberVertices);
+        subMesh->setNumberIndices(subMeshData.numberIndices);
 
-                    if (!indexVertexBuffer.get())
-                    {
-                        logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Could not create indices vertex buffer");
+        subMesh->setVertexOffset(subMeshData.offsets[0]);
+        subMesh->setNormalOffset(subMeshData.offsets[1]);
+        subMesh->setBitangentOffset(subMeshData.offsets[2]);
+        subMesh->setTangentOffset(subMeshData.offsets[3]);
+        subMesh->setTexcoordOffset(subMeshData.offsets[4]);
+        subMesh->setBoneIndices0Offset(subMeshData.offsets[5]);
+        subMesh->setBoneIndices1Offset(subMeshData.offsets[6]);
+        subMesh->setBoneWeights0Offset(subMeshData.offsets[7]);
+        subMesh->setBoneWeights1Offset(subMeshData.offsets[8]);
+        subMesh->setNumberBonesOffset(subMeshData.offsets[9]);
 
-                        return VK_FALSE;
-                    }
+        subMesh->setStrideInBytes(subMeshData.strideInBytes);
 
-                    //
+        auto vertexBuffer = createVertexBufferObject(sceneManager->getAssetManager(), subMeshData.vertexBinaryBuffer);
 
-                    subMesh->setIndexBuffer(indexVertexBuffer);
-                }
-                else
-                {
-                    logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Sub mesh incomplete");
+        if (!vertexBuffer.get())
+        {
+            logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Could not create vertex buffer");
 
-                    return VK_FALSE;
-                }
+            return VK_FALSE;
+        }
 
-                //
+        subMesh->setVertexBuffer(vertexBuffer, subMeshData.vertexBufferType, Aabb(subMeshData.aabbMin, subMeshData.aabbMax));
 
-                if (subMesh->getBSDFMaterial().get() && sceneFactory->getSceneRenderFactory().get())
-                {
-                	if (!sceneFactory->getSceneRenderFactory()->prepareBSDFMaterial(sceneManager, subMesh))
-                	{
-                		return VK_FALSE;
-                	}
-                }
+        //
 
-                //
+        auto indexVertexBuffer = createIndexBufferObject(sceneManager->getAssetManager(), subMeshData.indicesBinaryBuffer);
 
-                sceneManager->addSubMesh(subMesh);
-            }
-            else
-            {
-                logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "No sub mesh");
+        if (!indexVertexBuffer.get())
+        {
+            logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Could not create indices vertex buffer");
 
-                return VK_FALSE;
-            }
+            return VK_FALSE;
+        }
 
-            vertex.clear();
-            normal.clear();
-            bitangent.clear();
-            tangent.clear();
-            texcoord.clear();
+        subMesh->setIndexBuffer(indexVertexBuffer);
 
-            boneIndices0.clear();
-            boneIndices1.clear();
-            boneWeights0.clear();
-            boneWeights1.clear();
-            numberBones.clear();
+        //
 
-            indices.clear();
-        }
-        else
+        if (subMesh->getBSDFMaterial().get() && sceneFactory->getSceneRenderFactory().get())
         {
-            parseUnknownBuffer(buffer);
+        	if (!sceneFactory->getSceneRenderFactory()->prepareBSDFMaterial(sceneManager, subMesh))
+        	{
+        		return VK_FALSE;
+        	}
         }
+
+        //
+
+        sceneManager->addSubMesh(subMesh);
     }
 
     return VK_TRUE;
@@ -2307,11 +1806,11 @@ static VkBool32 sceneLoadMeshes(const char* directory, const char* filename, con
 
     std::string finalFilename = std::string(directory) + std::string(filename);
 
-    auto textBuffer = fileLoadText(finalFilename.c_str());
+    auto textBuffer = fileMapText(finalFilename.c_str());
 
     if (!textBuffer.get())
     {
-        textBuffer = fileLoadText(filename);
+        textBuffer = fileMapText(filename);
 
         if (!textBuffer.get())
         {
@@ -2445,231 +1944,58 @@ static VkBool32 sceneLoadChannels(const char* directory, const char* filename, c
         return VK_FALSE;
     }
 
-    std::string finalFilename = std::string(directory) + std::string(filename);
-
-    auto textBuffer = fileLoadText(finalFilename.c_str());
+    VkTsChannelLibrary channelLibrary;
 
-    if (!textBuffer.get())
+    if (!_sceneLibraryLoadChannels(directory, filename, VK_TRUE, channelLibrary))
     {
-        textBuffer = fileLoadText(filename);
-
-        if (!textBuffer.get())
-        {
-            return VK_FALSE;
-        }
+        return VK_FALSE;
     }
 
-    char buffer[VKTS_MAX_BUFFER_CHARS + 1];
-    char sdata[VKTS_MAX_TOKEN_CHARS + 1];
-    float fdata[6];
-
-    auto channel = IChannelSP();
-
-    while (textBuffer->gets(buffer, VKTS_MAX_BUFFER_CHARS))
+    for (size_t i = 0; i < channelLibrary.allChannels.size(); i++)
     {
-        if (parseSkipBuffer(buffer))
-        {
-            continue;
-        }
-
-        if (parseIsToken(buffer, "name"))
-        {
-        	if (channel.get() && VKTS_CONVERT_BEZIER)
-        	{
-        		auto optimizedChannel = sceneFactory->createChannel(sceneManager);
-
-                if (!optimizedChannel.get())
-                {
-                    logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Optimized channel not created: '%s'", channel->getName().c_str());
-
-                    return VK_FALSE;
-                }
-
-                if (!interpolateConvert(optimizedChannel, channel, VKTS_CONVERT_SAMPLING))
-                {
-                    logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Could not optimize channel: '%s'", channel->getName().c_str());
-
-                    return VK_FALSE;
-                }
+        const VkTsChannelData& channelData = channelLibrary.allChannels[i];
 
-                sceneManager->removeChannel(channel);
-                sceneManager->addChannel(optimizedChannel);
-        	}
-
-            if (!parseString(buffer, sdata, VKTS_MAX_TOKEN_CHARS))
-            {
-                return VK_FALSE;
-            }
-
-            channel = sceneFactory->createChannel(sceneManager);
-
-            if (!channel.get())
-            {
-                logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Channel not created: '%s'", sdata, VKTS_MAX_TOKEN_CHARS);
-
-                return VK_FALSE;
-            }
+        auto channel = sceneFactory->createChannel(sceneManager);
 
-            channel->setName(sdata);
-
-            sceneManager->addChannel(channel);
-        }
-        else if (parseIsToken(buffer, "target_transform"))
+        if (!channel.get())
         {
-            if (!parseString(buffer, sdata, VKTS_MAX_TOKEN_CHARS))
-            {
-                return VK_FALSE;
-            }
-
-            if (channel.get())
-            {
-                if (strncmp(sdata, "TRANSLATE", 9) == 0)
-                {
-                    channel->setTargetTransform(VKTS_TARGET_TRANSFORM_TRANSLATE);
-                }
-                else if (strncmp(sdata, "ROTATE", 6) == 0)
-                {
-                    channel->setTargetTransform(VKTS_TARGET_TRANSFORM_ROTATE);
-                }
-                else if (strncmp(sdata, "QUATERNION_ROTATE", 17) == 0)
-                {
-                    channel->setTargetTransform(VKTS_TARGET_TRANSFORM_QUATERNION_ROTATE);
-                }
-                else if (strncmp(sdata, "SCALE", 5) == 0)
-                {
-                    channel->setTargetTransform(VKTS_TARGET_TRANSFORM_SCALE);
-                }
-                else
-                {
-                    logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Unknown target transform: '%s'", sdata, VKTS_MAX_TOKEN_CHARS);
-
-                    return VK_FALSE;
-                }
-            }
-            else
-            {
-                logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "No channel");
+            logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Channel not created: '%s'", channelData.name.c_str());
 
-                return VK_FALSE;
-            }
+            return VK_FALSE;
         }
-        else if (parseIsToken(buffer, "target_element"))
-        {
-            if (!parseString(buffer, sdata, VKTS_MAX_TOKEN_CHARS))
-            {
-                return VK_FALSE;
-            }
-
-            if (channel.get())
-            {
-                if (strncmp(sdata, "X", 1) == 0)
-                {
-                    channel->setTargetTransformElement(VKTS_TARGET_TRANSFORM_ELEMENT_X);
-                }
-                else if (strncmp(sdata, "Y", 1) == 0)
-                {
-                    channel->setTargetTransformElement(VKTS_TARGET_TRANSFORM_ELEMENT_Y);
-                }
-                else if (strncmp(sdata, "Z", 1) == 0)
-                {
-                    channel->setTargetTransformElement(VKTS_TARGET_TRANSFORM_ELEMENT_Z);
-                }
-                else if (strncmp(sdata, "W", 1) == 0)
-                {
-                    channel->setTargetTransformElement(VKTS_TARGET_TRANSFORM_ELEMENT_W);
-                }
-                else
-                {
-                    logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Unknown target transform element: '%s'", sdata, VKTS_MAX_TOKEN_CHARS);
 
-                    return VK_FALSE;
-                }
-            }
-            else
-            {
-                logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "No channel");
+        channel->setName(channelData.name);
+        channel->setTargetTransform(channelData.targetTransform);
+        channel->setTargetTransformElement(channelData.targetTransformElement);
 
-                return VK_FALSE;
-            }
-        }
-        else if (parseIsToken(buffer, "keyframe"))
+        for (size_t k = 0; k < channelData.keys.size(); k++)
         {
-            char token[VKTS_MAX_TOKEN_CHARS + 1];
+            channel->addEntry(channelData.keys[k], channelData.values[k], channelData.handles[k], channelData.interpolators[k]);
+        }
 
-            auto numberItems = sscanf(buffer, "%256s %f %f %256s %f %f %f %f", token, &fdata[0], &fdata[1], sdata, &fdata[2], &fdata[3], &fdata[4], &fdata[5]);
+    	if (VKTS_CONVERT_BEZIER)
+    	{
+    		auto optimizedChannel = sceneFactory->createChannel(sceneManager);
 
-            if (numberItems != 4 && numberItems != 8)
+            if (!optimizedChannel.get())
             {
-                return VK_FALSE;
-            }
+                logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Optimized channel not created: '%s'", channel->getName().c_str());
 
-            if (numberItems == 4)
-            {
-                fdata[2] = fdata[0] - 0.1f;
-                fdata[3] = fdata[1];
-                fdata[4] = fdata[0] + 0.1f;
-                fdata[5] = fdata[1];
+                return VK_FALSE;
             }
 
-            if (channel.get())
-            {
-                VkTsInterpolator interpolator = VKTS_INTERPOLATOR_CONSTANT;
-
-                if (strncmp(sdata, "CONSTANT", 8) == 0)
-                {
-                    // Do nothing.
-                }
-                else if (strncmp(sdata, "LINEAR", 6) == 0)
-                {
-                    interpolator = VKTS_INTERPOLATOR_LINEAR;
-                }
-                else if (strncmp(sdata, "BEZIER", 6) == 0)
-                {
-                    interpolator = VKTS_INTERPOLATOR_BEZIER;
-                }
-                else
-                {
-                    logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Unknown interpolator: '%s'", sdata, VKTS_MAX_TOKEN_CHARS);
-
-                    return VK_FALSE;
-                }
-
-                channel->addEntry(fdata[0], fdata[1], glm::vec4(fdata[2], fdata[3], fdata[4], fdata[5]), interpolator);
-            }
-            else
+            if (!interpolateConvert(optimizedChannel, channel, VKTS_CONVERT_SAMPLING))
             {
-                logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "No channel");
+                logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Could not optimize channel: '%s'", channel->getName().c_str());
 
                 return VK_FALSE;
             }
-        }
-        else
-        {
-            parseUnknownBuffer(buffer);
-        }
-    }
-
-	if (channel.get() && VKTS_CONVERT_BEZIER)
-	{
-		auto optimizedChannel = sceneFactory->createChannel(sceneManager);
-
-        if (!optimizedChannel.get())
-        {
-            logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Optimized channel not created: '%s'", channel->getName().c_str());
-
-            return VK_FALSE;
-        }
-
-        if (!interpolateConvert(optimizedChannel, channel, VKTS_CONVERT_SAMPLING))
-        {
-            logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Could not optimize channel: '%s'", channel->getName().c_str());
 
-            return VK_FALSE;
-        }
+            channel = optimizedChannel;
+    	}
 
-        sceneManager->removeChannel(channel);
-        sceneManager->addChannel(optimizedChannel);
-	}
+        sceneManager->addChannel(channel);
+    }
 
     return VK_TRUE;
 }
@@ -2683,11 +2009,11 @@ static VkBool32 sceneLoadAnimations(const char* directory, const char* filename,
 
     std::string finalFilename = std::string(directory) + std::string(filename);
 
-    auto textBuffer = fileLoadText(finalFilename.c_str());
+    auto textBuffer = fileMapText(finalFilename.c_str());
 
     if (!textBuffer.get())
     {
-        textBuffer = fileLoadText(filename);
+        textBuffer = fileMapText(filename);
 
         if (!textBuffer.get())
         {
@@ -2851,11 +2177,11 @@ static VkBool32 sceneLoadParticleSystems(const char* directory, const char* file
 
     std::string finalFilename = std::string(directory) + std::string(filename);
 
-    auto textBuffer = fileLoadText(finalFilename.c_str());
+    auto textBuffer = fileMapText(finalFilename.c_str());
 
     if (!textBuffer.get())
     {
-        textBuffer = fileLoadText(filename);
+        textBuffer = fileMapText(filename);
 
         if (!textBuffer.get())
         {
@@ -3219,11 +2545,11 @@ static VkBool32 sceneLoadCameras(const char* directory, const char* filename, co
 
     std::string finalFilename = std::string(directory) + std::string(filename);
 
-    auto textBuffer = fileLoadText(finalFilename.c_str());
+    auto textBuffer = fileMapText(finalFilename.c_str());
 
     if (!textBuffer.get())
     {
-        textBuffer = fileLoadText(filename);
+        textBuffer = fileMapText(filename);
 
         if (!textBuffer.get())
         {
@@ -3388,11 +2714,11 @@ static VkBool32 sceneLoadLights(const char* directory, const char* filename, con
 
     std::string finalFilename = std::string(directory) + std::string(filename);
 
-    auto textBuffer = fileLoadText(finalFilename.c_str());
+    auto textBuffer = fileMapText(finalFilename.c_str());
 
     if (!textBuffer.get())
     {
-        textBuffer = fileLoadText(filename);
+        textBuffer = fileMapText(filename);
 
         if (!textBuffer.get())
         {
@@ -3597,11 +2923,11 @@ static VkBool32 sceneLoadObjects(const char* directory, const char* filename, co
 
     std::string finalFilename = std::string(directory) + std::string(filename);
 
-    auto textBuffer = fileLoadText(finalFilename.c_str());
+    auto textBuffer = fileMapText(finalFilename.c_str());
 
     if (!textBuffer.get())
     {
-        textBuffer = fileLoadText(filename);
+        textBuffer = fileMapText(filename);
 
         if (!textBuffer.get())
         {
@@ -4404,7 +3730,7 @@ ISceneSP VKTS_APIENTRY sceneLoad(const char* filename, const ISceneManagerSP& sc
         return ISceneSP();
     }
 
-    auto textBuffer = fileLoadText(filename);
+    auto textBuffer = fileMapText(filename);
 
     if (!textBuffer.get())
     {
@@ -4672,4 +3998,117 @@ ISceneSP VKTS_APIENTRY sceneLoad(const char* filename, const ISceneManagerSP& sc
     return scene;
 }
 
+static VkBool32 sceneConvertLibrary(const char* directory, const char* filename)
+{
+    std::string finalFilename = std::string(directory) + std::string(filename);
+
+    auto textBuffer = fileMapText(finalFilename.c_str());
+
+    if (!textBuffer.get())
+    {
+        finalFilename = filename;
+
+        textBuffer = fileMapText(finalFilename.c_str());
+
+        if (!textBuffer.get())
+        {
+            return VK_FALSE;
+        }
+    }
+
+    char buffer[VKTS_MAX_BUFFER_CHARS + 1];
+    char sdata[VKTS_MAX_TOKEN_CHARS + 1];
+
+    while (textBuffer->gets(buffer, VKTS_MAX_BUFFER_CHARS))
+    {
+        if (parseSkipBuffer(buffer))
+        {
+            continue;
+        }
+
+        // Only libraries, which do lead to sub meshes or channels, are followed.
+
+        if (parseIsToken(buffer, "object_library") || parseIsToken(buffer, "mesh_library") || parseIsToken(buffer, "animation_library"))
+        {
+            if (!parseString(buffer, sdata, VKTS_MAX_TOKEN_CHARS))
+            {
+                return VK_FALSE;
+            }
+
+            if (!sceneConvertLibrary(directory, sdata))
+            {
+                logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Could not convert library: '%s'", sdata);
+
+                return VK_FALSE;
+            }
+        }
+        else if (parseIsToken(buffer, "submesh_library"))
+        {
+            if (!parseString(buffer, sdata, VKTS_MAX_TOKEN_CHARS))
+            {
+                return VK_FALSE;
+            }
+
+            VkTsSubMeshLibrary subMeshLibrary;
+
+            if (!_sceneLibraryLoadSubMeshes(directory, sdata, VK_FALSE, subMeshLibrary))
+            {
+                logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Could not load sub meshes: '%s'", sdata);
+
+                return VK_FALSE;
+            }
+
+            const std::string binaryFilename = std::string(directory) + _sceneLibraryGetBinaryFilename(sdata);
+
+            if (!_sceneLibrarySaveSubMeshes(binaryFilename.c_str(), subMeshLibrary))
+            {
+                logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Could not save sub meshes: '%s'", binaryFilename.c_str());
+
+                return VK_FALSE;
+            }
+        }
+        else if (parseIsToken(buffer, "channel_library"))
+        {
+            if (!parseString(buffer, sdata, VKTS_MAX_TOKEN_CHARS))
+            {
+                return VK_FALSE;
+            }
+
+            VkTsChannelLibrary channelLibrary;
+
+            if (!_sceneLibraryLoadChannels(directory, sdata, VK_FALSE, channelLibrary))
+            {
+                logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Could not load channels: '%s'", sdata);
+
+                return VK_FALSE;
+            }
+
+            const std::string binaryFilename = std::string(directory) + _sceneLibraryGetBinaryFilename(sdata);
+
+            if (!_sceneLibrarySaveChannels(binaryFilename.c_str(), channelLibrary))
+            {
+                logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Could not save channels: '%s'", binaryFilename.c_str());
+
+                return VK_FALSE;
+            }
+        }
+    }
+
+    return VK_TRUE;
+}
+
+VkBool32 VKTS_APIENTRY sceneConvertLibraries(const char* filename)
+{
+    if (!filename)
+    {
+        return VK_FALSE;
+    }
+
+    char directory[VKTS_MAX_BUFFER_CHARS] = "";
+
+    fileGetDirectory(directory, filename);
+
+    return sceneConvertLibrary(directory, filename + strlen(directory));
+}
+
 }
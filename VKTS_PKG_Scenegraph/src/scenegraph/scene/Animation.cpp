@@ -30,12 +30,12 @@ namespace vkts
 {
 
 Animation::Animation() :
-    IAnimation(), name(""), start(0.0f), stop(0.0f), currentSection(-1), animationType(AnimationLoop), animationScale(1.0f), currentTime(0.0f), allMarkers(), allChannels()
+    IAnimation(), name(""), start(0.0f), stop(0.0f), currentSection(-1), animationType(AnimationLoop), animationScale(1.0f), currentTime(0.0f), allMarkers(), allChannels(), clip(), clipTrack(0)
 {
 }
 
 Animation::Animation(const Animation& other) :
-    IAnimation(), name(other.name + "_clone"), start(other.start), stop(other.stop), currentSection(other.currentSection), animationType(other.animationType), animationScale(other.animationScale), currentTime(other.currentTime), allChannels()
+    IAnimation(), name(other.name + "_clone"), start(other.start), stop(other.stop), currentSection(other.currentSection), animationType(other.animationType), animationScale(other.animationScale), currentTime(other.currentTime), allChannels(), clip(other.clip), clipTrack(other.clipTrack)
 {
     for (uint32_t i = 0; i < other.allMarkers.size(); i++)
     {
@@ -262,6 +262,22 @@ const SmartPointerVector<IChannelSP>& Animation::getChannels() const
     return allChannels;
 }
 
+void Animation::setClip(const AnimationClipSP& clip, const uint32_t track)
+{
+    this->clip = clip;
+    this->clipTrack = track;
+}
+
+const AnimationClipSP& Animation::getClip() const
+{
+    return clip;
+}
+
+uint32_t Animation::getClipTrack() const
+{
+    return clipTrack;
+}
+
 //
 // ICloneable
 //
@@ -296,6 +312,8 @@ void Animation::destroy()
 	        allChannels[i]->destroy();
 	    }
 	    allChannels.clear();
+
+	    clip.reset();
 	}
 	catch(const std::exception& e)
 	{
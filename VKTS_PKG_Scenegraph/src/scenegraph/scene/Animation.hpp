@@ -55,6 +55,10 @@ private:
 
     SmartPointerVector<IChannelSP> allChannels;
 
+    AnimationClipSP clip;
+
+    uint32_t clipTrack;
+
 public:
 
     Animation();
@@ -115,6 +119,12 @@ public:
 
     virtual const SmartPointerVector<IChannelSP>& getChannels() const override;
 
+    virtual void setClip(const AnimationClipSP& clip, const uint32_t track) override;
+
+    virtual const AnimationClipSP& getClip() const override;
+
+    virtual uint32_t getClipTrack() const override;
+
     //
     // ICloneable
     //
@@ -147,7 +147,7 @@ void BSDFMaterial::setTransparent(const VkBool32 transparent)
 	this->transparent = transparent;
 }
 
-void BSDFMaterial::updateDescriptorSetsRecursive(const uint32_t allWriteDescriptorSetsCount, VkWriteDescriptorSet* allWriteDescriptorSets, const uint32_t currentBuffer, const std::string& nodeName)
+void BSDFMaterial::updateDescriptorSetsRecursive(const uint32_t allWriteDescriptorSetsCount, VkWriteDescriptorSet* allWriteDescriptorSets, const uint32_t currentBuffer, const int32_t nodeIndex)
 {
 	if (currentBuffer >= materialData.size())
 	{
@@ -156,11 +156,11 @@ void BSDFMaterial::updateDescriptorSetsRecursive(const uint32_t allWriteDescript
 
 	if (materialData[currentBuffer].get())
 	{
-		materialData[currentBuffer]->updateDescriptorSets(allWriteDescriptorSetsCount, allWriteDescriptorSets, nodeName);
+		materialData[currentBuffer]->updateDescriptorSets(allWriteDescriptorSetsCount, allWriteDescriptorSets, nodeIndex);
 	}
 }
 
-void BSDFMaterial::drawRecursive(const ICommandBuffersSP& cmdBuffer, const IGraphicsPipelineSP& graphicsPipeline, const uint32_t currentBuffer, const std::map<uint32_t, VkTsDynamicOffset>& dynamicOffsetMappings, const OverwriteDraw* renderOverwrite, const std::string& nodeName)
+void BSDFMaterial::drawRecursive(const ICommandBuffersSP& cmdBuffer, const IGraphicsPipelineSP& graphicsPipeline, const uint32_t currentBuffer, const std::map<uint32_t, VkTsDynamicOffset>& dynamicOffsetMappings, const OverwriteDraw* renderOverwrite, const int32_t nodeIndex)
 {
     const OverwriteDraw* currentOverwrite = renderOverwrite;
     while (currentOverwrite)
@@ -182,7 +182,7 @@ void BSDFMaterial::drawRecursive(const ICommandBuffersSP& cmdBuffer, const IGrap
 
 	if (materialData[currentBuffer].get())
 	{
-		materialData[currentBuffer]->draw(cmdBuffer, graphicsPipeline, currentBuffer, dynamicOffsetMappings, nodeName);
+		materialData[currentBuffer]->draw(cmdBuffer, graphicsPipeline, currentBuffer, dynamicOffsetMappings, nodeIndex);
 	}
 }
 
@@ -30,12 +30,12 @@ namespace vkts
 {
 
 Channel::Channel() :
-    IChannel(), name(""), targetTransform(VKTS_TARGET_TRANSFORM_TRANSLATE), targetTransformElement(VKTS_TARGET_TRANSFORM_ELEMENT_X), allKeys(), allValues(), allHandles(), allInterpolators()
+    IChannel(), name(""), targetTransform(VKTS_TARGET_TRANSFORM_TRANSLATE), targetTransformElement(VKTS_TARGET_TRANSFORM_ELEMENT_X), curve()
 {
 }
 
 Channel::Channel(const Channel& other) :
-    IChannel(), name(other.name + "_clone"), targetTransform(other.targetTransform), targetTransformElement(other.targetTransformElement), allKeys(other.allKeys), allValues(other.allValues), allHandles(other.allHandles), allInterpolators(other.allInterpolators)
+    IChannel(), name(other.name + "_clone"), targetTransform(other.targetTransform), targetTransformElement(other.targetTransformElement), curve(other.curve)
 {
 }
 
@@ -80,91 +80,42 @@ void Channel::setTargetTransformElement(VkTsTargetTransformElement targetTransfo
 
 VkBool32 Channel::addEntry(const float key, const float value, const glm::vec4& handles, const VkTsInterpolator interpolator)
 {
-    uint32_t index = 0;
-
-    while (index < allKeys.size())
-    {
-        if (key == allKeys[index])
-        {
-            return VK_FALSE;
-        }
-        else if (key < allKeys[index])
-        {
-            index--;
-
-            break;
-        }
-
-        index++;
-    }
-
-    if (index == allKeys.size())
-    {
-        allKeys.push_back(key);
-        allValues.push_back(value);
-        allHandles.push_back(handles);
-        allInterpolators.push_back(interpolator);
-    }
-    else
-    {
-        allKeys.insert(allKeys.begin() + index, key);
-        allValues.insert(allValues.begin() + index, value);
-        allHandles.insert(allHandles.begin() + index, handles);
-        allInterpolators.insert(allInterpolators.begin() + index, interpolator);
-    }
-
-    return VK_TRUE;
+    return curve.addEntry(key, value, handles, interpolator);
 }
 
 VkBool32 Channel::removeEntry(const float key)
 {
-    uint32_t index = 0;
-
-    while (index < allKeys.size())
-    {
-        if (key == allKeys[index])
-        {
-            allKeys.erase(allKeys.begin() + index);
-            allValues.erase(allValues.begin() + index);
-            allHandles.erase(allHandles.begin() + index);
-            allInterpolators.erase(allInterpolators.begin() + index);
-
-            return VK_TRUE;
-        }
-        else if (key > allKeys[index])
-        {
-            break;
-        }
-
-        index++;
-    }
-
-    return VK_FALSE;
+    return curve.removeEntry(key);
 }
 
 uint32_t Channel::getNumberEntries() const
 {
-    return (uint32_t)allKeys.size();
+    return curve.getNumberEntries();
 }
 
 const std::vector<float>& Channel::getKeys() const
 {
-    return allKeys;
+    return curve.getKeys();
 }
 
 const std::vector<float>& Channel::getValues() const
 {
-    return allValues;
+    return curve.getValues();
 }
 
 const std::vector<glm::vec4>& Channel::getHandles() const
 {
-    return allHandles;
+    return curve.getHandles();
 }
 
 const std::vector<VkTsInterpolator>& Channel::getInterpolators() const
 {
-    return allInterpolators;
+    return curve.getInterpolators();
+}
+
+const KeyframeCurve& Channel::getCurve() const
+{
+    return curve;
 }
 
 //
@@ -182,13 +133,7 @@ IChannelSP Channel::clone() const
 
 void Channel::destroy()
 {
-    allKeys.clear();
-
-    allValues.clear();
-
-    allHandles.clear();
-
-    allInterpolators.clear();
+    curve.reset();
 }
 
 } /* namespace vkts */
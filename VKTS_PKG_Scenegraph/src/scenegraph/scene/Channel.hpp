@@ -43,13 +43,7 @@ private:
 
     VkTsTargetTransformElement targetTransformElement;
 
-    std::vector<float> allKeys;
-
-    std::vector<float> allValues;
-
-    std::vector<glm::vec4> allHandles;
-
-    std::vector<VkTsInterpolator> allInterpolators;
+    KeyframeCurve curve;
 
 public:
 
@@ -92,6 +86,8 @@ public:
 
     virtual const std::vector<VkTsInterpolator>& getInterpolators() const override;
 
+    virtual const KeyframeCurve& getCurve() const override;
+
     //
     // ICloneable
     //
@@ -36,6 +36,8 @@ void Node::reset()
 {
     name = "";
 
+    nodeIndex = -1;
+
     parentNode = INodeSP();
 
     translate = glm::vec3(0.0f, 0.0f, 0.0f);
@@ -76,6 +78,11 @@ void Node::reset()
 
     currentAnimation = -1;
 
+    allChannelValues.clear();
+    allChannelCursors.clear();
+
+    clipCursor = 0;
+
     allParticleSystems.clear();
     allParticleSystemSeeds.clear();
 
@@ -83,8 +90,13 @@ void Node::reset()
 
     jointsUniformBuffer = IBufferObjectSP();
 
+    jointPalette.reset(0);
+    jointPaletteDirty = 0;
+
     box = Aabb(glm::vec4(0.0f, 0.0f, 0.0f, 1.0f), glm::vec4(0.0f, 0.0f, 0.0f, 1.0f));
 
+    boundsDirty = VK_TRUE;
+
     layers = 0x01;
 
     //
@@ -97,17 +109,91 @@ void Node::reset()
         }
     }
     nodeData.clear();
+
+    //
+
+    if (transformHierarchy)
+    {
+    	// Children are gone, so the hierarchy has to be rebuilt.
+    	transformHierarchy->reset();
+    }
+
+    transformHierarchy = nullptr;
+    transformIndex = -1;
+}
+
+void Node::setSubtreeDirty()
+{
+	// Mark the path to the root, so the next updates do visit this node again.
+
+	Node* currentNode = this;
+
+	while (currentNode && currentNode->subtreeDirty != 0xFFFFFFFF)
+	{
+		currentNode->subtreeDirty = 0xFFFFFFFF;
+
+		currentNode = static_cast<Node*>(currentNode->parentNode.get());
+	}
+}
+
+void Node::setStructureDirty()
+{
+	if (transformHierarchy)
+	{
+		// Flattened hierarchy has to gather the nodes again.
+
+		transformHierarchy->reset();
+	}
+
+	setSubtreeDirty();
+
+	setBoundsDirty();
+}
+
+void Node::setBoundsDirty()
+{
+	// Parents contain the bounds of this node, so they have to be updated as well.
+
+	Node* currentNode = this;
+
+	while (currentNode && !currentNode->boundsDirty)
+	{
+		currentNode->boundsDirty = VK_TRUE;
+
+		currentNode = static_cast<Node*>(currentNode->parentNode.get());
+	}
+}
+
+void Node::updateBounds() const
+{
+	if (!boundsDirty)
+	{
+		return;
+	}
+
+	const glm::mat4& currentTransformMatrix = getTransformMatrix();
+
+	boundingBox = currentTransformMatrix * box;
+	boundingSphere = currentTransformMatrix * box.getSphere();
+
+	for (uint32_t i = 0; i < allChildNodes.size(); i++)
+	{
+		boundingBox += allChildNodes[i]->getBoundingBox();
+		boundingSphere += allChildNodes[i]->getBoundingSphere();
+	}
+
+	boundsDirty = VK_FALSE;
 }
 
 Node::Node() :
-    INode(), name(""), parentNode(), translate(0.0f, 0.0f, 0.0f), nodeRotationMode(VKTS_EULER_XZY), rotate(0.0f, 0.0f, 0.0f), scale(1.0f, 1.0f, 1.0f), finalTranslate(0.0f, 0.0f, 0.0f), finalRotate(0.0f, 0.0f, 0.0f), finalScale(1.0f, 1.0f, 1.0f), transformMatrix(1.0f), transformMatrixDirty(), jointIndex(-1), joints(0), bindTranslate(0.0f, 0.0f, 0.0f), bindRotationMode(VKTS_EULER_XYZ), bindRotate(0.0f, 0.0f,0.0f), bindScale(1.0f, 1.0f, 1.0f), bindMatrix(1.0f), inverseBindMatrix(1.0f), bindMatrixDirty(), allChildNodes(), allMeshes(), allCameras(), allLights(), allConstraints(), allAnimations(), currentAnimation(-1), allParticleSystems(), allParticleSystemSeeds(), transformUniformBuffer(), jointsUniformBuffer(), box(glm::vec4(0.0f, 0.0f, 0.0f, 1.0f), glm::vec4(0.0f, 0.0f, 0.0f, 1.0f)), layers(0x01), nodeData()
+    INode(), name(""), nodeIndex(-1), parentNode(), translate(0.0f, 0.0f, 0.0f), nodeRotationMode(VKTS_EULER_XZY), rotate(0.0f, 0.0f, 0.0f), scale(1.0f, 1.0f, 1.0f), finalTranslate(0.0f, 0.0f, 0.0f), finalRotate(0.0f, 0.0f, 0.0f), finalScale(1.0f, 1.0f, 1.0f), transformMatrix(1.0f), transformMatrixDirty(0), jointIndex(-1), joints(0), bindTranslate(0.0f, 0.0f, 0.0f), bindRotationMode(VKTS_EULER_XYZ), bindRotate(0.0f, 0.0f,0.0f), bindScale(1.0f, 1.0f, 1.0f), bindMatrix(1.0f), inverseBindMatrix(1.0f), bindMatrixDirty(0), subtreeDirty(0xFFFFFFFF), subtreeAnimated(VK_TRUE), allChildNodes(), allMeshes(), allCameras(), allLights(), allConstraints(), allAnimations(), currentAnimation(-1), allChannelValues(), allChannelCursors(), clipCursor(0), allParticleSystems(), allParticleSystemSeeds(), transformUniformBuffer(), jointsUniformBuffer(), jointPalette(), jointPaletteDirty(0), box(glm::vec4(0.0f, 0.0f, 0.0f, 1.0f), glm::vec4(0.0f, 0.0f, 0.0f, 1.0f)), boundingBox(), boundingSphere(), boundsDirty(VK_TRUE), layers(0x01), nodeData(), transformHierarchy(nullptr), transformIndex(-1)
 
 {
     reset();
 }
 
 Node::Node(const Node& other) :
-    INode(), name(other.name + "_clone"), parentNode(other.parentNode), translate(other.translate), nodeRotationMode(other.nodeRotationMode), rotate(other.rotate), scale(other.scale), finalTranslate(other.finalTranslate), finalRotate(other.finalRotate), finalScale(other.finalScale), transformMatrix(other.transformMatrix), transformMatrixDirty(other.transformMatrixDirty), jointIndex(-1), joints(0), bindTranslate(other.bindTranslate), bindRotationMode(other.bindRotationMode), bindRotate(other.bindRotate), bindScale(other.bindScale), bindMatrix(other.bindMatrix), inverseBindMatrix(other.inverseBindMatrix), bindMatrixDirty(other.bindMatrixDirty), box(other.box), layers(other.layers), nodeData()
+    INode(), name(other.name + "_clone"), nodeIndex(-1), parentNode(other.parentNode), translate(other.translate), nodeRotationMode(other.nodeRotationMode), rotate(other.rotate), scale(other.scale), finalTranslate(other.finalTranslate), finalRotate(other.finalRotate), finalScale(other.finalScale), transformMatrix(other.transformMatrix), transformMatrixDirty(other.transformMatrixDirty), jointIndex(-1), joints(0), bindTranslate(other.bindTranslate), bindRotationMode(other.bindRotationMode), bindRotate(other.bindRotate), bindScale(other.bindScale), bindMatrix(other.bindMatrix), inverseBindMatrix(other.inverseBindMatrix), bindMatrixDirty(other.bindMatrixDirty), subtreeDirty(0xFFFFFFFF), subtreeAnimated(VK_TRUE), clipCursor(0), jointPalette(), jointPaletteDirty(0), box(other.box), boundingBox(), boundingSphere(), boundsDirty(VK_TRUE), layers(other.layers), nodeData(), transformHierarchy(nullptr), transformIndex(-1)
 {
     for (uint32_t i = 0; i < other.nodeData.size(); i++)
     {
@@ -327,6 +413,16 @@ void Node::setName(const std::string& name)
     this->name = name;
 }
 
+int32_t Node::getNodeIndex() const
+{
+    return nodeIndex;
+}
+
+void Node::setNodeIndex(const int32_t nodeIndex)
+{
+    this->nodeIndex = nodeIndex;
+}
+
 IRenderNodeSP Node::getRenderNode(const uint32_t index) const
 {
 	if (index >= nodeData.size())
@@ -366,6 +462,14 @@ void Node::setTranslate(const glm::vec3& translate)
 {
     this->translate = translate;
 
+    if (transformHierarchy)
+    {
+    	// Without animation and constraints, the final values are the node values.
+    	this->finalTranslate = translate;
+
+    	transformHierarchy->setTranslate(transformIndex, translate);
+    }
+
     setDirty();
 }
 
@@ -378,6 +482,11 @@ void Node::setNodeRotationMode(const VkTsRotationMode rotationMode)
 {
 	this->nodeRotationMode = rotationMode;
 
+	if (transformHierarchy)
+	{
+		transformHierarchy->setRotationMode(transformIndex, rotationMode);
+	}
+
 	setDirty();
 }
 
@@ -390,6 +499,13 @@ void Node::setRotate(const glm::vec3& rotate)
 {
     this->rotate = rotate;
 
+    if (transformHierarchy)
+    {
+    	this->finalRotate = rotate;
+
+    	transformHierarchy->setRotate(transformIndex, rotate);
+    }
+
     setDirty();
 }
 
@@ -402,6 +518,13 @@ void Node::setScale(const glm::vec3& scale)
 {
     this->scale = scale;
 
+    if (transformHierarchy)
+    {
+    	this->finalScale = scale;
+
+    	transformHierarchy->setScale(transformIndex, scale);
+    }
+
     setDirty();
 }
 
@@ -512,10 +635,17 @@ void Node::addChildNode(const INodeSP& childNode)
     {
     	this->box += childNode->getAABB();
     }
+
+    // Child has to be transformed with this node.
+    childNode->setDirty();
+
+    setStructureDirty();
 }
 
 VkBool32 Node::removeChildNode(const INodeSP& childNode)
 {
+    setStructureDirty();
+
     return allChildNodes.remove(childNode);
 }
 
@@ -543,6 +673,10 @@ void Node::addMesh(const IMeshSP& mesh)
     {
     	this->box += mesh->getAABB();
     }
+
+    setStructureDirty();
+
+    setDirty();
 }
 
 VkBool32 Node::removeMesh(const IMeshSP& mesh)
@@ -563,6 +697,10 @@ const SmartPointerVector<IMeshSP>& Node::getMeshes() const
 void Node::addCamera(const ICameraSP& camera)
 {
     allCameras.append(camera);
+
+    setStructureDirty();
+
+    setDirty();
 }
 
 VkBool32 Node::removeCamera(const ICameraSP& camera)
@@ -583,6 +721,10 @@ const SmartPointerVector<ICameraSP>& Node::getCameras() const
 void Node::addLight(const ILightSP& light)
 {
     allLights.append(light);
+
+    setStructureDirty();
+
+    setDirty();
 }
 
 VkBool32 Node::removeLight(const ILightSP& light)
@@ -603,10 +745,14 @@ const SmartPointerVector<ILightSP>& Node::getLights() const
 void Node::addConstraint(const IConstraintSP& constraint)
 {
     allConstraints.append(constraint);
+
+    setStructureDirty();
 }
 
 VkBool32 Node::removeConstraint(const IConstraintSP& constraint)
 {
+    setSubtreeDirty();
+
     return allConstraints.remove(constraint);
 }
 
@@ -628,10 +774,14 @@ void Node::addAnimation(const IAnimationSP& animation)
     {
         currentAnimation = 0;
     }
+
+    setStructureDirty();
 }
 
 VkBool32 Node::removeAnimation(const IAnimationSP& animation)
 {
+    setSubtreeDirty();
+
     VkBool32 result = allAnimations.remove(animation);
 
     if (currentAnimation >= (int32_t) allAnimations.size())
@@ -667,6 +817,8 @@ void Node::setCurrentAnimation(const int32_t currentAnimation)
 	{
 		this->currentAnimation = -1;
 	}
+
+	setSubtreeDirty();
 }
 
 
@@ -736,26 +888,17 @@ uint32_t Node::getParticleSystemSeed(const IParticleSystemSP& particleSystem) co
 
 VkBool32 Node::getDirty() const
 {
-	VkBool32 total = VK_FALSE;
-
-	for (uint32_t i = 0; i < transformMatrixDirty.size(); i++)
-    {
-		total = total || transformMatrixDirty[i];
-    }
-
-    return total;
+    return transformMatrixDirty != 0;
 }
 
 void Node::setDirty(const VkBool32 dirty)
 {
-    for (uint32_t i = 0; i < transformMatrixDirty.size(); i++)
-    {
-    	transformMatrixDirty[i] = dirty;
-    }
+    transformMatrixDirty = dirty ? 0xFFFFFFFF : 0;
+    bindMatrixDirty = dirty ? 0xFFFFFFFF : 0;
 
-    for (uint32_t i = 0; i < bindMatrixDirty.size(); i++)
+    if (dirty)
     {
-    	bindMatrixDirty[i] = dirty;
+    	setSubtreeDirty();
     }
 }
 
@@ -768,8 +911,7 @@ void Node::setTransformUniformBuffer(const IBufferObjectSP& transformUniformBuff
 {
     this->transformUniformBuffer = transformUniformBuffer;
 
-    this->transformMatrixDirty.resize(0);
-    this->bindMatrixDirty.resize(0);
+    setDirty();
 
     for (uint32_t i = 0; i < nodeData.size(); i++)
     {
@@ -790,8 +932,10 @@ void Node::setJointsUniformBuffer(const int32_t joints, const IBufferObjectSP& j
 	this->joints = joints;
 	this->jointsUniformBuffer = jointsUniformBuffer;
 
-    this->transformMatrixDirty.resize(0);
-    this->bindMatrixDirty.resize(0);
+	jointPalette.reset(joints > 0 ? VKTS_MAX_JOINTS : 0);
+	jointPaletteDirty = 0xFFFFFFFF;
+
+    setDirty();
 
     for (uint32_t i = 0; i < nodeData.size(); i++)
     {
@@ -809,16 +953,18 @@ const Aabb& Node::getAABB() const
 
 Sphere Node::getBoundingSphere() const
 {
-	Sphere boundingSphere = transformMatrix * box.getSphere();
-
-	for (uint32_t i = 0; i < allChildNodes.size(); i++)
-    {
-		boundingSphere += allChildNodes[i]->getBoundingSphere();
-    }
+	updateBounds();
 
 	return boundingSphere;
 }
 
+const Aabb& Node::getBoundingBox() const
+{
+	updateBounds();
+
+	return boundingBox;
+}
+
 uint32_t Node::getLayers() const
 {
 	return layers;
@@ -861,6 +1007,11 @@ void Node::removeFromLayer(const uint8_t layer)
 
 const glm::mat4& Node::getTransformMatrix() const
 {
+	if (transformHierarchy && transformIndex >= 0 && transformIndex < (int32_t)transformHierarchy->getSize())
+	{
+		return transformHierarchy->getWorldMatrix(transformIndex);
+	}
+
 	return transformMatrix;
 }
 
@@ -948,7 +1099,7 @@ void Node::updateDescriptorSetsRecursive(const uint32_t allWriteDescriptorSetsCo
 
 	for (uint32_t i = 0; i < allMeshes.size(); i++)
 	{
-		allMeshes[i]->updateDescriptorSetsRecursive(allWriteDescriptorSetsCount, allWriteDescriptorSets, currentBuffer, name);
+		allMeshes[i]->updateDescriptorSetsRecursive(allWriteDescriptorSetsCount, allWriteDescriptorSets, currentBuffer, nodeIndex);
 	}
 
 	for (uint32_t i = 0; i < allChildNodes.size(); i++)
@@ -957,147 +1108,64 @@ void Node::updateDescriptorSetsRecursive(const uint32_t allWriteDescriptorSetsCo
 	}
 }
 
-void Node::updateTransformRecursive(const double deltaTime, const uint64_t deltaTicks, const double tickTime, const uint32_t currentBuffer, const glm::mat4& parentTransformMatrix, const VkBool32 parentTransformMatrixDirty, const glm::mat4& parentBindMatrix, const VkBool32 parentBindMatrixDirty, const INodeSP& armatureNode)
+void Node::updateTransformRecursive(const double deltaTime, const uint64_t deltaTicks, const double tickTime, const uint32_t currentBuffer, const glm::mat4& parentTransformMatrix, const VkBool32 parentTransformMatrixDirty, const glm::mat4& parentBindMatrix, const VkBool32 parentBindMatrixDirty, const INodeSP& armatureNode, SmartPointerVector<INodeSP>& allChangedNodes)
 {
-	if (transformMatrixDirty.size() != bindMatrixDirty.size() || currentBuffer >= (uint32_t)transformMatrixDirty.size())
+	if (currentBuffer >= VKTS_MAX_DIRTY_BUFFERS)
 	{
-		transformMatrixDirty.resize(currentBuffer + 1);
-		bindMatrixDirty.resize(currentBuffer + 1);
+		logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Too many buffers: %u >= %d", currentBuffer, VKTS_MAX_DIRTY_BUFFERS);
+
+		return;
+	}
+
+	const uint32_t currentBufferBit = 1u << currentBuffer;
 
-		setDirty();
+	// Skip static subtrees: Nothing was modified since the last update of this buffer and nothing is animated.
+	if (!parentTransformMatrixDirty && !parentBindMatrixDirty && !subtreeAnimated && !(subtreeDirty & currentBufferBit))
+	{
+		return;
 	}
 
-    transformMatrixDirty[currentBuffer] = transformMatrixDirty[currentBuffer] || parentTransformMatrixDirty;
+	// Cleared before processing, so modifications during the update are not lost.
+	subtreeDirty &= ~currentBufferBit;
 
-    bindMatrixDirty[currentBuffer] = bindMatrixDirty[currentBuffer] || parentBindMatrixDirty;
+	if (parentTransformMatrixDirty)
+	{
+		transformMatrixDirty |= currentBufferBit;
+	}
+
+	if (parentBindMatrixDirty)
+	{
+		bindMatrixDirty |= currentBufferBit;
+	}
 
     // Gathering armature.
     auto newArmatureNode = isArmature() ? INode::shared_from_this() : armatureNode;
 
     //
 
-    finalTranslate = translate;
-    finalRotate = rotate;
-    finalScale = scale;
-
-    //
+    VkBool32 finalTransformDirty = VK_FALSE;
 
-    if (currentAnimation >= 0 && currentAnimation < (int32_t) allAnimations.size())
+    if (!updateFinalTransform(deltaTime, finalTransformDirty))
     {
-    	float currentTime = allAnimations[currentAnimation]->update((float)deltaTime);
-
-        const auto& currentChannels = allAnimations[currentAnimation]->getChannels();
-
-        //
-
-        Quat quaternion;
-        VkBool32 quaternionDirty = VK_FALSE;
-
-        //
-
-        for (uint32_t i = 0; i < currentChannels.size(); i++)
-        {
-        	float value = interpolate(currentTime, currentChannels[i]);
-
-            if (currentChannels[i]->getTargetTransform() == VKTS_TARGET_TRANSFORM_TRANSLATE)
-            {
-                finalTranslate[currentChannels[i]->getTargetTransformElement()] = value;
-            }
-            else if (currentChannels[i]->getTargetTransform() == VKTS_TARGET_TRANSFORM_ROTATE)
-            {
-            	finalRotate[currentChannels[i]->getTargetTransformElement()] = value;
-            }
-            else if (currentChannels[i]->getTargetTransform() == VKTS_TARGET_TRANSFORM_QUATERNION_ROTATE)
-            {
-            	quaternion[currentChannels[i]->getTargetTransformElement()] = value;
-
-            	quaternionDirty = VK_TRUE;
-            }
-            else if (currentChannels[i]->getTargetTransform() == VKTS_TARGET_TRANSFORM_SCALE)
-            {
-            	finalScale[currentChannels[i]->getTargetTransformElement()] = value;
-            }
-        }
-
-        //
-
-        if (quaternionDirty)
-        {
-        	VkTsRotationMode currentRotationMode = VKTS_EULER_XZY;
-
-        	if (isNode())
-        	{
-        		// Processing node.
-
-        		currentRotationMode = nodeRotationMode;
-        	}
-        	else if (isArmature() || isJoint())
-        	{
-        		// Processing joint and armature.
-
-        		currentRotationMode = bindRotationMode;
-        	}
-        	else
-        	{
-            	logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Invalid combination: joints = %d jointIndex = %d", joints, jointIndex);
-
-            	return;
-        	}
-
-        	switch (currentRotationMode)
-        	{
-        		case VKTS_EULER_YXZ:
-        			finalRotate = decomposeRotateRzRxRy(quaternion.mat3());
-        			break;
-        		case VKTS_EULER_XYZ:
-        			finalRotate = decomposeRotateRzRyRx(quaternion.mat3());
-        			break;
-        		case VKTS_EULER_XZY:
-        			finalRotate = decomposeRotateRyRzRx(quaternion.mat3());
-        			break;
-        	}
-        }
-
-        //
-
-        transformMatrixDirty[currentBuffer] = VK_TRUE;
-
-        if (isArmature() || isJoint())
-        {
-        	// Processing joint and armature.
-
-        	bindMatrixDirty[currentBuffer] = VK_TRUE;
-        }
+    	return;
     }
 
-    //
-
-    if (allConstraints.size() > 0)
+    if (finalTransformDirty)
     {
-    	for (uint32_t i = 0; i < allConstraints.size(); i++)
-    	{
-    		if (!allConstraints[i]->applyConstraint(*this))
-    		{
-    			return;
-    		}
-    	}
-
-        //
-
-        transformMatrixDirty[currentBuffer] = VK_TRUE;
+        transformMatrixDirty |= currentBufferBit;
 
         if (isArmature() || isJoint())
         {
         	// Processing joint and armature.
 
-        	bindMatrixDirty[currentBuffer] = VK_TRUE;
+        	bindMatrixDirty |= currentBufferBit;
         }
     }
 
     //
     if (isArmature() || isJoint())
     {
-		if (bindMatrixDirty[currentBuffer])
+		if (bindMatrixDirty & currentBufferBit)
 		{
 			// Processing joints and armature.
 
@@ -1160,14 +1228,16 @@ void Node::updateTransformRecursive(const double deltaTime, const uint64_t delta
 
 			//
 
-			transformMatrixDirty[currentBuffer] = VK_TRUE;
+			transformMatrixDirty |= currentBufferBit;
 		}
 	}
 
     //
 
-    if (transformMatrixDirty[currentBuffer])
+    if (transformMatrixDirty & currentBufferBit)
     {
+    	setBoundsDirty();
+
         if (isNode() || isArmature())
         {
         	// Processing node and armature.
@@ -1215,12 +1285,20 @@ void Node::updateTransformRecursive(const double deltaTime, const uint64_t delta
         			break;
         	}
 
-        	this->transformMatrix = bindMatrix * translateMat4(finalTranslate.x, finalTranslate.y, finalTranslate.z) * currentRotation * scaleMat4(finalScale.x, finalScale.y, finalScale.z) * this->inverseBindMatrix;
+        	// Same as translate * rotate * scale, without the full matrix multiplications.
+
+        	currentRotation[0] *= finalScale.x;
+        	currentRotation[1] *= finalScale.y;
+        	currentRotation[2] *= finalScale.z;
+        	currentRotation[3] = glm::vec4(finalTranslate, 1.0f);
+
+        	multiplyMat4(this->transformMatrix, bindMatrix, currentRotation);
+        	multiplyMat4(this->transformMatrix, this->transformMatrix, this->inverseBindMatrix);
 
         	// Only use parent transform, if parent is not an armature.
         	if (parentNode.get() && parentNode->getNumberJoints() == 0)
         	{
-        		this->transformMatrix = parentTransformMatrix * this->transformMatrix;
+        		multiplyMat4(this->transformMatrix, parentTransformMatrix, this->transformMatrix);
         	}
         }
         else
@@ -1252,21 +1330,9 @@ void Node::updateTransformRecursive(const double deltaTime, const uint64_t delta
 
 			if (allMeshes.size() > 0)
 			{
-				uint32_t dynamicOffset = currentBuffer * (uint32_t)(transformUniformBuffer->getBuffer()->getSize() / transformUniformBuffer->getBufferCount());
-
-				// A mesh has to be rendered, so update with transform matrix from the node tree.
+				// A mesh has to be rendered, so the upload stage does update it with the transform matrix from the node tree.
 
-				if (!transformUniformBuffer->upload(dynamicOffset + 0, 0, this->transformMatrix))
-				{
-					return;
-				}
-
-				auto transformNormalMatrix = glm::transpose(glm::inverse(glm::mat3(this->transformMatrix)));
-
-				if (!transformUniformBuffer->upload(dynamicOffset + sizeof(float) * 16, 0, transformNormalMatrix))
-				{
-					return;
-				}
+				allChangedNodes.append(INode::shared_from_this());
 			}
         }
 
@@ -1274,21 +1340,11 @@ void Node::updateTransformRecursive(const double deltaTime, const uint64_t delta
         {
         	// Process armature.
 
-        	uint32_t dynamicOffset = currentBuffer * (uint32_t)(jointsUniformBuffer->getBuffer()->getSize() / jointsUniformBuffer->getBufferCount());
-
         	// Store parent matrix separately, as this allows to modify it without recalculating the bind matrices.
 
-			if (!jointsUniformBuffer->upload(dynamicOffset + 0, 0, parentTransformMatrix))
-			{
-				return;
-			}
+        	jointPalette.setParent(parentTransformMatrix);
 
-            auto transformNormalMatrix = glm::transpose(glm::inverse(glm::mat3(parentTransformMatrix)));
-
-            if (!jointsUniformBuffer->upload(dynamicOffset + sizeof(float) * 16, 0, transformNormalMatrix))
-            {
-            	return;
-            }
+        	jointPaletteDirty = 0xFFFFFFFF;
         }
 
         if (isJoint())
@@ -1299,27 +1355,11 @@ void Node::updateTransformRecursive(const double deltaTime, const uint64_t delta
 			{
 				if (newArmatureNode.get())
 				{
-					auto currentJointsUniformBuffer = newArmatureNode->getJointsUniformBuffer();
+					// Joint matrices are gathered by the armature and uploaded at once, to blend them on the GPU.
 
-					if (currentJointsUniformBuffer.get())
+					if (!static_cast<Node*>(newArmatureNode.get())->setJointMatrix(jointIndex, this->transformMatrix))
 					{
-						uint32_t dynamicOffset = currentBuffer * (uint32_t)(currentJointsUniformBuffer->getBuffer()->getSize() / currentJointsUniformBuffer->getBufferCount());
-
-						uint32_t offset = sizeof(float) * 16 + sizeof(float) * 12;
-
-						// Upload the joint matrices to blend them on the GPU.
-
-						if (!currentJointsUniformBuffer->upload(dynamicOffset + offset + jointIndex * sizeof(float) * 16, 0, this->transformMatrix))
-						{
-							return;
-						}
-
-						auto transformNormalMatrix = glm::transpose(glm::inverse(glm::mat3(this->transformMatrix)));
-
-						if (!currentJointsUniformBuffer->upload(dynamicOffset + offset + VKTS_MAX_JOINTS * sizeof(float) * 16 + jointIndex * sizeof(float) * 12, 0, transformNormalMatrix))
-						{
-							return;
-						}
+						return;
 					}
 				}
 				else
@@ -1342,18 +1382,34 @@ void Node::updateTransformRecursive(const double deltaTime, const uint64_t delta
 
     // Process children.
 
+    VkBool32 childNodesAnimated = VK_FALSE;
+
     for (uint32_t i = 0; i < allChildNodes.size(); i++)
     {
-        allChildNodes[i]->updateTransformRecursive(deltaTime, deltaTicks, tickTime, currentBuffer, this->transformMatrix, this->transformMatrixDirty[currentBuffer], this->bindMatrix, this->bindMatrixDirty[currentBuffer], newArmatureNode);
+        allChildNodes[i]->updateTransformRecursive(deltaTime, deltaTicks, tickTime, currentBuffer, this->transformMatrix, (this->transformMatrixDirty & currentBufferBit) != 0, this->bindMatrix, (this->bindMatrixDirty & currentBufferBit) != 0, newArmatureNode, allChangedNodes);
+
+        childNodesAnimated = childNodesAnimated || static_cast<Node*>(allChildNodes[i].get())->subtreeAnimated;
     }
 
+    // All joints are processed, so the palette is complete.
+
+    if (isArmature() && (jointPaletteDirty & currentBufferBit))
+    {
+    	if (!uploadJointPalette(currentBuffer))
+    	{
+    		return;
+    	}
+    }
+
+    subtreeAnimated = (currentAnimation >= 0 && currentAnimation < (int32_t) allAnimations.size()) || allConstraints.size() > 0 || childNodesAnimated;
+
     //
 
     // Reset dirty for current buffer.
 
-    transformMatrixDirty[currentBuffer] = VK_FALSE;
+    transformMatrixDirty &= ~currentBufferBit;
 
-    bindMatrixDirty[currentBuffer] = VK_FALSE;
+    bindMatrixDirty &= ~currentBufferBit;
 }
 
 void Node::drawRecursive(const ICommandBuffersSP& cmdBuffer, const SmartPointerVector<IGraphicsPipelineSP>& allGraphicsPipelines, const uint32_t currentBuffer, const std::map<uint32_t, VkTsDynamicOffset>& dynamicOffsetMappings, const OverwriteDraw* renderOverwrite)
@@ -1373,7 +1429,7 @@ void Node::drawRecursive(const ICommandBuffersSP& cmdBuffer, const SmartPointerV
 
 	for (uint32_t i = 0; i < allMeshes.size(); i++)
 	{
-		allMeshes[i]->drawRecursive(cmdBuffer, allGraphicsPipelines, currentBuffer, dynamicOffsetMappings, renderOverwrite, name);
+		allMeshes[i]->drawRecursive(cmdBuffer, allGraphicsPipelines, currentBuffer, dynamicOffsetMappings, renderOverwrite, nodeIndex);
 	}
 
 	for (uint32_t i = 0; i < allChildNodes.size(); i++)
@@ -1397,6 +1453,300 @@ VkBool32 Node::isJoint() const
 	return (joints == 0) && (jointIndex != -1);
 }
 
+//
+// Flattened transform hierarchy.
+//
+
+void Node::setTransformHierarchy(TransformHierarchy* transformHierarchy, const int32_t transformIndex)
+{
+	// Continue with the last world matrix of the previous hierarchy.
+	this->transformMatrix = getTransformMatrix();
+
+	this->transformHierarchy = transformHierarchy;
+	this->transformIndex = transformHierarchy ? transformIndex : -1;
+
+	setDirty();
+}
+
+VkBool32 Node::updateFinalTransform(const double deltaTime, VkBool32& finalTransformDirty)
+{
+    finalTranslate = translate;
+    finalRotate = rotate;
+    finalScale = scale;
+
+    //
+
+    if (currentAnimation >= 0 && currentAnimation < (int32_t) allAnimations.size())
+    {
+    	float currentTime = allAnimations[currentAnimation]->update((float)deltaTime);
+
+        const auto& currentChannels = allAnimations[currentAnimation]->getChannels();
+
+        const auto& currentClip = allAnimations[currentAnimation]->getClip();
+
+        //
+
+        Quat quaternion;
+        VkBool32 quaternionDirty = VK_FALSE;
+
+        //
+
+        if (currentClip.get())
+        {
+        	// Baked clip contains the whole transform, so no channel is sampled.
+
+        	currentClip->sample(finalTranslate, quaternion, finalScale, allAnimations[currentAnimation]->getClipTrack(), currentTime, clipCursor);
+
+        	quaternionDirty = VK_TRUE;
+        }
+        else if (!interpolateChannels(allChannelValues, allChannelCursors, currentTime, allAnimations[currentAnimation]))
+        {
+        	return VK_FALSE;
+        }
+
+        //
+
+        for (uint32_t i = 0; !currentClip.get() && i < currentChannels.size(); i++)
+        {
+        	float value = allChannelValues[i];
+
+            if (currentChannels[i]->getTargetTransform() == VKTS_TARGET_TRANSFORM_TRANSLATE)
+            {
+                finalTranslate[currentChannels[i]->getTargetTransformElement()] = value;
+            }
+            else if (currentChannels[i]->getTargetTransform() == VKTS_TARGET_TRANSFORM_ROTATE)
+            {
+            	finalRotate[currentChannels[i]->getTargetTransformElement()] = value;
+            }
+            else if (currentChannels[i]->getTargetTransform() == VKTS_TARGET_TRANSFORM_QUATERNION_ROTATE)
+            {
+            	quaternion[currentChannels[i]->getTargetTransformElement()] = value;
+
+            	quaternionDirty = VK_TRUE;
+            }
+            else if (currentChannels[i]->getTargetTransform() == VKTS_TARGET_TRANSFORM_SCALE)
+            {
+            	finalScale[currentChannels[i]->getTargetTransformElement()] = value;
+            }
+        }
+
+        //
+
+        if (quaternionDirty)
+        {
+        	VkTsRotationMode currentRotationMode = VKTS_EULER_XZY;
+
+        	if (isNode())
+        	{
+        		// Processing node.
+
+        		currentRotationMode = nodeRotationMode;
+        	}
+        	else if (isArmature() || isJoint())
+        	{
+        		// Processing joint and armature.
+
+        		currentRotationMode = bindRotationMode;
+        	}
+        	else
+        	{
+            	logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Invalid combination: joints = %d jointIndex = %d", joints, jointIndex);
+
+            	return VK_FALSE;
+        	}
+
+        	switch (currentRotationMode)
+        	{
+        		case VKTS_EULER_YXZ:
+        			finalRotate = decomposeRotateRzRxRy(quaternion.mat3());
+        			break;
+        		case VKTS_EULER_XYZ:
+        			finalRotate = decomposeRotateRzRyRx(quaternion.mat3());
+        			break;
+        		case VKTS_EULER_XZY:
+        			finalRotate = decomposeRotateRyRzRx(quaternion.mat3());
+        			break;
+        	}
+        }
+
+        //
+
+        finalTransformDirty = VK_TRUE;
+    }
+
+    //
+
+    if (allConstraints.size() > 0)
+    {
+    	for (uint32_t i = 0; i < allConstraints.size(); i++)
+    	{
+    		if (!allConstraints[i]->applyConstraint(*this))
+    		{
+    			return VK_FALSE;
+    		}
+    	}
+
+        //
+
+        finalTransformDirty = VK_TRUE;
+    }
+
+    return VK_TRUE;
+}
+
+VkBool32 Node::updateFlattenedTransform(const uint32_t currentBuffer, const VkBool32 updated, VkBool32& changed)
+{
+	changed = VK_FALSE;
+
+	if (!transformHierarchy || transformIndex < 0 || currentBuffer >= VKTS_MAX_DIRTY_BUFFERS)
+	{
+		return VK_FALSE;
+	}
+
+	const uint32_t currentBufferBit = 1u << currentBuffer;
+
+	if (updated)
+	{
+		// All buffers have to receive the new world matrix.
+
+		transformMatrixDirty = 0xFFFFFFFF;
+		bindMatrixDirty = 0xFFFFFFFF;
+
+		setBoundsDirty();
+	}
+
+	if (!(transformMatrixDirty & currentBufferBit))
+	{
+		return VK_TRUE;
+	}
+
+	const glm::mat4& worldMatrix = transformHierarchy->getWorldMatrix(transformIndex);
+
+	for (uint32_t i = 0; i < allCameras.size(); i++)
+	{
+		allCameras[i]->updateViewMatrix(worldMatrix);
+	}
+
+	for (uint32_t i = 0; i < allLights.size(); i++)
+	{
+		allLights[i]->updateDirection(worldMatrix);
+	}
+
+	changed = allMeshes.size() > 0;
+
+	transformMatrixDirty &= ~currentBufferBit;
+
+	bindMatrixDirty &= ~currentBufferBit;
+
+	return VK_TRUE;
+}
+
+VkBool32 Node::uploadJointPalette(const uint32_t currentBuffer)
+{
+	if (!jointsUniformBuffer.get() || jointsUniformBuffer->getBufferCount() == 0)
+	{
+		jointPaletteDirty = 0;
+
+		return VK_TRUE;
+	}
+
+	jointPalette.update();
+
+	// The frame of the current buffer starts at the dynamic offset.
+
+	jointsUniformBuffer->reset(currentBuffer);
+
+	uint32_t dynamicOffset;
+
+	if (!jointsUniformBuffer->allocate(dynamicOffset, jointPalette.getSize(), 16))
+	{
+		return VK_FALSE;
+	}
+
+	if (!jointsUniformBuffer->upload(dynamicOffset, 0, jointPalette.getData(), jointPalette.getSize()))
+	{
+		return VK_FALSE;
+	}
+
+	if (!jointsUniformBuffer->flush())
+	{
+		return VK_FALSE;
+	}
+
+	// Buffers of the other frames still contain the previous palette.
+
+	const uint32_t allBuffersBits = jointsUniformBuffer->getBufferCount() < 32 ? (1u << (uint32_t)jointsUniformBuffer->getBufferCount()) - 1 : 0xFFFFFFFF;
+
+	jointPaletteDirty &= ~(1u << currentBuffer) & allBuffersBits;
+
+	if (jointPaletteDirty)
+	{
+		setSubtreeDirty();
+	}
+
+	return VK_TRUE;
+}
+
+VkBool32 Node::setJointMatrix(const int32_t jointIndex, const glm::mat4& transformMatrix)
+{
+	if (!isArmature() || jointIndex < 0 || !jointPalette.setJoint((uint32_t)jointIndex, transformMatrix))
+	{
+		logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Could not set joint %d", jointIndex);
+
+		return VK_FALSE;
+	}
+
+	jointPaletteDirty = 0xFFFFFFFF;
+
+	return VK_TRUE;
+}
+
+VkBool32 Node::uploadTransform(const uint32_t currentBuffer)
+{
+	if (allMeshes.size() == 0 || !transformUniformBuffer.get())
+	{
+		return VK_TRUE;
+	}
+
+	// Both matrices are written into the frame of the current buffer and flushed at once.
+
+	transformUniformBuffer->reset(currentBuffer);
+
+	uint32_t dynamicOffset;
+
+	if (!transformUniformBuffer->allocate(dynamicOffset, sizeof(float) * 16 + sizeof(float) * 12, 16))
+	{
+		return VK_FALSE;
+	}
+
+	const glm::mat4& currentTransformMatrix = getTransformMatrix();
+
+	if (!transformUniformBuffer->upload(dynamicOffset + 0, 0, currentTransformMatrix))
+	{
+		return VK_FALSE;
+	}
+
+	glm::mat3 transformNormalMatrix;
+
+	if (transformHierarchy && transformIndex >= 0 && transformIndex < (int32_t)transformHierarchy->getSize())
+	{
+		// Normal matrix is already calculated by the hierarchy.
+
+		transformNormalMatrix = transformHierarchy->getNormalMatrix(transformIndex);
+	}
+	else
+	{
+		transformNormalMatrix = glm::transpose(glm::inverse(glm::mat3(currentTransformMatrix)));
+	}
+
+	if (!transformUniformBuffer->upload(dynamicOffset + sizeof(float) * 16, 0, transformNormalMatrix))
+	{
+		return VK_FALSE;
+	}
+
+	return transformUniformBuffer->flush();
+}
+
 //
 // ICloneable
 //
@@ -1445,6 +1795,12 @@ INodeSP Node::clone() const
 		return INodeSP();
 	}
 
+	// Cloned child nodes have to point to the cloned parent, as modifications are propagated to the root.
+	for (uint32_t i = 0; i < result->getNumberChildNodes(); i++)
+	{
+		result->getChildNodes()[i]->setParentNode(result);
+	}
+
     return result;
 }
 
@@ -39,6 +39,8 @@ private:
 
     std::string name;
 
+    int32_t nodeIndex;
+
     INodeSP parentNode;
 
     glm::vec3 translate;
@@ -51,7 +53,7 @@ private:
     glm::vec3 finalScale;
 
     glm::mat4 transformMatrix;
-    std::vector<VkBool32> transformMatrixDirty;
+    uint32_t transformMatrixDirty;
 
     int32_t jointIndex;
     int32_t joints;
@@ -63,7 +65,13 @@ private:
 
     glm::mat4 bindMatrix;
     glm::mat4 inverseBindMatrix;
-    std::vector<VkBool32> bindMatrixDirty;
+    uint32_t bindMatrixDirty;
+
+    // This node or a child node was modified, so the subtree has to be visited for these buffers.
+    uint32_t subtreeDirty;
+
+    // This node or a child node has an animation or constraints, so the subtree has to be visited every update.
+    VkBool32 subtreeAnimated;
 
     SmartPointerVector<INodeSP> allChildNodes;
 
@@ -78,6 +86,13 @@ private:
 
     int32_t currentAnimation;
 
+    // Sampled channel values and cursors of the current animation.
+    std::vector<float> allChannelValues;
+    std::vector<uint32_t> allChannelCursors;
+
+    // Cursor of the baked clip of the current animation.
+    uint32_t clipCursor;
+
     SmartPointerVector<IParticleSystemSP> allParticleSystems;
     Vector<uint32_t> allParticleSystemSeeds;
 
@@ -85,14 +100,36 @@ private:
 
     IBufferObjectSP jointsUniformBuffer;
 
+    // Joint matrices of an armature, uploaded at once after all joints are updated.
+    JointPalette jointPalette;
+    uint32_t jointPaletteDirty;
+
     Aabb box;
 
+    // World space bounds of this node and all children, updated on request.
+    mutable Aabb boundingBox;
+    mutable Sphere boundingSphere;
+    mutable VkBool32 boundsDirty;
+
     uint32_t layers;
 
     SmartPointerVector<IRenderNodeSP> nodeData;
 
+    TransformHierarchy* transformHierarchy;
+    int32_t transformIndex;
+
     void reset();
 
+    void setSubtreeDirty();
+
+    void setStructureDirty();
+
+    void setBoundsDirty();
+
+    void updateBounds() const;
+
+    VkBool32 uploadJointPalette(const uint32_t currentBuffer);
+
 public:
 
     Node();
@@ -111,6 +148,10 @@ public:
 
     virtual void setName(const std::string& name) override;
 
+    virtual int32_t getNodeIndex() const override;
+
+    virtual void setNodeIndex(const int32_t nodeIndex) override;
+
 
     virtual IRenderNodeSP getRenderNode(const uint32_t index) const override;
 
@@ -255,6 +296,8 @@ public:
 
     virtual Sphere getBoundingSphere() const override;
 
+    virtual const Aabb& getBoundingBox() const override;
+
     virtual uint32_t getLayers() const override;
 
     virtual void setLayers(const uint32_t layers) override;
@@ -275,7 +318,7 @@ public:
 
     virtual void updateDescriptorSetsRecursive(const uint32_t allWriteDescriptorSetsCount, VkWriteDescriptorSet* allWriteDescriptorSets, const uint32_t currentBuffer) override;
 
-    virtual void updateTransformRecursive(const double deltaTime, const uint64_t deltaTicks, const double tickTime, const uint32_t currentBuffer, const glm::mat4& parentTransformMatrix, const VkBool32 parentTransformMatrixDirty, const glm::mat4& parentBindMatrix, const VkBool32 parentBindMatrixDirty, const INodeSP& armatureNode) override;
+    virtual void updateTransformRecursive(const double deltaTime, const uint64_t deltaTicks, const double tickTime, const uint32_t currentBuffer, const glm::mat4& parentTransformMatrix, const VkBool32 parentTransformMatrixDirty, const glm::mat4& parentBindMatrix, const VkBool32 parentBindMatrixDirty, const INodeSP& armatureNode, SmartPointerVector<INodeSP>& allChangedNodes) override;
 
     virtual void drawRecursive(const ICommandBuffersSP& cmdBuffer, const SmartPointerVector<IGraphicsPipelineSP>& allGraphicsPipelines, const uint32_t currentBuffer, const std::map<uint32_t, VkTsDynamicOffset>& dynamicOffsetMappings, const OverwriteDraw* renderOverwrite = nullptr) override;
 
@@ -286,6 +329,36 @@ public:
 
     virtual VkBool32 isJoint() const override;
 
+    //
+    // Flattened transform hierarchy.
+    //
+
+    /**
+     * Attaches the node to a flattened transform hierarchy owned by the object. While attached,
+     * the transform setters write through and the transform matrix is read from the hierarchy.
+     */
+    void setTransformHierarchy(TransformHierarchy* transformHierarchy, const int32_t transformIndex);
+
+    /**
+     * Gathers the final translate, rotate and scale from the node values, the current animation and the constraints.
+     */
+    VkBool32 updateFinalTransform(const double deltaTime, VkBool32& finalTransformDirty);
+
+    /**
+     * Updates cameras and lights from the flattened transform hierarchy. Changed is set, if the transform has to be uploaded for the current buffer.
+     */
+    VkBool32 updateFlattenedTransform(const uint32_t currentBuffer, const VkBool32 updated, VkBool32& changed);
+
+    /**
+     * Uploads the transform and normal matrix of a changed node to the transform uniform buffer.
+     */
+    VkBool32 uploadTransform(const uint32_t currentBuffer);
+
+    /**
+     * Writes the matrix of a joint into the palette of this armature.
+     */
+    VkBool32 setJointMatrix(const int32_t jointIndex, const glm::mat4& transformMatrix);
+
     //
     // ICloneable
     //
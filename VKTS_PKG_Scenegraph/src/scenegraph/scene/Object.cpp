@@ -31,6 +31,85 @@
 namespace vkts
 {
 
+VkBool32 Object::flattenRecursive(const INodeSP& node, const int32_t parentIndex)
+{
+	if (!node.get())
+	{
+		return VK_FALSE;
+	}
+
+	if (!node->isNode())
+	{
+		logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Object '%s': Armature and joints can not be flattened", name.c_str());
+
+		return VK_FALSE;
+	}
+
+	int32_t transformIndex = transformHierarchy.addTransform(parentIndex, node->getTranslate(), node->getNodeRotationMode(), node->getRotate(), node->getScale());
+
+	if (transformIndex < 0)
+	{
+		return VK_FALSE;
+	}
+
+	static_cast<Node*>(node.get())->setTransformHierarchy(&transformHierarchy, transformIndex);
+
+	allFlattenedNodes.append(node);
+
+	if (node->getNumberAnimations() > 0 || node->getNumberConstraints() > 0)
+	{
+		allAnimatedIndices.append((uint32_t)transformIndex);
+	}
+
+	if (node->getNumberMeshes() > 0 || node->getNumberCameras() > 0 || node->getNumberLights() > 0)
+	{
+		allDependentIndices.append((uint32_t)transformIndex);
+	}
+
+	for (uint32_t i = 0; i < node->getNumberChildNodes(); i++)
+	{
+		if (!flattenRecursive(node->getChildNodes()[i], transformIndex))
+		{
+			return VK_FALSE;
+		}
+	}
+
+	return VK_TRUE;
+}
+
+VkBool32 Object::buildTransformHierarchy()
+{
+	detachTransformHierarchy();
+
+	// Parents are always stored before their children.
+
+	if (rootNode.get() && !flattenRecursive(rootNode, -1))
+	{
+		detachTransformHierarchy();
+
+		// Continue with the recursive update.
+
+		flattened = VK_FALSE;
+
+		return VK_FALSE;
+	}
+
+	return VK_TRUE;
+}
+
+void Object::detachTransformHierarchy()
+{
+	for (uint32_t i = 0; i < allFlattenedNodes.size(); i++)
+	{
+		static_cast<Node*>(allFlattenedNodes[i].get())->setTransformHierarchy(nullptr, -1);
+	}
+
+	allFlattenedNodes.clear();
+	allAnimatedIndices.clear();
+	allDependentIndices.clear();
+
+	transformHierarchy.reset();
+}
 
 //
 // IMoveable
@@ -42,12 +121,12 @@ void Object::update()
 }
 
 Object::Object() :
-    IObject(), name(""), scale(1.0f, 1.0f, 1.0f), transformMatrix(1.0f), dirty(VK_TRUE), rootNode()
+    IObject(), name(""), scale(1.0f, 1.0f, 1.0f), transformMatrix(1.0f), dirty(VK_TRUE), rootNode(), flattened(VK_FALSE), transformHierarchy(), allFlattenedNodes(), allAnimatedIndices(), allDependentIndices(), allChangedNodes()
 {
 }
 
 Object::Object(const Object& other) :
-    IObject(other), name(other.name + "_clone"), scale(other.scale), transformMatrix(other.transformMatrix), dirty(VK_TRUE), rootNode()
+    IObject(other), name(other.name + "_clone"), scale(other.scale), transformMatrix(other.transformMatrix), dirty(VK_TRUE), rootNode(), flattened(other.flattened), transformHierarchy(), allFlattenedNodes(), allAnimatedIndices(), allDependentIndices(), allChangedNodes()
 {
     if (!other.rootNode.get())
     {
@@ -68,6 +147,11 @@ Object::Object(const Object& other) :
 
         return;
     }
+
+    if (flattened)
+    {
+    	buildTransformHierarchy();
+    }
 }
 
 Object::~Object()
@@ -103,6 +187,11 @@ void Object::setRootNode(const INodeSP& rootNode)
 {
     this->rootNode = rootNode;
 
+    if (flattened)
+    {
+    	buildTransformHierarchy();
+    }
+
     setDirty();
 }
 
@@ -118,6 +207,32 @@ void Object::setDirty()
     dirty = VK_TRUE;
 }
 
+VkBool32 Object::setFlattened(const VkBool32 flattened)
+{
+	this->flattened = flattened;
+
+	setDirty();
+
+	if (!flattened)
+	{
+		detachTransformHierarchy();
+
+		return VK_TRUE;
+	}
+
+	return buildTransformHierarchy();
+}
+
+VkBool32 Object::isFlattened() const
+{
+	return flattened;
+}
+
+const SmartPointerVector<INodeSP>& Object::getChangedNodes() const
+{
+	return allChangedNodes;
+}
+
 void Object::updateParameterRecursive(const Parameter* parameter)
 {
 	if (parameter)
@@ -153,9 +268,69 @@ void Object::updateTransformRecursive(const double deltaTime, const uint64_t del
         transformMatrix = translateMat4(translate.x, translate.y, translate.z) * (rotateZ * rotateY * rotateX) * scaleMat4(scale.x, scale.y, scale.z);
     }
 
-    if (rootNode.get())
+    allChangedNodes.clear();
+
+    if (flattened && transformHierarchy.getSize() != allFlattenedNodes.size())
     {
-        rootNode->updateTransformRecursive(deltaTime, deltaTicks, tickTime, currentBuffer, transformMatrix, dirty, glm::mat4(1.0f), VK_FALSE, INodeSP());
+    	// Node tree was modified.
+
+    	buildTransformHierarchy();
+    }
+
+    if (flattened)
+    {
+    	// Only animated and constrained nodes need a per node update before the linear pass.
+
+    	for (uint32_t i = 0; i < allAnimatedIndices.size(); i++)
+    	{
+    		const uint32_t transformIndex = allAnimatedIndices[i];
+
+    		Node* currentNode = static_cast<Node*>(allFlattenedNodes[transformIndex].get());
+
+    		VkBool32 finalTransformDirty = VK_FALSE;
+
+    		if (!currentNode->updateFinalTransform(deltaTime, finalTransformDirty))
+    		{
+    			return;
+    		}
+
+    		if (finalTransformDirty)
+    		{
+    			transformHierarchy.setTransform(transformIndex, currentNode->getFinalTranslate(), currentNode->getFinalRotate(), currentNode->getFinalScale());
+    		}
+    	}
+
+    	transformHierarchy.update(transformMatrix, dirty);
+
+    	for (uint32_t i = 0; i < allDependentIndices.size(); i++)
+    	{
+    		const uint32_t transformIndex = allDependentIndices[i];
+
+    		VkBool32 changed = VK_FALSE;
+
+    		if (!static_cast<Node*>(allFlattenedNodes[transformIndex].get())->updateFlattenedTransform(currentBuffer, transformHierarchy.isUpdated(transformIndex), changed))
+    		{
+    			logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Object '%s': Could not update node '%s'", name.c_str(), allFlattenedNodes[transformIndex]->getName().c_str());
+    		}
+    		else if (changed)
+    		{
+    			allChangedNodes.append(allFlattenedNodes[transformIndex]);
+    		}
+    	}
+    }
+    else if (rootNode.get())
+    {
+        rootNode->updateTransformRecursive(deltaTime, deltaTicks, tickTime, currentBuffer, transformMatrix, dirty, glm::mat4(1.0f), VK_FALSE, INodeSP(), allChangedNodes);
+    }
+
+    // Upload stage: Only the changed nodes are uploaded, static parts of the scene are not touched.
+
+    for (uint32_t i = 0; i < allChangedNodes.size(); i++)
+    {
+    	if (!static_cast<Node*>(allChangedNodes[i].get())->uploadTransform(currentBuffer))
+    	{
+    		logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Object '%s': Could not upload node '%s'", name.c_str(), allChangedNodes[i]->getName().c_str());
+    	}
     }
 
     dirty = VK_FALSE;
@@ -205,6 +380,8 @@ IObjectSP Object::clone() const
 
 void Object::destroy()
 {
+    detachTransformHierarchy();
+
     if (rootNode.get())
     {
         rootNode->destroy();
@@ -46,6 +46,22 @@ private:
 
     INodeSP rootNode;
 
+    VkBool32 flattened;
+
+    TransformHierarchy transformHierarchy;
+
+    SmartPointerVector<INodeSP> allFlattenedNodes;
+    Vector<uint32_t> allAnimatedIndices;
+    Vector<uint32_t> allDependentIndices;
+
+    SmartPointerVector<INodeSP> allChangedNodes;
+
+    VkBool32 flattenRecursive(const INodeSP& node, const int32_t parentIndex);
+
+    VkBool32 buildTransformHierarchy();
+
+    void detachTransformHierarchy();
+
 protected:
 
     //
@@ -83,6 +99,12 @@ public:
 
     virtual void setDirty() override;
 
+    virtual VkBool32 setFlattened(const VkBool32 flattened) override;
+
+    virtual VkBool32 isFlattened() const override;
+
+    virtual const SmartPointerVector<INodeSP>& getChangedNodes() const override;
+
     virtual void updateParameterRecursive(const Parameter* parameter) override;
 
     virtual void updateDescriptorSetsRecursive(const uint32_t allWriteDescriptorSetsCount, VkWriteDescriptorSet* allWriteDescriptorSets, const uint32_t currentBuffer) override;
@@ -28,16 +28,86 @@
 
 #include "Object.hpp"
 
+// Estimated update cost relative to a node without animation.
+#define VKTS_SCENE_COST_NODE 1.0f
+#define VKTS_SCENE_COST_CHANNEL 0.5f
+#define VKTS_SCENE_COST_SUB_MESH 0.25f
+
+// More chunks than threads, so threads finishing early take over remaining chunks.
+#define VKTS_SCENE_CHUNKS_PER_THREAD 4
+
 namespace vkts
 {
 
+static float sceneEstimateCost(const INodeSP& node)
+{
+    if (!node.get())
+    {
+        return 0.0f;
+    }
+
+    float cost = VKTS_SCENE_COST_NODE;
+
+    if (node->getCurrentAnimation() >= 0 && node->getCurrentAnimation() < (int32_t)node->getNumberAnimations())
+    {
+        const auto& currentAnimation = node->getAnimations()[node->getCurrentAnimation()];
+
+        // A baked clip samples all channels of the node at once.
+        cost += VKTS_SCENE_COST_CHANNEL * (float)(currentAnimation->getClip().get() ? 1 : currentAnimation->getNumberChannels());
+    }
+
+    for (uint32_t i = 0; i < node->getNumberMeshes(); i++)
+    {
+        cost += VKTS_SCENE_COST_SUB_MESH * (float)node->getMeshes()[i]->getNumberSubMeshes();
+    }
+
+    for (uint32_t i = 0; i < node->getNumberChildNodes(); i++)
+    {
+        cost += sceneEstimateCost(node->getChildNodes()[i]);
+    }
+
+    return cost;
+}
+
+static void sceneAssignNodeIndices(const INodeSP& node, int32_t& nodeCount)
+{
+    if (!node.get())
+    {
+        return;
+    }
+
+    if (node->getNodeIndex() < 0)
+    {
+        node->setNodeIndex(nodeCount);
+
+        nodeCount++;
+    }
+
+    for (uint32_t i = 0; i < node->getNumberChildNodes(); i++)
+    {
+        sceneAssignNodeIndices(node->getChildNodes()[i], nodeCount);
+    }
+}
+
+void Scene::updatePartitionCosts()
+{
+    updatePartition.setCount(allObjects.size());
+
+    for (uint32_t i = 0; i < allObjects.size(); i++)
+    {
+        updatePartition.setCost(i, sceneEstimateCost(allObjects[i]->getRootNode()));
+    }
+
+    updatePartitionDirty = VK_FALSE;
+}
+
 Scene::Scene() :
-    IScene(), name(""), allObjects(), allCameras(), allLights(), environment(nullptr), diffuseEnvironment(nullptr), specularEnvironment(nullptr), lut(nullptr), environmentStrength(1.0f), maxLuminance(1.0f)
+    IScene(), name(""), allObjects(), allCameras(), allLights(), environment(nullptr), diffuseEnvironment(nullptr), specularEnvironment(nullptr), lut(nullptr), environmentStrength(1.0f), maxLuminance(1.0f), bvh(), bvhDirty(VK_TRUE), updatePartition(), updatePartitionDirty(VK_TRUE), nodeCount(0)
 {
 }
 
 Scene::Scene(const Scene& other) :
-    IScene(), name(other.name + "_clone")
+    IScene(), name(other.name + "_clone"), bvh(), bvhDirty(VK_TRUE), updatePartition(), updatePartitionDirty(VK_TRUE), nodeCount(0)
 {
     for (uint32_t i = 0; i < other.allObjects.size(); i++)
     {
@@ -63,6 +133,8 @@ Scene::Scene(const Scene& other) :
             break;
         }
 
+        sceneAssignNodeIndices(cloneObject->getRootNode(), nodeCount);
+
         allObjects.append(cloneObject);
     }
 
@@ -150,11 +222,24 @@ void Scene::setName(const std::string& name)
 
 void Scene::addObject(const IObjectSP& object)
 {
+    if (object.get())
+    {
+        sceneAssignNodeIndices(object->getRootNode(), nodeCount);
+    }
+
     allObjects.append(object);
+
+    bvhDirty = VK_TRUE;
+
+    updatePartitionDirty = VK_TRUE;
 }
 
 VkBool32 Scene::removeObject(const IObjectSP& object)
 {
+    bvhDirty = VK_TRUE;
+
+    updatePartitionDirty = VK_TRUE;
+
     return allObjects.remove(object);
 }
 
@@ -309,6 +394,45 @@ float Scene::getMaxLuminance() const
     return maxLuminance;
 }
 
+void Scene::updateBoundingVolumeHierarchy()
+{
+    if (bvhDirty || bvh.getSize() != allObjects.size())
+    {
+        std::vector<Aabb> allBoxes(allObjects.size());
+
+        for (uint32_t i = 0; i < allObjects.size(); i++)
+        {
+            if (allObjects[i]->getRootNode().get())
+            {
+                allBoxes[i] = allObjects[i]->getRootNode()->getBoundingBox();
+            }
+        }
+
+        bvh.build(allBoxes);
+
+        bvhDirty = VK_FALSE;
+
+        return;
+    }
+
+    // Unchanged boxes are ignored, so only moved objects are refitted.
+
+    for (uint32_t i = 0; i < allObjects.size(); i++)
+    {
+        if (allObjects[i]->getRootNode().get())
+        {
+            bvh.setBox(i, allObjects[i]->getRootNode()->getBoundingBox());
+        }
+    }
+
+    bvh.refit();
+}
+
+const Bvh& Scene::getBoundingVolumeHierarchy() const
+{
+    return bvh;
+}
+
 void Scene::updateParameterRecursive(const Parameter* parameter, const uint32_t objectOffset, const uint32_t objectStep, const uint32_t objectLimit)
 {
 	if (parameter)
@@ -355,6 +479,28 @@ void Scene::updateTransformRecursive(const double deltaTime, const uint64_t delt
     }
 }
 
+VkBool32 Scene::updateParallel(const IUpdateThreadContext& updateContext, const double deltaTime, const uint64_t deltaTicks, const double tickTime, const uint32_t currentBuffer)
+{
+    if (updatePartitionDirty || updatePartition.getCount() != allObjects.size())
+    {
+        updatePartitionCosts();
+    }
+
+    // Objects do not share any state, so each chunk can be updated by another thread.
+
+    auto rangeFunction = [&](const uint32_t first, const uint32_t last) -> VkBool32
+    {
+        for (uint32_t i = first; i < last; i++)
+        {
+            allObjects[i]->updateTransformRecursive(deltaTime, deltaTicks, tickTime, currentBuffer);
+        }
+
+        return VK_TRUE;
+    };
+
+    return updatePartition.process(updateContext, (engineGetTaskExecutorCount() + 1) * VKTS_SCENE_CHUNKS_PER_THREAD, rangeFunction);
+}
+
 void Scene::drawRecursive(const ICommandBuffersSP& cmdBuffer, const SmartPointerVector<IGraphicsPipelineSP>& allGraphicsPipelines, const uint32_t currentBuffer, const std::map<uint32_t, VkTsDynamicOffset>& dynamicOffsetMappings, const OverwriteDraw* renderOverwrite, const uint32_t objectOffset, const uint32_t objectStep, const uint32_t objectLimit)
 {
     const OverwriteDraw* currentOverwrite = renderOverwrite;
@@ -451,6 +597,13 @@ void Scene::destroy()
 	    }
 	    allObjects.clear();
 
+	    bvh.reset();
+	    bvhDirty = VK_TRUE;
+
+	    updatePartitionDirty = VK_TRUE;
+
+	    nodeCount = 0;
+
 	    allCameras.clear();
 
 	    allLights.clear();
@@ -57,6 +57,17 @@ private:
 
     float maxLuminance;
 
+    Bvh bvh;
+    VkBool32 bvhDirty;
+
+    TaskPartition updatePartition;
+    VkBool32 updatePartitionDirty;
+
+    // Next free node index. Indices of removed objects are not reused.
+    int32_t nodeCount;
+
+    void updatePartitionCosts();
+
 public:
 
     Scene();
@@ -134,6 +145,10 @@ public:
 
     virtual float getMaxLuminance() const override;
 
+    virtual void updateBoundingVolumeHierarchy() override;
+
+    virtual const Bvh& getBoundingVolumeHierarchy() const override;
+
     //
 
     virtual void updateParameterRecursive(const Parameter* parameter, const uint32_t objectOffset = 0, const uint32_t objectStep = 1, const uint32_t objectLimit = UINT32_MAX) override;
@@ -142,6 +157,8 @@ public:
 
     virtual void updateTransformRecursive(const double deltaTime, const uint64_t deltaTicks, const double tickTime, const uint32_t currentBuffer = 0, const uint32_t objectOffset = 0, const uint32_t objectStep = 1, const uint32_t objectLimit = UINT32_MAX) override;
 
+    virtual VkBool32 updateParallel(const IUpdateThreadContext& updateContext, const double deltaTime, const uint64_t deltaTicks, const double tickTime, const uint32_t currentBuffer = 0) override;
+
     virtual void drawRecursive(const ICommandBuffersSP& cmdBuffer, const SmartPointerVector<IGraphicsPipelineSP>& allGraphicsPipelines, const uint32_t currentBuffer, const std::map<uint32_t, VkTsDynamicOffset>& dynamicOffsetMappings, const OverwriteDraw* renderOverwrite, const uint32_t objectOffset = 0, const uint32_t objectStep = 1, const uint32_t objectLimit = UINT32_MAX) override;
 
     //
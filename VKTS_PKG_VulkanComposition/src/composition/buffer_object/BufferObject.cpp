@@ -29,8 +29,22 @@
 namespace vkts
 {
 
+VkDeviceSize BufferObject::getNonCoherentAtomSize(const IContextObjectSP& contextObject)
+{
+    if (!contextObject.get() || !contextObject->getPhysicalDevice().get())
+    {
+        return 1;
+    }
+
+    VkPhysicalDeviceProperties physicalDeviceProperties;
+
+    contextObject->getPhysicalDevice()->getPhysicalDeviceProperties(physicalDeviceProperties);
+
+    return physicalDeviceProperties.limits.nonCoherentAtomSize;
+}
+
 BufferObject::BufferObject(const IContextObjectSP& contextObject, const IBufferSP& buffer, const IBufferViewSP& bufferView, const IDeviceMemorySP& deviceMemory, const VkDeviceSize bufferCount) :
-    IBufferObject(), contextObject(contextObject), buffer(buffer), bufferView(bufferView), deviceMemory(deviceMemory), bufferCount(bufferCount)
+    IBufferObject(), contextObject(contextObject), buffer(buffer), bufferView(bufferView), deviceMemory(deviceMemory), bufferCount(bufferCount), uploadRing((buffer.get() && bufferCount > 0) ? buffer->getSize() / bufferCount : 0, (uint32_t)bufferCount, getNonCoherentAtomSize(contextObject)), mappedData(nullptr), collecting(VK_FALSE), allFlushRanges()
 {
 }
 
@@ -68,24 +82,116 @@ const IDeviceMemorySP& BufferObject::getDeviceMemory() const
     return deviceMemory;
 }
 
-VkBool32 BufferObject::upload(const uint32_t offset, const VkMemoryMapFlags flags, const void* data, const uint32_t size) const
+void BufferObject::reset(const uint32_t currentBuffer) const
 {
-    if (!data || size == 0)
+    uploadRing.reset(currentBuffer);
+
+    collecting = VK_TRUE;
+}
+
+VkBool32 BufferObject::allocate(uint32_t& offset, const uint32_t size, const uint32_t alignment) const
+{
+    VkDeviceSize ringOffset;
+
+    if (!uploadRing.allocate(ringOffset, size, alignment))
     {
+        logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Could not allocate %u bytes.", size);
+
         return VK_FALSE;
     }
 
-    VkResult result;
+    offset = (uint32_t)ringOffset;
+
+    return VK_TRUE;
+}
+
+VkBool32 BufferObject::flush() const
+{
+    collecting = VK_FALSE;
+
+    if (!uploadRing.isDirty())
+    {
+        return VK_TRUE;
+    }
+
+    uploadRing.getFlushRanges(allFlushRanges);
+
+    // Flushed together with the other buffer objects at the end of the frame.
+    if (contextObject.get())
+    {
+        if (!contextObject->addFlushRanges(deviceMemory, (uint32_t)allFlushRanges.size(), &allFlushRanges[0]))
+        {
+            logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Could not add flush ranges.");
+
+            return VK_FALSE;
+        }
+
+        return VK_TRUE;
+    }
+
+    return flushRanges();
+}
 
-    result = deviceMemory->upload(offset, flags, data, size);
+VkBool32 BufferObject::flushRanges() const
+{
+    VkResult result = deviceMemory->flushMappedMemoryRanges((uint32_t)allFlushRanges.size(), &allFlushRanges[0]);
 
     if (result != VK_SUCCESS)
     {
-        logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Could not unmap memory.");
+        logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Could not flush memory.");
+
+        return VK_FALSE;
+    }
+
+    return VK_TRUE;
+}
+
+VkBool32 BufferObject::upload(const uint32_t offset, const VkMemoryMapFlags flags, const void* data, const uint32_t size) const
+{
+    if (!data || size == 0 || !deviceMemory.get())
+    {
+        return VK_FALSE;
+    }
+
+    if ((VkDeviceSize)offset + (VkDeviceSize)size > deviceMemory->getAllocationSize())
+    {
+        logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Upload out of range.");
 
         return VK_FALSE;
     }
 
+    // Mapped once, as the memory stays mapped for its lifetime.
+    if (!mappedData)
+    {
+        VkResult result = deviceMemory->mapMemory(0, VK_WHOLE_SIZE, flags);
+
+        if (result != VK_SUCCESS)
+        {
+            logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Could not map memory.");
+
+            return VK_FALSE;
+        }
+
+        mappedData = (uint8_t*)deviceMemory->getMemory();
+    }
+
+    memcpy(mappedData + offset, data, size);
+
+    profileAddUpload(size);
+
+    if (!(deviceMemory->getMemoryPropertyFlags() & VK_MEMORY_PROPERTY_HOST_COHERENT_BIT))
+    {
+        uploadRing.addDirtyRange(offset, size);
+
+        // Uploads outside of a frame are flushed at once.
+        if (!collecting)
+        {
+            uploadRing.getFlushRanges(allFlushRanges);
+
+            return flushRanges();
+        }
+    }
+
     return VK_TRUE;
 }
 
@@ -137,6 +243,8 @@ VkBool32 BufferObject::upload(const uint32_t offset, const VkMemoryMapFlags flag
 
 void BufferObject::destroy()
 {
+	mappedData = nullptr;
+
 	bufferView.reset();
 
 	buffer.reset();
@@ -47,6 +47,20 @@ private:
 
     const VkDeviceSize bufferCount;
 
+    // Uploads do write to the persistently mapped memory, so they are tracked by the ring.
+
+    mutable UploadRing uploadRing;
+
+    mutable uint8_t* mappedData;
+
+    mutable VkBool32 collecting;
+
+    mutable std::vector<VkTsMemoryRange> allFlushRanges;
+
+    static VkDeviceSize getNonCoherentAtomSize(const IContextObjectSP& contextObject);
+
+    VkBool32 flushRanges() const;
+
 public:
 
     BufferObject() = delete;
@@ -73,6 +87,12 @@ public:
 
     virtual const IDeviceMemorySP& getDeviceMemory() const override;
 
+    virtual void reset(const uint32_t currentBuffer) const override;
+
+    virtual VkBool32 allocate(uint32_t& offset, const uint32_t size, const uint32_t alignment) const override;
+
+    virtual VkBool32 flush() const override;
+
     virtual VkBool32 upload(const uint32_t offset, const VkMemoryMapFlags flags, const void* data, const uint32_t size) const override;
 
     virtual VkBool32 upload(const uint32_t offset, const VkMemoryMapFlags flags, const glm::mat4& mat) const override;
@@ -79,7 +79,7 @@ static VkBool32 bufferObjectPrepare(IBufferSP& buffer, IDeviceMemorySP& deviceMe
         return VK_FALSE;
     }
 
-    result = buffer->bindBufferMemory(deviceMemory->getDeviceMemory(), 0);
+    result = buffer->bindBufferMemory(deviceMemory->getDeviceMemory(), deviceMemory->getOffset());
 
     if (result != VK_SUCCESS)
     {
@@ -171,6 +171,51 @@ IBufferObjectSP VKTS_APIENTRY bufferObjectCreate(IBufferSP& stageBuffer, IDevice
     return IBufferObjectSP(newInstance);
 }
 
+IBufferObjectSP VKTS_APIENTRY bufferObjectCreate(const IUploadManagerSP& uploadManager, const IContextObjectSP& contextObject, const IBinaryBufferSP& binaryBuffer, const VkBufferCreateInfo& bufferCreateInfo, const VkAccessFlags dstAccessMask, const VkMemoryPropertyFlags memoryPropertyFlag)
+{
+    if (!uploadManager.get() || !contextObject.get() || !binaryBuffer.get() || (memoryPropertyFlag & VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT))
+    {
+        return IBufferObjectSP();
+    }
+
+    VkDeviceSize bufferCount = 1;
+
+    //
+
+    IBufferSP buffer;
+
+    IDeviceMemorySP deviceMemory;
+
+    if (!bufferObjectPrepare(buffer, deviceMemory, contextObject, bufferCreateInfo, memoryPropertyFlag, bufferCount))
+    {
+        return IBufferObjectSP();
+    }
+
+    //
+
+    if (!uploadManager->uploadBuffer(buffer, 0, binaryBuffer->getData(), binaryBuffer->getSize(), dstAccessMask))
+    {
+        logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Could not upload buffer data.");
+
+        return IBufferObjectSP();
+    }
+
+    //
+
+    IBufferViewSP noBufferView;
+
+    auto newInstance = new BufferObject(contextObject, buffer, noBufferView, deviceMemory, bufferCount);
+
+    if (!newInstance)
+    {
+        buffer->destroy();
+
+        return IBufferObjectSP();
+    }
+
+    return IBufferObjectSP(newInstance);
+}
+
 IBufferObjectSP VKTS_APIENTRY bufferObjectCreate(const IContextObjectSP& contextObject, const VkBufferCreateInfo& bufferCreateInfo, const VkMemoryPropertyFlags memoryPropertyFlag, const VkDeviceSize bufferCount)
 {
     if (!contextObject.get() || bufferCount == 0)
@@ -29,8 +29,8 @@
 namespace vkts
 {
 
-CommandObject::CommandObject(const ICommandBuffersSP& cmdBuffer) :
-    ICommandObject(), cmdBuffer(cmdBuffer)
+CommandObject::CommandObject(const ICommandBuffersSP& cmdBuffer, const IUploadManagerSP& uploadManager) :
+    ICommandObject(), cmdBuffer(cmdBuffer), uploadManager(uploadManager)
 {
 }
 
@@ -48,6 +48,11 @@ const ICommandBuffersSP& CommandObject::getCommandBuffer() const
     return cmdBuffer;
 }
 
+const IUploadManagerSP& CommandObject::getUploadManager() const
+{
+    return uploadManager;
+}
+
 void CommandObject::addStageImage(const IImageSP& stageImage)
 {
     if (stageImage.get())
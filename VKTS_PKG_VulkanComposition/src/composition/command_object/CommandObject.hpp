@@ -39,6 +39,8 @@ private:
 
 	const ICommandBuffersSP cmdBuffer;
 
+	const IUploadManagerSP uploadManager;
+
     //
 
     SmartPointerVector<IImageSP> allStageImages;
@@ -48,7 +50,7 @@ private:
 public:
 
     CommandObject() = delete;
-    explicit CommandObject(const ICommandBuffersSP& cmdBuffer);
+    CommandObject(const ICommandBuffersSP& cmdBuffer, const IUploadManagerSP& uploadManager);
     CommandObject(const CommandObject& other) = delete;
     CommandObject(CommandObject&& other) = delete;
     virtual ~CommandObject();
@@ -63,6 +65,8 @@ public:
 
     virtual const ICommandBuffersSP& getCommandBuffer() const override;
 
+    virtual const IUploadManagerSP& getUploadManager() const override;
+
     //
 
     virtual void addStageImage(const IImageSP& stageImage) override;
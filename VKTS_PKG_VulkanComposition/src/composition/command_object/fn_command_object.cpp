@@ -30,14 +30,14 @@
 namespace vkts
 {
 
-ICommandObjectSP VKTS_APIENTRY commandObjectCreate(const ICommandBuffersSP& cmdBuffer)
+ICommandObjectSP VKTS_APIENTRY commandObjectCreate(const ICommandBuffersSP& cmdBuffer, const IUploadManagerSP& uploadManager)
 {
     if (!cmdBuffer.get())
     {
         return ICommandObjectSP();
     }
 
-    return ICommandObjectSP(new CommandObject(cmdBuffer));
+    return ICommandObjectSP(new CommandObject(cmdBuffer, uploadManager));
 }
 
 }
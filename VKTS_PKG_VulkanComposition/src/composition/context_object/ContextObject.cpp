@@ -29,9 +29,20 @@
 namespace vkts
 {
 
-ContextObject::ContextObject(const IInstanceSP& instance, const IPhysicalDeviceSP& physicalDevice, const IDeviceSP& device, const IQueueSP& queue, const VkBool32 manage) :
-    IContextObject(), instance(instance), physicalDevice(physicalDevice), device(device), queue(queue), manage(manage)
+ContextObject::ContextObject(const IInstanceSP& instance, const IPhysicalDeviceSP& physicalDevice, const IDeviceSP& device, const IQueueSP& queue, const VkBool32 manage, const IQueueSP& transferQueue) :
+    IContextObject(), instance(instance), physicalDevice(physicalDevice), device(device), queue(queue), transferQueue(transferQueue.get() ? transferQueue : queue), manage(manage), flushMutex(), allFlushRanges(), allFlushMemories()
 {
+	// Only the owner of the device does sub-allocate its memory, as the blocks have to be freed before the device is destroyed.
+	if (manage && physicalDevice.get() && device.get())
+	{
+		VkPhysicalDeviceProperties physicalDeviceProperties;
+		physicalDevice->getPhysicalDeviceProperties(physicalDeviceProperties);
+
+		VkPhysicalDeviceMemoryProperties physicalDeviceMemoryProperties;
+		physicalDevice->getPhysicalDeviceMemoryProperties(physicalDeviceMemoryProperties);
+
+		deviceMemoryInitAllocator(device->getDevice(), physicalDeviceMemoryProperties, physicalDeviceProperties.limits.bufferImageGranularity, physicalDeviceProperties.limits.nonCoherentAtomSize);
+	}
 }
 
 ContextObject::~ContextObject()
@@ -78,14 +89,119 @@ const IQueueSP& ContextObject::getQueue() const
     return queue;
 }
 
+const IQueueSP& ContextObject::getTransferQueue() const
+{
+    return transferQueue;
+}
+
+VkBool32 ContextObject::addFlushRanges(const IDeviceMemorySP& deviceMemory, const uint32_t rangeCount, const VkTsMemoryRange* ranges)
+{
+    if (!deviceMemory.get())
+    {
+        return VK_FALSE;
+    }
+
+    std::lock_guard<std::mutex> flushLock(flushMutex);
+
+    const size_t previousSize = allFlushRanges.size();
+
+    if (!deviceMemory->getMappedMemoryRanges(allFlushRanges, rangeCount, ranges))
+    {
+        allFlushRanges.resize(previousSize);
+
+        return VK_FALSE;
+    }
+
+    if (allFlushRanges.size() > previousSize)
+    {
+        allFlushMemories.push_back(std::make_pair(deviceMemory, (uint32_t)(allFlushRanges.size() - previousSize)));
+    }
+
+    return VK_TRUE;
+}
+
+VkBool32 ContextObject::flushMappedMemoryRanges()
+{
+    std::lock_guard<std::mutex> flushLock(flushMutex);
+
+    if (allFlushRanges.size() == 0)
+    {
+        return VK_TRUE;
+    }
+
+    if (!device.get())
+    {
+        allFlushRanges.clear();
+        allFlushMemories.clear();
+
+        return VK_FALSE;
+    }
+
+    // Ranges of memory, which was destroyed explicitly in the meantime, are dropped, as their handle is not valid anymore.
+
+    size_t validRangeCount = 0;
+    size_t rangeIndex = 0;
+
+    for (size_t i = 0; i < allFlushMemories.size(); i++)
+    {
+        const uint32_t rangeCount = allFlushMemories[i].second;
+
+        if (allFlushMemories[i].first->getDeviceMemory() == allFlushRanges[rangeIndex].memory)
+        {
+            for (uint32_t k = 0; k < rangeCount; k++)
+            {
+                allFlushRanges[validRangeCount++] = allFlushRanges[rangeIndex + k];
+            }
+        }
+
+        rangeIndex += rangeCount;
+    }
+
+    VkResult result = VK_SUCCESS;
+
+    if (validRangeCount > 0)
+    {
+        profileAddFlush((uint64_t)validRangeCount);
+
+        result = vkFlushMappedMemoryRanges(device->getDevice(), (uint32_t)validRangeCount, &allFlushRanges[0]);
+    }
+
+    // Kept for the next frame, so the memory is reused.
+    allFlushRanges.clear();
+
+    // Released after the flush, as this can free the memory.
+    allFlushMemories.clear();
+
+    if (result != VK_SUCCESS)
+    {
+        logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Could not flush memory.");
+
+        return VK_FALSE;
+    }
+
+    return VK_TRUE;
+}
+
 void ContextObject::destroyDevice()
 {
+	{
+		std::lock_guard<std::mutex> flushLock(flushMutex);
+
+		// The memory has to be freed before the device is destroyed.
+		allFlushRanges.clear();
+		allFlushMemories.clear();
+	}
+
+	transferQueue.reset();
+
 	queue.reset();
 
     if (device.get())
     {
     	if (manage)
     	{
+    		deviceMemoryTerminateAllocator(device->getDevice());
+
     		device->destroy();
     	}
 
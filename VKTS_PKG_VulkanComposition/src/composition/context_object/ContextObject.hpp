@@ -45,12 +45,21 @@ private:
 
     IQueueSP queue;
 
+    IQueueSP transferQueue;
+
     VkBool32 manage;
 
+    std::mutex flushMutex;
+
+    std::vector<VkMappedMemoryRange> allFlushRanges;
+
+    // Keeps the memory of the collected ranges alive until they are flushed. Second is the number of ranges.
+    std::vector<std::pair<IDeviceMemorySP, uint32_t>> allFlushMemories;
+
 public:
 
     ContextObject() = delete;
-    ContextObject(const IInstanceSP& instance, const IPhysicalDeviceSP& physicalDevice, const IDeviceSP& device, const IQueueSP& queue, const VkBool32 manage);
+    ContextObject(const IInstanceSP& instance, const IPhysicalDeviceSP& physicalDevice, const IDeviceSP& device, const IQueueSP& queue, const VkBool32 manage, const IQueueSP& transferQueue);
     ContextObject(const ContextObject& other) = delete;
     ContextObject(ContextObject&& other) = delete;
     virtual ~ContextObject();
@@ -72,6 +81,12 @@ public:
 
     virtual const IQueueSP& getQueue() const override;
 
+    virtual const IQueueSP& getTransferQueue() const override;
+
+    virtual VkBool32 addFlushRanges(const IDeviceMemorySP& deviceMemory, const uint32_t rangeCount, const VkTsMemoryRange* ranges) override;
+
+    virtual VkBool32 flushMappedMemoryRanges() override;
+
     virtual void destroyDevice() override;
 
     //
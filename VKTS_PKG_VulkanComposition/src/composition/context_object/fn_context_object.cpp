@@ -30,14 +30,14 @@
 namespace vkts
 {
 
-IContextObjectSP VKTS_APIENTRY contextObjectCreate(const IInstanceSP& instance, const IPhysicalDeviceSP& physicalDevice, const IDeviceSP& device, const IQueueSP& queue, const VkBool32 manage)
+IContextObjectSP VKTS_APIENTRY contextObjectCreate(const IInstanceSP& instance, const IPhysicalDeviceSP& physicalDevice, const IDeviceSP& device, const IQueueSP& queue, const VkBool32 manage, const IQueueSP& transferQueue)
 {
     if (!instance.get() || !physicalDevice.get() || !device.get() || !queue.get())
     {
         return IContextObjectSP();
     }
 
-    auto newInstance = new ContextObject(instance, physicalDevice, device, queue, manage);
+    auto newInstance = new ContextObject(instance, physicalDevice, device, queue, manage, transferQueue);
 
     if (!newInstance)
     {
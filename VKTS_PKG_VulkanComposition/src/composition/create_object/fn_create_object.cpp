@@ -136,6 +136,13 @@ IImageObjectSP VKTS_APIENTRY createImageObject(const IAssetManagerSP& assetManag
 
 	//
 
+	const auto& uploadManager = assetManager->getCommandObject()->getUploadManager();
+
+	if (uploadManager.get() && imageTiling == VK_IMAGE_TILING_OPTIMAL && !(memoryPropertyFlags & VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT))
+	{
+		return imageObjectCreate(uploadManager, assetManager->getContextObject(), imageObjectName, imageData, imageCreateInfo, VK_ACCESS_SHADER_READ_BIT, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, subresourceRange, memoryPropertyFlags);
+	}
+
 	IDeviceMemorySP stageDeviceMemory;
 	IImageSP stageImage;
 	IBufferSP stageBuffer;
@@ -343,15 +350,26 @@ ITextureObjectSP VKTS_APIENTRY createTextureObject(const IAssetManagerSP& assetM
 
     VkImageSubresourceRange subresourceRange = {VK_IMAGE_ASPECT_COLOR_BIT, 0, imageData->getMipLevels(), 0, imageData->getArrayLayers()};
 
-    IDeviceMemorySP stageDeviceMemory;
-    IBufferSP stageBuffer;
-    IImageSP stageImage;
+    IImageObjectSP imageObject;
 
-    auto imageObject = imageObjectCreate(stageImage, stageBuffer, stageDeviceMemory, assetManager->getContextObject(), assetManager->getCommandObject()->getCommandBuffer(), imageObjectName, imageData, imageCreateInfo, srcAccessMask, VK_ACCESS_SHADER_READ_BIT, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, subresourceRange, memoryPropertyFlags);
+    const auto& uploadManager = assetManager->getCommandObject()->getUploadManager();
 
-    assetManager->getCommandObject()->addStageImage(stageImage);
-    assetManager->getCommandObject()->addStageBuffer(stageBuffer);
-    assetManager->getCommandObject()->addStageDeviceMemory(stageDeviceMemory);
+    if (uploadManager.get() && imageTiling == VK_IMAGE_TILING_OPTIMAL && !(memoryPropertyFlags & VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT))
+    {
+        imageObject = imageObjectCreate(uploadManager, assetManager->getContextObject(), imageObjectName, imageData, imageCreateInfo, VK_ACCESS_SHADER_READ_BIT, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, subresourceRange, memoryPropertyFlags);
+    }
+    else
+    {
+        IDeviceMemorySP stageDeviceMemory;
+        IBufferSP stageBuffer;
+        IImageSP stageImage;
+
+        imageObject = imageObjectCreate(stageImage, stageBuffer, stageDeviceMemory, assetManager->getContextObject(), assetManager->getCommandObject()->getCommandBuffer(), imageObjectName, imageData, imageCreateInfo, srcAccessMask, VK_ACCESS_SHADER_READ_BIT, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, subresourceRange, memoryPropertyFlags);
+
+        assetManager->getCommandObject()->addStageImage(stageImage);
+        assetManager->getCommandObject()->addStageBuffer(stageBuffer);
+        assetManager->getCommandObject()->addStageDeviceMemory(stageDeviceMemory);
+    }
 
     if (!imageObject.get())
     {
@@ -439,6 +457,13 @@ IBufferObjectSP VKTS_APIENTRY createIndexBufferObject(const IAssetManagerSP& ass
     bufferCreateInfo.queueFamilyIndexCount = 0;
     bufferCreateInfo.pQueueFamilyIndices = nullptr;
 
+    const auto& uploadManager = assetManager->getCommandObject()->getUploadManager();
+
+    if (uploadManager.get())
+    {
+        return bufferObjectCreate(uploadManager, assetManager->getContextObject(), binaryBuffer, bufferCreateInfo, VK_ACCESS_INDEX_READ_BIT, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
+    }
+
     IDeviceMemorySP stageDeviceMemory;
     IBufferSP stageBuffer;
 
@@ -463,6 +488,13 @@ IBufferObjectSP VKTS_APIENTRY createVertexBufferObject(const IAssetManagerSP& as
     bufferCreateInfo.queueFamilyIndexCount = 0;
     bufferCreateInfo.pQueueFamilyIndices = nullptr;
 
+    const auto& uploadManager = assetManager->getCommandObject()->getUploadManager();
+
+    if (uploadManager.get())
+    {
+        return bufferObjectCreate(uploadManager, assetManager->getContextObject(), binaryBuffer, bufferCreateInfo, VK_ACCESS_VERTEX_ATTRIBUTE_READ_BIT, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
+    }
+
     IDeviceMemorySP stageDeviceMemory;
     IBufferSP stageBuffer;
 
@@ -0,0 +1,1009 @@
+/**
+ * VKTS - VulKan ToolS.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) since 2014 Norbert Nopper
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "UploadManager.hpp"
+
+namespace vkts
+{
+
+VkDeviceSize UploadManager::getNonCoherentAtomSize(const IContextObjectSP& contextObject)
+{
+    if (!contextObject.get() || !contextObject->getPhysicalDevice().get())
+    {
+        return 1;
+    }
+
+    VkPhysicalDeviceProperties physicalDeviceProperties;
+
+    contextObject->getPhysicalDevice()->getPhysicalDeviceProperties(physicalDeviceProperties);
+
+    return physicalDeviceProperties.limits.nonCoherentAtomSize;
+}
+
+VkBool32 UploadManager::createStageBuffer(IBufferSP& buffer, IDeviceMemorySP& deviceMemory, const VkDeviceSize size) const
+{
+    VkResult result;
+
+    buffer = bufferCreate(contextObject->getDevice()->getDevice(), 0, size, VK_BUFFER_USAGE_TRANSFER_SRC_BIT, VK_SHARING_MODE_EXCLUSIVE, 0, nullptr);
+
+    if (!buffer.get())
+    {
+        logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Could not create buffer.");
+
+        return VK_FALSE;
+    }
+
+    VkMemoryRequirements memoryRequirements;
+
+    buffer->getBufferMemoryRequirements(memoryRequirements);
+
+    VkPhysicalDeviceMemoryProperties physicalDeviceMemoryProperties;
+    contextObject->getPhysicalDevice()->getPhysicalDeviceMemoryProperties(physicalDeviceMemoryProperties);
+
+    deviceMemory = deviceMemoryCreate(contextObject->getDevice()->getDevice(), memoryRequirements, physicalDeviceMemoryProperties.memoryTypeCount, physicalDeviceMemoryProperties.memoryTypes, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
+
+    if (!deviceMemory.get())
+    {
+        logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Could not allocate memory.");
+
+        return VK_FALSE;
+    }
+
+    result = buffer->bindBufferMemory(deviceMemory->getDeviceMemory(), deviceMemory->getOffset());
+
+    if (result != VK_SUCCESS)
+    {
+        logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Could not bind buffer memory.");
+
+        return VK_FALSE;
+    }
+
+    result = deviceMemory->mapMemory(0, VK_WHOLE_SIZE, 0);
+
+    if (result != VK_SUCCESS)
+    {
+        logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Could not map memory.");
+
+        return VK_FALSE;
+    }
+
+    return VK_TRUE;
+}
+
+VkBool32 UploadManager::beginBatch(std::vector<UploadCallback>& allFinishedCallbacks)
+{
+    UploadBatch& batch = allBatches[currentBatch];
+
+    if (batch.state == UPLOAD_BATCH_RECORDING)
+    {
+        return VK_TRUE;
+    }
+
+    // The batches are used round robin, so a submitted batch is the oldest one in flight.
+    if (batch.state == UPLOAD_BATCH_SUBMITTED)
+    {
+        if (!retire(batch.lastTicket, VK_TRUE, allFinishedCallbacks))
+        {
+            return VK_FALSE;
+        }
+    }
+
+    stageRing.reset(currentBatch);
+
+    if (batch.transferCmdBuffer->reset() != VK_SUCCESS || batch.transferCmdBuffer->beginCommandBuffer(VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT, VK_NULL_HANDLE, 0, VK_NULL_HANDLE, VK_FALSE, 0, 0) != VK_SUCCESS)
+    {
+        logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Could not begin command buffer.");
+
+        return VK_FALSE;
+    }
+
+    if (ownershipTransfer)
+    {
+        if (batch.acquireCmdBuffer->reset() != VK_SUCCESS || batch.acquireCmdBuffer->beginCommandBuffer(VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT, VK_NULL_HANDLE, 0, VK_NULL_HANDLE, VK_FALSE, 0, 0) != VK_SUCCESS)
+        {
+            logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Could not begin command buffer.");
+
+            return VK_FALSE;
+        }
+    }
+
+    batch.state = UPLOAD_BATCH_RECORDING;
+    batch.uploadCount = 0;
+    batch.firstTicket = 0;
+    batch.lastTicket = 0;
+
+    return VK_TRUE;
+}
+
+VkBool32 UploadManager::stage(VkBuffer& buffer, VkDeviceSize& offset, const void* data, const VkDeviceSize size, const VkDeviceSize alignment, std::vector<UploadCallback>& allFinishedCallbacks)
+{
+    // The ring only aligns to powers of two, so other alignments e.g. of three component texels are padded.
+    const VkDeviceSize padding = (alignment & (alignment - 1)) ? alignment : 0;
+    const VkDeviceSize ringAlignment = padding ? 4 : alignment;
+
+    if (size + padding + ringAlignment <= stageRing.getFrameSize())
+    {
+        if (!beginBatch(allFinishedCallbacks))
+        {
+            return VK_FALSE;
+        }
+
+        if (!stageRing.allocate(offset, size + padding, ringAlignment))
+        {
+            // Segment is full, so the batch is submitted and the next one is recorded.
+
+            if (!submitBatch(allFinishedCallbacks) || !beginBatch(allFinishedCallbacks))
+            {
+                return VK_FALSE;
+            }
+
+            if (!stageRing.allocate(offset, size + padding, ringAlignment))
+            {
+                logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Could not allocate %llu bytes.", (unsigned long long)size);
+
+                return VK_FALSE;
+            }
+        }
+
+        if (padding)
+        {
+            offset = ((offset + alignment - 1) / alignment) * alignment;
+        }
+
+        memcpy(stageData + offset, data, (size_t)size);
+
+        if (!(stageDeviceMemory->getMemoryPropertyFlags() & VK_MEMORY_PROPERTY_HOST_COHERENT_BIT))
+        {
+            stageRing.addDirtyRange(offset, size);
+        }
+
+        buffer = stageBuffer->getBuffer();
+
+        return VK_TRUE;
+    }
+
+    // Too large for a segment, so the upload gets its own staging buffer, which is released with the batch.
+
+    if (!beginBatch(allFinishedCallbacks))
+    {
+        return VK_FALSE;
+    }
+
+    IBufferSP dedicatedStageBuffer;
+    IDeviceMemorySP dedicatedStageDeviceMemory;
+
+    if (!createStageBuffer(dedicatedStageBuffer, dedicatedStageDeviceMemory, size))
+    {
+        return VK_FALSE;
+    }
+
+    memcpy(dedicatedStageDeviceMemory->getMemory(), data, (size_t)size);
+
+    if (!(dedicatedStageDeviceMemory->getMemoryPropertyFlags() & VK_MEMORY_PROPERTY_HOST_COHERENT_BIT))
+    {
+        if (dedicatedStageDeviceMemory->flushMappedMemoryRanges(0, VK_WHOLE_SIZE) != VK_SUCCESS)
+        {
+            logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Could not flush memory.");
+
+            return VK_FALSE;
+        }
+    }
+
+    allBatches[currentBatch].allStageBuffers.append(dedicatedStageBuffer);
+    allBatches[currentBatch].allStageDeviceMemories.append(dedicatedStageDeviceMemory);
+
+    dedicatedStageCount++;
+
+    buffer = dedicatedStageBuffer->getBuffer();
+    offset = 0;
+
+    return VK_TRUE;
+}
+
+uint64_t UploadManager::endUpload(UploadBatch& batch, const VkDeviceSize size, const UploadCallbackFunction& callback)
+{
+    const uint64_t ticket = nextTicket++;
+
+    if (batch.uploadCount == 0)
+    {
+        batch.firstTicket = ticket;
+    }
+
+    batch.uploadCount++;
+    batch.lastTicket = ticket;
+
+    if (callback)
+    {
+        batch.allCallbacks.push_back(UploadCallback{ticket, callback, VK_FALSE});
+    }
+
+    uploadCount++;
+    uploadBytes += size;
+
+    profileAddUpload(size);
+
+    return ticket;
+}
+
+VkBool32 UploadManager::submitBatch(std::vector<UploadCallback>& allFinishedCallbacks)
+{
+    if (allBatches.size() == 0)
+    {
+        return VK_TRUE;
+    }
+
+    UploadBatch& batch = allBatches[currentBatch];
+
+    if (batch.state != UPLOAD_BATCH_RECORDING || batch.uploadCount == 0)
+    {
+        return VK_TRUE;
+    }
+
+    VkResult result;
+
+    if (stageRing.isDirty())
+    {
+        stageRing.getFlushRanges(allFlushRanges);
+
+        result = stageDeviceMemory->flushMappedMemoryRanges((uint32_t)allFlushRanges.size(), &allFlushRanges[0]);
+
+        if (result != VK_SUCCESS)
+        {
+            logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Could not flush memory.");
+
+            return VK_FALSE;
+        }
+    }
+
+    if (batch.transferCmdBuffer->endCommandBuffer() != VK_SUCCESS || (ownershipTransfer && batch.acquireCmdBuffer->endCommandBuffer() != VK_SUCCESS))
+    {
+        logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Could not end command buffer.");
+
+        return VK_FALSE;
+    }
+
+    if (batch.fence->resetFence() != VK_SUCCESS)
+    {
+        logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Could not reset fence.");
+
+        return VK_FALSE;
+    }
+
+    //
+
+    const VkSemaphore semaphore = ownershipTransfer ? batch.semaphore->getSemaphore() : VK_NULL_HANDLE;
+
+    VkSubmitInfo submitInfo{};
+
+    submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+
+    submitInfo.waitSemaphoreCount = 0;
+    submitInfo.pWaitSemaphores = nullptr;
+    submitInfo.pWaitDstStageMask = nullptr;
+    submitInfo.commandBufferCount = 1;
+    submitInfo.pCommandBuffers = batch.transferCmdBuffer->getCommandBuffers();
+    submitInfo.signalSemaphoreCount = ownershipTransfer ? 1 : 0;
+    submitInfo.pSignalSemaphores = ownershipTransfer ? &semaphore : nullptr;
+
+    result = transferQueue->submit(1, &submitInfo, ownershipTransfer ? VK_NULL_HANDLE : batch.fence->getFence());
+
+    const VkBool32 transferSubmitted = (result == VK_SUCCESS);
+
+    if (result == VK_SUCCESS && ownershipTransfer)
+    {
+        // The acquiring command buffer waits for the transfer and signals the fence.
+
+        VkPipelineStageFlags waitDstStageMask = VK_PIPELINE_STAGE_ALL_COMMANDS_BIT;
+
+        submitInfo.waitSemaphoreCount = 1;
+        submitInfo.pWaitSemaphores = &semaphore;
+        submitInfo.pWaitDstStageMask = &waitDstStageMask;
+        submitInfo.commandBufferCount = 1;
+        submitInfo.pCommandBuffers = batch.acquireCmdBuffer->getCommandBuffers();
+        submitInfo.signalSemaphoreCount = 0;
+        submitInfo.pSignalSemaphores = nullptr;
+
+        result = contextObject->getQueue()->submit(1, &submitInfo, batch.fence->getFence());
+    }
+
+    if (result != VK_SUCCESS)
+    {
+        logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Could not submit queue.");
+
+        // Older batches are completed first, as tickets complete in order.
+        retire(submittedTicket, VK_TRUE, allFinishedCallbacks);
+
+        // Only acquiring failed, so the transfer is still reading the staging memory.
+        if (transferSubmitted)
+        {
+            transferQueue->waitIdle();
+        }
+
+        retireBatch(batch, VK_FALSE, allFinishedCallbacks);
+
+        return VK_FALSE;
+    }
+
+    batch.state = UPLOAD_BATCH_SUBMITTED;
+
+    submittedTicket = batch.lastTicket;
+
+    submitCount++;
+
+    currentBatch = (currentBatch + 1) % (uint32_t)allBatches.size();
+
+    return VK_TRUE;
+}
+
+void UploadManager::retireBatch(UploadBatch& batch, const VkBool32 success, std::vector<UploadCallback>& allFinishedCallbacks)
+{
+    if (!success && batch.uploadCount > 0)
+    {
+        allFailedTickets.push_back(UploadTicketRange{batch.firstTicket, batch.lastTicket});
+    }
+
+    for (auto& currentCallback : batch.allCallbacks)
+    {
+        currentCallback.success = success;
+
+        allFinishedCallbacks.push_back(currentCallback);
+    }
+
+    batch.allCallbacks.clear();
+
+    batch.allBuffers.clear();
+    batch.allImages.clear();
+
+    batch.allStageBuffers.clear();
+    batch.allStageDeviceMemories.clear();
+
+    batch.state = UPLOAD_BATCH_FREE;
+    batch.uploadCount = 0;
+
+    completedTicket = glm::max(completedTicket, batch.lastTicket);
+}
+
+VkBool32 UploadManager::retire(const uint64_t ticket, const VkBool32 wait, std::vector<UploadCallback>& allFinishedCallbacks)
+{
+    const uint32_t count = (uint32_t)allBatches.size();
+
+    // Starting after the recording batch, so the batches are visited in the order they were submitted.
+    for (uint32_t i = 0; i < count; i++)
+    {
+        UploadBatch& batch = allBatches[(currentBatch + i) % count];
+
+        if (batch.state != UPLOAD_BATCH_SUBMITTED)
+        {
+            continue;
+        }
+
+        VkResult result = batch.fence->getStatus();
+
+        if (result == VK_NOT_READY)
+        {
+            if (!wait || completedTicket >= ticket)
+            {
+                break;
+            }
+
+            result = batch.fence->waitForFence(UINT64_MAX);
+        }
+
+        if (result != VK_SUCCESS)
+        {
+            logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Could not wait for fence.");
+
+            // The fence can not tell, if the device is done, so the staging memory is released after the queues are idle.
+            transferQueue->waitIdle();
+
+            if (ownershipTransfer)
+            {
+                contextObject->getQueue()->waitIdle();
+            }
+
+            retireBatch(batch, VK_FALSE, allFinishedCallbacks);
+
+            return VK_FALSE;
+        }
+
+        retireBatch(batch, VK_TRUE, allFinishedCallbacks);
+    }
+
+    return VK_TRUE;
+}
+
+VkBool32 UploadManager::isFailedTicket(const uint64_t ticket) const
+{
+    for (const auto& currentFailedTickets : allFailedTickets)
+    {
+        if (ticket >= currentFailedTickets.firstTicket && ticket <= currentFailedTickets.lastTicket)
+        {
+            return VK_TRUE;
+        }
+    }
+
+    return VK_FALSE;
+}
+
+void UploadManager::callCallbacks(const std::vector<UploadCallback>& allFinishedCallbacks)
+{
+    for (const auto& currentCallback : allFinishedCallbacks)
+    {
+        currentCallback.callback(currentCallback.ticket, currentCallback.success);
+    }
+}
+
+UploadManager::UploadManager(const IContextObjectSP& contextObject, const IQueueSP& transferQueue, const VkDeviceSize stageSize, const uint32_t batchCount) :
+    IUploadManager(), contextObject(contextObject), transferQueue(transferQueue), ownershipTransfer(transferQueue->getQueueFamilyIndex() != contextObject->getQueue()->getQueueFamilyIndex()), stageSize(stageSize), batchCount(batchCount), transferCommandPool(), acquireCommandPool(), stageBuffer(), stageDeviceMemory(), stageData(nullptr), stageRing(stageSize / batchCount, batchCount, getNonCoherentAtomSize(contextObject)), allFlushRanges(), allBatches(), currentBatch(0), nextTicket(1), submittedTicket(0), completedTicket(0), allFailedTickets(), uploadCount(0), uploadBytes(0), submitCount(0), dedicatedStageCount(0), mutex()
+{
+}
+
+UploadManager::~UploadManager()
+{
+    destroy();
+}
+
+VkBool32 UploadManager::prepare()
+{
+    std::lock_guard<std::mutex> lock(mutex);
+
+    const VkDevice device = contextObject->getDevice()->getDevice();
+
+    transferCommandPool = commandPoolCreate(device, VK_COMMAND_POOL_CREATE_TRANSIENT_BIT | VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT, transferQueue->getQueueFamilyIndex());
+
+    if (!transferCommandPool.get())
+    {
+        logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Could not create command pool.");
+
+        return VK_FALSE;
+    }
+
+    if (ownershipTransfer)
+    {
+        acquireCommandPool = commandPoolCreate(device, VK_COMMAND_POOL_CREATE_TRANSIENT_BIT | VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT, contextObject->getQueue()->getQueueFamilyIndex());
+
+        if (!acquireCommandPool.get())
+        {
+            logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Could not create command pool.");
+
+            return VK_FALSE;
+        }
+    }
+
+    //
+
+    if (!createStageBuffer(stageBuffer, stageDeviceMemory, stageSize))
+    {
+        return VK_FALSE;
+    }
+
+    stageData = (uint8_t*)stageDeviceMemory->getMemory();
+
+    //
+
+    allBatches.resize(batchCount);
+
+    for (auto& batch : allBatches)
+    {
+        batch.transferCmdBuffer = commandBuffersCreate(device, transferCommandPool->getCmdPool(), VK_COMMAND_BUFFER_LEVEL_PRIMARY, 1);
+
+        if (!batch.transferCmdBuffer.get())
+        {
+            logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Could not create command buffer.");
+
+            return VK_FALSE;
+        }
+
+        if (ownershipTransfer)
+        {
+            batch.acquireCmdBuffer = commandBuffersCreate(device, acquireCommandPool->getCmdPool(), VK_COMMAND_BUFFER_LEVEL_PRIMARY, 1);
+
+            batch.semaphore = semaphoreCreate(device, 0);
+
+            if (!batch.acquireCmdBuffer.get() || !batch.semaphore.get())
+            {
+                logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Could not create command buffer or semaphore.");
+
+                return VK_FALSE;
+            }
+        }
+
+        batch.fence = fenceCreate(device, 0);
+
+        if (!batch.fence.get())
+        {
+            logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Could not create fence.");
+
+            return VK_FALSE;
+        }
+
+        batch.state = UPLOAD_BATCH_FREE;
+        batch.uploadCount = 0;
+        batch.firstTicket = 0;
+        batch.lastTicket = 0;
+    }
+
+    return VK_TRUE;
+}
+
+//
+// IUploadManager
+//
+
+const IContextObjectSP& UploadManager::getContextObject() const
+{
+    return contextObject;
+}
+
+const IQueueSP& UploadManager::getTransferQueue() const
+{
+    return transferQueue;
+}
+
+VkDeviceSize UploadManager::getStageSize() const
+{
+    return stageSize;
+}
+
+uint32_t UploadManager::getBatchCount() const
+{
+    return batchCount;
+}
+
+uint64_t UploadManager::uploadBuffer(const IBufferSP& buffer, const VkDeviceSize offset, const void* data, const VkDeviceSize size, const VkAccessFlags dstAccessMask, const UploadCallbackFunction& callback)
+{
+    if (!buffer.get() || !data || size == 0 || offset + size > buffer->getSize())
+    {
+        return 0;
+    }
+
+    std::vector<UploadCallback> allFinishedCallbacks;
+
+    uint64_t ticket = 0;
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+
+        VkBuffer srcBuffer;
+        VkDeviceSize srcOffset;
+
+        if (allBatches.size() > 0 && stage(srcBuffer, srcOffset, data, size, 4, allFinishedCallbacks))
+        {
+            UploadBatch& batch = allBatches[currentBatch];
+
+            buffer->cmdPipelineBarrier(batch.transferCmdBuffer->getCommandBuffer(), VK_ACCESS_TRANSFER_WRITE_BIT);
+
+            VkBufferCopy bufferCopy;
+
+            bufferCopy.srcOffset = srcOffset;
+            bufferCopy.dstOffset = offset;
+            bufferCopy.size = size;
+
+            vkCmdCopyBuffer(batch.transferCmdBuffer->getCommandBuffer(), srcBuffer, buffer->getBuffer(), 1, &bufferCopy);
+
+            if (ownershipTransfer)
+            {
+                VkBufferMemoryBarrier bufferMemoryBarrier{};
+
+                bufferMemoryBarrier.sType = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER;
+
+                bufferMemoryBarrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+                bufferMemoryBarrier.dstAccessMask = 0;
+                bufferMemoryBarrier.srcQueueFamilyIndex = transferQueue->getQueueFamilyIndex();
+                bufferMemoryBarrier.dstQueueFamilyIndex = contextObject->getQueue()->getQueueFamilyIndex();
+                bufferMemoryBarrier.buffer = buffer->getBuffer();
+                bufferMemoryBarrier.offset = 0;
+                bufferMemoryBarrier.size = VK_WHOLE_SIZE;
+
+                batch.transferCmdBuffer->cmdPipelineBarrier(VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, 0, 0, nullptr, 1, &bufferMemoryBarrier, 0, nullptr);
+
+                // Acquired with the transfer access, which the buffer has been left in, so its tracked access mask stays valid.
+
+                bufferMemoryBarrier.srcAccessMask = 0;
+                bufferMemoryBarrier.dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+
+                batch.acquireCmdBuffer->cmdPipelineBarrier(VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 0, nullptr, 1, &bufferMemoryBarrier, 0, nullptr);
+
+                buffer->cmdPipelineBarrier(batch.acquireCmdBuffer->getCommandBuffer(), dstAccessMask);
+            }
+            else
+            {
+                buffer->cmdPipelineBarrier(batch.transferCmdBuffer->getCommandBuffer(), dstAccessMask);
+            }
+
+            batch.allBuffers.append(buffer);
+
+            ticket = endUpload(batch, size, callback);
+        }
+    }
+
+    callCallbacks(allFinishedCallbacks);
+
+    return ticket;
+}
+
+uint64_t UploadManager::uploadImage(const IImageSP& image, const IImageDataSP& imageData, const VkAccessFlags dstAccessMask, const VkImageLayout newLayout, const VkImageSubresourceRange& subresourceRange, const UploadCallbackFunction& callback)
+{
+    if (!image.get() || !imageData.get() || !imageData->getData() || imageData->getSize() == 0 || newLayout == VK_IMAGE_LAYOUT_UNDEFINED || newLayout == VK_IMAGE_LAYOUT_PREINITIALIZED)
+    {
+        return 0;
+    }
+
+    // All mip levels and array layers are copied from the image data with one call.
+
+    std::vector<VkBufferImageCopy> allBufferImageCopies;
+
+    for (uint32_t arrayLayer = subresourceRange.baseArrayLayer; arrayLayer < imageData->getArrayLayers() && arrayLayer - subresourceRange.baseArrayLayer < subresourceRange.layerCount; arrayLayer++)
+    {
+        for (uint32_t mipLevel = subresourceRange.baseMipLevel; mipLevel < imageData->getMipLevels() && mipLevel - subresourceRange.baseMipLevel < subresourceRange.levelCount; mipLevel++)
+        {
+            VkExtent3D currentExtent;
+            uint32_t currentOffset;
+
+            if (!imageData->getExtentAndOffset(currentExtent, currentOffset, mipLevel, arrayLayer))
+            {
+                logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Could not get extent and offset.");
+
+                return 0;
+            }
+
+            VkBufferImageCopy bufferImageCopy;
+
+            bufferImageCopy.bufferOffset = currentOffset;
+            bufferImageCopy.bufferRowLength = 0;	// Zero means tightly packed.
+            bufferImageCopy.bufferImageHeight = 0;
+            bufferImageCopy.imageSubresource = {subresourceRange.aspectMask, mipLevel, arrayLayer, 1};
+            bufferImageCopy.imageOffset = {0, 0, 0};
+            bufferImageCopy.imageExtent = currentExtent;
+
+            allBufferImageCopies.push_back(bufferImageCopy);
+        }
+    }
+
+    if (allBufferImageCopies.size() == 0)
+    {
+        return 0;
+    }
+
+    // Buffer offsets have to be a multiple of the texel size and of four.
+
+    VkDeviceSize alignment = glm::max(imageData->getBytesPerTexel(), 1u);
+
+    while (alignment % 4 != 0)
+    {
+        alignment += glm::max(imageData->getBytesPerTexel(), 1u);
+    }
+
+    //
+
+    std::vector<UploadCallback> allFinishedCallbacks;
+
+    uint64_t ticket = 0;
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+
+        VkBuffer srcBuffer;
+        VkDeviceSize srcOffset;
+
+        if (allBatches.size() > 0 && stage(srcBuffer, srcOffset, imageData->getData(), imageData->getSize(), alignment, allFinishedCallbacks))
+        {
+            UploadBatch& batch = allBatches[currentBatch];
+
+            for (auto& currentBufferImageCopy : allBufferImageCopies)
+            {
+                currentBufferImageCopy.bufferOffset += srcOffset;
+            }
+
+            image->cmdPipelineBarrier(batch.transferCmdBuffer->getCommandBuffer(), VK_ACCESS_TRANSFER_WRITE_BIT, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, subresourceRange);
+
+            vkCmdCopyBufferToImage(batch.transferCmdBuffer->getCommandBuffer(), srcBuffer, image->getImage(), VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, (uint32_t)allBufferImageCopies.size(), &allBufferImageCopies[0]);
+
+            if (ownershipTransfer)
+            {
+                VkImageMemoryBarrier imageMemoryBarrier{};
+
+                imageMemoryBarrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+
+                imageMemoryBarrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+                imageMemoryBarrier.dstAccessMask = 0;
+                imageMemoryBarrier.oldLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+                imageMemoryBarrier.newLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+                imageMemoryBarrier.srcQueueFamilyIndex = transferQueue->getQueueFamilyIndex();
+                imageMemoryBarrier.dstQueueFamilyIndex = contextObject->getQueue()->getQueueFamilyIndex();
+                imageMemoryBarrier.image = image->getImage();
+                imageMemoryBarrier.subresourceRange = subresourceRange;
+
+                batch.transferCmdBuffer->cmdPipelineBarrier(VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, 0, 0, nullptr, 0, nullptr, 1, &imageMemoryBarrier);
+
+                // Layout and access are kept during the transfer, so the final transition is tracked by the image.
+
+                imageMemoryBarrier.srcAccessMask = 0;
+                imageMemoryBarrier.dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+
+                batch.acquireCmdBuffer->cmdPipelineBarrier(VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 0, nullptr, 0, nullptr, 1, &imageMemoryBarrier);
+
+                image->cmdPipelineBarrier(batch.acquireCmdBuffer->getCommandBuffer(), dstAccessMask, newLayout, subresourceRange);
+            }
+            else
+            {
+                image->cmdPipelineBarrier(batch.transferCmdBuffer->getCommandBuffer(), dstAccessMask, newLayout, subresourceRange);
+            }
+
+            batch.allImages.append(image);
+
+            ticket = endUpload(batch, imageData->getSize(), callback);
+        }
+    }
+
+    callCallbacks(allFinishedCallbacks);
+
+    return ticket;
+}
+
+VkBool32 UploadManager::submit()
+{
+    std::vector<UploadCallback> allFinishedCallbacks;
+
+    VkBool32 result;
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+
+        result = submitBatch(allFinishedCallbacks);
+    }
+
+    callCallbacks(allFinishedCallbacks);
+
+    return result;
+}
+
+VkBool32 UploadManager::update()
+{
+    std::vector<UploadCallback> allFinishedCallbacks;
+
+    VkBool32 result;
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+
+        result = retire(0, VK_FALSE, allFinishedCallbacks);
+    }
+
+    callCallbacks(allFinishedCallbacks);
+
+    return result;
+}
+
+VkBool32 UploadManager::isComplete(const uint64_t ticket)
+{
+    if (ticket == 0)
+    {
+        return VK_FALSE;
+    }
+
+    std::vector<UploadCallback> allFinishedCallbacks;
+
+    VkBool32 result;
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+
+        retire(0, VK_FALSE, allFinishedCallbacks);
+
+        result = ticket <= completedTicket && !isFailedTicket(ticket);
+    }
+
+    callCallbacks(allFinishedCallbacks);
+
+    return result;
+}
+
+VkBool32 UploadManager::isFailed(const uint64_t ticket)
+{
+    if (ticket == 0)
+    {
+        return VK_TRUE;
+    }
+
+    std::vector<UploadCallback> allFinishedCallbacks;
+
+    VkBool32 result;
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+
+        retire(0, VK_FALSE, allFinishedCallbacks);
+
+        result = isFailedTicket(ticket);
+    }
+
+    callCallbacks(allFinishedCallbacks);
+
+    return result;
+}
+
+VkBool32 UploadManager::wait(const uint64_t ticket)
+{
+    if (ticket == 0)
+    {
+        return VK_FALSE;
+    }
+
+    std::vector<UploadCallback> allFinishedCallbacks;
+
+    VkBool32 result = VK_TRUE;
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+
+        if (ticket > submittedTicket)
+        {
+            result = submitBatch(allFinishedCallbacks);
+        }
+
+        if (result)
+        {
+            result = retire(ticket, VK_TRUE, allFinishedCallbacks) && ticket <= completedTicket && !isFailedTicket(ticket);
+        }
+    }
+
+    callCallbacks(allFinishedCallbacks);
+
+    return result;
+}
+
+VkBool32 UploadManager::waitIdle()
+{
+    std::vector<UploadCallback> allFinishedCallbacks;
+
+    VkBool32 result;
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+
+        result = submitBatch(allFinishedCallbacks);
+
+        if (result)
+        {
+            result = retire(submittedTicket, VK_TRUE, allFinishedCallbacks);
+        }
+    }
+
+    callCallbacks(allFinishedCallbacks);
+
+    return result;
+}
+
+uint64_t UploadManager::getUploadCount() const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+
+    return uploadCount;
+}
+
+uint64_t UploadManager::getUploadBytes() const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+
+    return uploadBytes;
+}
+
+uint64_t UploadManager::getSubmitCount() const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+
+    return submitCount;
+}
+
+uint64_t UploadManager::getDedicatedStageCount() const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+
+    return dedicatedStageCount;
+}
+
+//
+// IDestroyable
+//
+
+void UploadManager::destroy()
+{
+    waitIdle();
+
+    std::lock_guard<std::mutex> lock(mutex);
+
+    for (auto& batch : allBatches)
+    {
+        batch.allCallbacks.clear();
+
+        batch.allBuffers.clear();
+        batch.allImages.clear();
+
+        batch.allStageBuffers.clear();
+        batch.allStageDeviceMemories.clear();
+
+        if (batch.transferCmdBuffer.get())
+        {
+            batch.transferCmdBuffer->destroy();
+        }
+
+        if (batch.acquireCmdBuffer.get())
+        {
+            batch.acquireCmdBuffer->destroy();
+        }
+
+        if (batch.fence.get())
+        {
+            batch.fence->destroy();
+        }
+
+        if (batch.semaphore.get())
+        {
+            batch.semaphore->destroy();
+        }
+    }
+
+    allBatches.clear();
+
+    currentBatch = 0;
+
+    //
+
+    stageData = nullptr;
+
+    if (stageBuffer.get())
+    {
+        stageBuffer->destroy();
+
+        stageBuffer.reset();
+    }
+
+    if (stageDeviceMemory.get())
+    {
+        stageDeviceMemory->destroy();
+
+        stageDeviceMemory.reset();
+    }
+
+    //
+
+    if (acquireCommandPool.get())
+    {
+        acquireCommandPool->destroy();
+
+        acquireCommandPool.reset();
+    }
+
+    if (transferCommandPool.get())
+    {
+        transferCommandPool->destroy();
+
+        transferCommandPool.reset();
+    }
+}
+
+} /* namespace vkts */
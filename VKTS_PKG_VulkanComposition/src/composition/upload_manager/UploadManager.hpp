@@ -0,0 +1,206 @@
+/**
+ * VKTS - VulKan ToolS.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) since 2014 Norbert Nopper
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef VKTS_UPLOADMANAGER_HPP_
+#define VKTS_UPLOADMANAGER_HPP_
+
+#include <vkts/vulkan/composition/vkts_composition.hpp>
+
+namespace vkts
+{
+
+class UploadManager: public IUploadManager
+{
+
+private:
+
+	typedef enum UploadBatchState_
+	{
+		UPLOAD_BATCH_FREE = 0,
+		UPLOAD_BATCH_RECORDING = 1,
+		UPLOAD_BATCH_SUBMITTED = 2
+	} UploadBatchState;
+
+	typedef struct UploadTicketRange_
+	{
+		uint64_t firstTicket;
+		uint64_t lastTicket;
+	} UploadTicketRange;
+
+	typedef struct UploadCallback_
+	{
+		uint64_t ticket;
+		UploadCallbackFunction callback;
+		VkBool32 success;
+	} UploadCallback;
+
+	/**
+	 * One segment of the staging ring, its command buffers and the resources used until the fence is signaled.
+	 */
+	typedef struct UploadBatch_
+	{
+		ICommandBuffersSP transferCmdBuffer;
+		ICommandBuffersSP acquireCmdBuffer;
+
+		IFenceSP fence;
+		ISemaphoreSP semaphore;
+
+		UploadBatchState state;
+
+		uint32_t uploadCount;
+		uint64_t firstTicket;
+		uint64_t lastTicket;
+
+		std::vector<UploadCallback> allCallbacks;
+
+		SmartPointerVector<IBufferSP> allBuffers;
+		SmartPointerVector<IImageSP> allImages;
+
+		SmartPointerVector<IBufferSP> allStageBuffers;
+		SmartPointerVector<IDeviceMemorySP> allStageDeviceMemories;
+	} UploadBatch;
+
+	const IContextObjectSP contextObject;
+
+	const IQueueSP transferQueue;
+
+	// Resources are released on the transfer queue and acquired on the queue of the context object.
+	const VkBool32 ownershipTransfer;
+
+	const VkDeviceSize stageSize;
+
+	const uint32_t batchCount;
+
+	ICommandPoolSP transferCommandPool;
+	ICommandPoolSP acquireCommandPool;
+
+	IBufferSP stageBuffer;
+	IDeviceMemorySP stageDeviceMemory;
+	uint8_t* stageData;
+
+	UploadRing stageRing;
+	std::vector<VkTsMemoryRange> allFlushRanges;
+
+	std::vector<UploadBatch> allBatches;
+	uint32_t currentBatch;
+
+	uint64_t nextTicket;
+	uint64_t submittedTicket;
+	// Tickets up to this one are retired, either executed or failed.
+	uint64_t completedTicket;
+
+	std::vector<UploadTicketRange> allFailedTickets;
+
+	uint64_t uploadCount;
+	uint64_t uploadBytes;
+	uint64_t submitCount;
+	uint64_t dedicatedStageCount;
+
+	mutable std::mutex mutex;
+
+	static VkDeviceSize getNonCoherentAtomSize(const IContextObjectSP& contextObject);
+
+	VkBool32 createStageBuffer(IBufferSP& buffer, IDeviceMemorySP& deviceMemory, const VkDeviceSize size) const;
+
+	VkBool32 beginBatch(std::vector<UploadCallback>& allFinishedCallbacks);
+
+	VkBool32 stage(VkBuffer& buffer, VkDeviceSize& offset, const void* data, const VkDeviceSize size, const VkDeviceSize alignment, std::vector<UploadCallback>& allFinishedCallbacks);
+
+	uint64_t endUpload(UploadBatch& batch, const VkDeviceSize size, const UploadCallbackFunction& callback);
+
+	VkBool32 submitBatch(std::vector<UploadCallback>& allFinishedCallbacks);
+
+	void retireBatch(UploadBatch& batch, const VkBool32 success, std::vector<UploadCallback>& allFinishedCallbacks);
+
+	VkBool32 retire(const uint64_t ticket, const VkBool32 wait, std::vector<UploadCallback>& allFinishedCallbacks);
+
+	VkBool32 isFailedTicket(const uint64_t ticket) const;
+
+	static void callCallbacks(const std::vector<UploadCallback>& allFinishedCallbacks);
+
+public:
+
+	UploadManager() = delete;
+	UploadManager(const IContextObjectSP& contextObject, const IQueueSP& transferQueue, const VkDeviceSize stageSize, const uint32_t batchCount);
+	UploadManager(const UploadManager& other) = delete;
+	UploadManager(UploadManager&& other) = delete;
+	virtual ~UploadManager();
+
+	UploadManager& operator =(const UploadManager& other) = delete;
+	UploadManager& operator =(UploadManager && other) = delete;
+
+	/**
+	 * Creates the command pools, the batches and the staging ring.
+	 */
+	VkBool32 prepare();
+
+	//
+	// IUploadManager
+	//
+
+	virtual const IContextObjectSP& getContextObject() const override;
+
+	virtual const IQueueSP& getTransferQueue() const override;
+
+	virtual VkDeviceSize getStageSize() const override;
+
+	virtual uint32_t getBatchCount() const override;
+
+	virtual uint64_t uploadBuffer(const IBufferSP& buffer, const VkDeviceSize offset, const void* data, const VkDeviceSize size, const VkAccessFlags dstAccessMask, const UploadCallbackFunction& callback = nullptr) override;
+
+	virtual uint64_t uploadImage(const IImageSP& image, const IImageDataSP& imageData, const VkAccessFlags dstAccessMask, const VkImageLayout newLayout, const VkImageSubresourceRange& subresourceRange, const UploadCallbackFunction& callback = nullptr) override;
+
+	virtual VkBool32 submit() override;
+
+	virtual VkBool32 update() override;
+
+	virtual VkBool32 isComplete(const uint64_t ticket) override;
+
+	virtual VkBool32 isFailed(const uint64_t ticket) override;
+
+	virtual VkBool32 wait(const uint64_t ticket) override;
+
+	virtual VkBool32 waitIdle() override;
+
+	virtual uint64_t getUploadCount() const override;
+
+	virtual uint64_t getUploadBytes() const override;
+
+	virtual uint64_t getSubmitCount() const override;
+
+	virtual uint64_t getDedicatedStageCount() const override;
+
+	//
+	// IDestroyable
+	//
+
+	virtual void destroy() override;
+
+};
+
+} /* namespace vkts */
+
+#endif /* VKTS_UPLOADMANAGER_HPP_ */
@@ -0,0 +1,59 @@
+/**
+ * VKTS - VulKan ToolS.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) since 2014 Norbert Nopper
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <vkts/vulkan/composition/vkts_composition.hpp>
+#include "UploadManager.hpp"
+
+namespace vkts
+{
+
+IUploadManagerSP VKTS_APIENTRY uploadManagerCreate(const IContextObjectSP& contextObject, const IQueueSP& transferQueue, const VkDeviceSize stageSize, const uint32_t batchCount)
+{
+    if (!contextObject.get() || !contextObject->getDevice().get() || !contextObject->getQueue().get() || stageSize == 0 || batchCount == 0)
+    {
+        return IUploadManagerSP();
+    }
+
+    auto newInstance = new UploadManager(contextObject, transferQueue.get() ? transferQueue : contextObject->getQueue(), stageSize, batchCount);
+
+    if (!newInstance)
+    {
+        return IUploadManagerSP();
+    }
+
+    IUploadManagerSP uploadManager(newInstance);
+
+    if (!newInstance->prepare())
+    {
+        uploadManager->destroy();
+
+        return IUploadManagerSP();
+    }
+
+    return uploadManager;
+}
+
+}
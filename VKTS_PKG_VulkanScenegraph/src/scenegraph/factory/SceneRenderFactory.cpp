@@ -41,7 +41,7 @@ namespace vkts
 {
 
 SceneRenderFactory::SceneRenderFactory(const IDescriptorSetLayoutSP& descriptorSetLayout, const IRenderPassSP& renderPass, const IPipelineCacheSP& pipelineCache, const VkDeviceSize bufferCount) :
-	ISceneRenderFactory(), descriptorSetLayout(descriptorSetLayout), renderPass(renderPass), pipelineCache(pipelineCache), bufferCount(bufferCount)
+	ISceneRenderFactory(), descriptorSetLayout(descriptorSetLayout), renderPass(renderPass), pipelineCache(pipelineCache), bufferCount(bufferCount), allDescriptorSetLayouts(), allPipelineLayouts(), allGraphicsPipelines(), allKeyedDescriptorSetLayouts(), allKeyedPipelineLayouts(), allKeyedShaderModules()
 {
 }
 
@@ -49,6 +49,18 @@ SceneRenderFactory::~SceneRenderFactory()
 {
 }
 
+std::string SceneRenderFactory::createKey(const void* createInfo)
+{
+	auto binaryBuffer = serializeStructureTypeDeep(createInfo);
+
+	if (!binaryBuffer.get())
+	{
+		return std::string();
+	}
+
+	return std::string((const char*)binaryBuffer->getData(), binaryBuffer->getSize());
+}
+
 //
 // IDataFactory
 //
@@ -106,9 +118,9 @@ VkBool32 SceneRenderFactory::preparePhongMaterial(const ISceneManagerSP& sceneMa
 
 		//
 
-		auto allDescriptorSetLayouts = descriptorSetLayout->getDescriptorSetLayout();
+		auto setLayout = descriptorSetLayout->getDescriptorSetLayout();
 
-		auto descriptorSets = descriptorSetsCreate(sceneManager->getContextObject()->getDevice()->getDevice(), descriptorPool->getDescriptorPool(), 1, &allDescriptorSetLayouts);
+		auto descriptorSets = descriptorSetsCreate(sceneManager->getContextObject()->getDevice()->getDevice(), descriptorPool->getDescriptorPool(), 1, &setLayout);
 
 		if (!descriptorSets.get())
 		{
@@ -226,15 +238,40 @@ VkBool32 SceneRenderFactory::prepareBSDFMaterial(const ISceneManagerSP& sceneMan
 		bindingCount++;
     }
 
-    //
+	//
 
-    auto descriptorSetLayout = descriptorSetLayoutCreate(sceneManager->getContextObject()->getDevice()->getDevice(), 0, bindingCount, descriptorSetLayoutBinding);
+	// Sub meshes with the same bindings share the descriptor set layout. An empty key disables sharing.
 
-	if (!descriptorSetLayout.get())
+	VkDescriptorSetLayoutCreateInfo descriptorSetLayoutCreateInfo{};
+
+	descriptorSetLayoutCreateInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO;
+	descriptorSetLayoutCreateInfo.flags = 0;
+	descriptorSetLayoutCreateInfo.bindingCount = bindingCount;
+	descriptorSetLayoutCreateInfo.pBindings = descriptorSetLayoutBinding;
+
+	const std::string descriptorSetLayoutKey = createKey(&descriptorSetLayoutCreateInfo);
+
+	IDescriptorSetLayoutSP descriptorSetLayout;
+
+	if (descriptorSetLayoutKey.size() > 0 && allDescriptorSetLayouts.contains(descriptorSetLayoutKey))
+	{
+		descriptorSetLayout = allDescriptorSetLayouts[descriptorSetLayoutKey];
+	}
+	else
 	{
-		logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Could not create descriptor set layout.");
+		descriptorSetLayout = descriptorSetLayoutCreate(sceneManager->getContextObject()->getDevice()->getDevice(), 0, bindingCount, descriptorSetLayoutBinding);
 
-		return VK_FALSE;
+		if (!descriptorSetLayout.get())
+		{
+			logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Could not create descriptor set layout.");
+
+			return VK_FALSE;
+		}
+
+		if (descriptorSetLayoutKey.size() > 0)
+		{
+			allDescriptorSetLayouts[descriptorSetLayoutKey] = descriptorSetLayout;
+		}
 	}
 
 	subMesh->setDescriptorSetLayout(descriptorSetLayout);
@@ -270,9 +307,9 @@ VkBool32 SceneRenderFactory::prepareBSDFMaterial(const ISceneManagerSP& sceneMan
 
 		//
 
-		const auto allDescriptorSetLayouts = descriptorSetLayout->getDescriptorSetLayout();
+		const auto setLayout = descriptorSetLayout->getDescriptorSetLayout();
 
-		auto descriptorSets = descriptorSetsCreate(sceneManager->getContextObject()->getDevice()->getDevice(), bsdfMaterial->getRenderMaterial(currentBuffer)->getDescriptorPool()->getDescriptorPool(), 1, &allDescriptorSetLayouts);
+		auto descriptorSets = descriptorSetsCreate(sceneManager->getContextObject()->getDevice()->getDevice(), bsdfMaterial->getRenderMaterial(currentBuffer)->getDescriptorPool()->getDescriptorPool(), 1, &setLayout);
 
 		if (!descriptorSets.get())
 		{
@@ -309,13 +346,43 @@ VkBool32 SceneRenderFactory::prepareBSDFMaterial(const ISceneManagerSP& sceneMan
 
 	setLayouts[0] = subMesh->getDescriptorSetLayout()->getDescriptorSetLayout();
 
-	auto pipelineLayout = pipelineCreateLayout(sceneManager->getContextObject()->getDevice()->getDevice(), 0, 1, setLayouts, finalPushConstantRangeCount, finalPushConstantRange);
+	VkPipelineLayoutCreateInfo pipelineLayoutCreateInfo{};
 
-	if (!pipelineLayout.get())
+	pipelineLayoutCreateInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
+	pipelineLayoutCreateInfo.flags = 0;
+	pipelineLayoutCreateInfo.setLayoutCount = 1;
+	pipelineLayoutCreateInfo.pSetLayouts = setLayouts;
+	pipelineLayoutCreateInfo.pushConstantRangeCount = finalPushConstantRangeCount;
+	pipelineLayoutCreateInfo.pPushConstantRanges = finalPushConstantRange;
+
+	const std::string pipelineLayoutKey = createKey(&pipelineLayoutCreateInfo);
+
+	IPipelineLayoutSP pipelineLayout;
+
+	if (pipelineLayoutKey.size() > 0 && allPipelineLayouts.contains(pipelineLayoutKey))
+	{
+		pipelineLayout = allPipelineLayouts[pipelineLayoutKey];
+	}
+	else
 	{
-		logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Could not create pipeline layout.");
+		pipelineLayout = pipelineCreateLayout(sceneManager->getContextObject()->getDevice()->getDevice(), 0, 1, setLayouts, finalPushConstantRangeCount, finalPushConstantRange);
 
-		return VK_FALSE;
+		if (!pipelineLayout.get())
+		{
+			logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Could not create pipeline layout.");
+
+			return VK_FALSE;
+		}
+
+		if (pipelineLayoutKey.size() > 0)
+		{
+			allPipelineLayouts[pipelineLayoutKey] = pipelineLayout;
+
+			if (!allKeyedDescriptorSetLayouts.contains(subMesh->getDescriptorSetLayout()))
+			{
+				allKeyedDescriptorSetLayouts.append(subMesh->getDescriptorSetLayout());
+			}
+		}
 	}
 
 	subMesh->setPipelineLayout(pipelineLayout);
@@ -538,15 +605,61 @@ VkBool32 SceneRenderFactory::prepareBSDFMaterial(const ISceneManagerSP& sceneMan
 		pipelineCache = this->pipelineCache->getPipelineCache();
 	}
 
-	//
+	// The key contains the shared pipeline layout and shader modules, so only sub meshes with the same material setup share the pipeline.
+	// A base pipeline is not kept alive, so pipelines derived from one are not shared.
 
-	auto pipeline = pipelineCreateGraphics(sceneManager->getContextObject()->getDevice()->getDevice(), pipelineCache, gp.getGraphicsPipelineCreateInfo(), vertexBufferType);
+	std::string graphicsPipelineKey;
 
-	if (!pipeline.get())
+	if (gp.getGraphicsPipelineCreateInfo().basePipelineHandle == VK_NULL_HANDLE)
 	{
-		logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Could not create graphics pipeline.");
+		graphicsPipelineKey = createKey(&gp.getGraphicsPipelineCreateInfo());
+	}
 
-		return VK_FALSE;
+	if (graphicsPipelineKey.size() > 0)
+	{
+		graphicsPipelineKey.append((const char*)&vertexBufferType, sizeof(vertexBufferType));
+	}
+
+	IGraphicsPipelineSP pipeline;
+
+	if (graphicsPipelineKey.size() > 0 && allGraphicsPipelines.contains(graphicsPipelineKey))
+	{
+		pipeline = allGraphicsPipelines[graphicsPipelineKey];
+
+		profileAddPipeline(VK_TRUE);
+	}
+	else
+	{
+		pipeline = pipelineCreateGraphics(sceneManager->getContextObject()->getDevice()->getDevice(), pipelineCache, gp.getGraphicsPipelineCreateInfo(), vertexBufferType);
+
+		if (!pipeline.get())
+		{
+			logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Could not create graphics pipeline.");
+
+			return VK_FALSE;
+		}
+
+		if (graphicsPipelineKey.size() > 0)
+		{
+			allGraphicsPipelines[graphicsPipelineKey] = pipeline;
+
+			if (!allKeyedPipelineLayouts.contains(currentPipelineLayout))
+			{
+				allKeyedPipelineLayouts.append(currentPipelineLayout);
+			}
+
+			if (!allKeyedShaderModules.contains(currentVertexShaderModule))
+			{
+				allKeyedShaderModules.append(currentVertexShaderModule);
+			}
+
+			if (!allKeyedShaderModules.contains(subMesh->getBSDFMaterial()->getFragmentShader()))
+			{
+				allKeyedShaderModules.append(subMesh->getBSDFMaterial()->getFragmentShader());
+			}
+		}
+
+		profileAddPipeline(VK_FALSE);
 	}
 
 	subMesh->setGraphicsPipeline(pipeline);
@@ -915,6 +1028,16 @@ SmartPointerVector<IImageDataSP> SceneRenderFactory::prefilter(const ISceneManag
     //
     //
 
+	// Pending uploads have to be submitted before the command buffer, which samples them.
+
+	if (sceneManager->getAssetManager()->getCommandObject()->getUploadManager().get())
+	{
+		if (!sceneManager->getAssetManager()->getCommandObject()->getUploadManager()->submit())
+		{
+			return SmartPointerVector<IImageDataSP>();
+		}
+	}
+
 	if (sceneManager->getAssetManager()->getCommandObject()->getCommandBuffer()->endCommandBuffer() != VK_SUCCESS)
 	{
 		return SmartPointerVector<IImageDataSP>();
@@ -45,6 +45,25 @@ private:
 
     const VkDeviceSize bufferCount;
 
+    // Shared by all sub meshes, keyed by the deeply serialized create info.
+
+    SmartPointerMap<std::string, IDescriptorSetLayoutSP> allDescriptorSetLayouts;
+
+    SmartPointerMap<std::string, IPipelineLayoutSP> allPipelineLayouts;
+
+    SmartPointerMap<std::string, IGraphicsPipelineSP> allGraphicsPipelines;
+
+    // The keys contain raw handles, so the keyed objects are kept alive as long as the cache entries.
+    // The render pass is kept alive by the factory itself.
+
+    SmartPointerVector<IDescriptorSetLayoutSP> allKeyedDescriptorSetLayouts;
+
+    SmartPointerVector<IPipelineLayoutSP> allKeyedPipelineLayouts;
+
+    SmartPointerVector<IShaderModuleSP> allKeyedShaderModules;
+
+    static std::string createKey(const void* createInfo);
+
     SmartPointerVector<IImageDataSP> prefilter(const ISceneManagerSP& sceneManager, const IImageDataSP& sourceImage, const uint32_t samples, const std::string& name, const VkBool32 useLambert) const;
 
 public:
@@ -26,120 +26,158 @@
 
 #include "RenderMaterial.hpp"
 
+// Node descriptor sets in the first pool. Following pools have twice the size of the previous one.
+#define VKTS_RENDER_MATERIAL_POOL_CAPACITY 16
+
+// Dynamic uniform buffer bindings are stored as bits.
+#define VKTS_RENDER_MATERIAL_MAX_BINDINGS 64
+
 namespace vkts
 {
 
-IDescriptorSetsSP RenderMaterial::createDescriptorSetsByName(const std::string& nodeName)
+IDescriptorSetsSP RenderMaterial::allocateDescriptorSets(const IDescriptorSetsSP& templateDescriptorSets)
 {
-	if (!descriptorPool.get() || !descriptorSets.get())
+	if (!descriptorPool.get() || !templateDescriptorSets.get())
 	{
 		return IDescriptorSetsSP();
 	}
 
-	if (allDescriptorSets.contains(nodeName))
+	if (allDescriptorPools.size() == 0 || descriptorPoolUsed == descriptorPoolCapacity)
 	{
-		return allDescriptorSets[nodeName];
-	}
+		uint32_t capacity = allDescriptorPools.size() == 0 ? VKTS_RENDER_MATERIAL_POOL_CAPACITY : descriptorPoolCapacity * 2;
 
-	//
+		// The pool of the material holds the descriptors of one node.
+		std::vector<VkDescriptorPoolSize> allPoolSizes(descriptorPool->getPoolSizes(), descriptorPool->getPoolSizes() + descriptorPool->getPoolSizeCount());
 
-	if (this->nodeName == "")
-	{
-		this->nodeName = nodeName;
+		for (auto& currentPoolSize : allPoolSizes)
+		{
+			currentPoolSize.descriptorCount *= capacity;
+		}
 
-		allDescriptorPools[nodeName] = descriptorPool;
+		auto currentDescriptorPool = descriptorPoolCreate(descriptorPool->getDevice(), descriptorPool->getFlags(), descriptorPool->getMaxSets() * capacity, (uint32_t)allPoolSizes.size(), allPoolSizes.size() > 0 ? &allPoolSizes[0] : nullptr);
 
-		allDescriptorSets[nodeName] = descriptorSets;
+	    if (!currentDescriptorPool.get())
+	    {
+	        return IDescriptorSetsSP();
+	    }
 
-		allBindingPresent[nodeName].clear();
+	    allDescriptorPools.append(currentDescriptorPool);
 
-		return descriptorSets;
+	    descriptorPoolCapacity = capacity;
+	    descriptorPoolUsed = 0;
 	}
 
-	//
+	const auto& currentDescriptorPool = allDescriptorPools[allDescriptorPools.size() - 1];
 
-	auto currentDescriptorPool = descriptorPoolCreate(descriptorPool->getDevice(), descriptorPool->getFlags(), descriptorPool->getMaxSets(), descriptorPool->getPoolSizeCount(), descriptorPool->getPoolSizes());
+	auto currentDescriptorSets = descriptorSetsCreate(currentDescriptorPool->getDevice(), currentDescriptorPool->getDescriptorPool(), templateDescriptorSets->getDescriptorSetCount(), templateDescriptorSets->getSetLayouts());
 
-    if (!currentDescriptorPool.get())
+    if (!currentDescriptorSets.get())
     {
         return IDescriptorSetsSP();
     }
 
-	auto currentDescriptorSets = descriptorSetsCreate(currentDescriptorPool->getDevice(), currentDescriptorPool->getDescriptorPool(), descriptorSets->getDescriptorSetCount(), descriptorSets->getSetLayouts());
+    descriptorPoolUsed++;
+
+    return currentDescriptorSets;
+}
+
+IDescriptorSetsSP RenderMaterial::createDescriptorSetsByIndex(const int32_t nodeIndex)
+{
+	if (!descriptorPool.get() || !descriptorSets.get() || nodeIndex < 0)
+	{
+		return IDescriptorSetsSP();
+	}
+
+	if ((size_t)nodeIndex < allDescriptorSets.size() && allDescriptorSets[nodeIndex].get())
+	{
+		return allDescriptorSets[nodeIndex];
+	}
+
+	if ((size_t)nodeIndex >= allDescriptorSets.size())
+	{
+		allDescriptorSets.resize(nodeIndex + 1);
+		allBindingPresent.resize(nodeIndex + 1, 0);
+	}
+
+	//
+
+	if (!descriptorSetsUsed)
+	{
+		descriptorSetsUsed = VK_TRUE;
+
+		allDescriptorSets[nodeIndex] = descriptorSets;
+
+		allBindingPresent[nodeIndex] = 0;
+
+		return descriptorSets;
+	}
+
+	//
+
+	auto currentDescriptorSets = allocateDescriptorSets(descriptorSets);
 
     if (!currentDescriptorSets.get())
     {
         return IDescriptorSetsSP();
     }
 
-    allDescriptorPools[nodeName] = currentDescriptorPool;
-
-    allDescriptorSets[nodeName] = currentDescriptorSets;
+    allDescriptorSets[nodeIndex] = currentDescriptorSets;
 
-    allBindingPresent[nodeName].clear();
+    allBindingPresent[nodeIndex] = 0;
 
     //
 
-    return allDescriptorSets[nodeName];
+    return currentDescriptorSets;
 }
 
-IDescriptorSetsSP RenderMaterial::getDescriptorSetsByName(const std::string& nodeName) const
-{
-	if (allDescriptorSets.contains(nodeName))
-	{
-		return allDescriptorSets[nodeName];
-	}
-
-	return IDescriptorSetsSP();
-}
-
-void RenderMaterial::bindDescriptorSets(const ICommandBuffersSP& cmdBuffer, const VkPipelineLayout layout, const uint32_t currentBuffer, const std::map<uint32_t, VkTsDynamicOffset>& dynamicOffsetMappings, const std::string& nodeName) const
+void RenderMaterial::bindDescriptorSets(const ICommandBuffersSP& cmdBuffer, const VkPipelineLayout layout, const uint32_t currentBuffer, const std::map<uint32_t, VkTsDynamicOffset>& dynamicOffsetMappings, const int32_t nodeIndex) const
 {
     if (!cmdBuffer.get())
     {
         return;
     }
 
-    auto currentDescriptorSets = getDescriptorSetsByName(nodeName);
-
-    if (!currentDescriptorSets.get())
+    if (nodeIndex < 0 || (size_t)nodeIndex >= allDescriptorSets.size() || !allDescriptorSets[nodeIndex].get())
     {
         return;
     }
 
+    const auto& currentDescriptorSets = allDescriptorSets[nodeIndex];
+
     //
     uint32_t localDynamicOffsetCount = 0;
 
-    std::vector<uint32_t> localDynamicOffsets;
+    uint32_t localDynamicOffsets[VKTS_RENDER_MATERIAL_MAX_BINDINGS];
 
     //
 
-    const auto& currentBindingPresent = allBindingPresent.at(nodeName);
-    for (const auto& currentBinding : currentBindingPresent)
+    // Dynamic offsets are ordered by binding.
+    uint64_t currentBindingPresent = allBindingPresent[nodeIndex];
+    for (uint32_t currentBinding = 0; currentBindingPresent != 0; currentBinding++, currentBindingPresent >>= 1)
     {
-    	if (currentBinding.second)
+    	if (currentBindingPresent & 1)
     	{
-    		auto currentOffset = dynamicOffsetMappings.find(currentBinding.first);
+    		auto currentOffset = dynamicOffsetMappings.find(currentBinding);
 
 			if (currentOffset != dynamicOffsetMappings.end())
 			{
-	    		localDynamicOffsetCount++;
+	    		localDynamicOffsets[localDynamicOffsetCount] = currentOffset->second.stride * currentBuffer + currentOffset->second.offset;
 
-	    		localDynamicOffsets.push_back(currentOffset->second.stride * currentBuffer + currentOffset->second.offset);
+	    		localDynamicOffsetCount++;
 			}
     	}
     }
 
-    vkCmdBindDescriptorSets(cmdBuffer->getCommandBuffer(0), VK_PIPELINE_BIND_POINT_GRAPHICS, layout, 0, 1, &currentDescriptorSets->getDescriptorSets()[0], localDynamicOffsetCount, &localDynamicOffsets[0]);
+    vkCmdBindDescriptorSets(cmdBuffer->getCommandBuffer(0), VK_PIPELINE_BIND_POINT_GRAPHICS, layout, 0, 1, &currentDescriptorSets->getDescriptorSets()[0], localDynamicOffsetCount, localDynamicOffsets);
 }
 
 RenderMaterial::RenderMaterial() :
-    IRenderMaterial(), descriptorPool(), descriptorSets(), descriptorImageInfos{}, writeDescriptorSets{}, nodeName(), allDescriptorPools(), allDescriptorSets(), allBindingPresent()
+    IRenderMaterial(), descriptorPool(), descriptorSets(), descriptorImageInfos{}, writeDescriptorSets{}, descriptorSetsUsed(VK_FALSE), allDescriptorPools(), descriptorPoolCapacity(0), descriptorPoolUsed(0), allDescriptorSets(), allBindingPresent()
 {
 }
 
 RenderMaterial::RenderMaterial(const RenderMaterial& other) :
-	IRenderMaterial(), descriptorPool(), descriptorSets(), descriptorImageInfos{}, writeDescriptorSets{}, nodeName(), allDescriptorPools(), allDescriptorSets(), allBindingPresent(other.allBindingPresent)
+	IRenderMaterial(), descriptorPool(), descriptorSets(), descriptorImageInfos{}, writeDescriptorSets{}, descriptorSetsUsed(VK_FALSE), allDescriptorPools(), descriptorPoolCapacity(0), descriptorPoolUsed(0), allDescriptorSets(), allBindingPresent(other.allBindingPresent)
 {
 	if (other.descriptorPool.get())
 	{
@@ -166,30 +204,16 @@ RenderMaterial::RenderMaterial(const RenderMaterial& other) :
 
 		//
 
-		if (other.allDescriptorPools.size() != other.allDescriptorSets.size())
-		{
-			destroy();
-
-			return;
-		}
+		allDescriptorSets.resize(other.allDescriptorSets.size());
 
-
-		for (uint32_t i = 0; i < other.allDescriptorPools.size(); i++)
+		for (size_t i = 0; i < other.allDescriptorSets.size(); i++)
 		{
-			auto currentDescriptorPool = descriptorPoolCreate(other.allDescriptorPools.valueAt(i)->getDevice(), other.allDescriptorPools.valueAt(i)->getFlags(), other.allDescriptorPools.valueAt(i)->getMaxSets(), other.allDescriptorPools.valueAt(i)->getPoolSizeCount(), other.allDescriptorPools.valueAt(i)->getPoolSizes());
-
-			if (!currentDescriptorPool.get())
+			if (!other.allDescriptorSets[i].get())
 			{
-				destroy();
-
-				return;
+				continue;
 			}
 
-			allDescriptorPools[other.allDescriptorPools.keyAt(i)] = currentDescriptorPool;
-
-			//
-
-			auto currentDescriptorSets = descriptorSetsCreate(currentDescriptorPool->getDevice(), currentDescriptorPool->getDescriptorPool(), other.allDescriptorSets.valueAt(i)->getDescriptorSetCount(), other.allDescriptorSets.valueAt(i)->getSetLayouts());
+			auto currentDescriptorSets = allocateDescriptorSets(other.allDescriptorSets[i]);
 
 			if (!currentDescriptorSets.get())
 			{
@@ -198,7 +222,7 @@ RenderMaterial::RenderMaterial(const RenderMaterial& other) :
 				return;
 			}
 
-			allDescriptorSets[other.allDescriptorSets.keyAt(i)] = currentDescriptorSets;
+			allDescriptorSets[i] = currentDescriptorSets;
 		}
 	}
 }
@@ -254,9 +278,9 @@ void RenderMaterial::addDescriptorImageInfo(const uint32_t colorIndex, const uin
     writeDescriptorSets[colorIndex].pTexelBufferView = nullptr;
 }
 
-void RenderMaterial::updateDescriptorSets(const uint32_t allWriteDescriptorSetsCount, VkWriteDescriptorSet* allWriteDescriptorSets, const std::string& nodeName)
+void RenderMaterial::updateDescriptorSets(const uint32_t allWriteDescriptorSetsCount, VkWriteDescriptorSet* allWriteDescriptorSets, const int32_t nodeIndex)
 {
-    auto currentDescriptorSets = createDescriptorSetsByName(nodeName);
+    auto currentDescriptorSets = createDescriptorSetsByIndex(nodeIndex);
 
     if (!currentDescriptorSets.get())
     {
@@ -271,9 +295,11 @@ void RenderMaterial::updateDescriptorSets(const uint32_t allWriteDescriptorSetsC
 	// Copy from parent nodes.
     for (uint32_t i = 0; i < allWriteDescriptorSetsCount; i++)
     {
-		if (allWriteDescriptorSets[i].descriptorType == VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC)
+		const VkBool32 isDynamic = allWriteDescriptorSets[i].descriptorType == VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC && allWriteDescriptorSets[i].dstBinding < VKTS_RENDER_MATERIAL_MAX_BINDINGS;
+
+		if (isDynamic)
 		{
-			allBindingPresent[nodeName][allWriteDescriptorSets[i].dstBinding] = VK_FALSE;
+			allBindingPresent[nodeIndex] &= ~((uint64_t)1 << allWriteDescriptorSets[i].dstBinding);
 		}
 
 		if (allWriteDescriptorSets[i].descriptorCount > 0)
@@ -284,9 +310,9 @@ void RenderMaterial::updateDescriptorSets(const uint32_t allWriteDescriptorSetsC
 
 			finalWriteDescriptorSetsCount++;
 
-			if (allWriteDescriptorSets[i].descriptorType == VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC)
+			if (isDynamic)
 			{
-				allBindingPresent[nodeName][allWriteDescriptorSets[i].dstBinding] = VK_TRUE;
+				allBindingPresent[nodeIndex] |= (uint64_t)1 << allWriteDescriptorSets[i].dstBinding;
 			}
     	}
     }
@@ -307,9 +333,9 @@ void RenderMaterial::updateDescriptorSets(const uint32_t allWriteDescriptorSetsC
 
 				finalWriteDescriptorSetsCount++;
 
-				if (allWriteDescriptorSets[i].descriptorType == VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC)
+				if (allWriteDescriptorSets[i].descriptorType == VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC && allWriteDescriptorSets[i].dstBinding < VKTS_RENDER_MATERIAL_MAX_BINDINGS)
 				{
-					allBindingPresent[nodeName][allWriteDescriptorSets[i].dstBinding] = VK_TRUE;
+					allBindingPresent[nodeIndex] |= (uint64_t)1 << allWriteDescriptorSets[i].dstBinding;
 				}
 			}
         }
@@ -318,9 +344,9 @@ void RenderMaterial::updateDescriptorSets(const uint32_t allWriteDescriptorSetsC
     currentDescriptorSets->updateDescriptorSets(finalWriteDescriptorSetsCount, finalWriteDescriptorSets, 0, nullptr);
 }
 
-void RenderMaterial::draw(const ICommandBuffersSP& cmdBuffer, const IGraphicsPipelineSP& graphicsPipeline, const uint32_t currentBuffer, const std::map<uint32_t, VkTsDynamicOffset>& dynamicOffsetMappings, const std::string& nodeName)
+void RenderMaterial::draw(const ICommandBuffersSP& cmdBuffer, const IGraphicsPipelineSP& graphicsPipeline, const uint32_t currentBuffer, const std::map<uint32_t, VkTsDynamicOffset>& dynamicOffsetMappings, const int32_t nodeIndex)
 {
-    bindDescriptorSets(cmdBuffer, graphicsPipeline->getLayout(), currentBuffer, dynamicOffsetMappings, nodeName);
+    bindDescriptorSets(cmdBuffer, graphicsPipeline->getLayout(), currentBuffer, dynamicOffsetMappings, nodeIndex);
 }
 
 //
@@ -357,24 +383,36 @@ void RenderMaterial::destroy()
 {
 	try
 	{
-	    for (uint32_t i = 0; i < allDescriptorSets.values().size(); i++)
+	    for (size_t i = 0; i < allDescriptorSets.size(); i++)
 	    {
-	        allDescriptorSets.values()[i]->destroy();
+	    	if (allDescriptorSets[i].get())
+	    	{
+	    		allDescriptorSets[i]->destroy();
+	    	}
 	    }
 	    allDescriptorSets.clear();
 
-	    for (uint32_t i = 0; i < allDescriptorPools.values().size(); i++)
+	    for (uint32_t i = 0; i < allDescriptorPools.size(); i++)
 	    {
-	    	allDescriptorPools.values()[i]->destroy();
+	    	allDescriptorPools[i]->destroy();
 	    }
 	    allDescriptorPools.clear();
 
+	    descriptorPoolCapacity = 0;
+	    descriptorPoolUsed = 0;
+
 	    allBindingPresent.clear();
 
 	    memset(writeDescriptorSets, 0, sizeof(writeDescriptorSets));
 	    memset(descriptorImageInfos, 0, sizeof(descriptorImageInfos));
 
-	    nodeName = "";
+	    // The descriptor sets of the material were given to the first node.
+	    if (descriptorSetsUsed && descriptorPool.get())
+	    {
+	    	descriptorPool->destroy();
+	    }
+
+	    descriptorSetsUsed = VK_FALSE;
 
 	    descriptorSets = IDescriptorSetsSP();
 	    descriptorPool = IDescriptorPoolSP();
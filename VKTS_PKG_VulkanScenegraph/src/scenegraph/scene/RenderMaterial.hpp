@@ -41,16 +41,23 @@ protected:
     IDescriptorSetsSP descriptorSets;
     VkDescriptorImageInfo descriptorImageInfos[VKTS_BINDING_UNIFORM_MATERIAL_TOTAL_BINDING_COUNT];
     VkWriteDescriptorSet writeDescriptorSets[VKTS_BINDING_UNIFORM_MATERIAL_TOTAL_BINDING_COUNT];
-    std::string nodeName;
+    VkBool32 descriptorSetsUsed;
 
-    SmartPointerMap<std::string, IDescriptorPoolSP> allDescriptorPools;
-    SmartPointerMap<std::string, IDescriptorSetsSP> allDescriptorSets;
-    std::map<std::string, std::map<uint32_t, VkBool32>> allBindingPresent;
+    // Descriptor sets of all nodes are allocated from these pools. If the last pool is full, a pool with twice the sets is added.
+    SmartPointerVector<IDescriptorPoolSP> allDescriptorPools;
+    uint32_t descriptorPoolCapacity;
+    uint32_t descriptorPoolUsed;
 
-    IDescriptorSetsSP createDescriptorSetsByName(const std::string& nodeName);
-    IDescriptorSetsSP getDescriptorSetsByName(const std::string& nodeName) const;
+    // Indexed by the node index. One bit per present dynamic uniform buffer binding.
+    std::vector<IDescriptorSetsSP> allDescriptorSets;
+    std::vector<uint64_t> allBindingPresent;
 
-    void bindDescriptorSets(const ICommandBuffersSP& cmdBuffer, const VkPipelineLayout layout, const uint32_t currentBuffer, const std::map<uint32_t, VkTsDynamicOffset>& dynamicOffsetMappings, const std::string& nodeName) const;
+    IDescriptorSetsSP allocateDescriptorSets(const IDescriptorSetsSP& templateDescriptorSets);
+
+    IDescriptorSetsSP createDescriptorSetsByIndex(const int32_t nodeIndex);
+    IDescriptorSetsSP getDescriptorSetsByIndex(const int32_t nodeIndex) const;
+
+    void bindDescriptorSets(const ICommandBuffersSP& cmdBuffer, const VkPipelineLayout layout, const uint32_t currentBuffer, const std::map<uint32_t, VkTsDynamicOffset>& dynamicOffsetMappings, const int32_t nodeIndex) const;
 
 public:
 
@@ -78,9 +85,9 @@ public:
 
     virtual void addDescriptorImageInfo(const uint32_t colorIndex, const uint32_t dstBindingOffset, const VkSampler sampler, const VkImageView imageView, const VkImageLayout imageLayout) override;
 
-    virtual void updateDescriptorSets(const uint32_t allWriteDescriptorSetsCount, VkWriteDescriptorSet* allWriteDescriptorSets, const std::string& nodeName) override;
+    virtual void updateDescriptorSets(const uint32_t allWriteDescriptorSetsCount, VkWriteDescriptorSet* allWriteDescriptorSets, const int32_t nodeIndex) override;
 
-    virtual void draw(const ICommandBuffersSP& cmdBuffer, const IGraphicsPipelineSP& graphicsPipeline, const uint32_t currentBuffer, const std::map<uint32_t, VkTsDynamicOffset>& dynamicOffsetMappings, const std::string& nodeName) override;
+    virtual void draw(const ICommandBuffersSP& cmdBuffer, const IGraphicsPipelineSP& graphicsPipeline, const uint32_t currentBuffer, const std::map<uint32_t, VkTsDynamicOffset>& dynamicOffsetMappings, const int32_t nodeIndex) override;
 
     //
     // IDestroyable
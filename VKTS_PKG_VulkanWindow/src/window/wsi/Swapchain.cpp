@@ -251,6 +251,9 @@ VkResult Swapchain::queuePresent(const VkQueue queue, const uint32_t waitSemapho
     presentInfo.pImageIndices = imageIndices;
     presentInfo.pResults = results;
 
+    // Other threads may submit to the same queue, e.g. the upload manager.
+    std::lock_guard<std::mutex> queueLock(queueGetMutex(queue));
+
     return vkQueuePresentKHR(queue, &presentInfo);
 }
 
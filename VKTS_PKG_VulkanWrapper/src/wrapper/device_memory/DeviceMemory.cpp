@@ -30,7 +30,7 @@ namespace vkts
 {
 
 DeviceMemory::DeviceMemory(const VkDevice device, const VkMemoryAllocateInfo& memoryAllocInfo, const uint32_t memoryTypeCount, const VkMemoryType* memoryTypes, const VkMemoryPropertyFlags memoryPropertyFlags, const VkDeviceMemory deviceMemory) :
-    IDeviceMemory(), device(device), memoryAllocInfo(memoryAllocInfo), allMemoryTypes(0), memoryPropertyFlags(memoryPropertyFlags), deviceMemory(deviceMemory), data(nullptr), mapped(VK_FALSE)
+    IDeviceMemory(), device(device), memoryAllocInfo(memoryAllocInfo), allMemoryTypes(0), memoryPropertyFlags(memoryPropertyFlags), deviceMemory(deviceMemory), persistentData(nullptr), data(nullptr), mapped(VK_FALSE)
 {
     if (memoryTypes)
     {
@@ -100,6 +100,11 @@ const VkDeviceMemory DeviceMemory::getDeviceMemory() const
     return deviceMemory;
 }
 
+VkDeviceSize DeviceMemory::getOffset() const
+{
+    return 0;
+}
+
 VkResult DeviceMemory::mapMemory(const VkDeviceSize offset, const VkDeviceSize size, const VkMemoryMapFlags flags)
 {
     if (!(memoryPropertyFlags & VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT))
@@ -107,28 +112,32 @@ VkResult DeviceMemory::mapMemory(const VkDeviceSize offset, const VkDeviceSize s
         return VK_ERROR_MEMORY_MAP_FAILED;
     }
 
-	if (offset + size > getAllocationSize() && !VK_WHOLE_SIZE)
+	if (size != VK_WHOLE_SIZE && offset + size > getAllocationSize())
 	{
 		return VK_ERROR_MEMORY_MAP_FAILED;
 	}
 
-    if (mapped)
+    if (!persistentData)
     {
-        unmapMemory();
-    }
+        auto result = vkMapMemory(device, deviceMemory, 0, VK_WHOLE_SIZE, flags, &persistentData);
 
-    auto result = vkMapMemory(device, deviceMemory, offset, size, flags, &data);
+        if (result != VK_SUCCESS)
+        {
+            persistentData = nullptr;
 
-    if (result == VK_SUCCESS)
-    {
-        mapped = VK_TRUE;
-    }
-    else
-    {
-        data = nullptr;
+            data = nullptr;
+
+            mapped = VK_FALSE;
+
+            return result;
+        }
     }
 
-    return result;
+    data = (uint8_t*)persistentData + offset;
+
+    mapped = VK_TRUE;
+
+    return VK_SUCCESS;
 }
 
 void* DeviceMemory::getMemory()
@@ -146,9 +155,59 @@ VkResult DeviceMemory::flushMappedMemoryRanges(const VkDeviceSize offset, const
 	mappedMemoryRange.offset = offset;
 	mappedMemoryRange.size = size;
 
+	profileAddFlush(1);
+
 	return vkFlushMappedMemoryRanges(device, 1, &mappedMemoryRange);
 }
 
+VkResult DeviceMemory::flushMappedMemoryRanges(const uint32_t rangeCount, const VkTsMemoryRange* ranges) const
+{
+	if (rangeCount == 0)
+	{
+		return VK_SUCCESS;
+	}
+
+	if (!ranges)
+	{
+		return VK_ERROR_MEMORY_MAP_FAILED;
+	}
+
+	std::vector<VkMappedMemoryRange> allMappedMemoryRanges;
+
+	if (!getMappedMemoryRanges(allMappedMemoryRanges, rangeCount, ranges))
+	{
+		return VK_ERROR_MEMORY_MAP_FAILED;
+	}
+
+	profileAddFlush(rangeCount);
+
+	return vkFlushMappedMemoryRanges(device, rangeCount, &allMappedMemoryRanges[0]);
+}
+
+VkBool32 DeviceMemory::getMappedMemoryRanges(std::vector<VkMappedMemoryRange>& allMappedMemoryRanges, const uint32_t rangeCount, const VkTsMemoryRange* ranges) const
+{
+	if (rangeCount > 0 && !ranges)
+	{
+		return VK_FALSE;
+	}
+
+	for (uint32_t i = 0; i < rangeCount; i++)
+	{
+		VkMappedMemoryRange mappedMemoryRange{};
+
+		mappedMemoryRange.sType = VK_STRUCTURE_TYPE_MAPPED_MEMORY_RANGE;
+
+		mappedMemoryRange.memory = deviceMemory;
+		mappedMemoryRange.offset = ranges[i].offset;
+		// Ranges rounded up to the atom size may pass the end of the memory.
+		mappedMemoryRange.size = (ranges[i].offset + ranges[i].size >= getAllocationSize()) ? VK_WHOLE_SIZE : ranges[i].size;
+
+		allMappedMemoryRanges.push_back(mappedMemoryRange);
+	}
+
+	return VK_TRUE;
+}
+
 VkResult DeviceMemory::invalidateMappedMemoryRanges(const VkDeviceSize offset, const VkDeviceSize size) const
 {
 	VkMappedMemoryRange mappedMemoryRange{};
@@ -169,14 +228,11 @@ void DeviceMemory::unmapMemory()
         return;
     }
 
-    if (mapped)
-    {
-        vkUnmapMemory(device, deviceMemory);
+    // The memory stays mapped, so only the pointer is released.
 
-        data = nullptr;
+    data = nullptr;
 
-        mapped = VK_FALSE;
-    }
+    mapped = VK_FALSE;
 }
 
 VkResult DeviceMemory::upload(const VkDeviceSize offset, const VkMemoryMapFlags flags, const void* uploadData, const uint32_t uploadDataSize)
@@ -197,6 +253,8 @@ VkResult DeviceMemory::upload(const VkDeviceSize offset, const VkMemoryMapFlags
 
     unmapMemory();
 
+    profileAddUpload(uploadDataSize);
+
     return result;
 }
 
@@ -213,6 +271,13 @@ void DeviceMemory::destroy()
             unmapMemory();
         }
 
+        if (persistentData)
+        {
+            vkUnmapMemory(device, deviceMemory);
+
+            persistentData = nullptr;
+        }
+
         vkFreeMemory(device, deviceMemory, nullptr);
 
         deviceMemory = VK_NULL_HANDLE;
@@ -47,6 +47,9 @@ private:
 
     VkDeviceMemory deviceMemory;
 
+    // Host visible memory is mapped once and stays mapped until it is destroyed.
+    void* persistentData;
+
     void* data;
     VkBool32 mapped;
 
@@ -84,12 +87,18 @@ public:
 
     virtual const VkDeviceMemory getDeviceMemory() const override;
 
+    virtual VkDeviceSize getOffset() const override;
+
     virtual VkResult mapMemory(const VkDeviceSize offset, const VkDeviceSize size, const VkMemoryMapFlags flags) override;
 
     virtual void* getMemory() override;
 
     virtual VkResult flushMappedMemoryRanges(const VkDeviceSize offset, const VkDeviceSize size) const override;
 
+    virtual VkResult flushMappedMemoryRanges(const uint32_t rangeCount, const VkTsMemoryRange* ranges) const override;
+
+    virtual VkBool32 getMappedMemoryRanges(std::vector<VkMappedMemoryRange>& allMappedMemoryRanges, const uint32_t rangeCount, const VkTsMemoryRange* ranges) const override;
+
     virtual VkResult invalidateMappedMemoryRanges(const VkDeviceSize offset, const VkDeviceSize size) const override;
 
     virtual void unmapMemory() override;
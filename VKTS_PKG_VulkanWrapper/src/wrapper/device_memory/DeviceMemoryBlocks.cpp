@@ -0,0 +1,177 @@
+/**
+ * VKTS - VulKan ToolS.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) since 2014 Norbert Nopper
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "DeviceMemoryBlocks.hpp"
+
+namespace vkts
+{
+
+DeviceMemoryBlocks::DeviceMemoryBlocks(const VkDevice device, const VkPhysicalDeviceMemoryProperties& memoryProperties) :
+    IMemoryBlockAllocator(), device(device), memoryProperties(memoryProperties), allBlocks(), mutex()
+{
+}
+
+DeviceMemoryBlocks::~DeviceMemoryBlocks()
+{
+    std::lock_guard<std::mutex> lock(mutex);
+
+    for (auto& currentBlock : allBlocks)
+    {
+        if (currentBlock.second.data)
+        {
+            vkUnmapMemory(device, currentBlock.second.deviceMemory);
+        }
+
+        vkFreeMemory(device, currentBlock.second.deviceMemory, nullptr);
+    }
+
+    allBlocks.clear();
+}
+
+const VkDevice DeviceMemoryBlocks::getDevice() const
+{
+    return device;
+}
+
+const VkDeviceMemory DeviceMemoryBlocks::getDeviceMemory(const uint32_t blockId) const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+
+    auto currentBlock = allBlocks.find(blockId);
+
+    if (currentBlock == allBlocks.end())
+    {
+        return VK_NULL_HANDLE;
+    }
+
+    return currentBlock->second.deviceMemory;
+}
+
+VkDeviceSize DeviceMemoryBlocks::getSize(const uint32_t blockId) const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+
+    auto currentBlock = allBlocks.find(blockId);
+
+    if (currentBlock == allBlocks.end())
+    {
+        return 0;
+    }
+
+    return currentBlock->second.size;
+}
+
+void* DeviceMemoryBlocks::getMemory(const uint32_t blockId) const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+
+    auto currentBlock = allBlocks.find(blockId);
+
+    if (currentBlock == allBlocks.end())
+    {
+        return nullptr;
+    }
+
+    return currentBlock->second.data;
+}
+
+//
+// IMemoryBlockAllocator
+//
+
+VkBool32 DeviceMemoryBlocks::allocateBlock(const uint32_t memoryTypeIndex, const VkDeviceSize size, const uint32_t blockId)
+{
+    if (memoryTypeIndex >= memoryProperties.memoryTypeCount)
+    {
+        return VK_FALSE;
+    }
+
+    VkResult result;
+
+    VkMemoryAllocateInfo memoryAllocInfo{};
+
+    memoryAllocInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+    memoryAllocInfo.allocationSize = size;
+    memoryAllocInfo.memoryTypeIndex = memoryTypeIndex;
+
+    DeviceMemoryBlock deviceMemoryBlock;
+
+    deviceMemoryBlock.size = size;
+    deviceMemoryBlock.data = nullptr;
+
+    result = vkAllocateMemory(device, &memoryAllocInfo, nullptr, &deviceMemoryBlock.deviceMemory);
+
+    if (result != VK_SUCCESS)
+    {
+        logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Could not allocate device memory block.");
+
+        return VK_FALSE;
+    }
+
+    // Mapping is expensive, so it is done once for the whole block.
+    if (memoryProperties.memoryTypes[memoryTypeIndex].propertyFlags & VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT)
+    {
+        result = vkMapMemory(device, deviceMemoryBlock.deviceMemory, 0, VK_WHOLE_SIZE, 0, &deviceMemoryBlock.data);
+
+        if (result != VK_SUCCESS)
+        {
+            logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Could not map device memory block.");
+
+            vkFreeMemory(device, deviceMemoryBlock.deviceMemory, nullptr);
+
+            return VK_FALSE;
+        }
+    }
+
+    std::lock_guard<std::mutex> lock(mutex);
+
+    allBlocks[blockId] = deviceMemoryBlock;
+
+    return VK_TRUE;
+}
+
+void DeviceMemoryBlocks::freeBlock(const uint32_t memoryTypeIndex, const uint32_t blockId)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+
+    auto currentBlock = allBlocks.find(blockId);
+
+    if (currentBlock == allBlocks.end())
+    {
+        return;
+    }
+
+    if (currentBlock->second.data)
+    {
+        vkUnmapMemory(device, currentBlock->second.deviceMemory);
+    }
+
+    vkFreeMemory(device, currentBlock->second.deviceMemory, nullptr);
+
+    allBlocks.erase(currentBlock);
+}
+
+} /* namespace vkts */
@@ -0,0 +1,95 @@
+/**
+ * VKTS - VulKan ToolS.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) since 2014 Norbert Nopper
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef VKTS_DEVICEMEMORYBLOCKS_HPP_
+#define VKTS_DEVICEMEMORYBLOCKS_HPP_
+
+#include <vkts/vulkan/wrapper/vkts_wrapper.hpp>
+
+namespace vkts
+{
+
+/**
+ * Allocates the device memory blocks of one device. Host visible blocks are mapped once and stay mapped until they are freed.
+ */
+class DeviceMemoryBlocks: public IMemoryBlockAllocator
+{
+
+private:
+
+    typedef struct DeviceMemoryBlock_
+    {
+        VkDeviceMemory deviceMemory;
+        VkDeviceSize size;
+        void* data;
+    } DeviceMemoryBlock;
+
+    const VkDevice device;
+
+    const VkPhysicalDeviceMemoryProperties memoryProperties;
+
+    std::map<uint32_t, DeviceMemoryBlock> allBlocks;
+
+    mutable std::mutex mutex;
+
+public:
+
+    DeviceMemoryBlocks() = delete;
+    DeviceMemoryBlocks(const VkDevice device, const VkPhysicalDeviceMemoryProperties& memoryProperties);
+    DeviceMemoryBlocks(const DeviceMemoryBlocks& other) = delete;
+    DeviceMemoryBlocks(DeviceMemoryBlocks&& other) = delete;
+    virtual ~DeviceMemoryBlocks();
+
+    DeviceMemoryBlocks& operator =(const DeviceMemoryBlocks& other) = delete;
+
+    DeviceMemoryBlocks& operator =(DeviceMemoryBlocks && other) = delete;
+
+    const VkDevice getDevice() const;
+
+    const VkDeviceMemory getDeviceMemory(const uint32_t blockId) const;
+
+    VkDeviceSize getSize(const uint32_t blockId) const;
+
+    /**
+     * Persistently mapped memory of the block or nullptr, if the block is not host visible.
+     */
+    void* getMemory(const uint32_t blockId) const;
+
+    //
+    // IMemoryBlockAllocator
+    //
+
+    virtual VkBool32 allocateBlock(const uint32_t memoryTypeIndex, const VkDeviceSize size, const uint32_t blockId) override;
+
+    virtual void freeBlock(const uint32_t memoryTypeIndex, const uint32_t blockId) override;
+
+};
+
+typedef std::shared_ptr<DeviceMemoryBlocks> DeviceMemoryBlocksSP;
+
+} /* namespace vkts */
+
+#endif /* VKTS_DEVICEMEMORYBLOCKS_HPP_ */
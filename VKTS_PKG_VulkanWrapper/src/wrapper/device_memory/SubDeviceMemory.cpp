@@ -0,0 +1,313 @@
+/**
+ * VKTS - VulKan ToolS.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) since 2014 Norbert Nopper
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "SubDeviceMemory.hpp"
+
+namespace vkts
+{
+
+VkBool32 SubDeviceMemory::getMappedMemoryRange(VkMappedMemoryRange& mappedMemoryRange, const VkDeviceSize offset, const VkDeviceSize size) const
+{
+    VkTsMemoryAllocation memoryAllocation;
+
+    if (!memoryAllocator.get() || !memoryAllocator->getAllocation(memoryAllocation, allocation))
+    {
+        return VK_FALSE;
+    }
+
+    // Ranges have to be aligned to the atom size. Allocations of non coherent memory are aligned, so neighbours are not touched.
+
+    const VkDeviceSize atomSize = glm::max(nonCoherentAtomSize, (VkDeviceSize)1);
+
+    const VkDeviceSize begin = ((memoryAllocation.offset + offset) / atomSize) * atomSize;
+
+    VkDeviceSize end = (size == VK_WHOLE_SIZE) ? memoryAllocation.offset + memoryAllocation.size : memoryAllocation.offset + offset + size;
+
+    end = ((end + atomSize - 1) / atomSize) * atomSize;
+
+    mappedMemoryRange.sType = VK_STRUCTURE_TYPE_MAPPED_MEMORY_RANGE;
+
+    mappedMemoryRange.memory = deviceMemoryBlocks->getDeviceMemory(memoryAllocation.blockId);
+    mappedMemoryRange.offset = begin;
+    mappedMemoryRange.size = (end >= deviceMemoryBlocks->getSize(memoryAllocation.blockId)) ? VK_WHOLE_SIZE : end - begin;
+
+    return VK_TRUE;
+}
+
+SubDeviceMemory::SubDeviceMemory(const VkDevice device, const VkMemoryAllocateInfo& memoryAllocInfo, const uint32_t memoryTypeCount, const VkMemoryType* memoryTypes, const VkMemoryPropertyFlags memoryPropertyFlags, const MemoryAllocatorSP& memoryAllocator, const DeviceMemoryBlocksSP& deviceMemoryBlocks, const uint32_t allocation, const VkDeviceSize nonCoherentAtomSize) :
+    IDeviceMemory(), device(device), memoryAllocInfo(memoryAllocInfo), allMemoryTypes(0), memoryPropertyFlags(memoryPropertyFlags), memoryAllocator(memoryAllocator), deviceMemoryBlocks(deviceMemoryBlocks), allocation(allocation), nonCoherentAtomSize(nonCoherentAtomSize), data(nullptr), mapped(VK_FALSE)
+{
+    if (memoryTypes)
+    {
+        for (uint32_t i = 0; i < memoryTypeCount; i++)
+        {
+            allMemoryTypes.push_back(memoryTypes[i]);
+        }
+    }
+}
+
+SubDeviceMemory::~SubDeviceMemory()
+{
+    destroy();
+}
+
+//
+// IDeviceMemory
+//
+
+const VkDevice SubDeviceMemory::getDevice() const
+{
+    return device;
+}
+
+const VkMemoryAllocateInfo& SubDeviceMemory::getMemoryAllocInfo() const
+{
+    return memoryAllocInfo;
+}
+
+VkDeviceSize SubDeviceMemory::getAllocationSize() const
+{
+    return memoryAllocInfo.allocationSize;
+}
+
+uint32_t SubDeviceMemory::getMemoryTypeIndex() const
+{
+    return memoryAllocInfo.memoryTypeIndex;
+}
+
+VkMemoryType SubDeviceMemory::getMemoryType() const
+{
+    return allMemoryTypes[memoryAllocInfo.memoryTypeIndex];
+}
+
+uint32_t SubDeviceMemory::getMemoryTypeCount() const
+{
+    return (uint32_t) allMemoryTypes.size();
+}
+
+const VkMemoryType* SubDeviceMemory::getMemoryTypes() const
+{
+    if (allMemoryTypes.size() == 0)
+    {
+        return nullptr;
+    }
+
+    return &allMemoryTypes[0];
+}
+
+VkMemoryPropertyFlags SubDeviceMemory::getMemoryPropertyFlags() const
+{
+    return memoryPropertyFlags;
+}
+
+const VkDeviceMemory SubDeviceMemory::getDeviceMemory() const
+{
+    VkTsMemoryAllocation memoryAllocation;
+
+    if (!memoryAllocator.get() || !memoryAllocator->getAllocation(memoryAllocation, allocation))
+    {
+        return VK_NULL_HANDLE;
+    }
+
+    return deviceMemoryBlocks->getDeviceMemory(memoryAllocation.blockId);
+}
+
+VkDeviceSize SubDeviceMemory::getOffset() const
+{
+    VkTsMemoryAllocation memoryAllocation;
+
+    if (!memoryAllocator.get() || !memoryAllocator->getAllocation(memoryAllocation, allocation))
+    {
+        return 0;
+    }
+
+    return memoryAllocation.offset;
+}
+
+VkResult SubDeviceMemory::mapMemory(const VkDeviceSize offset, const VkDeviceSize size, const VkMemoryMapFlags flags)
+{
+    if (!(memoryPropertyFlags & VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT))
+    {
+        return VK_ERROR_MEMORY_MAP_FAILED;
+    }
+
+    if (size != VK_WHOLE_SIZE && offset + size > getAllocationSize())
+    {
+        return VK_ERROR_MEMORY_MAP_FAILED;
+    }
+
+    VkTsMemoryAllocation memoryAllocation;
+
+    if (!memoryAllocator.get() || !memoryAllocator->getAllocation(memoryAllocation, allocation))
+    {
+        return VK_ERROR_MEMORY_MAP_FAILED;
+    }
+
+    // The block is persistently mapped, so only the pointer is calculated.
+
+    uint8_t* blockData = (uint8_t*)deviceMemoryBlocks->getMemory(memoryAllocation.blockId);
+
+    if (!blockData)
+    {
+        return VK_ERROR_MEMORY_MAP_FAILED;
+    }
+
+    data = blockData + memoryAllocation.offset + offset;
+
+    mapped = VK_TRUE;
+
+    return VK_SUCCESS;
+}
+
+void* SubDeviceMemory::getMemory()
+{
+    return data;
+}
+
+VkResult SubDeviceMemory::flushMappedMemoryRanges(const VkDeviceSize offset, const VkDeviceSize size) const
+{
+    VkMappedMemoryRange mappedMemoryRange{};
+
+    if (!getMappedMemoryRange(mappedMemoryRange, offset, size))
+    {
+        return VK_ERROR_MEMORY_MAP_FAILED;
+    }
+
+    profileAddFlush(1);
+
+    return vkFlushMappedMemoryRanges(device, 1, &mappedMemoryRange);
+}
+
+VkResult SubDeviceMemory::flushMappedMemoryRanges(const uint32_t rangeCount, const VkTsMemoryRange* ranges) const
+{
+    if (rangeCount == 0)
+    {
+        return VK_SUCCESS;
+    }
+
+    if (!ranges)
+    {
+        return VK_ERROR_MEMORY_MAP_FAILED;
+    }
+
+    std::vector<VkMappedMemoryRange> allMappedMemoryRanges;
+
+    if (!getMappedMemoryRanges(allMappedMemoryRanges, rangeCount, ranges))
+    {
+        return VK_ERROR_MEMORY_MAP_FAILED;
+    }
+
+    profileAddFlush(rangeCount);
+
+    return vkFlushMappedMemoryRanges(device, rangeCount, &allMappedMemoryRanges[0]);
+}
+
+VkBool32 SubDeviceMemory::getMappedMemoryRanges(std::vector<VkMappedMemoryRange>& allMappedMemoryRanges, const uint32_t rangeCount, const VkTsMemoryRange* ranges) const
+{
+    if (rangeCount > 0 && !ranges)
+    {
+        return VK_FALSE;
+    }
+
+    for (uint32_t i = 0; i < rangeCount; i++)
+    {
+        VkMappedMemoryRange mappedMemoryRange{};
+
+        if (!getMappedMemoryRange(mappedMemoryRange, ranges[i].offset, ranges[i].size))
+        {
+            return VK_FALSE;
+        }
+
+        allMappedMemoryRanges.push_back(mappedMemoryRange);
+    }
+
+    return VK_TRUE;
+}
+
+VkResult SubDeviceMemory::invalidateMappedMemoryRanges(const VkDeviceSize offset, const VkDeviceSize size) const
+{
+    VkMappedMemoryRange mappedMemoryRange{};
+
+    if (!getMappedMemoryRange(mappedMemoryRange, offset, size))
+    {
+        return VK_ERROR_MEMORY_MAP_FAILED;
+    }
+
+    return vkInvalidateMappedMemoryRanges(device, 1, &mappedMemoryRange);
+}
+
+void SubDeviceMemory::unmapMemory()
+{
+    // The block stays mapped.
+
+    data = nullptr;
+
+    mapped = VK_FALSE;
+}
+
+VkResult SubDeviceMemory::upload(const VkDeviceSize offset, const VkMemoryMapFlags flags, const void* uploadData, const uint32_t uploadDataSize)
+{
+    auto result = mapMemory(offset, uploadDataSize, flags);
+
+    if (result != VK_SUCCESS)
+    {
+        return result;
+    }
+
+    memcpy(data, uploadData, uploadDataSize);
+
+    if (!(memoryPropertyFlags & VK_MEMORY_PROPERTY_HOST_COHERENT_BIT))
+    {
+        result = flushMappedMemoryRanges(offset, uploadDataSize);
+    }
+
+    unmapMemory();
+
+    profileAddUpload(uploadDataSize);
+
+    return result;
+}
+
+//
+// IDestroyable
+//
+
+void SubDeviceMemory::destroy()
+{
+    if (memoryAllocator.get())
+    {
+        if (mapped)
+        {
+            unmapMemory();
+        }
+
+        memoryAllocator->free(allocation);
+
+        memoryAllocator.reset();
+    }
+}
+
+} /* namespace vkts */
@@ -0,0 +1,129 @@
+/**
+ * VKTS - VulKan ToolS.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) since 2014 Norbert Nopper
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef VKTS_SUBDEVICEMEMORY_HPP_
+#define VKTS_SUBDEVICEMEMORY_HPP_
+
+#include <vkts/vulkan/wrapper/vkts_wrapper.hpp>
+
+#include "DeviceMemoryBlocks.hpp"
+
+namespace vkts
+{
+
+/**
+ * Range of a device memory block, given by the memory allocator. Offsets are relative to the range.
+ * The range is looked up on each access, so it stays valid, if the allocation is moved.
+ */
+class SubDeviceMemory: public IDeviceMemory
+{
+
+private:
+
+    const VkDevice device;
+
+    const VkMemoryAllocateInfo memoryAllocInfo;
+
+    std::vector<VkMemoryType> allMemoryTypes;
+
+    const VkMemoryPropertyFlags memoryPropertyFlags;
+
+    MemoryAllocatorSP memoryAllocator;
+
+    const DeviceMemoryBlocksSP deviceMemoryBlocks;
+
+    const uint32_t allocation;
+
+    const VkDeviceSize nonCoherentAtomSize;
+
+    void* data;
+    VkBool32 mapped;
+
+    VkBool32 getMappedMemoryRange(VkMappedMemoryRange& mappedMemoryRange, const VkDeviceSize offset, const VkDeviceSize size) const;
+
+public:
+
+    SubDeviceMemory() = delete;
+    SubDeviceMemory(const VkDevice device, const VkMemoryAllocateInfo& memoryAllocInfo, const uint32_t memoryTypeCount, const VkMemoryType* memoryTypes, const VkMemoryPropertyFlags memoryPropertyFlags, const MemoryAllocatorSP& memoryAllocator, const DeviceMemoryBlocksSP& deviceMemoryBlocks, const uint32_t allocation, const VkDeviceSize nonCoherentAtomSize);
+    SubDeviceMemory(const SubDeviceMemory& other) = delete;
+    SubDeviceMemory(SubDeviceMemory&& other) = delete;
+    virtual ~SubDeviceMemory();
+
+    SubDeviceMemory& operator =(const SubDeviceMemory& other) = delete;
+
+    SubDeviceMemory& operator =(SubDeviceMemory && other) = delete;
+
+    //
+    // IDeviceMemory
+    //
+
+    virtual const VkDevice getDevice() const override;
+
+    virtual const VkMemoryAllocateInfo& getMemoryAllocInfo() const override;
+
+    virtual VkDeviceSize getAllocationSize() const override;
+
+    virtual uint32_t getMemoryTypeIndex() const override;
+
+    virtual VkMemoryType getMemoryType() const override;
+
+    virtual uint32_t getMemoryTypeCount() const override;
+
+    virtual const VkMemoryType* getMemoryTypes() const override;
+
+    virtual VkMemoryPropertyFlags getMemoryPropertyFlags() const override;
+
+    virtual const VkDeviceMemory getDeviceMemory() const override;
+
+    virtual VkDeviceSize getOffset() const override;
+
+    virtual VkResult mapMemory(const VkDeviceSize offset, const VkDeviceSize size, const VkMemoryMapFlags flags) override;
+
+    virtual void* getMemory() override;
+
+    virtual VkResult flushMappedMemoryRanges(const VkDeviceSize offset, const VkDeviceSize size) const override;
+
+    virtual VkResult flushMappedMemoryRanges(const uint32_t rangeCount, const VkTsMemoryRange* ranges) const override;
+
+    virtual VkBool32 getMappedMemoryRanges(std::vector<VkMappedMemoryRange>& allMappedMemoryRanges, const uint32_t rangeCount, const VkTsMemoryRange* ranges) const override;
+
+    virtual VkResult invalidateMappedMemoryRanges(const VkDeviceSize offset, const VkDeviceSize size) const override;
+
+    virtual void unmapMemory() override;
+
+    virtual VkResult upload(const VkDeviceSize offset, const VkMemoryMapFlags flags, const void* uploadData, const uint32_t uploadDataSize) override;
+
+    //
+    // IDestroyable
+    //
+
+    virtual void destroy() override;
+
+};
+
+} /* namespace vkts */
+
+#endif /* VKTS_SUBDEVICEMEMORY_HPP_ */
@@ -26,10 +26,93 @@
 
 #include <vkts/vulkan/wrapper/vkts_wrapper.hpp>
 #include "DeviceMemory.hpp"
+#include "DeviceMemoryBlocks.hpp"
+#include "SubDeviceMemory.hpp"
 
 namespace vkts
 {
 
+typedef struct DeviceMemoryAllocator_
+{
+    MemoryAllocatorSP memoryAllocator;
+    DeviceMemoryBlocksSP deviceMemoryBlocks;
+    VkDeviceSize nonCoherentAtomSize;
+} DeviceMemoryAllocator;
+
+static std::mutex g_deviceMemoryMutex;
+
+static std::map<VkDevice, DeviceMemoryAllocator> g_allDeviceMemoryAllocators;
+
+static VkBool32 deviceMemoryGetAllocator(DeviceMemoryAllocator& deviceMemoryAllocator, const VkDevice device)
+{
+    std::lock_guard<std::mutex> lock(g_deviceMemoryMutex);
+
+    auto currentAllocator = g_allDeviceMemoryAllocators.find(device);
+
+    if (currentAllocator == g_allDeviceMemoryAllocators.end())
+    {
+        return VK_FALSE;
+    }
+
+    deviceMemoryAllocator = currentAllocator->second;
+
+    return VK_TRUE;
+}
+
+VkBool32 VKTS_APIENTRY deviceMemoryInitAllocator(const VkDevice device, const VkPhysicalDeviceMemoryProperties& memoryProperties, const VkDeviceSize bufferImageGranularity, const VkDeviceSize nonCoherentAtomSize, const VkDeviceSize blockSize)
+{
+    if (!device)
+    {
+        return VK_FALSE;
+    }
+
+    std::lock_guard<std::mutex> lock(g_deviceMemoryMutex);
+
+    if (g_allDeviceMemoryAllocators.find(device) != g_allDeviceMemoryAllocators.end())
+    {
+        return VK_TRUE;
+    }
+
+    DeviceMemoryAllocator deviceMemoryAllocator;
+
+    deviceMemoryAllocator.deviceMemoryBlocks = DeviceMemoryBlocksSP(new DeviceMemoryBlocks(device, memoryProperties));
+    deviceMemoryAllocator.memoryAllocator = MemoryAllocatorSP(new MemoryAllocator(deviceMemoryAllocator.deviceMemoryBlocks, memoryProperties, bufferImageGranularity, blockSize));
+    deviceMemoryAllocator.nonCoherentAtomSize = nonCoherentAtomSize;
+
+    g_allDeviceMemoryAllocators[device] = deviceMemoryAllocator;
+
+    return VK_TRUE;
+}
+
+void VKTS_APIENTRY deviceMemoryTerminateAllocator(const VkDevice device)
+{
+    std::lock_guard<std::mutex> lock(g_deviceMemoryMutex);
+
+    auto currentAllocator = g_allDeviceMemoryAllocators.find(device);
+
+    if (currentAllocator == g_allDeviceMemoryAllocators.end())
+    {
+        return;
+    }
+
+    // Device memory, which is still alive, does only keep the book keeping.
+    currentAllocator->second.memoryAllocator->destroy();
+
+    g_allDeviceMemoryAllocators.erase(currentAllocator);
+}
+
+uint32_t VKTS_APIENTRY deviceMemoryDefragment(const VkDevice device, const uint32_t memoryTypeIndex, const uint32_t maxMoves, const MemoryMoveFunction& moveFunction)
+{
+    DeviceMemoryAllocator deviceMemoryAllocator;
+
+    if (!deviceMemoryGetAllocator(deviceMemoryAllocator, device))
+    {
+        return 0;
+    }
+
+    return deviceMemoryAllocator.memoryAllocator->defragment(memoryTypeIndex, maxMoves, moveFunction);
+}
+
 VkBool32 VKTS_APIENTRY deviceGetMemoryTypeIndex(const uint32_t memoryTypeCount, const VkMemoryType* memoryType, const uint32_t memoryTypeBits, const VkMemoryPropertyFlags propertyFlags, uint32_t& memoryTypeIndex)
 {
     if (memoryTypeCount == 0 || memoryTypeCount > VK_MAX_MEMORY_TYPES || !memoryType || memoryTypeBits == 0)
@@ -58,7 +141,7 @@ VkBool32 VKTS_APIENTRY deviceGetMemoryTypeIndex(const uint32_t memoryTypeCount,
     return VK_FALSE;
 }
 
-IDeviceMemorySP VKTS_APIENTRY deviceMemoryCreate(const VkDevice device, const VkMemoryRequirements& memoryRequirements, const uint32_t memoryTypeCount, const VkMemoryType* memoryTypes, const VkMemoryPropertyFlags propertyFlags)
+IDeviceMemorySP VKTS_APIENTRY deviceMemoryCreate(const VkDevice device, const VkMemoryRequirements& memoryRequirements, const uint32_t memoryTypeCount, const VkMemoryType* memoryTypes, const VkMemoryPropertyFlags propertyFlags, const VkBool32 linear)
 {
     if (!device || !memoryTypes)
     {
@@ -82,6 +165,39 @@ IDeviceMemorySP VKTS_APIENTRY deviceMemoryCreate(const VkDevice device, const Vk
         return IDeviceMemorySP();
     }
 
+    DeviceMemoryAllocator deviceMemoryAllocator;
+
+    if (deviceMemoryGetAllocator(deviceMemoryAllocator, device))
+    {
+        VkDeviceSize alignment = glm::max(memoryRequirements.alignment, (VkDeviceSize)1);
+
+        // Flushed ranges are rounded to the atom size, so they must not reach into other allocations.
+        if (!(memoryTypes[memoryAllocInfo.memoryTypeIndex].propertyFlags & VK_MEMORY_PROPERTY_HOST_COHERENT_BIT) && (memoryTypes[memoryAllocInfo.memoryTypeIndex].propertyFlags & VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT))
+        {
+            alignment = glm::max(alignment, deviceMemoryAllocator.nonCoherentAtomSize);
+
+            memoryAllocInfo.allocationSize = ((memoryAllocInfo.allocationSize + alignment - 1) / alignment) * alignment;
+        }
+
+        uint32_t allocation;
+
+        if (deviceMemoryAllocator.memoryAllocator->allocate(allocation, memoryAllocInfo.memoryTypeIndex, memoryAllocInfo.allocationSize, alignment, linear))
+        {
+            auto newInstance = new SubDeviceMemory(device, memoryAllocInfo, memoryTypeCount, memoryTypes, propertyFlags, deviceMemoryAllocator.memoryAllocator, deviceMemoryAllocator.deviceMemoryBlocks, allocation, deviceMemoryAllocator.nonCoherentAtomSize);
+
+            if (!newInstance)
+            {
+                deviceMemoryAllocator.memoryAllocator->free(allocation);
+
+                return IDeviceMemorySP();
+            }
+
+            return IDeviceMemorySP(newInstance);
+        }
+
+        logPrint(VKTS_LOG_WARNING, __FILE__, __LINE__, "Could not sub-allocate device memory. Allocating it on its own.");
+    }
+
     VkDeviceMemory deviceMemory;
 
     result = vkAllocateMemory(device, &memoryAllocInfo, nullptr, &deviceMemory);
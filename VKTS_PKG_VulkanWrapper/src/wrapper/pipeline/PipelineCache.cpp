@@ -82,6 +82,99 @@ const VkPipelineCache PipelineCache::getPipelineCache() const
     return pipelineCache;
 }
 
+IBinaryBufferSP PipelineCache::getData() const
+{
+    VkResult result;
+
+    size_t dataSize = 0;
+
+    result = vkGetPipelineCacheData(device, pipelineCache, &dataSize, nullptr);
+
+    if (result != VK_SUCCESS || dataSize == 0)
+    {
+        logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Could not get pipeline cache data size.");
+
+        return IBinaryBufferSP();
+    }
+
+    std::vector<uint8_t> data(dataSize);
+
+    result = vkGetPipelineCacheData(device, pipelineCache, &dataSize, &data[0]);
+
+    if (result != VK_SUCCESS)
+    {
+        logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Could not get pipeline cache data.");
+
+        return IBinaryBufferSP();
+    }
+
+    data.resize(dataSize);
+
+    return binaryBufferCreate(data);
+}
+
+VkResult PipelineCache::mergePipelineCaches(const uint32_t srcCacheCount, const VkPipelineCache* srcCaches) const
+{
+    if (srcCacheCount == 0)
+    {
+        return VK_SUCCESS;
+    }
+
+    VkResult result = vkMergePipelineCaches(device, pipelineCache, srcCacheCount, srcCaches);
+
+    if (result != VK_SUCCESS)
+    {
+        logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Could not merge pipeline caches.");
+    }
+
+    return result;
+}
+
+IBinaryBufferSP PipelineCache::getFileData(const VkPhysicalDeviceProperties& physicalDeviceProperties) const
+{
+    auto data = getData();
+
+    if (!data.get())
+    {
+        return IBinaryBufferSP();
+    }
+
+    PipelineCacheFileHeader pipelineCacheFileHeader{};
+
+    pipelineCacheFileHeader.magic = VKTS_PIPELINE_CACHE_FILE_MAGIC;
+    pipelineCacheFileHeader.version = VKTS_PIPELINE_CACHE_FILE_VERSION;
+    pipelineCacheFileHeader.vendorID = physicalDeviceProperties.vendorID;
+    pipelineCacheFileHeader.deviceID = physicalDeviceProperties.deviceID;
+    pipelineCacheFileHeader.driverVersion = physicalDeviceProperties.driverVersion;
+    memcpy(pipelineCacheFileHeader.pipelineCacheUUID, physicalDeviceProperties.pipelineCacheUUID, VK_UUID_SIZE);
+    pipelineCacheFileHeader.dataSize = data->getSize();
+    pipelineCacheFileHeader.checksum = hashString((const char*)data->getData(), data->getSize());
+
+    auto fileData = binaryBufferCreate((uint32_t)sizeof(PipelineCacheFileHeader) + data->getSize());
+
+    if (!fileData.get())
+    {
+        return IBinaryBufferSP();
+    }
+
+    if (fileData->write(&pipelineCacheFileHeader, sizeof(PipelineCacheFileHeader), 1) != 1 || fileData->write(data->getData(), 1, data->getSize()) != data->getSize())
+    {
+        return IBinaryBufferSP();
+    }
+
+    return fileData;
+}
+
+VkBool32 PipelineCache::save(const char* filename, const VkPhysicalDeviceProperties& physicalDeviceProperties) const
+{
+    if (!filename)
+    {
+        return VK_FALSE;
+    }
+
+    return fileSaveBinary(filename, getFileData(physicalDeviceProperties));
+}
+
 //
 // IDestroyable
 //
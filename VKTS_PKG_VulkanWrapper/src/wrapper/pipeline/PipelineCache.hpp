@@ -29,9 +29,27 @@
 
 #include <vkts/vulkan/wrapper/vkts_wrapper.hpp>
 
+#define VKTS_PIPELINE_CACHE_FILE_MAGIC      0x43505456
+#define VKTS_PIPELINE_CACHE_FILE_VERSION    1
+
 namespace vkts
 {
 
+/**
+ * Header of a saved pipeline cache. The cache data is only used on the same device and driver.
+ */
+typedef struct PipelineCacheFileHeader_
+{
+    uint32_t magic;
+    uint32_t version;
+    uint32_t vendorID;
+    uint32_t deviceID;
+    uint32_t driverVersion;
+    uint8_t pipelineCacheUUID[VK_UUID_SIZE];
+    uint32_t dataSize;
+    uint32_t checksum;
+} PipelineCacheFileHeader;
+
 class PipelineCache: public IPipelineCache
 {
 
@@ -72,6 +90,14 @@ public:
 
     virtual const VkPipelineCache getPipelineCache() const override;
 
+    virtual IBinaryBufferSP getData() const override;
+
+    virtual VkResult mergePipelineCaches(const uint32_t srcCacheCount, const VkPipelineCache* srcCaches) const override;
+
+    virtual IBinaryBufferSP getFileData(const VkPhysicalDeviceProperties& physicalDeviceProperties) const override;
+
+    virtual VkBool32 save(const char* filename, const VkPhysicalDeviceProperties& physicalDeviceProperties) const override;
+
     //
     // IDestroyable
     //
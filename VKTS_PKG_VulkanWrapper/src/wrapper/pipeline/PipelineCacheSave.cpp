@@ -0,0 +1,89 @@
+/**
+ * VKTS - VulKan ToolS.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) since 2014 Norbert Nopper
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "PipelineCacheSave.hpp"
+
+namespace vkts
+{
+
+void PipelineCacheSave::run()
+{
+    const VkBool32 result = fileSaveBinary(filename.c_str(), fileData);
+
+    if (!result)
+    {
+        logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Could not save '%s'.", filename.c_str());
+    }
+
+    std::lock_guard<std::mutex> lockGuard(mutex);
+
+    saved = result;
+    done = VK_TRUE;
+
+    conditionVariable.notify_all();
+}
+
+PipelineCacheSave::PipelineCacheSave(const std::string& filename, const IBinaryBufferSP& fileData) :
+    IPipelineCacheSave(), filename(filename), fileData(fileData), mutex(), conditionVariable(), done(VK_FALSE), saved(VK_FALSE), thread()
+{
+    // Started last, as the thread is using the members.
+    thread = std::thread(&PipelineCacheSave::run, this);
+}
+
+PipelineCacheSave::~PipelineCacheSave()
+{
+    join();
+}
+
+//
+// IPipelineCacheSave
+//
+
+VkBool32 PipelineCacheSave::wait(const double timeout) const
+{
+    std::unique_lock<std::mutex> uniqueLock(mutex);
+
+    if (!conditionVariable.wait_for(uniqueLock, std::chrono::duration<double>(timeout), [this] {return done == VK_TRUE;}))
+    {
+        return VK_FALSE;
+    }
+
+    return saved;
+}
+
+VkBool32 PipelineCacheSave::join()
+{
+    if (thread.joinable())
+    {
+        thread.join();
+    }
+
+    std::lock_guard<std::mutex> lockGuard(mutex);
+
+    return saved;
+}
+
+} /* namespace vkts */
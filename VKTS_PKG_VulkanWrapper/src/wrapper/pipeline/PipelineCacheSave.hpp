@@ -0,0 +1,79 @@
+/**
+ * VKTS - VulKan ToolS.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) since 2014 Norbert Nopper
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef VKTS_PIPELINECACHESAVE_HPP_
+#define VKTS_PIPELINECACHESAVE_HPP_
+
+#include <vkts/vulkan/wrapper/vkts_wrapper.hpp>
+
+namespace vkts
+{
+
+class PipelineCacheSave: public IPipelineCacheSave
+{
+
+private:
+
+    const std::string filename;
+
+    const IBinaryBufferSP fileData;
+
+    mutable std::mutex mutex;
+
+    mutable std::condition_variable conditionVariable;
+
+    VkBool32 done;
+
+    VkBool32 saved;
+
+    std::thread thread;
+
+    void run();
+
+public:
+
+    PipelineCacheSave() = delete;
+    PipelineCacheSave(const std::string& filename, const IBinaryBufferSP& fileData);
+    PipelineCacheSave(const PipelineCacheSave& other) = delete;
+    PipelineCacheSave(PipelineCacheSave&& other) = delete;
+    virtual ~PipelineCacheSave();
+
+    PipelineCacheSave& operator =(const PipelineCacheSave& other) = delete;
+    PipelineCacheSave& operator =(PipelineCacheSave && other) = delete;
+
+    //
+    // IPipelineCacheSave
+    //
+
+    virtual VkBool32 wait(const double timeout) const override;
+
+    virtual VkBool32 join() override;
+
+};
+
+} /* namespace vkts */
+
+#endif /* VKTS_PIPELINECACHESAVE_HPP_ */
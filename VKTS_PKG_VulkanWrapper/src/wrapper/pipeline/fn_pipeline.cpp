@@ -28,6 +28,7 @@
 #include "ComputePipeline.hpp"
 #include "GraphicsPipeline.hpp"
 #include "PipelineCache.hpp"
+#include "PipelineCacheSave.hpp"
 #include "PipelineLayout.hpp"
 
 namespace vkts
@@ -73,6 +74,76 @@ IPipelineCacheSP VKTS_APIENTRY pipelineCreateCache(const VkDevice device, const
     return IPipelineCacheSP(newInstance);
 }
 
+IPipelineCacheSP VKTS_APIENTRY pipelineCreateCache(const VkDevice device, const VkPipelineCacheCreateFlags flags, const char* filename, const VkPhysicalDeviceProperties& physicalDeviceProperties)
+{
+    if (!device || !filename)
+    {
+        return IPipelineCacheSP();
+    }
+
+    auto fileData = fileLoadBinary(filename);
+
+    if (!fileData.get() || fileData->getSize() < sizeof(PipelineCacheFileHeader))
+    {
+        return pipelineCreateCache(device, flags);
+    }
+
+    // Data from another device, driver or a broken file is ignored and an empty cache is created.
+
+    PipelineCacheFileHeader pipelineCacheFileHeader;
+
+    memcpy(&pipelineCacheFileHeader, fileData->getData(), sizeof(PipelineCacheFileHeader));
+
+    const uint8_t* data = fileData->getByteData() + sizeof(PipelineCacheFileHeader);
+
+    if (pipelineCacheFileHeader.magic != VKTS_PIPELINE_CACHE_FILE_MAGIC || pipelineCacheFileHeader.version != VKTS_PIPELINE_CACHE_FILE_VERSION)
+    {
+        logPrint(VKTS_LOG_WARNING, __FILE__, __LINE__, "Pipeline cache '%s' has an unknown format.", filename);
+
+        return pipelineCreateCache(device, flags);
+    }
+
+    if (pipelineCacheFileHeader.vendorID != physicalDeviceProperties.vendorID || pipelineCacheFileHeader.deviceID != physicalDeviceProperties.deviceID || pipelineCacheFileHeader.driverVersion != physicalDeviceProperties.driverVersion || memcmp(pipelineCacheFileHeader.pipelineCacheUUID, physicalDeviceProperties.pipelineCacheUUID, VK_UUID_SIZE) != 0)
+    {
+        logPrint(VKTS_LOG_INFO, __FILE__, __LINE__, "Pipeline cache '%s' was saved for another device or driver.", filename);
+
+        return pipelineCreateCache(device, flags);
+    }
+
+    if (pipelineCacheFileHeader.dataSize == 0 || pipelineCacheFileHeader.dataSize != fileData->getSize() - sizeof(PipelineCacheFileHeader) || pipelineCacheFileHeader.checksum != hashString((const char*)data, pipelineCacheFileHeader.dataSize))
+    {
+        logPrint(VKTS_LOG_WARNING, __FILE__, __LINE__, "Pipeline cache '%s' is corrupted.", filename);
+
+        return pipelineCreateCache(device, flags);
+    }
+
+    return pipelineCreateCache(device, flags, pipelineCacheFileHeader.dataSize, data);
+}
+
+IPipelineCacheSaveSP VKTS_APIENTRY pipelineCacheSaveAsync(const IPipelineCacheSP& pipelineCache, const char* filename, const VkPhysicalDeviceProperties& physicalDeviceProperties)
+{
+    if (!pipelineCache.get() || !filename)
+    {
+        return IPipelineCacheSaveSP();
+    }
+
+    auto fileData = pipelineCache->getFileData(physicalDeviceProperties);
+
+    if (!fileData.get())
+    {
+        return IPipelineCacheSaveSP();
+    }
+
+    auto newInstance = new PipelineCacheSave(filename, fileData);
+
+    if (!newInstance)
+    {
+        return IPipelineCacheSaveSP();
+    }
+
+    return IPipelineCacheSaveSP(newInstance);
+}
+
 IPipelineLayoutSP VKTS_APIENTRY pipelineCreateLayout(const VkDevice device, const VkPipelineLayoutCreateFlags flags, const uint32_t setLayoutCount, const VkDescriptorSetLayout* setLayouts, const uint32_t pushConstantRangeCount, const VkPushConstantRange* pushConstantRanges)
 {
     if (!device)
@@ -45,6 +45,8 @@ private:
 
     const VkQueue queue;
 
+    std::mutex& queueMutex;
+
 public:
 
     Queue() = delete;
@@ -30,6 +30,10 @@
 namespace vkts
 {
 
+static std::mutex g_queueMutex;
+
+static std::map<VkQueue, std::unique_ptr<std::mutex>> g_allQueueMutexes;
+
 IQueueSP VKTS_APIENTRY queueGet(const VkDevice device, const uint32_t queueFamilyIndex, const uint32_t queueIndex)
 {
     if (!device)
@@ -44,6 +48,20 @@ IQueueSP VKTS_APIENTRY queueGet(const VkDevice device, const uint32_t queueFamil
     return IQueueSP(new Queue(device, queueFamilyIndex, queueIndex, queue));
 }
 
+std::mutex& VKTS_APIENTRY queueGetMutex(const VkQueue queue)
+{
+    std::lock_guard<std::mutex> queueLock(g_queueMutex);
+
+    auto& currentQueueMutex = g_allQueueMutexes[queue];
+
+    if (!currentQueueMutex.get())
+    {
+        currentQueueMutex = std::unique_ptr<std::mutex>(new std::mutex());
+    }
+
+    return *currentQueueMutex;
+}
+
 VkBool32 VKTS_APIENTRY queueGetFamilyIndex(const std::vector<VkQueueFamilyProperties>& allQueueFamilyProperties, const VkQueueFlags queueFlags, const uint32_t queueIndex, const std::vector<VkBool32>* filter, uint32_t& queueFamilyIndex)
 {
     for (uint32_t queueFamilyIndexWalker = 0; queueFamilyIndexWalker < allQueueFamilyProperties.size(); queueFamilyIndexWalker++)
@@ -64,4 +82,21 @@ VkBool32 VKTS_APIENTRY queueGetFamilyIndex(const std::vector<VkQueueFamilyProper
     return VK_FALSE;
 }
 
+VkBool32 VKTS_APIENTRY queueGetTransferFamilyIndex(const std::vector<VkQueueFamilyProperties>& allQueueFamilyProperties, uint32_t& queueFamilyIndex)
+{
+    for (uint32_t queueFamilyIndexWalker = 0; queueFamilyIndexWalker < allQueueFamilyProperties.size(); queueFamilyIndexWalker++)
+    {
+        const VkQueueFlags queueFlags = allQueueFamilyProperties[queueFamilyIndexWalker].queueFlags;
+
+        if ((queueFlags & VK_QUEUE_TRANSFER_BIT) && !(queueFlags & (VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT)) && allQueueFamilyProperties[queueFamilyIndexWalker].queueCount > 0)
+        {
+            queueFamilyIndex = queueFamilyIndexWalker;
+
+            return VK_TRUE;
+        }
+    }
+
+    return VK_FALSE;
+}
+
 }
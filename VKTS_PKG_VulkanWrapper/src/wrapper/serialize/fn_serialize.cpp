@@ -29,6 +29,284 @@
 namespace vkts
 {
 
+//
+// Deep serialization.
+//
+
+template<class T>
+static void serializeWrite(std::vector<uint8_t>& data, const T& value)
+{
+    const uint8_t* bytes = (const uint8_t*)&value;
+
+    data.insert(data.end(), bytes, bytes + sizeof(T));
+}
+
+/**
+ * Only for structures without padding and pointers.
+ */
+template<class T>
+static void serializeWriteArray(std::vector<uint8_t>& data, const uint32_t count, const T* values)
+{
+    serializeWrite(data, count);
+
+    serializeWrite(data, (uint32_t)(values ? 1 : 0));
+
+    if (count > 0 && values)
+    {
+        const uint8_t* bytes = (const uint8_t*)values;
+
+        data.insert(data.end(), bytes, bytes + sizeof(T) * count);
+    }
+}
+
+static void serializeWriteString(std::vector<uint8_t>& data, const char* str)
+{
+    const uint32_t length = str ? (uint32_t)strlen(str) : 0;
+
+    serializeWrite(data, length);
+
+    data.insert(data.end(), (const uint8_t*)str, (const uint8_t*)str + length);
+}
+
+static VkBool32 serializeDeep(std::vector<uint8_t>& data, const void* ptr);
+
+/**
+ * Pointed to structures and pNext chains are written after a marker, so a missing structure differs from an empty one.
+ */
+static VkBool32 serializePointer(std::vector<uint8_t>& data, const void* ptr)
+{
+    serializeWrite(data, (uint32_t)(ptr ? 1 : 0));
+
+    if (!ptr)
+    {
+        return VK_TRUE;
+    }
+
+    return serializeDeep(data, ptr);
+}
+
+static VkBool32 serializeDeep(std::vector<uint8_t>& data, const void* ptr)
+{
+    const VkTsStructureTypeHeader* structureTypeHeader = (const VkTsStructureTypeHeader*) ptr;
+
+    serializeWrite(data, structureTypeHeader->sType);
+
+    switch (structureTypeHeader->sType)
+    {
+        case VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO:
+        {
+            const VkDescriptorSetLayoutCreateInfo* createInfo = (const VkDescriptorSetLayoutCreateInfo*) ptr;
+
+            serializeWrite(data, createInfo->flags);
+            serializeWrite(data, createInfo->bindingCount);
+
+            for (uint32_t i = 0; i < createInfo->bindingCount; i++)
+            {
+                const VkDescriptorSetLayoutBinding& binding = createInfo->pBindings[i];
+
+                serializeWrite(data, binding.binding);
+                serializeWrite(data, binding.descriptorType);
+                serializeWrite(data, binding.descriptorCount);
+                serializeWrite(data, binding.stageFlags);
+
+                serializeWriteArray(data, binding.pImmutableSamplers ? binding.descriptorCount : 0, binding.pImmutableSamplers);
+            }
+        }
+        break;
+        case VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO:
+        {
+            const VkPipelineLayoutCreateInfo* createInfo = (const VkPipelineLayoutCreateInfo*) ptr;
+
+            serializeWrite(data, createInfo->flags);
+            serializeWriteArray(data, createInfo->setLayoutCount, createInfo->pSetLayouts);
+            serializeWriteArray(data, createInfo->pushConstantRangeCount, createInfo->pPushConstantRanges);
+        }
+        break;
+        case VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO:
+        {
+            const VkPipelineShaderStageCreateInfo* createInfo = (const VkPipelineShaderStageCreateInfo*) ptr;
+
+            serializeWrite(data, createInfo->flags);
+            serializeWrite(data, createInfo->stage);
+            serializeWrite(data, createInfo->module);
+            serializeWriteString(data, createInfo->pName);
+
+            serializeWrite(data, (uint32_t)(createInfo->pSpecializationInfo ? 1 : 0));
+
+            if (createInfo->pSpecializationInfo)
+            {
+                const VkSpecializationInfo* specializationInfo = createInfo->pSpecializationInfo;
+
+                serializeWrite(data, specializationInfo->mapEntryCount);
+
+                for (uint32_t i = 0; i < specializationInfo->mapEntryCount; i++)
+                {
+                    serializeWrite(data, specializationInfo->pMapEntries[i].constantID);
+                    serializeWrite(data, specializationInfo->pMapEntries[i].offset);
+                    serializeWrite(data, (uint64_t)specializationInfo->pMapEntries[i].size);
+                }
+
+                serializeWriteArray(data, (uint32_t)specializationInfo->dataSize, (const uint8_t*)specializationInfo->pData);
+            }
+        }
+        break;
+        case VK_STRUCTURE_TYPE_PIPELINE_VERTEX_INPUT_STATE_CREATE_INFO:
+        {
+            const VkPipelineVertexInputStateCreateInfo* createInfo = (const VkPipelineVertexInputStateCreateInfo*) ptr;
+
+            serializeWrite(data, createInfo->flags);
+            serializeWriteArray(data, createInfo->vertexBindingDescriptionCount, createInfo->pVertexBindingDescriptions);
+            serializeWriteArray(data, createInfo->vertexAttributeDescriptionCount, createInfo->pVertexAttributeDescriptions);
+        }
+        break;
+        case VK_STRUCTURE_TYPE_PIPELINE_INPUT_ASSEMBLY_STATE_CREATE_INFO:
+        {
+            const VkPipelineInputAssemblyStateCreateInfo* createInfo = (const VkPipelineInputAssemblyStateCreateInfo*) ptr;
+
+            serializeWrite(data, createInfo->flags);
+            serializeWrite(data, createInfo->topology);
+            serializeWrite(data, createInfo->primitiveRestartEnable);
+        }
+        break;
+        case VK_STRUCTURE_TYPE_PIPELINE_TESSELLATION_STATE_CREATE_INFO:
+        {
+            const VkPipelineTessellationStateCreateInfo* createInfo = (const VkPipelineTessellationStateCreateInfo*) ptr;
+
+            serializeWrite(data, createInfo->flags);
+            serializeWrite(data, createInfo->patchControlPoints);
+        }
+        break;
+        case VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_STATE_CREATE_INFO:
+        {
+            const VkPipelineViewportStateCreateInfo* createInfo = (const VkPipelineViewportStateCreateInfo*) ptr;
+
+            serializeWrite(data, createInfo->flags);
+            serializeWriteArray(data, createInfo->viewportCount, createInfo->pViewports);
+            serializeWriteArray(data, createInfo->scissorCount, createInfo->pScissors);
+        }
+        break;
+        case VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_STATE_CREATE_INFO:
+        {
+            const VkPipelineRasterizationStateCreateInfo* createInfo = (const VkPipelineRasterizationStateCreateInfo*) ptr;
+
+            serializeWrite(data, createInfo->flags);
+            serializeWrite(data, createInfo->depthClampEnable);
+            serializeWrite(data, createInfo->rasterizerDiscardEnable);
+            serializeWrite(data, createInfo->polygonMode);
+            serializeWrite(data, createInfo->cullMode);
+            serializeWrite(data, createInfo->frontFace);
+            serializeWrite(data, createInfo->depthBiasEnable);
+            serializeWrite(data, createInfo->depthBiasConstantFactor);
+            serializeWrite(data, createInfo->depthBiasClamp);
+            serializeWrite(data, createInfo->depthBiasSlopeFactor);
+            serializeWrite(data, createInfo->lineWidth);
+        }
+        break;
+        case VK_STRUCTURE_TYPE_PIPELINE_MULTISAMPLE_STATE_CREATE_INFO:
+        {
+            const VkPipelineMultisampleStateCreateInfo* createInfo = (const VkPipelineMultisampleStateCreateInfo*) ptr;
+
+            serializeWrite(data, createInfo->flags);
+            serializeWrite(data, createInfo->rasterizationSamples);
+            serializeWrite(data, createInfo->sampleShadingEnable);
+            serializeWrite(data, createInfo->minSampleShading);
+            serializeWriteArray(data, createInfo->pSampleMask ? ((uint32_t)createInfo->rasterizationSamples + 31) / 32 : 0, createInfo->pSampleMask);
+            serializeWrite(data, createInfo->alphaToCoverageEnable);
+            serializeWrite(data, createInfo->alphaToOneEnable);
+        }
+        break;
+        case VK_STRUCTURE_TYPE_PIPELINE_DEPTH_STENCIL_STATE_CREATE_INFO:
+        {
+            const VkPipelineDepthStencilStateCreateInfo* createInfo = (const VkPipelineDepthStencilStateCreateInfo*) ptr;
+
+            serializeWrite(data, createInfo->flags);
+            serializeWrite(data, createInfo->depthTestEnable);
+            serializeWrite(data, createInfo->depthWriteEnable);
+            serializeWrite(data, createInfo->depthCompareOp);
+            serializeWrite(data, createInfo->depthBoundsTestEnable);
+            serializeWrite(data, createInfo->stencilTestEnable);
+            serializeWrite(data, createInfo->front);
+            serializeWrite(data, createInfo->back);
+            serializeWrite(data, createInfo->minDepthBounds);
+            serializeWrite(data, createInfo->maxDepthBounds);
+        }
+        break;
+        case VK_STRUCTURE_TYPE_PIPELINE_COLOR_BLEND_STATE_CREATE_INFO:
+        {
+            const VkPipelineColorBlendStateCreateInfo* createInfo = (const VkPipelineColorBlendStateCreateInfo*) ptr;
+
+            serializeWrite(data, createInfo->flags);
+            serializeWrite(data, createInfo->logicOpEnable);
+            serializeWrite(data, createInfo->logicOp);
+            serializeWriteArray(data, createInfo->attachmentCount, createInfo->pAttachments);
+            serializeWrite(data, createInfo->blendConstants);
+        }
+        break;
+        case VK_STRUCTURE_TYPE_PIPELINE_DYNAMIC_STATE_CREATE_INFO:
+        {
+            const VkPipelineDynamicStateCreateInfo* createInfo = (const VkPipelineDynamicStateCreateInfo*) ptr;
+
+            serializeWrite(data, createInfo->flags);
+            serializeWriteArray(data, createInfo->dynamicStateCount, createInfo->pDynamicStates);
+        }
+        break;
+        case VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO:
+        {
+            const VkGraphicsPipelineCreateInfo* createInfo = (const VkGraphicsPipelineCreateInfo*) ptr;
+
+            serializeWrite(data, createInfo->flags);
+            serializeWrite(data, createInfo->stageCount);
+
+            for (uint32_t i = 0; i < createInfo->stageCount; i++)
+            {
+                if (!serializeDeep(data, &createInfo->pStages[i]))
+                {
+                    return VK_FALSE;
+                }
+            }
+
+            if (!serializePointer(data, createInfo->pVertexInputState) || !serializePointer(data, createInfo->pInputAssemblyState) || !serializePointer(data, createInfo->pTessellationState) || !serializePointer(data, createInfo->pViewportState) || !serializePointer(data, createInfo->pRasterizationState) || !serializePointer(data, createInfo->pMultisampleState) || !serializePointer(data, createInfo->pDepthStencilState) || !serializePointer(data, createInfo->pColorBlendState) || !serializePointer(data, createInfo->pDynamicState))
+            {
+                return VK_FALSE;
+            }
+
+            serializeWrite(data, createInfo->layout);
+            serializeWrite(data, createInfo->renderPass);
+            serializeWrite(data, createInfo->subpass);
+            serializeWrite(data, createInfo->basePipelineHandle);
+            serializeWrite(data, createInfo->basePipelineIndex);
+        }
+        break;
+        case VK_STRUCTURE_TYPE_COMPUTE_PIPELINE_CREATE_INFO:
+        {
+            const VkComputePipelineCreateInfo* createInfo = (const VkComputePipelineCreateInfo*) ptr;
+
+            serializeWrite(data, createInfo->flags);
+
+            if (!serializeDeep(data, &createInfo->stage))
+            {
+                return VK_FALSE;
+            }
+
+            serializeWrite(data, createInfo->layout);
+            serializeWrite(data, createInfo->basePipelineHandle);
+            serializeWrite(data, createInfo->basePipelineIndex);
+        }
+        break;
+
+        default:
+            logPrint(VKTS_LOG_WARNING, __FILE__, __LINE__, "Structure type can not be serialized deeply 0x%x", structureTypeHeader->sType);
+
+            return VK_FALSE;
+    }
+
+    return serializePointer(data, structureTypeHeader->pNext);
+}
+
+//
+//
+//
+
 uint32_t VKTS_APIENTRY serializeGetStructureTypeSize(const void* ptr)
 {
     if (!ptr)
@@ -197,4 +475,21 @@ IBinaryBufferSP VKTS_APIENTRY serializeStructureType(const void* ptr)
     return binaryBuffer;
 }
 
+IBinaryBufferSP VKTS_APIENTRY serializeStructureTypeDeep(const void* ptr)
+{
+    if (!ptr)
+    {
+        return IBinaryBufferSP();
+    }
+
+    std::vector<uint8_t> data;
+
+    if (!serializeDeep(data, ptr))
+    {
+        return IBinaryBufferSP();
+    }
+
+    return binaryBufferCreate(data);
+}
+
 }
@@ -0,0 +1,104 @@
+#ifndef BENCHMARK_HPP_
+#define BENCHMARK_HPP_
+
+#include <vkts/core/vkts_core.hpp>
+#include <vkts/math/vkts_math.hpp>
+#include <vkts/image/vkts_image.hpp>
+#include <vkts/runtime/vkts_runtime.hpp>
+
+typedef VkBool32 (*PFN_benchmarkFrameFunction)(const vkts::IUpdateThreadContext& updateContext);
+
+/**
+ * Runs the engine with one update thread and the given number of task executors.
+ * The frame function is called frameCount times. Returns the average time of one frame in seconds.
+ */
+double benchmarkRunEngine(const uint32_t taskExecutorCount, const uint32_t frameCount, const PFN_benchmarkFrameFunction frameFunction);
+
+/**
+ * Command line arguments, which are not benchmark names e.g. files to load.
+ */
+const std::vector<std::string>& benchmarkGetArguments();
+
+/**
+ * Compares the lock free task scheduler against the previous, mutex guarded task queue.
+ */
+VkBool32 benchmarkTask();
+
+/**
+ * Compares inserting and finding string keys in the hash map against the sorted map.
+ */
+VkBool32 benchmarkMap();
+
+/**
+ * Measures the JSON decoding throughput of a generated glTF like document and of the given files.
+ */
+VkBool32 benchmarkJson();
+
+/**
+ * Compares reading whole files against memory mapping them, using several loader threads.
+ */
+VkBool32 benchmarkFile();
+
+/**
+ * Compares the per texel cube map pre-filter against the vectorized one, running on several task executors.
+ */
+VkBool32 benchmarkPrefilter();
+
+/**
+ * Compares the recursive node transform update against the flattened transform hierarchy.
+ */
+VkBool32 benchmarkTransform();
+
+/**
+ * Compares testing each object against the view frustum with culling the bounding volume hierarchy, including its refit.
+ */
+VkBool32 benchmarkBvh();
+
+/**
+ * Compares testing each box against each frustum with the batched culling of one and of several frusta.
+ */
+VkBool32 benchmarkFrustum();
+
+/**
+ * Compares sampling channels by searching from the first key against the keyframe curve cursor.
+ */
+VkBool32 benchmarkAnimation();
+
+/**
+ * Compares sampling the translate, quaternion and scale channels of a skeleton against sampling the baked, quantised clip.
+ */
+VkBool32 benchmarkClip();
+
+/**
+ * Compares uploading each joint matrix of the skinned characters on its own against uploading the joint palette at once.
+ */
+VkBool32 benchmarkSkinning();
+
+/**
+ * Compares updating every n-th object per thread against the cost balanced chunks, corrected by the measured times.
+ */
+VkBool32 benchmarkPartition();
+
+/**
+ * Compares drawing each sub mesh with its own binds against collecting, sorting and recording the render queue into a mock command stream.
+ */
+VkBool32 benchmarkQueue();
+
+/**
+ * Compares binding the descriptor sets of a node looked up by its name against looking them up by the node index.
+ */
+VkBool32 benchmarkDescriptor();
+
+/**
+ * Measures the fragmentation and the number of device allocations of the sub-allocator against a fake memory properties table
+ * and compares its throughput against a first fit list.
+ */
+VkBool32 benchmarkMemory();
+
+/**
+ * Compares mapping, copying and flushing each uniform value against persistently mapped memory written through
+ * an upload ring per buffer and through one shared ring. Counts the flushes of non coherent memory.
+ */
+VkBool32 benchmarkUpload();
+
+#endif /* BENCHMARK_HPP_ */
@@ -0,0 +1,312 @@
+#include "Benchmark.hpp"
+
+#define BENCHMARK_ANIMATION_CHANNELS 1000
+#define BENCHMARK_ANIMATION_KEYS 10000
+#define BENCHMARK_ANIMATION_FRAMES 200
+
+#define BENCHMARK_LEGACY_BEZIER_TOLERANCE 0.1f
+#define BENCHMARK_LEGACY_BEZIER_LOOPS 10
+
+/**
+ * Copy of the previous interpolation, which searches the segment from the first key and inverts Bezier segments iteratively.
+ */
+static float benchmarkAnimationLegacyInterpolateLinear(const uint32_t currentIndex, const float key, const vkts::KeyframeCurve& channel)
+{
+	float beforeKey = channel.getKeys()[currentIndex];
+	float beforeValue = channel.getValues()[currentIndex];
+
+	float afterKey = channel.getKeys()[currentIndex + 1];
+
+	float deltaKey = afterKey - beforeKey;
+	if (deltaKey == 0.0f)
+	{
+		return beforeValue;
+	}
+
+	float afterValue = channel.getValues()[currentIndex + 1];
+
+	return (afterValue - beforeValue) * (key - beforeKey) / deltaKey + beforeValue;
+}
+
+static float benchmarkAnimationLegacyInterpolateBezier(const uint32_t currentIndex, const float key, const vkts::KeyframeCurve& channel)
+{
+	float beforeKey = channel.getKeys()[currentIndex];
+	float beforeValue = channel.getValues()[currentIndex];
+
+	float afterKey = channel.getKeys()[currentIndex + 1];
+
+	float deltaKey = afterKey - beforeKey;
+	if (deltaKey == 0.0f)
+	{
+		return beforeValue;
+	}
+
+	float afterValue = channel.getValues()[currentIndex + 1];
+
+	float beforeRightHandleKey = channel.getHandles()[currentIndex].z;
+	float afterLeftHandleKey = channel.getHandles()[currentIndex + 1].x;
+
+	float t;
+	float t2;
+	float t3;
+	float ot;
+	float ot2;
+	float ot3;
+
+	float currentKey = key;
+
+	bool doBinarySearch = true;
+
+	int32_t counter = 0;
+
+	do
+	{
+		t = (currentKey - beforeKey) / deltaKey;
+		t2 = t * t;
+		t3 = t2 * t;
+		ot = 1.0f - t;
+		ot2 = ot * ot;
+		ot3 = ot2 * ot;
+
+		float newKey = ot3 * beforeKey + 3.0f * ot2 * t * beforeRightHandleKey + 3.0f * ot * t2 * afterLeftHandleKey + t3 * afterKey;
+
+		if (newKey > key + BENCHMARK_LEGACY_BEZIER_TOLERANCE || newKey < key - BENCHMARK_LEGACY_BEZIER_TOLERANCE)
+		{
+			if ((newKey < currentKey && newKey > key) || (newKey > currentKey && newKey < key))
+			{
+				currentKey = (key + newKey) * 0.5f;
+			}
+			else if (newKey > currentKey)
+			{
+				currentKey -= BENCHMARK_LEGACY_BEZIER_TOLERANCE;
+			}
+			else
+			{
+				currentKey += BENCHMARK_LEGACY_BEZIER_TOLERANCE;
+			}
+		}
+		else
+		{
+			currentKey = newKey;
+
+			doBinarySearch = false;
+		}
+
+		counter++;
+	}
+	while (doBinarySearch && counter < BENCHMARK_LEGACY_BEZIER_LOOPS);
+
+	float beforeRightHandleValue = channel.getHandles()[currentIndex].w;
+	float afterLeftHandleValue = channel.getHandles()[currentIndex + 1].y;
+
+	t = (currentKey - beforeKey) / deltaKey;
+	t2 = t * t;
+	t3 = t2 * t;
+	ot = 1.0f - t;
+	ot2 = ot * ot;
+	ot3 = ot2 * ot;
+
+	return ot3 * beforeValue + 3.0f * ot2 * t * beforeRightHandleValue + 3.0f * ot * t2 * afterLeftHandleValue + t3 * afterValue;
+}
+
+static float benchmarkAnimationLegacyInterpolate(const float key, const vkts::KeyframeCurve& channel)
+{
+	if (channel.getNumberEntries() == 0)
+	{
+		return 0.0f;
+	}
+
+	if (channel.getNumberEntries() == 1)
+	{
+		return channel.getValues()[0];
+	}
+
+	if (key <= channel.getKeys()[0])
+	{
+		return channel.getValues()[0];
+	}
+
+	auto lastIndex = channel.getNumberEntries() - 1;
+
+	if (key >= channel.getKeys()[lastIndex])
+	{
+		return channel.getValues()[lastIndex];
+	}
+
+	uint32_t currentIndex = 0;
+	while (currentIndex < channel.getNumberEntries())
+	{
+		if (key < channel.getKeys()[currentIndex])
+		{
+			currentIndex--;
+
+			break;
+		}
+
+		currentIndex++;
+	}
+
+	if (channel.getInterpolators()[currentIndex] == VKTS_INTERPOLATOR_BEZIER)
+	{
+		if (channel.getInterpolators()[currentIndex + 1] == VKTS_INTERPOLATOR_BEZIER)
+		{
+			return benchmarkAnimationLegacyInterpolateBezier(currentIndex, key, channel);
+		}
+
+		return benchmarkAnimationLegacyInterpolateLinear(currentIndex, key, channel);
+	}
+
+	if (channel.getInterpolators()[currentIndex] == VKTS_INTERPOLATOR_LINEAR)
+	{
+		return benchmarkAnimationLegacyInterpolateLinear(currentIndex, key, channel);
+	}
+
+	return channel.getValues()[currentIndex];
+}
+
+/**
+ * Reference value of a Bezier segment by bisection in double precision.
+ */
+static double benchmarkAnimationReference(const float key, const vkts::KeyframeCurve& channel)
+{
+	const auto& allKeys = channel.getKeys();
+
+	uint32_t index = (uint32_t)(std::upper_bound(allKeys.begin(), allKeys.end(), key) - allKeys.begin()) - 1;
+
+	const double p0 = allKeys[index];
+	const double p1 = channel.getHandles()[index].z;
+	const double p2 = channel.getHandles()[index + 1].x;
+	const double p3 = allKeys[index + 1];
+
+	double low = 0.0;
+	double high = 1.0;
+	double t = 0.5;
+
+	for (uint32_t i = 0; i < 60; i++)
+	{
+		double ot = 1.0 - t;
+
+		if (ot * ot * ot * p0 + 3.0 * ot * ot * t * p1 + 3.0 * ot * t * t * p2 + t * t * t * p3 < (double)key)
+		{
+			low = t;
+		}
+		else
+		{
+			high = t;
+		}
+
+		t = (low + high) * 0.5;
+	}
+
+	const double v0 = channel.getValues()[index];
+	const double v1 = channel.getHandles()[index].w;
+	const double v2 = channel.getHandles()[index + 1].y;
+	const double v3 = channel.getValues()[index + 1];
+
+	double ot = 1.0 - t;
+
+	return ot * ot * ot * v0 + 3.0 * ot * ot * t * v1 + 3.0 * ot * t * t * v2 + t * t * t * v3;
+}
+
+static float benchmarkAnimationRandom(uint32_t& random)
+{
+	random = random * 1664525u + 1013904223u;
+
+	return (float)(random >> 8) / (float)(1 << 24);
+}
+
+VkBool32 benchmarkAnimation()
+{
+	// Every second channel is a Bezier curve. Keys are one frame apart.
+
+	uint32_t random = 0x12345678;
+
+	std::vector<vkts::KeyframeCurve> allChannels(BENCHMARK_ANIMATION_CHANNELS);
+
+	for (uint32_t c = 0; c < BENCHMARK_ANIMATION_CHANNELS; c++)
+	{
+		const VkTsInterpolator interpolator = (c % 2) ? VKTS_INTERPOLATOR_BEZIER : VKTS_INTERPOLATOR_LINEAR;
+
+		for (uint32_t k = 0; k < BENCHMARK_ANIMATION_KEYS; k++)
+		{
+			const float key = (float)k;
+			const float value = benchmarkAnimationRandom(random) * 10.0f;
+			const float slope = benchmarkAnimationRandom(random) * 4.0f - 2.0f;
+			const float handleLength = 0.1f + benchmarkAnimationRandom(random) * 0.3f;
+
+			allChannels[c].addEntry(key, value, glm::vec4(key - handleLength, value - slope * handleLength, key + handleLength, value + slope * handleLength), interpolator);
+		}
+	}
+
+	vkts::logPrint(VKTS_LOG_INFO, __FILE__, __LINE__, "Benchmark 'animation': %u channels, %u keys, %u frames.", BENCHMARK_ANIMATION_CHANNELS, BENCHMARK_ANIMATION_KEYS, BENCHMARK_ANIMATION_FRAMES);
+
+	std::vector<float> allLegacyValues(BENCHMARK_ANIMATION_CHANNELS);
+	std::vector<float> allValues(BENCHMARK_ANIMATION_CHANNELS);
+	std::vector<uint32_t> allCursors(BENCHMARK_ANIMATION_CHANNELS, 0);
+
+	// Playback at half the key rate from the middle, afterwards seeking to random times.
+
+	for (uint32_t seek = 0; seek < 2; seek++)
+	{
+		double legacyTime = 0.0;
+		double curveTime = 0.0;
+
+		double maxLinearDifference = 0.0;
+		double maxLegacyError = 0.0;
+		double maxCurveError = 0.0;
+
+		for (uint32_t frame = 0; frame < BENCHMARK_ANIMATION_FRAMES; frame++)
+		{
+			const float key = seek ? benchmarkAnimationRandom(random) * (float)(BENCHMARK_ANIMATION_KEYS - 1) : (float)(BENCHMARK_ANIMATION_KEYS / 2) + 0.5f * (float)frame + 0.1f;
+
+			double startTime = vkts::timeGetRaw();
+
+			for (uint32_t c = 0; c < BENCHMARK_ANIMATION_CHANNELS; c++)
+			{
+				allLegacyValues[c] = benchmarkAnimationLegacyInterpolate(key, allChannels[c]);
+			}
+
+			legacyTime += vkts::timeGetRaw() - startTime;
+
+			startTime = vkts::timeGetRaw();
+
+			for (uint32_t c = 0; c < BENCHMARK_ANIMATION_CHANNELS; c++)
+			{
+				allValues[c] = allChannels[c].sample(key, allCursors[c]);
+			}
+
+			curveTime += vkts::timeGetRaw() - startTime;
+
+			//
+
+			for (uint32_t c = 0; c < BENCHMARK_ANIMATION_CHANNELS; c++)
+			{
+				if (c % 2)
+				{
+					const double reference = benchmarkAnimationReference(key, allChannels[c]);
+
+					maxLegacyError = glm::max(maxLegacyError, glm::abs((double)allLegacyValues[c] - reference));
+					maxCurveError = glm::max(maxCurveError, glm::abs((double)allValues[c] - reference));
+				}
+				else
+				{
+					maxLinearDifference = glm::max(maxLinearDifference, (double)glm::abs(allLegacyValues[c] - allValues[c]));
+				}
+			}
+		}
+
+		if (maxLinearDifference > 1e-4 || maxCurveError > 1e-3)
+		{
+			vkts::logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Benchmark 'animation': Linear difference %g, Bezier error %g.", maxLinearDifference, maxCurveError);
+
+			return VK_FALSE;
+		}
+
+		legacyTime /= (double)BENCHMARK_ANIMATION_FRAMES;
+		curveTime /= (double)BENCHMARK_ANIMATION_FRAMES;
+
+		vkts::logPrint(VKTS_LOG_INFO, __FILE__, __LINE__, "Benchmark 'animation': %s: linear scan %8.3f ms, cursor %8.3f ms per frame, speedup %.2fx, Bezier error %g before, %g now", seek ? "seeking " : "playback", legacyTime * 1000.0, curveTime * 1000.0, legacyTime / curveTime, maxLegacyError, maxCurveError);
+	}
+
+	return VK_TRUE;
+}
@@ -0,0 +1,158 @@
+#include "Benchmark.hpp"
+
+#define BENCHMARK_BVH_OBJECTS 100000
+#define BENCHMARK_BVH_FRAMES 100
+
+static float benchmarkBvhRandom(uint32_t& random)
+{
+	random = random * 1664525u + 1013904223u;
+
+	return (float)(random >> 8) / (float)(1 << 24);
+}
+
+static vkts::Aabb benchmarkBvhBox(uint32_t& random)
+{
+	// Objects are spread over a 1000 x 100 x 1000 area.
+
+	glm::vec3 center = glm::vec3(benchmarkBvhRandom(random) * 1000.0f - 500.0f, benchmarkBvhRandom(random) * 100.0f - 50.0f, benchmarkBvhRandom(random) * 1000.0f - 500.0f);
+	glm::vec3 halfExtent = glm::vec3(0.5f + benchmarkBvhRandom(random) * 2.0f, 0.5f + benchmarkBvhRandom(random) * 2.0f, 0.5f + benchmarkBvhRandom(random) * 2.0f);
+
+	return vkts::Aabb(glm::vec4(center - halfExtent, 1.0f), glm::vec4(center + halfExtent, 1.0f));
+}
+
+VkBool32 benchmarkBvh()
+{
+	uint32_t random = 0x12345678;
+
+	std::vector<vkts::Aabb> allBoxes;
+
+	for (uint32_t i = 0; i < BENCHMARK_BVH_OBJECTS; i++)
+	{
+		allBoxes.push_back(benchmarkBvhBox(random));
+	}
+
+	vkts::Bvh bvh;
+
+	double startTime = vkts::timeGetRaw();
+
+	bvh.build(allBoxes);
+
+	double buildTime = vkts::timeGetRaw() - startTime;
+
+	vkts::logPrint(VKTS_LOG_INFO, __FILE__, __LINE__, "Benchmark 'bvh': %u objects, %u frames, %u nodes, build %.3f ms.", BENCHMARK_BVH_OBJECTS, BENCHMARK_BVH_FRAMES, bvh.getNodeCount(), buildTime * 1000.0);
+
+	const glm::mat4 projectionMatrix = vkts::perspectiveMat4(45.0f, 16.0f / 9.0f, 0.1f, 250.0f);
+
+	// Every n-th object is moved a bit each frame.
+
+	for (uint32_t movedStep = 1; movedStep <= 100; movedStep *= 10)
+	{
+		double sphereTime = 0.0;
+		double boxTime = 0.0;
+		double refitTime = 0.0;
+		double bvhTime = 0.0;
+
+		size_t visibleCount = 0;
+
+		std::vector<uint32_t> allLinearVisibleItems;
+		std::vector<uint32_t> allVisibleItems;
+
+		for (uint32_t frame = 0; frame < BENCHMARK_BVH_FRAMES; frame++)
+		{
+			for (uint32_t i = movedStep - 1; i < BENCHMARK_BVH_OBJECTS; i += movedStep)
+			{
+				glm::vec4 offset = glm::vec4(benchmarkBvhRandom(random) - 0.5f, benchmarkBvhRandom(random) - 0.5f, benchmarkBvhRandom(random) - 0.5f, 0.0f);
+
+				allBoxes[i] = vkts::Aabb(allBoxes[i].getCorner(0) + offset, allBoxes[i].getCorner(1) + offset);
+			}
+
+			// Camera is turning around.
+
+			const float angle = 360.0f * (float)frame / (float)BENCHMARK_BVH_FRAMES;
+
+			const vkts::Frustum frustum(projectionMatrix, vkts::lookAtMat4(0.0f, 0.0f, 0.0f, sinf(glm::radians(angle)), 0.0f, cosf(glm::radians(angle)), 0.0f, 1.0f, 0.0f));
+
+			// Linear sphere test, as done by the previous culling.
+
+			startTime = vkts::timeGetRaw();
+
+			uint32_t sphereVisibleCount = 0;
+
+			for (uint32_t i = 0; i < BENCHMARK_BVH_OBJECTS; i++)
+			{
+				if (frustum.isVisible(allBoxes[i].getSphere()))
+				{
+					sphereVisibleCount++;
+				}
+			}
+
+			sphereTime += vkts::timeGetRaw() - startTime;
+
+			// Linear box test, same result as the hierarchy.
+
+			startTime = vkts::timeGetRaw();
+
+			allLinearVisibleItems.clear();
+
+			for (uint32_t i = 0; i < BENCHMARK_BVH_OBJECTS; i++)
+			{
+				if (frustum.isVisible(allBoxes[i]))
+				{
+					allLinearVisibleItems.push_back(i);
+				}
+			}
+
+			boxTime += vkts::timeGetRaw() - startTime;
+
+			//
+
+			startTime = vkts::timeGetRaw();
+
+			for (uint32_t i = movedStep - 1; i < BENCHMARK_BVH_OBJECTS; i += movedStep)
+			{
+				bvh.setBox(i, allBoxes[i]);
+			}
+
+			bvh.refit();
+
+			refitTime += vkts::timeGetRaw() - startTime;
+
+			startTime = vkts::timeGetRaw();
+
+			allVisibleItems.clear();
+
+			bvh.cull(frustum, allVisibleItems);
+
+			bvhTime += vkts::timeGetRaw() - startTime;
+
+			//
+
+			std::sort(allVisibleItems.begin(), allVisibleItems.end());
+
+			if (allVisibleItems != allLinearVisibleItems)
+			{
+				vkts::logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Benchmark 'bvh': Hierarchy found %u objects, linear test %u objects.", (uint32_t)allVisibleItems.size(), (uint32_t)allLinearVisibleItems.size());
+
+				return VK_FALSE;
+			}
+
+			if (sphereVisibleCount < (uint32_t)allVisibleItems.size())
+			{
+				vkts::logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Benchmark 'bvh': Sphere test is not conservative.");
+
+				return VK_FALSE;
+			}
+
+			visibleCount += allVisibleItems.size();
+		}
+
+		sphereTime /= (double)BENCHMARK_BVH_FRAMES;
+		boxTime /= (double)BENCHMARK_BVH_FRAMES;
+		refitTime /= (double)BENCHMARK_BVH_FRAMES;
+		bvhTime /= (double)BENCHMARK_BVH_FRAMES;
+
+		vkts::logPrint(VKTS_LOG_INFO, __FILE__, __LINE__, "Benchmark 'bvh': %3u%% moved, %u visible: linear sphere %7.3f ms, linear box %7.3f ms, refit %7.3f ms, cull %7.3f ms per frame, speedup %.2fx", 100 / movedStep, (uint32_t)(visibleCount / BENCHMARK_BVH_FRAMES), sphereTime * 1000.0, boxTime * 1000.0, refitTime * 1000.0, bvhTime * 1000.0, sphereTime / (refitTime + bvhTime));
+	}
+
+	return VK_TRUE;
+}
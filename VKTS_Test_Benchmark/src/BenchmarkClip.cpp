@@ -0,0 +1,205 @@
+#include "Benchmark.hpp"
+
+#define BENCHMARK_CLIP_JOINTS 64
+#define BENCHMARK_CLIP_CHARACTERS 200
+#define BENCHMARK_CLIP_KEYS 301
+#define BENCHMARK_CLIP_SAMPLE_RATE 30.0f
+#define BENCHMARK_CLIP_FRAMES 100
+
+// Translate, quaternion and scale channels of one joint.
+#define BENCHMARK_CLIP_CHANNELS 10
+
+static float benchmarkClipRandom(uint32_t& random)
+{
+	random = random * 1664525u + 1013904223u;
+
+	return (float)(random >> 8) / (float)(1 << 24);
+}
+
+static size_t benchmarkClipCurveSize(const vkts::KeyframeCurve& curve)
+{
+	// Keys, values, handles and interpolators plus the per segment interpolator and coefficients.
+
+	const size_t entryCount = curve.getNumberEntries();
+
+	return sizeof(vkts::KeyframeCurve) + entryCount * (sizeof(float) * 2 + sizeof(glm::vec4) + sizeof(VkTsInterpolator)) + (entryCount > 0 ? entryCount - 1 : 0) * (sizeof(VkTsInterpolator) + sizeof(glm::vec4) * 2);
+}
+
+static void benchmarkClipSampleCurves(glm::vec3& translate, vkts::Quat& rotation, glm::vec3& scale, const vkts::KeyframeCurve* allCurves, uint32_t* allCursors, const float time)
+{
+	for (uint32_t i = 0; i < 3; i++)
+	{
+		translate[i] = allCurves[i].sample(time, allCursors[i]);
+	}
+
+	for (uint32_t i = 0; i < 4; i++)
+	{
+		rotation[i] = allCurves[3 + i].sample(time, allCursors[3 + i]);
+	}
+
+	rotation = vkts::normalize(rotation);
+
+	for (uint32_t i = 0; i < 3; i++)
+	{
+		scale[i] = allCurves[7 + i].sample(time, allCursors[7 + i]);
+	}
+}
+
+VkBool32 benchmarkClip()
+{
+	// Skeleton, where only the root is translated and all joints are rotated. Scale is constant.
+
+	uint32_t random = 0x12345678;
+
+	std::vector<vkts::KeyframeCurve> allCurves(BENCHMARK_CLIP_JOINTS * BENCHMARK_CLIP_CHANNELS);
+
+	size_t curveSize = 0;
+
+	for (uint32_t joint = 0; joint < BENCHMARK_CLIP_JOINTS; joint++)
+	{
+		const glm::vec3 offset = glm::vec3(benchmarkClipRandom(random), benchmarkClipRandom(random), benchmarkClipRandom(random));
+		const glm::vec3 axis = glm::vec3(benchmarkClipRandom(random) - 0.5f, benchmarkClipRandom(random) - 0.5f, benchmarkClipRandom(random) - 0.5f);
+		const float speed = 1.0f + benchmarkClipRandom(random) * 4.0f;
+
+		for (uint32_t k = 0; k < BENCHMARK_CLIP_KEYS; k++)
+		{
+			const float key = (float)k / BENCHMARK_CLIP_SAMPLE_RATE;
+
+			const glm::vec3 translate = joint == 0 ? glm::vec3(key * 1.5f, 0.1f * sinf(key * 8.0f), 0.0f) : offset;
+			const vkts::Quat rotation = vkts::rotateAxis(45.0f * sinf(key * speed), axis.x, axis.y, axis.z);
+			const glm::vec3 scale = glm::vec3(1.0f, 1.0f, 1.0f);
+
+			float allValues[BENCHMARK_CLIP_CHANNELS] = {translate.x, translate.y, translate.z, rotation.x, rotation.y, rotation.z, rotation.w, scale.x, scale.y, scale.z};
+
+			for (uint32_t c = 0; c < BENCHMARK_CLIP_CHANNELS; c++)
+			{
+				allCurves[joint * BENCHMARK_CLIP_CHANNELS + c].addEntry(key, allValues[c], glm::vec4(key - 0.1f, allValues[c], key + 0.1f, allValues[c]), VKTS_INTERPOLATOR_LINEAR);
+			}
+		}
+
+		for (uint32_t c = 0; c < BENCHMARK_CLIP_CHANNELS; c++)
+		{
+			curveSize += benchmarkClipCurveSize(allCurves[joint * BENCHMARK_CLIP_CHANNELS + c]);
+		}
+	}
+
+	// Bake at the key rate, as done when loading.
+
+	std::vector<glm::vec3> allBakeTranslates(BENCHMARK_CLIP_KEYS * BENCHMARK_CLIP_JOINTS);
+	std::vector<vkts::Quat> allBakeRotations(BENCHMARK_CLIP_KEYS * BENCHMARK_CLIP_JOINTS);
+	std::vector<glm::vec3> allBakeScales(BENCHMARK_CLIP_KEYS * BENCHMARK_CLIP_JOINTS);
+
+	std::vector<uint32_t> allBakeCursors(BENCHMARK_CLIP_JOINTS * BENCHMARK_CLIP_CHANNELS, 0);
+
+	for (uint32_t frame = 0; frame < BENCHMARK_CLIP_KEYS; frame++)
+	{
+		for (uint32_t joint = 0; joint < BENCHMARK_CLIP_JOINTS; joint++)
+		{
+			const uint32_t index = frame * BENCHMARK_CLIP_JOINTS + joint;
+
+			benchmarkClipSampleCurves(allBakeTranslates[index], allBakeRotations[index], allBakeScales[index], &allCurves[joint * BENCHMARK_CLIP_CHANNELS], &allBakeCursors[joint * BENCHMARK_CLIP_CHANNELS], (float)frame / BENCHMARK_CLIP_SAMPLE_RATE);
+		}
+	}
+
+	vkts::logPrint(VKTS_LOG_INFO, __FILE__, __LINE__, "Benchmark 'clip': %u joints, %u characters, %u keys, %u frames.", BENCHMARK_CLIP_JOINTS, BENCHMARK_CLIP_CHARACTERS, BENCHMARK_CLIP_KEYS, BENCHMARK_CLIP_FRAMES);
+
+	const float stopTime = (float)(BENCHMARK_CLIP_KEYS - 1) / BENCHMARK_CLIP_SAMPLE_RATE;
+
+	// Without and with key reduction.
+
+	for (uint32_t reduce = 0; reduce < 2; reduce++)
+	{
+		const float maxError = reduce ? 0.001f : 0.0f;
+
+		vkts::AnimationClip clip;
+
+		double startTime = vkts::timeGetRaw();
+
+		if (!clip.bake(BENCHMARK_CLIP_JOINTS, BENCHMARK_CLIP_KEYS, 0.0f, BENCHMARK_CLIP_SAMPLE_RATE, allBakeTranslates, allBakeRotations, allBakeScales, maxError))
+		{
+			vkts::logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Benchmark 'clip': Baking failed.");
+
+			return VK_FALSE;
+		}
+
+		double bakeTime = vkts::timeGetRaw() - startTime;
+
+		// Each character plays the animation from a different time.
+
+		std::vector<float> allCharacterTimes(BENCHMARK_CLIP_CHARACTERS);
+
+		for (uint32_t character = 0; character < BENCHMARK_CLIP_CHARACTERS; character++)
+		{
+			allCharacterTimes[character] = benchmarkClipRandom(random) * stopTime;
+		}
+
+		std::vector<uint32_t> allCurveCursors(BENCHMARK_CLIP_CHARACTERS * BENCHMARK_CLIP_JOINTS * BENCHMARK_CLIP_CHANNELS, 0);
+		std::vector<uint32_t> allClipCursors(BENCHMARK_CLIP_CHARACTERS, 0);
+
+		std::vector<glm::vec3> allCurveTranslates(BENCHMARK_CLIP_JOINTS);
+		std::vector<vkts::Quat> allCurveRotations(BENCHMARK_CLIP_JOINTS);
+		std::vector<glm::vec3> allCurveScales(BENCHMARK_CLIP_JOINTS);
+
+		std::vector<glm::vec3> allClipTranslates;
+		std::vector<vkts::Quat> allClipRotations;
+		std::vector<glm::vec3> allClipScales;
+
+		double curveTime = 0.0;
+		double clipTime = 0.0;
+
+		double maxTranslateError = 0.0;
+		double maxRotationError = 0.0;
+
+		for (uint32_t frame = 0; frame < BENCHMARK_CLIP_FRAMES; frame++)
+		{
+			for (uint32_t character = 0; character < BENCHMARK_CLIP_CHARACTERS; character++)
+			{
+				allCharacterTimes[character] = fmodf(allCharacterTimes[character] + 1.0f / 60.0f, stopTime);
+
+				const float time = allCharacterTimes[character];
+
+				startTime = vkts::timeGetRaw();
+
+				for (uint32_t joint = 0; joint < BENCHMARK_CLIP_JOINTS; joint++)
+				{
+					benchmarkClipSampleCurves(allCurveTranslates[joint], allCurveRotations[joint], allCurveScales[joint], &allCurves[joint * BENCHMARK_CLIP_CHANNELS], &allCurveCursors[(character * BENCHMARK_CLIP_JOINTS + joint) * BENCHMARK_CLIP_CHANNELS], time);
+				}
+
+				curveTime += vkts::timeGetRaw() - startTime;
+
+				startTime = vkts::timeGetRaw();
+
+				clip.samplePose(allClipTranslates, allClipRotations, allClipScales, time, allClipCursors[character]);
+
+				clipTime += vkts::timeGetRaw() - startTime;
+
+				//
+
+				for (uint32_t joint = 0; joint < BENCHMARK_CLIP_JOINTS; joint++)
+				{
+					maxTranslateError = glm::max(maxTranslateError, (double)glm::length(allCurveTranslates[joint] - allClipTranslates[joint]));
+
+					// Angle between both rotations in degrees.
+					const float cosHalfAngle = glm::min(glm::abs(vkts::dot(allCurveRotations[joint], allClipRotations[joint])), 1.0f);
+
+					maxRotationError = glm::max(maxRotationError, (double)glm::degrees(2.0f * acosf(cosHalfAngle)));
+				}
+			}
+		}
+
+		if (maxTranslateError > 0.01 || maxRotationError > 1.0)
+		{
+			vkts::logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Benchmark 'clip': Translate error %g, rotation error %g degrees.", maxTranslateError, maxRotationError);
+
+			return VK_FALSE;
+		}
+
+		curveTime /= (double)BENCHMARK_CLIP_FRAMES;
+		clipTime /= (double)BENCHMARK_CLIP_FRAMES;
+
+		vkts::logPrint(VKTS_LOG_INFO, __FILE__, __LINE__, "Benchmark 'clip': max error %.4f: %u frames, bake %.3f ms, memory %zu bytes channels, %zu bytes clip, %.1fx smaller", maxError, clip.getNumberFrames(), bakeTime * 1000.0, curveSize, clip.getMemorySize(), (double)curveSize / (double)clip.getMemorySize());
+		vkts::logPrint(VKTS_LOG_INFO, __FILE__, __LINE__, "Benchmark 'clip': max error %.4f: channels %7.3f ms, clip %7.3f ms per frame, speedup %.2fx, error %g translate, %g degrees", maxError, curveTime * 1000.0, clipTime * 1000.0, curveTime / clipTime, maxTranslateError, maxRotationError);
+	}
+
+	return VK_TRUE;
+}
@@ -0,0 +1,193 @@
+#include "Benchmark.hpp"
+
+#define BENCHMARK_DESCRIPTOR_NODES 4000
+#define BENCHMARK_DESCRIPTOR_DRAWS 3
+#define BENCHMARK_DESCRIPTOR_FRAMES 100
+#define BENCHMARK_DESCRIPTOR_POOL_CAPACITY 16
+
+typedef struct BenchmarkDescriptorOffset_
+{
+	uint32_t offset;
+	uint32_t stride;
+} BenchmarkDescriptorOffset;
+
+static std::vector<std::string> g_allNodeNames;
+
+// Previous per node state of a material, keyed by the node name.
+static vkts::SmartPointerMap<std::string, std::shared_ptr<uint64_t>> g_allNamedDescriptorSets;
+static std::map<std::string, std::map<uint32_t, VkBool32>> g_allNamedBindingPresent;
+
+// Per node state of a material, indexed by the node index.
+static std::vector<std::shared_ptr<uint64_t>> g_allIndexedDescriptorSets;
+static std::vector<uint64_t> g_allIndexedBindingPresent;
+
+static std::map<uint32_t, BenchmarkDescriptorOffset> g_dynamicOffsetMappings;
+
+/**
+ * Copy of the previous binding of the descriptor sets of one node.
+ */
+static uint64_t benchmarkDescriptorBindNamed(const std::string& nodeName, const uint32_t currentBuffer)
+{
+	std::shared_ptr<uint64_t> currentDescriptorSets;
+
+	if (g_allNamedDescriptorSets.contains(nodeName))
+	{
+		currentDescriptorSets = g_allNamedDescriptorSets[nodeName];
+	}
+
+	if (!currentDescriptorSets.get())
+	{
+		return 0;
+	}
+
+	uint32_t localDynamicOffsetCount = 0;
+
+	std::vector<uint32_t> localDynamicOffsets;
+
+	const auto& currentBindingPresent = g_allNamedBindingPresent.at(nodeName);
+	for (const auto& currentBinding : currentBindingPresent)
+	{
+		if (currentBinding.second)
+		{
+			auto currentOffset = g_dynamicOffsetMappings.find(currentBinding.first);
+
+			if (currentOffset != g_dynamicOffsetMappings.end())
+			{
+				localDynamicOffsetCount++;
+
+				localDynamicOffsets.push_back(currentOffset->second.stride * currentBuffer + currentOffset->second.offset);
+			}
+		}
+	}
+
+	return *currentDescriptorSets + localDynamicOffsetCount + (localDynamicOffsetCount > 0 ? localDynamicOffsets[localDynamicOffsetCount - 1] : 0);
+}
+
+static uint64_t benchmarkDescriptorBindIndexed(const int32_t nodeIndex, const uint32_t currentBuffer)
+{
+	if (nodeIndex < 0 || (size_t)nodeIndex >= g_allIndexedDescriptorSets.size() || !g_allIndexedDescriptorSets[nodeIndex].get())
+	{
+		return 0;
+	}
+
+	const auto& currentDescriptorSets = g_allIndexedDescriptorSets[nodeIndex];
+
+	uint32_t localDynamicOffsetCount = 0;
+
+	uint32_t localDynamicOffsets[64];
+
+	uint64_t currentBindingPresent = g_allIndexedBindingPresent[nodeIndex];
+	for (uint32_t currentBinding = 0; currentBindingPresent != 0; currentBinding++, currentBindingPresent >>= 1)
+	{
+		if (currentBindingPresent & 1)
+		{
+			auto currentOffset = g_dynamicOffsetMappings.find(currentBinding);
+
+			if (currentOffset != g_dynamicOffsetMappings.end())
+			{
+				localDynamicOffsets[localDynamicOffsetCount] = currentOffset->second.stride * currentBuffer + currentOffset->second.offset;
+
+				localDynamicOffsetCount++;
+			}
+		}
+	}
+
+	return *currentDescriptorSets + localDynamicOffsetCount + (localDynamicOffsetCount > 0 ? localDynamicOffsets[localDynamicOffsetCount - 1] : 0);
+}
+
+VkBool32 benchmarkDescriptor()
+{
+	// Names as created by the loaders, so they share a long prefix. Transform and bone transform are dynamic.
+
+	g_dynamicOffsetMappings[1] = {0, 256};
+	g_dynamicOffsetMappings[3] = {0, 4096};
+
+	g_allIndexedDescriptorSets.resize(BENCHMARK_DESCRIPTOR_NODES);
+	g_allIndexedBindingPresent.resize(BENCHMARK_DESCRIPTOR_NODES);
+
+	for (uint32_t i = 0; i < BENCHMARK_DESCRIPTOR_NODES; i++)
+	{
+		g_allNodeNames.push_back("Scene_Object_Armature_Node_" + std::to_string(i));
+
+		auto descriptorSets = std::shared_ptr<uint64_t>(new uint64_t(i));
+
+		g_allNamedDescriptorSets[g_allNodeNames[i]] = descriptorSets;
+		g_allIndexedDescriptorSets[i] = descriptorSets;
+
+		g_allNamedBindingPresent[g_allNodeNames[i]][0] = VK_FALSE;
+		g_allNamedBindingPresent[g_allNodeNames[i]][1] = VK_TRUE;
+		g_allIndexedBindingPresent[i] = (uint64_t)1 << 1;
+
+		if (i % 4 == 0)
+		{
+			g_allNamedBindingPresent[g_allNodeNames[i]][3] = VK_TRUE;
+			g_allIndexedBindingPresent[i] |= (uint64_t)1 << 3;
+		}
+	}
+
+	// One pool per node before, now pools doubling in size.
+
+	uint32_t poolCount = 0;
+
+	for (uint32_t capacity = 0, nextCapacity = BENCHMARK_DESCRIPTOR_POOL_CAPACITY; capacity < BENCHMARK_DESCRIPTOR_NODES; capacity += nextCapacity, nextCapacity *= 2)
+	{
+		poolCount++;
+	}
+
+	vkts::logPrint(VKTS_LOG_INFO, __FILE__, __LINE__, "Benchmark 'descriptor': %u nodes, %u draws per node, %u frames. Descriptor pools: by name %u, growable %u.", BENCHMARK_DESCRIPTOR_NODES, BENCHMARK_DESCRIPTOR_DRAWS, BENCHMARK_DESCRIPTOR_FRAMES, BENCHMARK_DESCRIPTOR_NODES, poolCount);
+
+	uint64_t namedChecksum = 0;
+	uint64_t indexedChecksum = 0;
+
+	double namedTime = 0.0;
+	double indexedTime = 0.0;
+
+	for (uint32_t frame = 0; frame < BENCHMARK_DESCRIPTOR_FRAMES; frame++)
+	{
+		const uint32_t currentBuffer = frame % 2;
+
+		double startTime = vkts::timeGetRaw();
+
+		for (uint32_t i = 0; i < BENCHMARK_DESCRIPTOR_NODES; i++)
+		{
+			for (uint32_t k = 0; k < BENCHMARK_DESCRIPTOR_DRAWS; k++)
+			{
+				namedChecksum += benchmarkDescriptorBindNamed(g_allNodeNames[i], currentBuffer);
+			}
+		}
+
+		namedTime += vkts::timeGetRaw() - startTime;
+
+		startTime = vkts::timeGetRaw();
+
+		for (uint32_t i = 0; i < BENCHMARK_DESCRIPTOR_NODES; i++)
+		{
+			for (uint32_t k = 0; k < BENCHMARK_DESCRIPTOR_DRAWS; k++)
+			{
+				indexedChecksum += benchmarkDescriptorBindIndexed((int32_t)i, currentBuffer);
+			}
+		}
+
+		indexedTime += vkts::timeGetRaw() - startTime;
+	}
+
+	if (namedChecksum != indexedChecksum)
+	{
+		vkts::logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Benchmark 'descriptor': Checksum by name %llu and by index %llu differ.", (unsigned long long)namedChecksum, (unsigned long long)indexedChecksum);
+
+		return VK_FALSE;
+	}
+
+	const double bindCount = (double)(BENCHMARK_DESCRIPTOR_NODES * BENCHMARK_DESCRIPTOR_DRAWS * BENCHMARK_DESCRIPTOR_FRAMES);
+
+	vkts::logPrint(VKTS_LOG_INFO, __FILE__, __LINE__, "Benchmark 'descriptor': by name %7.1f ns, by index %7.1f ns per bind, speedup %.2fx", namedTime * 1.0e9 / bindCount, indexedTime * 1.0e9 / bindCount, namedTime / indexedTime);
+
+	g_allNodeNames.clear();
+	g_allNamedDescriptorSets.clear();
+	g_allNamedBindingPresent.clear();
+	g_allIndexedDescriptorSets.clear();
+	g_allIndexedBindingPresent.clear();
+	g_dynamicOffsetMappings.clear();
+
+	return VK_TRUE;
+}
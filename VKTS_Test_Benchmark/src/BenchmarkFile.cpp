@@ -0,0 +1,187 @@
+#include "Benchmark.hpp"
+
+#define BENCHMARK_FILE_COUNT 16
+#define BENCHMARK_FILE_BYTES (8 * 1024 * 1024)
+#define BENCHMARK_FILE_PAGE_BYTES 4096
+#define BENCHMARK_FILE_RUNS 3
+
+typedef vkts::IBinaryBufferSP (*PFN_benchmarkFileLoadFunction)(const char* filename);
+
+static std::vector<std::string> g_allFilenames;
+
+static std::vector<uint64_t> g_allChecksums;
+
+/**
+ * Sums up all bytes, so every page of a mapped file is touched.
+ */
+static uint64_t benchmarkFileChecksum(const vkts::IBinaryBufferSP& buffer)
+{
+    if (!buffer.get() || !buffer->getByteData())
+    {
+        return 0;
+    }
+
+    const uint8_t* data = buffer->getByteData();
+
+    uint64_t checksum = 0;
+
+    for (uint32_t i = 0; i < buffer->getSize(); i++)
+    {
+        checksum += (uint64_t)data[i] * (uint64_t)((i & 255) + 1);
+    }
+
+    return checksum;
+}
+
+/**
+ * Each thread loads every threadCount-th file and verifies its content.
+ */
+static double benchmarkFileRun(const uint32_t threadCount, const PFN_benchmarkFileLoadFunction loadFunction, VkBool32& valid)
+{
+    std::atomic<uint32_t> errorCount(0);
+
+    double startTime = vkts::timeGetRaw();
+
+    std::vector<std::thread> allThreads;
+
+    for (uint32_t threadIndex = 0; threadIndex < threadCount; threadIndex++)
+    {
+        allThreads.push_back(std::thread([threadIndex, threadCount, loadFunction, &errorCount]() {
+            for (size_t i = threadIndex; i < g_allFilenames.size(); i += threadCount)
+            {
+                auto buffer = loadFunction(g_allFilenames[i].c_str());
+
+                if (benchmarkFileChecksum(buffer) != g_allChecksums[i])
+                {
+                    errorCount.fetch_add(1);
+                }
+            }
+        }));
+    }
+
+    for (auto& currentThread : allThreads)
+    {
+        currentThread.join();
+    }
+
+    valid = errorCount.load() == 0;
+
+    return vkts::timeGetRaw() - startTime;
+}
+
+/**
+ * A file ending exactly on a page boundary still has to be zero terminated.
+ */
+static VkBool32 benchmarkFileVerifyText()
+{
+    std::string text(BENCHMARK_FILE_PAGE_BYTES, 'x');
+
+    text[BENCHMARK_FILE_PAGE_BYTES - 1] = '\n';
+
+    const char* filename = "benchmark_file_text.txt";
+
+    if (!vkts::fileSaveBinaryData(filename, text.c_str(), (uint32_t)text.length()))
+    {
+        return VK_FALSE;
+    }
+
+    auto textBuffer = vkts::fileMapText(filename);
+
+    VkBool32 result = textBuffer.get() && textBuffer->getLength() == text.length() && strlen(textBuffer->getString()) == text.length() && text == textBuffer->getString();
+
+    textBuffer.reset();
+
+    remove(filename);
+
+    return result;
+}
+
+VkBool32 benchmarkFile()
+{
+    if (!benchmarkFileVerifyText())
+    {
+        vkts::logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Benchmark 'file': Mapped text is not zero terminated.");
+
+        return VK_FALSE;
+    }
+
+    // Generated files are removed afterwards, which expects the current directory as the base directory.
+
+    std::vector<uint8_t> data(BENCHMARK_FILE_BYTES);
+
+    char filename[VKTS_MAX_BUFFER_CHARS];
+
+    g_allFilenames.clear();
+    g_allChecksums.clear();
+
+    for (uint32_t i = 0; i < BENCHMARK_FILE_COUNT; i++)
+    {
+        for (uint32_t k = 0; k < BENCHMARK_FILE_BYTES; k++)
+        {
+            data[k] = (uint8_t)((k * 31 + i * 7 + (k >> 12)) & 255);
+        }
+
+        snprintf(filename, VKTS_MAX_BUFFER_CHARS, "benchmark_file_%u.bin", i);
+
+        if (!vkts::fileSaveBinaryData(filename, &data[0], BENCHMARK_FILE_BYTES))
+        {
+            vkts::logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Benchmark 'file': Could not save '%s'.", filename);
+
+            return VK_FALSE;
+        }
+
+        g_allFilenames.push_back(filename);
+
+        g_allChecksums.push_back(benchmarkFileChecksum(vkts::binaryBufferCreate(&data[0], BENCHMARK_FILE_BYTES)));
+    }
+
+    const double megaBytes = (double)BENCHMARK_FILE_COUNT * (double)BENCHMARK_FILE_BYTES / (1024.0 * 1024.0);
+
+    vkts::logPrint(VKTS_LOG_INFO, __FILE__, __LINE__, "Benchmark 'file': %u files, %.2f MB in total, %u runs.", BENCHMARK_FILE_COUNT, megaBytes, BENCHMARK_FILE_RUNS);
+
+    VkBool32 result = VK_TRUE;
+
+    // Warm up the file cache, so only loading is measured.
+    benchmarkFileRun(1, vkts::fileLoadBinary, result);
+
+    for (uint32_t threadCount = 1; threadCount <= 8 && result; threadCount *= 2)
+    {
+        double loadTime = 0.0;
+        double mapTime = 0.0;
+
+        for (uint32_t run = 0; run < BENCHMARK_FILE_RUNS && result; run++)
+        {
+            VkBool32 loadValid = VK_FALSE;
+            VkBool32 mapValid = VK_FALSE;
+
+            loadTime += benchmarkFileRun(threadCount, vkts::fileLoadBinary, loadValid);
+
+            mapTime += benchmarkFileRun(threadCount, vkts::fileMapBinary, mapValid);
+
+            if (!loadValid || !mapValid)
+            {
+                vkts::logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Benchmark 'file': Loaded content differs.");
+
+                result = VK_FALSE;
+            }
+        }
+
+        loadTime /= (double)BENCHMARK_FILE_RUNS;
+        mapTime /= (double)BENCHMARK_FILE_RUNS;
+
+        if (result)
+        {
+            vkts::logPrint(VKTS_LOG_INFO, __FILE__, __LINE__, "Benchmark 'file': %u threads: load %8.2f ms, %8.2f MB/s, map %8.2f ms, %8.2f MB/s, speedup %.2fx", threadCount, loadTime * 1000.0, megaBytes / loadTime, mapTime * 1000.0, megaBytes / mapTime, loadTime / mapTime);
+        }
+    }
+
+    for (const auto& currentFilename : g_allFilenames)
+    {
+        remove(currentFilename.c_str());
+    }
+
+    g_allFilenames.clear();
+    g_allChecksums.clear();
+
+    return result;
+}
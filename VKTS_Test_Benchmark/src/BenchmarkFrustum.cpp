@@ -0,0 +1,173 @@
+#include "Benchmark.hpp"
+
+#define BENCHMARK_FRUSTUM_OBJECTS 100000
+#define BENCHMARK_FRUSTUM_FRAMES 100
+#define BENCHMARK_FRUSTUM_CASCADES 4
+
+/**
+ * Copy of the previous box test, which converts the box to an oriented box and tests all corners against all planes.
+ */
+static VkBool32 benchmarkFrustumLegacyIsVisible(const vkts::Frustum& frustum, const vkts::Aabb& aabbWorld)
+{
+	const vkts::Obb& obbWorld = aabbWorld.getObb();
+
+	for (uint32_t side = 0; side < 6; side++)
+	{
+		VkBool32 outsidePlane = VK_TRUE;
+
+		for (uint32_t i = 0; i < 8; i++)
+		{
+			if (frustum.getSide(side).distance(obbWorld.getCorner(i)) >= 0.0f)
+			{
+				outsidePlane = VK_FALSE;
+
+				break;
+			}
+		}
+
+		if (outsidePlane)
+		{
+			return VK_FALSE;
+		}
+	}
+
+	return VK_TRUE;
+}
+
+static float benchmarkFrustumRandom(uint32_t& random)
+{
+	random = random * 1664525u + 1013904223u;
+
+	return (float)(random >> 8) / (float)(1 << 24);
+}
+
+VkBool32 benchmarkFrustum()
+{
+	uint32_t random = 0x12345678;
+
+	std::vector<vkts::Aabb> allBoxes;
+
+	std::vector<float> allCentersX, allCentersY, allCentersZ;
+	std::vector<float> allExtentsX, allExtentsY, allExtentsZ;
+
+	for (uint32_t i = 0; i < BENCHMARK_FRUSTUM_OBJECTS; i++)
+	{
+		glm::vec3 center = glm::vec3(benchmarkFrustumRandom(random) * 1000.0f - 500.0f, benchmarkFrustumRandom(random) * 100.0f - 50.0f, benchmarkFrustumRandom(random) * 1000.0f - 500.0f);
+		glm::vec3 halfExtent = glm::vec3(0.5f + benchmarkFrustumRandom(random) * 2.0f, 0.5f + benchmarkFrustumRandom(random) * 2.0f, 0.5f + benchmarkFrustumRandom(random) * 2.0f);
+
+		allBoxes.push_back(vkts::Aabb(glm::vec4(center - halfExtent, 1.0f), glm::vec4(center + halfExtent, 1.0f)));
+
+		allCentersX.push_back(center.x);
+		allCentersY.push_back(center.y);
+		allCentersZ.push_back(center.z);
+		allExtentsX.push_back(halfExtent.x);
+		allExtentsY.push_back(halfExtent.y);
+		allExtentsZ.push_back(halfExtent.z);
+	}
+
+	const VkTsCullBounds bounds = {allCentersX.data(), allCentersY.data(), allCentersZ.data(), allExtentsX.data(), allExtentsY.data(), allExtentsZ.data(), nullptr};
+
+	vkts::logPrint(VKTS_LOG_INFO, __FILE__, __LINE__, "Benchmark 'frustum': %u objects, %u frames.", BENCHMARK_FRUSTUM_OBJECTS, BENCHMARK_FRUSTUM_FRAMES);
+
+	std::vector<uint8_t> allLegacyMasks(BENCHMARK_FRUSTUM_OBJECTS);
+	std::vector<uint8_t> allBoxMasks(BENCHMARK_FRUSTUM_OBJECTS);
+	std::vector<uint8_t> allBoundsMasks(BENCHMARK_FRUSTUM_OBJECTS);
+
+	// One view, afterwards shadow cascades with increasing distance.
+
+	for (uint32_t frustumCount = 1; frustumCount <= BENCHMARK_FRUSTUM_CASCADES; frustumCount += BENCHMARK_FRUSTUM_CASCADES - 1)
+	{
+		double legacyTime = 0.0;
+		double boxTime = 0.0;
+		double boundsTime = 0.0;
+
+		uint32_t mismatchCount = 0;
+
+		for (uint32_t frame = 0; frame < BENCHMARK_FRUSTUM_FRAMES; frame++)
+		{
+			const float angle = 360.0f * (float)frame / (float)BENCHMARK_FRUSTUM_FRAMES;
+
+			const glm::mat4 viewMatrix = vkts::lookAtMat4(0.0f, 0.0f, 0.0f, sinf(glm::radians(angle)), 0.0f, cosf(glm::radians(angle)), 0.0f, 1.0f, 0.0f);
+
+			std::vector<vkts::Frustum> allFrusta;
+
+			for (uint32_t f = 0; f < frustumCount; f++)
+			{
+				allFrusta.push_back(vkts::Frustum(vkts::perspectiveMat4(45.0f, 16.0f / 9.0f, 0.1f + 60.0f * (float)f, 60.0f * (float)(f + 1)), viewMatrix));
+			}
+
+			std::vector<const vkts::Frustum*> allFrustumPointers;
+
+			for (uint32_t f = 0; f < frustumCount; f++)
+			{
+				allFrustumPointers.push_back(&allFrusta[f]);
+			}
+
+			//
+
+			double startTime = vkts::timeGetRaw();
+
+			for (uint32_t i = 0; i < BENCHMARK_FRUSTUM_OBJECTS; i++)
+			{
+				uint8_t currentMask = 0;
+
+				for (uint32_t f = 0; f < frustumCount; f++)
+				{
+					if (benchmarkFrustumLegacyIsVisible(allFrusta[f], allBoxes[i]))
+					{
+						currentMask |= (uint8_t)(1 << f);
+					}
+				}
+
+				allLegacyMasks[i] = currentMask;
+			}
+
+			legacyTime += vkts::timeGetRaw() - startTime;
+
+			startTime = vkts::timeGetRaw();
+
+			vkts::Frustum::cull(allFrustumPointers.data(), frustumCount, nullptr, allBoxes.data(), BENCHMARK_FRUSTUM_OBJECTS, allBoxMasks.data());
+
+			boxTime += vkts::timeGetRaw() - startTime;
+
+			startTime = vkts::timeGetRaw();
+
+			vkts::Frustum::cull(allFrustumPointers.data(), frustumCount, bounds, BENCHMARK_FRUSTUM_OBJECTS, allBoundsMasks.data());
+
+			boundsTime += vkts::timeGetRaw() - startTime;
+
+			//
+
+			for (uint32_t i = 0; i < BENCHMARK_FRUSTUM_OBJECTS; i++)
+			{
+				if (allBoxMasks[i] != allBoundsMasks[i])
+				{
+					vkts::logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Benchmark 'frustum': Box and bounds results differ for object %u.", i);
+
+					return VK_FALSE;
+				}
+
+				// Results can only differ for boxes touching a plane, because of rounding.
+				if (allLegacyMasks[i] != allBoxMasks[i])
+				{
+					mismatchCount++;
+				}
+			}
+		}
+
+		if (mismatchCount > BENCHMARK_FRUSTUM_FRAMES)
+		{
+			vkts::logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Benchmark 'frustum': %u results differ from the previous test.", mismatchCount);
+
+			return VK_FALSE;
+		}
+
+		legacyTime /= (double)BENCHMARK_FRUSTUM_FRAMES;
+		boxTime /= (double)BENCHMARK_FRUSTUM_FRAMES;
+		boundsTime /= (double)BENCHMARK_FRUSTUM_FRAMES;
+
+		vkts::logPrint(VKTS_LOG_INFO, __FILE__, __LINE__, "Benchmark 'frustum': %u frusta: per object %7.3f ms, batched boxes %7.3f ms, batched bounds %7.3f ms per frame, speedup %.2fx / %.2fx, %u differences", frustumCount, legacyTime * 1000.0, boxTime * 1000.0, boundsTime * 1000.0, legacyTime / boxTime, legacyTime / boundsTime, mismatchCount);
+	}
+
+	return VK_TRUE;
+}
@@ -0,0 +1,264 @@
+#include "Benchmark.hpp"
+
+#define BENCHMARK_JSON_NODES 20000
+#define BENCHMARK_JSON_BASE64_BYTES (4 * 1024 * 1024)
+#define BENCHMARK_JSON_RUNS 3
+
+static const char* g_base64Characters = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+/**
+ * Pretty printed glTF like document: Many small objects, float arrays and one large inline buffer.
+ */
+static void benchmarkJsonCreateDocument(std::string& jsonText)
+{
+    char buffer[VKTS_MAX_BUFFER_CHARS];
+
+    jsonText.clear();
+
+    jsonText += "{\n    \"asset\" : {\n        \"generator\" : \"VKTS_Test_Benchmark\",\n        \"version\" : \"1.0\"\n    },\n";
+
+    jsonText += "    \"buffers\" : {\n        \"buffer\" : {\n            \"byteLength\" : 3145728,\n            \"uri\" : \"data:application/octet-stream;base64,";
+
+    for (uint32_t i = 0; i < BENCHMARK_JSON_BASE64_BYTES; i++)
+    {
+        jsonText += g_base64Characters[(i * 7 + i / 64) % 64];
+    }
+
+    jsonText += "\"\n        }\n    },\n";
+
+    jsonText += "    \"accessors\" : {\n";
+
+    for (uint32_t i = 0; i < BENCHMARK_JSON_NODES; i++)
+    {
+        snprintf(buffer, VKTS_MAX_BUFFER_CHARS, "        \"accessor_%u\" : {\n            \"bufferView\" : \"bufferView_%u\",\n            \"byteOffset\" : %u,\n            \"componentType\" : 5126,\n            \"count\" : %u,\n            \"type\" : \"VEC3\",\n            \"min\" : [ -%u.5, -1.25, -0.125 ],\n            \"max\" : [ %u.5, 1.25, 0.125 ]\n        }%s\n", i, i, i * 48, 64 + i % 100, i, i, i + 1 < BENCHMARK_JSON_NODES ? "," : "");
+
+        jsonText += buffer;
+    }
+
+    jsonText += "    },\n    \"nodes\" : {\n";
+
+    for (uint32_t i = 0; i < BENCHMARK_JSON_NODES; i++)
+    {
+        snprintf(buffer, VKTS_MAX_BUFFER_CHARS, "        \"node_%u\" : {\n            \"name\" : \"Node \\\"%u\\\"\",\n            \"children\" : [],\n            \"matrix\" : [ 1.0, 0.0, 0.0, 0.0, 0.0, 1.0, 0.0, 0.0, 0.0, 0.0, 1.0, 0.0, %f, %f, %f, 1.0 ],\n            \"visible\" : true,\n            \"extras\" : null\n        }%s\n", i, i, (float)i * 0.5f, (float)i * -0.25f, (float)i * 1e-3f, i + 1 < BENCHMARK_JSON_NODES ? "," : "");
+
+        jsonText += buffer;
+    }
+
+    jsonText += "    }\n}\n";
+}
+
+/**
+ * Visits every value, so the lazy decoder has to decode everything.
+ */
+class BenchmarkJsonVisitor : public vkts::JsonVisitor
+{
+
+public:
+
+    uint32_t valueCount;
+
+    BenchmarkJsonVisitor() :
+        JsonVisitor(), valueCount(0)
+    {
+    }
+
+    virtual ~BenchmarkJsonVisitor()
+    {
+    }
+
+    virtual void visit(vkts::JSONnull& jsonNull)
+    {
+        valueCount++;
+    }
+
+    virtual void visit(vkts::JSONfalse& jsonFalse)
+    {
+        valueCount++;
+    }
+
+    virtual void visit(vkts::JSONtrue& jsonTrue)
+    {
+        valueCount++;
+    }
+
+    virtual void visit(vkts::JSONfloat& jsonFloat)
+    {
+        valueCount++;
+    }
+
+    virtual void visit(vkts::JSONinteger& jsonInteger)
+    {
+        valueCount++;
+    }
+
+    virtual void visit(vkts::JSONstring& jsonString)
+    {
+        valueCount++;
+    }
+
+    virtual void visit(vkts::JSONarray& jsonArray)
+    {
+        valueCount++;
+
+        for (uint32_t i = 0; i < jsonArray.size(); i++)
+        {
+            jsonArray.getValueAt(i)->visit(*this);
+        }
+    }
+
+    virtual void visit(vkts::JSONobject& jsonObject)
+    {
+        valueCount++;
+
+        for (uint32_t i = 0; i < jsonObject.size(); i++)
+        {
+            jsonObject.getValueAt(i)->visit(*this);
+        }
+    }
+
+};
+
+static VkBool32 benchmarkJsonRun(const std::string& name, const std::string& jsonText)
+{
+    const double megaBytes = (double)jsonText.length() / (1024.0 * 1024.0);
+
+    double eagerTime = 0.0;
+    double releaseTime = 0.0;
+    uint32_t eagerValueCount = 0;
+
+    uint64_t maxRam = 0;
+
+    for (uint32_t run = 0; run < BENCHMARK_JSON_RUNS; run++)
+    {
+        uint64_t startRam = 0;
+        uint64_t endRam = 0;
+
+        vkts::profileApplicationGetRam(startRam);
+
+        double startTime = vkts::timeGetRaw();
+
+        auto json = vkts::jsonDecode(jsonText);
+
+        eagerTime += vkts::timeGetRaw() - startTime;
+
+        vkts::profileApplicationGetRam(endRam);
+
+        maxRam = glm::max(maxRam, endRam > startRam ? endRam - startRam : 0);
+
+        if (!json.get())
+        {
+            vkts::logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Benchmark 'json': Could not decode '%s'.", name.c_str());
+
+            return VK_FALSE;
+        }
+
+        BenchmarkJsonVisitor visitor;
+
+        json->visit(visitor);
+
+        eagerValueCount = visitor.valueCount;
+
+        startTime = vkts::timeGetRaw();
+
+        json.reset();
+
+        releaseTime += vkts::timeGetRaw() - startTime;
+    }
+
+    eagerTime /= (double)BENCHMARK_JSON_RUNS;
+    releaseTime /= (double)BENCHMARK_JSON_RUNS;
+
+    vkts::logPrint(VKTS_LOG_INFO, __FILE__, __LINE__, "Benchmark 'json': '%s' %.2f MB, %u values: decode %8.2f ms, %8.2f MB/s, release %8.2f ms, additional RAM %" PRIu64 " kB", name.c_str(), megaBytes, eagerValueCount, eagerTime * 1000.0, megaBytes / eagerTime, releaseTime * 1000.0, maxRam);
+
+    //
+
+    double lazyTime = 0.0;
+    double lazyVisitTime = 0.0;
+
+    for (uint32_t run = 0; run < BENCHMARK_JSON_RUNS; run++)
+    {
+        double startTime = vkts::timeGetRaw();
+
+        auto json = vkts::jsonDecodeLazy(jsonText);
+
+        lazyTime += vkts::timeGetRaw() - startTime;
+
+        if (!json.get())
+        {
+            vkts::logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Benchmark 'json': Could not lazy decode '%s'.", name.c_str());
+
+            return VK_FALSE;
+        }
+
+        BenchmarkJsonVisitor visitor;
+
+        startTime = vkts::timeGetRaw();
+
+        json->visit(visitor);
+
+        lazyVisitTime += vkts::timeGetRaw() - startTime;
+
+        if (visitor.valueCount != eagerValueCount)
+        {
+            vkts::logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Benchmark 'json': Lazy decoded '%s' has %u instead of %u values.", name.c_str(), visitor.valueCount, eagerValueCount);
+
+            return VK_FALSE;
+        }
+    }
+
+    lazyTime /= (double)BENCHMARK_JSON_RUNS;
+    lazyVisitTime /= (double)BENCHMARK_JSON_RUNS;
+
+    vkts::logPrint(VKTS_LOG_INFO, __FILE__, __LINE__, "Benchmark 'json': '%s' lazy decode %8.2f ms, %8.2f MB/s, visiting all values %8.2f ms", name.c_str(), lazyTime * 1000.0, megaBytes / lazyTime, lazyVisitTime * 1000.0);
+
+    return VK_TRUE;
+}
+
+VkBool32 benchmarkJson()
+{
+    // Files given on the command line are decoded in addition to the generated document.
+
+    for (const auto& argument : benchmarkGetArguments())
+    {
+        auto textFile = vkts::fileLoadText(argument.c_str());
+
+        if (!textFile.get())
+        {
+            continue;
+        }
+
+        if (!benchmarkJsonRun(argument, textFile->getString()))
+        {
+            return VK_FALSE;
+        }
+
+        // Decoding from the mapped file does not copy the text.
+
+        double startTime = vkts::timeGetRaw();
+
+        auto mappedFile = vkts::fileMapText(argument.c_str());
+
+        auto json = vkts::jsonDecodeLazy(mappedFile);
+
+        double mappedTime = vkts::timeGetRaw() - startTime;
+
+        if (!json.get())
+        {
+            vkts::logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Benchmark 'json': Could not lazy decode mapped '%s'.", argument.c_str());
+
+            return VK_FALSE;
+        }
+
+        BenchmarkJsonVisitor visitor;
+
+        json->visit(visitor);
+
+        vkts::logPrint(VKTS_LOG_INFO, __FILE__, __LINE__, "Benchmark 'json': '%s' mapped and lazy decoded %8.2f ms, %u values", argument.c_str(), mappedTime * 1000.0, visitor.valueCount);
+    }
+
+    std::string jsonText;
+
+    benchmarkJsonCreateDocument(jsonText);
+
+    return benchmarkJsonRun("generated", jsonText);
+}
@@ -0,0 +1,109 @@
+#include "Benchmark.hpp"
+
+#define BENCHMARK_MAP_MIN_COUNT 10000
+#define BENCHMARK_MAP_MAX_COUNT 1000000
+
+// The sorted map inserts in linear time, so larger counts take minutes.
+#define BENCHMARK_MAP_MAX_SORTED_COUNT 100000
+
+static void benchmarkMapCreateKeys(std::vector<std::string>& allKeys, const uint32_t count)
+{
+    allKeys.clear();
+    allKeys.reserve(count);
+
+    // Similar to node and mesh names of a large scene, inserted in a shuffled order.
+
+    char buffer[VKTS_MAX_TOKEN_CHARS];
+
+    for (uint32_t i = 0; i < count; i++)
+    {
+        snprintf(buffer, VKTS_MAX_TOKEN_CHARS, "Object_%u_Mesh", i);
+
+        allKeys.push_back(buffer);
+    }
+
+    uint32_t random = 0x12345678;
+
+    for (uint32_t i = count - 1; i > 0; i--)
+    {
+        random = random * 1664525u + 1013904223u;
+
+        std::swap(allKeys[i], allKeys[random % (i + 1)]);
+    }
+}
+
+template<class M>
+static VkBool32 benchmarkMapRun(const std::vector<std::string>& allKeys, double& insertTime, double& lookupTime)
+{
+    M map;
+
+    double startTime = vkts::timeGetRaw();
+
+    for (uint32_t i = 0; i < (uint32_t)allKeys.size(); i++)
+    {
+        map[allKeys[i]] = i;
+    }
+
+    insertTime = vkts::timeGetRaw() - startTime;
+
+    startTime = vkts::timeGetRaw();
+
+    uint64_t sum = 0;
+
+    for (uint32_t i = 0; i < (uint32_t)allKeys.size(); i++)
+    {
+        uint32_t index = map.find(allKeys[(i * 7) % allKeys.size()]);
+
+        if (index == map.size())
+        {
+            return VK_FALSE;
+        }
+
+        sum += map.valueAt(index);
+    }
+
+    lookupTime = vkts::timeGetRaw() - startTime;
+
+    return sum == (uint64_t)allKeys.size() * (uint64_t)(allKeys.size() - 1) / 2 && map.size() == allKeys.size();
+}
+
+VkBool32 benchmarkMap()
+{
+    std::vector<std::string> allKeys;
+
+    for (uint32_t count = BENCHMARK_MAP_MIN_COUNT; count <= BENCHMARK_MAP_MAX_COUNT; count *= 10)
+    {
+        benchmarkMapCreateKeys(allKeys, count);
+
+        double hashInsertTime = 0.0;
+        double hashLookupTime = 0.0;
+
+        if (!benchmarkMapRun<vkts::HashMap<std::string, uint32_t>>(allKeys, hashInsertTime, hashLookupTime))
+        {
+            vkts::logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Benchmark 'map': Hash map returned wrong values.");
+
+            return VK_FALSE;
+        }
+
+        if (count > BENCHMARK_MAP_MAX_SORTED_COUNT)
+        {
+            vkts::logPrint(VKTS_LOG_INFO, __FILE__, __LINE__, "Benchmark 'map': %7u keys: hash map insert %10.2f ms, lookup %10.2f ms, sorted map skipped", count, hashInsertTime * 1000.0, hashLookupTime * 1000.0);
+
+            continue;
+        }
+
+        double sortedInsertTime = 0.0;
+        double sortedLookupTime = 0.0;
+
+        if (!benchmarkMapRun<vkts::Map<std::string, uint32_t>>(allKeys, sortedInsertTime, sortedLookupTime))
+        {
+            vkts::logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Benchmark 'map': Sorted map returned wrong values.");
+
+            return VK_FALSE;
+        }
+
+        vkts::logPrint(VKTS_LOG_INFO, __FILE__, __LINE__, "Benchmark 'map': %7u keys: hash map insert %10.2f ms, lookup %10.2f ms, sorted map insert %10.2f ms, lookup %10.2f ms", count, hashInsertTime * 1000.0, hashLookupTime * 1000.0, sortedInsertTime * 1000.0, sortedLookupTime * 1000.0);
+    }
+
+    return VK_TRUE;
+}
@@ -0,0 +1,571 @@
+#include "Benchmark.hpp"
+
+#define BENCHMARK_MEMORY_RESOURCES 20000
+#define BENCHMARK_MEMORY_ROUNDS 8
+#define BENCHMARK_MEMORY_FREE_PERCENT 30
+#define BENCHMARK_MEMORY_MAX_ALLOCATION_COUNT 4096
+#define BENCHMARK_MEMORY_GRANULARITY 1024
+#define BENCHMARK_MEMORY_DEFRAGMENT_MOVES 256
+#define BENCHMARK_MEMORY_OPERATIONS 200000
+#define BENCHMARK_MEMORY_LIVE 2000
+#define BENCHMARK_MEMORY_RANGE_SIZE (256ull * 1024ull * 1024ull)
+
+typedef struct BenchmarkMemoryResource_
+{
+	uint32_t memoryTypeIndex;
+	VkDeviceSize size;
+	VkDeviceSize alignment;
+	VkBool32 linear;
+	uint32_t allocation;
+} BenchmarkMemoryResource;
+
+/**
+ * Stands in for vkAllocateMemory and enforces the heap sizes of the fake memory properties.
+ */
+class BenchmarkMemoryBlocks : public vkts::IMemoryBlockAllocator
+{
+
+public:
+
+	VkPhysicalDeviceMemoryProperties memoryProperties;
+
+	std::map<uint32_t, std::pair<uint32_t, VkDeviceSize>> allBlocks;
+
+	VkDeviceSize allHeapUsages[VK_MAX_MEMORY_HEAPS];
+
+	uint32_t allocateCount;
+
+	uint32_t maxBlockCount;
+
+	BenchmarkMemoryBlocks() :
+		IMemoryBlockAllocator(), memoryProperties(), allBlocks(), allocateCount(0), maxBlockCount(0)
+	{
+		for (uint32_t i = 0; i < VK_MAX_MEMORY_HEAPS; i++)
+		{
+			allHeapUsages[i] = 0;
+		}
+	}
+
+	virtual ~BenchmarkMemoryBlocks()
+	{
+	}
+
+	virtual VkBool32 allocateBlock(const uint32_t memoryTypeIndex, const VkDeviceSize size, const uint32_t blockId) override
+	{
+		const uint32_t heapIndex = memoryProperties.memoryTypes[memoryTypeIndex].heapIndex;
+
+		if (allHeapUsages[heapIndex] + size > memoryProperties.memoryHeaps[heapIndex].size)
+		{
+			return VK_FALSE;
+		}
+
+		allHeapUsages[heapIndex] += size;
+
+		allBlocks[blockId] = std::make_pair(memoryTypeIndex, size);
+
+		allocateCount++;
+
+		maxBlockCount = glm::max(maxBlockCount, (uint32_t)allBlocks.size());
+
+		return VK_TRUE;
+	}
+
+	virtual void freeBlock(const uint32_t memoryTypeIndex, const uint32_t blockId) override
+	{
+		auto currentBlock = allBlocks.find(blockId);
+
+		if (currentBlock == allBlocks.end())
+		{
+			return;
+		}
+
+		allHeapUsages[memoryProperties.memoryTypes[memoryTypeIndex].heapIndex] -= currentBlock->second.second;
+
+		allBlocks.erase(currentBlock);
+	}
+
+};
+
+static std::vector<BenchmarkMemoryResource> g_allResources;
+
+static uint32_t benchmarkMemoryRandom(uint32_t& random)
+{
+	random = random * 1664525u + 1013904223u;
+
+	return random >> 8;
+}
+
+/**
+ * Desktop like table: a large device local heap, a host heap and a small device local, host visible heap.
+ */
+static void benchmarkMemoryProperties(VkPhysicalDeviceMemoryProperties& memoryProperties)
+{
+	memoryProperties = VkPhysicalDeviceMemoryProperties();
+
+	memoryProperties.memoryHeapCount = 3;
+	memoryProperties.memoryHeaps[0].size = 4096ull * 1024ull * 1024ull;
+	memoryProperties.memoryHeaps[0].flags = VK_MEMORY_HEAP_DEVICE_LOCAL_BIT;
+	memoryProperties.memoryHeaps[1].size = 8192ull * 1024ull * 1024ull;
+	memoryProperties.memoryHeaps[1].flags = 0;
+	memoryProperties.memoryHeaps[2].size = 256ull * 1024ull * 1024ull;
+	memoryProperties.memoryHeaps[2].flags = VK_MEMORY_HEAP_DEVICE_LOCAL_BIT;
+
+	memoryProperties.memoryTypeCount = 4;
+	memoryProperties.memoryTypes[0].propertyFlags = VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT;
+	memoryProperties.memoryTypes[0].heapIndex = 0;
+	memoryProperties.memoryTypes[1].propertyFlags = VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT;
+	memoryProperties.memoryTypes[1].heapIndex = 1;
+	memoryProperties.memoryTypes[2].propertyFlags = VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_CACHED_BIT;
+	memoryProperties.memoryTypes[2].heapIndex = 1;
+	memoryProperties.memoryTypes[3].propertyFlags = VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT | VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT;
+	memoryProperties.memoryTypes[3].heapIndex = 2;
+}
+
+/**
+ * Mostly small vertex, index and uniform buffers, fewer textures and some huge render targets.
+ */
+static void benchmarkMemoryResource(BenchmarkMemoryResource& resource, uint32_t& random)
+{
+	const uint32_t kind = benchmarkMemoryRandom(random) % 2000;
+
+	if (kind < 1400)
+	{
+		resource.memoryTypeIndex = (kind % 8 == 0) ? 3 : 0;
+		resource.size = 256 + (VkDeviceSize)(benchmarkMemoryRandom(random) % (64 * 1024));
+		resource.alignment = 256;
+		resource.linear = VK_TRUE;
+	}
+	else if (kind < 1800)
+	{
+		resource.memoryTypeIndex = 1;
+		resource.size = 4096 + (VkDeviceSize)(benchmarkMemoryRandom(random) % (1024 * 1024));
+		resource.alignment = 64;
+		resource.linear = VK_TRUE;
+	}
+	else if (kind < 1999)
+	{
+		resource.memoryTypeIndex = 0;
+		resource.size = (VkDeviceSize)(64 * 1024) << (benchmarkMemoryRandom(random) % 6);
+		resource.alignment = 64 * 1024;
+		resource.linear = VK_FALSE;
+	}
+	else
+	{
+		resource.memoryTypeIndex = 0;
+		resource.size = 144ull * 1024ull * 1024ull;
+		resource.alignment = 64 * 1024;
+		resource.linear = VK_FALSE;
+	}
+
+	resource.allocation = UINT32_MAX;
+}
+
+/**
+ * Checks, that the live allocations are aligned, do not overlap and that linear and non-linear resources never share a block.
+ */
+static VkBool32 benchmarkMemoryValidate(const vkts::MemoryAllocator& memoryAllocator)
+{
+	std::map<std::pair<uint32_t, VkDeviceSize>, VkDeviceSize> allRanges;
+	std::map<uint32_t, VkBool32> allBlockLinear;
+
+	for (const auto& currentResource : g_allResources)
+	{
+		if (currentResource.allocation == UINT32_MAX)
+		{
+			continue;
+		}
+
+		VkTsMemoryAllocation memoryAllocation;
+
+		if (!memoryAllocator.getAllocation(memoryAllocation, currentResource.allocation))
+		{
+			return VK_FALSE;
+		}
+
+		if (memoryAllocation.offset % currentResource.alignment != 0 || memoryAllocation.size != currentResource.size || memoryAllocation.memoryTypeIndex != currentResource.memoryTypeIndex)
+		{
+			return VK_FALSE;
+		}
+
+		auto blockLinear = allBlockLinear.insert(std::make_pair(memoryAllocation.blockId, currentResource.linear));
+
+		if (blockLinear.first->second != currentResource.linear)
+		{
+			return VK_FALSE;
+		}
+
+		allRanges[std::make_pair(memoryAllocation.blockId, memoryAllocation.offset)] = memoryAllocation.size;
+	}
+
+	const std::pair<uint32_t, VkDeviceSize>* previousRange = nullptr;
+	VkDeviceSize previousSize = 0;
+
+	for (const auto& currentRange : allRanges)
+	{
+		if (previousRange && previousRange->first == currentRange.first.first && previousRange->second + previousSize > currentRange.first.second)
+		{
+			return VK_FALSE;
+		}
+
+		previousRange = &currentRange.first;
+		previousSize = currentRange.second;
+	}
+
+	return VK_TRUE;
+}
+
+/**
+ * Simple first fit list of free ranges, as a reference for the sub-allocator.
+ */
+class BenchmarkMemoryFirstFit
+{
+
+public:
+
+	std::map<VkDeviceSize, VkDeviceSize> allFreeRanges;
+
+	explicit BenchmarkMemoryFirstFit(const VkDeviceSize size) :
+		allFreeRanges()
+	{
+		allFreeRanges[0] = size;
+	}
+
+	VkBool32 allocate(VkDeviceSize& offset, const VkDeviceSize size, const VkDeviceSize alignment)
+	{
+		for (auto currentRange = allFreeRanges.begin(); currentRange != allFreeRanges.end(); currentRange++)
+		{
+			const VkDeviceSize rangeOffset = currentRange->first;
+			const VkDeviceSize rangeSize = currentRange->second;
+
+			const VkDeviceSize alignedOffset = (rangeOffset + alignment - 1) & ~(alignment - 1);
+
+			if (alignedOffset + size > rangeOffset + rangeSize)
+			{
+				continue;
+			}
+
+			allFreeRanges.erase(currentRange);
+
+			if (alignedOffset > rangeOffset)
+			{
+				allFreeRanges[rangeOffset] = alignedOffset - rangeOffset;
+			}
+
+			if (alignedOffset + size < rangeOffset + rangeSize)
+			{
+				allFreeRanges[alignedOffset + size] = rangeOffset + rangeSize - alignedOffset - size;
+			}
+
+			offset = alignedOffset;
+
+			return VK_TRUE;
+		}
+
+		return VK_FALSE;
+	}
+
+	void free(const VkDeviceSize offset, const VkDeviceSize size)
+	{
+		auto currentRange = allFreeRanges.insert(std::make_pair(offset, size)).first;
+
+		auto nextRange = std::next(currentRange);
+
+		if (nextRange != allFreeRanges.end() && currentRange->first + currentRange->second == nextRange->first)
+		{
+			currentRange->second += nextRange->second;
+
+			allFreeRanges.erase(nextRange);
+		}
+
+		if (currentRange != allFreeRanges.begin())
+		{
+			auto previousRange = std::prev(currentRange);
+
+			if (previousRange->first + previousRange->second == currentRange->first)
+			{
+				previousRange->second += currentRange->second;
+
+				allFreeRanges.erase(currentRange);
+			}
+		}
+	}
+
+};
+
+static VkBool32 benchmarkMemoryFragmentation()
+{
+	VkPhysicalDeviceMemoryProperties memoryProperties;
+
+	benchmarkMemoryProperties(memoryProperties);
+
+	auto memoryBlocks = std::shared_ptr<BenchmarkMemoryBlocks>(new BenchmarkMemoryBlocks());
+
+	memoryBlocks->memoryProperties = memoryProperties;
+
+	vkts::MemoryAllocator memoryAllocator(memoryBlocks, memoryProperties, BENCHMARK_MEMORY_GRANULARITY, 0);
+
+	uint32_t random = 0x12345678;
+
+	g_allResources.resize(BENCHMARK_MEMORY_RESOURCES);
+
+	for (auto& currentResource : g_allResources)
+	{
+		benchmarkMemoryResource(currentResource, random);
+	}
+
+	// Load all resources, then repeatedly free some and load others, as when streaming levels.
+
+	uint32_t maxResourceCount = 0;
+
+	double allocateTime = 0.0;
+	uint32_t allocateCount = 0;
+
+	for (uint32_t round = 0; round < BENCHMARK_MEMORY_ROUNDS; round++)
+	{
+		uint32_t resourceCount = 0;
+
+		double startTime = vkts::timeGetRaw();
+
+		for (auto& currentResource : g_allResources)
+		{
+			if (currentResource.allocation == UINT32_MAX)
+			{
+				if (!memoryAllocator.allocate(currentResource.allocation, currentResource.memoryTypeIndex, currentResource.size, currentResource.alignment, currentResource.linear))
+				{
+					vkts::logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Benchmark 'memory': Could not allocate %llu bytes.", (unsigned long long)currentResource.size);
+
+					return VK_FALSE;
+				}
+
+				allocateCount++;
+			}
+
+			resourceCount++;
+		}
+
+		allocateTime += vkts::timeGetRaw() - startTime;
+
+		maxResourceCount = glm::max(maxResourceCount, resourceCount);
+
+		if (!benchmarkMemoryValidate(memoryAllocator))
+		{
+			vkts::logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Benchmark 'memory': Invalid allocations in round %u.", round);
+
+			return VK_FALSE;
+		}
+
+		if (round + 1 == BENCHMARK_MEMORY_ROUNDS)
+		{
+			break;
+		}
+
+		for (auto& currentResource : g_allResources)
+		{
+			if (benchmarkMemoryRandom(random) % 100 < BENCHMARK_MEMORY_FREE_PERCENT)
+			{
+				memoryAllocator.free(currentResource.allocation);
+
+				benchmarkMemoryResource(currentResource, random);
+			}
+		}
+	}
+
+	const VkDeviceSize usedSize = memoryAllocator.getUsedSize();
+	const VkDeviceSize reservedSize = memoryAllocator.getReservedSize();
+
+	vkts::logPrint(VKTS_LOG_INFO, __FILE__, __LINE__, "Benchmark 'memory': %u resources, %u rounds. Device allocations: one per resource %u (limit %u), sub-allocated %u (at most %u live blocks), %.0f ns per allocation.", maxResourceCount, BENCHMARK_MEMORY_ROUNDS, maxResourceCount, BENCHMARK_MEMORY_MAX_ALLOCATION_COUNT, memoryBlocks->allocateCount, memoryBlocks->maxBlockCount, allocateTime * 1.0e9 / (double)allocateCount);
+
+	vkts::logPrint(VKTS_LOG_INFO, __FILE__, __LINE__, "Benchmark 'memory': Used %llu MB of %llu MB in %u blocks, utilisation %.1f%%, largest free range of device local memory %llu KB.", (unsigned long long)(usedSize >> 20), (unsigned long long)(reservedSize >> 20), memoryAllocator.getBlockCount(), 100.0 * (double)usedSize / (double)reservedSize, (unsigned long long)(memoryAllocator.getLargestFreeSize(0) >> 10));
+
+	if (memoryBlocks->maxBlockCount >= BENCHMARK_MEMORY_MAX_ALLOCATION_COUNT)
+	{
+		vkts::logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Benchmark 'memory': %u blocks exceed the allocation limit.", memoryBlocks->maxBlockCount);
+
+		return VK_FALSE;
+	}
+
+	// Free a random half and defragment all memory types.
+
+	for (auto& currentResource : g_allResources)
+	{
+		if (benchmarkMemoryRandom(random) % 2 == 0)
+		{
+			memoryAllocator.free(currentResource.allocation);
+
+			currentResource.allocation = UINT32_MAX;
+		}
+	}
+
+	const uint32_t blockCount = memoryAllocator.getBlockCount();
+	const VkDeviceSize fragmentedReservedSize = memoryAllocator.getReservedSize();
+
+	uint32_t moveCount = 0;
+	VkDeviceSize moveSize = 0;
+
+	for (uint32_t memoryTypeIndex = 0; memoryTypeIndex < memoryProperties.memoryTypeCount; memoryTypeIndex++)
+	{
+		uint32_t moves;
+
+		do
+		{
+			moves = memoryAllocator.defragment(memoryTypeIndex, BENCHMARK_MEMORY_DEFRAGMENT_MOVES, [&](const VkTsMemoryAllocation& source, const VkTsMemoryAllocation& destination) {
+				moveSize += source.size;
+
+				return (VkBool32)(source.size == destination.size && source.linear == destination.linear);
+			});
+
+			moveCount += moves;
+		} while (moves > 0);
+	}
+
+	if (!benchmarkMemoryValidate(memoryAllocator))
+	{
+		vkts::logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Benchmark 'memory': Invalid allocations after defragmentation.");
+
+		return VK_FALSE;
+	}
+
+	vkts::logPrint(VKTS_LOG_INFO, __FILE__, __LINE__, "Benchmark 'memory': Defragmentation moved %u allocations (%llu MB): %u blocks with %llu MB before, %u blocks with %llu MB after, utilisation %.1f%%.", moveCount, (unsigned long long)(moveSize >> 20), blockCount, (unsigned long long)(fragmentedReservedSize >> 20), memoryAllocator.getBlockCount(), (unsigned long long)(memoryAllocator.getReservedSize() >> 20), 100.0 * (double)memoryAllocator.getUsedSize() / (double)memoryAllocator.getReservedSize());
+
+	memoryAllocator.destroy();
+
+	g_allResources.clear();
+
+	if (memoryBlocks->allBlocks.size() != 0)
+	{
+		vkts::logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Benchmark 'memory': %u blocks not freed.", (uint32_t)memoryBlocks->allBlocks.size());
+
+		return VK_FALSE;
+	}
+
+	return VK_TRUE;
+}
+
+static VkBool32 benchmarkMemoryThroughput()
+{
+	// Same random sequence of allocations and frees in one range, keeping about the same number of ranges alive.
+
+	std::vector<std::pair<VkDeviceSize, VkDeviceSize>> allOperations(BENCHMARK_MEMORY_OPERATIONS);
+
+	uint32_t random = 0x87654321;
+
+	for (auto& currentOperation : allOperations)
+	{
+		currentOperation.first = 256 + (VkDeviceSize)(benchmarkMemoryRandom(random) % (128 * 1024));
+		currentOperation.second = (VkDeviceSize)256 << (benchmarkMemoryRandom(random) % 3);
+	}
+
+	std::vector<uint32_t> allSlots(BENCHMARK_MEMORY_OPERATIONS);
+
+	for (auto& currentSlot : allSlots)
+	{
+		currentSlot = benchmarkMemoryRandom(random) % BENCHMARK_MEMORY_LIVE;
+	}
+
+	//
+
+	BenchmarkMemoryFirstFit firstFit(BENCHMARK_MEMORY_RANGE_SIZE);
+
+	std::vector<std::pair<VkDeviceSize, VkDeviceSize>> allFirstFitLive(BENCHMARK_MEMORY_LIVE, std::make_pair(0, 0));
+
+	VkDeviceSize firstFitChecksum = 0;
+	uint32_t firstFitFailed = 0;
+
+	double startTime = vkts::timeGetRaw();
+
+	for (uint32_t i = 0; i < BENCHMARK_MEMORY_OPERATIONS; i++)
+	{
+		auto& currentLive = allFirstFitLive[allSlots[i]];
+
+		if (currentLive.second > 0)
+		{
+			firstFit.free(currentLive.first, currentLive.second);
+
+			currentLive.second = 0;
+		}
+
+		if (firstFit.allocate(currentLive.first, allOperations[i].first, allOperations[i].second))
+		{
+			currentLive.second = allOperations[i].first;
+
+			firstFitChecksum += currentLive.first % allOperations[i].second;
+		}
+		else
+		{
+			firstFitFailed++;
+		}
+	}
+
+	const double firstFitTime = vkts::timeGetRaw() - startTime;
+
+	//
+
+	vkts::TlsfAllocator tlsfAllocator(BENCHMARK_MEMORY_RANGE_SIZE);
+
+	std::vector<uint32_t> allTlsfLive(BENCHMARK_MEMORY_LIVE, UINT32_MAX);
+
+	VkDeviceSize tlsfChecksum = 0;
+	uint32_t tlsfFailed = 0;
+
+	startTime = vkts::timeGetRaw();
+
+	for (uint32_t i = 0; i < BENCHMARK_MEMORY_OPERATIONS; i++)
+	{
+		auto& currentLive = allTlsfLive[allSlots[i]];
+
+		if (currentLive != UINT32_MAX)
+		{
+			tlsfAllocator.free(currentLive);
+
+			currentLive = UINT32_MAX;
+		}
+
+		VkDeviceSize offset;
+
+		if (tlsfAllocator.allocate(offset, currentLive, allOperations[i].first, allOperations[i].second))
+		{
+			tlsfChecksum += offset % allOperations[i].second;
+		}
+		else
+		{
+			tlsfFailed++;
+		}
+	}
+
+	const double tlsfTime = vkts::timeGetRaw() - startTime;
+
+	// Both have to align every range and both must not run out of memory.
+
+	if (firstFitChecksum != 0 || tlsfChecksum != 0 || firstFitFailed != 0 || tlsfFailed != 0)
+	{
+		vkts::logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Benchmark 'memory': Misaligned or failed allocations: first fit %u, TLSF %u.", firstFitFailed, tlsfFailed);
+
+		return VK_FALSE;
+	}
+
+	for (auto currentLive : allTlsfLive)
+	{
+		tlsfAllocator.free(currentLive);
+	}
+
+	if (!tlsfAllocator.isEmpty() || tlsfAllocator.getLargestFreeSize() != BENCHMARK_MEMORY_RANGE_SIZE)
+	{
+		vkts::logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Benchmark 'memory': Free ranges were not merged.");
+
+		return VK_FALSE;
+	}
+
+	vkts::logPrint(VKTS_LOG_INFO, __FILE__, __LINE__, "Benchmark 'memory': %u operations with %u live ranges: first fit %7.1f ns, TLSF %7.1f ns per allocation and free, speedup %.2fx", BENCHMARK_MEMORY_OPERATIONS, BENCHMARK_MEMORY_LIVE, firstFitTime * 1.0e9 / (double)BENCHMARK_MEMORY_OPERATIONS, tlsfTime * 1.0e9 / (double)BENCHMARK_MEMORY_OPERATIONS, firstFitTime / tlsfTime);
+
+	return VK_TRUE;
+}
+
+VkBool32 benchmarkMemory()
+{
+	if (!benchmarkMemoryFragmentation())
+	{
+		return VK_FALSE;
+	}
+
+	return benchmarkMemoryThroughput();
+}
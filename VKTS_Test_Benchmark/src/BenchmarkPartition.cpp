@@ -0,0 +1,200 @@
+#include "Benchmark.hpp"
+
+#define BENCHMARK_PARTITION_OBJECTS 4096
+#define BENCHMARK_PARTITION_FRAMES 50
+#define BENCHMARK_PARTITION_GROUP 16
+#define BENCHMARK_PARTITION_CHARACTERS 128
+#define BENCHMARK_PARTITION_CHARACTER_NODES 64
+#define BENCHMARK_PARTITION_SKINNED_FACTOR 4
+#define BENCHMARK_PARTITION_CHUNKS_PER_THREAD 4
+#define BENCHMARK_PARTITION_NODE_LOOPS 64
+#define BENCHMARK_PARTITION_REPEATS 64
+
+static std::vector<uint32_t> g_allNodes;
+static std::vector<uint32_t> g_allWork;
+static std::vector<float> g_allResults;
+
+static uint32_t g_threadCount = 1;
+
+static vkts::TaskPartition g_partition;
+
+/**
+ * Stands in for updating the transforms of one object.
+ */
+static void benchmarkPartitionUpdate(const uint32_t index)
+{
+	float value = (float)index;
+
+	for (uint32_t i = 0; i < g_allWork[index] * BENCHMARK_PARTITION_NODE_LOOPS; i++)
+	{
+		value = value * 0.999f + 0.5f;
+	}
+
+	g_allResults[index] = value;
+}
+
+/**
+ * Copy of the previous split, where each thread updates every n-th object.
+ */
+static VkBool32 benchmarkPartitionStaticFrame(const vkts::IUpdateThreadContext& updateContext)
+{
+	return vkts::taskParallelFor(updateContext, g_threadCount, 1, [](const uint32_t first, const uint32_t last) {
+		for (uint32_t objectOffset = first; objectOffset < last; objectOffset++)
+		{
+			for (uint32_t i = objectOffset; i < BENCHMARK_PARTITION_OBJECTS; i += g_threadCount)
+			{
+				benchmarkPartitionUpdate(i);
+			}
+		}
+
+		return (VkBool32)VK_TRUE;
+	});
+}
+
+static VkBool32 benchmarkPartitionFrame(const vkts::IUpdateThreadContext& updateContext)
+{
+	return g_partition.process(updateContext, g_threadCount * BENCHMARK_PARTITION_CHUNKS_PER_THREAD, [](const uint32_t first, const uint32_t last) {
+		for (uint32_t i = first; i < last; i++)
+		{
+			benchmarkPartitionUpdate(i);
+		}
+
+		return (VkBool32)VK_TRUE;
+	});
+}
+
+/**
+ * Longest time of a thread, if the chunks are taken in the given order by the next idle thread.
+ * Uses the single threaded time of each object, so the result does not depend on the number of processors.
+ */
+static double benchmarkPartitionMakespan(const vkts::TaskPartition& partition, const std::vector<double>& allTimes)
+{
+	std::vector<double> allThreadTimes(g_threadCount, 0.0);
+
+	for (uint32_t chunk = 0; chunk < partition.getNumberChunks(); chunk++)
+	{
+		uint32_t first = 0;
+		uint32_t last = 0;
+
+		partition.getChunk(chunk, first, last);
+
+		auto idleThread = std::min_element(allThreadTimes.begin(), allThreadTimes.end());
+
+		for (uint32_t i = first; i < last; i++)
+		{
+			*idleThread += allTimes[i];
+		}
+	}
+
+	return *std::max_element(allThreadTimes.begin(), allThreadTimes.end());
+}
+
+VkBool32 benchmarkPartition()
+{
+	// The scene starts with groups of one skinned character and several small props, the rest are props.
+	// The estimate only knows the nodes, but skinned nodes are more expensive.
+
+	uint32_t random = 0x12345678;
+
+	g_allNodes.resize(BENCHMARK_PARTITION_OBJECTS);
+	g_allWork.resize(BENCHMARK_PARTITION_OBJECTS);
+	g_allResults.resize(BENCHMARK_PARTITION_OBJECTS);
+
+	uint32_t totalNodes = 0;
+
+	for (uint32_t i = 0; i < BENCHMARK_PARTITION_OBJECTS; i++)
+	{
+		random = random * 1664525u + 1013904223u;
+
+		if (i % BENCHMARK_PARTITION_GROUP == 0 && i / BENCHMARK_PARTITION_GROUP < BENCHMARK_PARTITION_CHARACTERS)
+		{
+			g_allNodes[i] = BENCHMARK_PARTITION_CHARACTER_NODES;
+			g_allWork[i] = BENCHMARK_PARTITION_CHARACTER_NODES * BENCHMARK_PARTITION_SKINNED_FACTOR;
+		}
+		else
+		{
+			g_allNodes[i] = 1 + (random >> 30);
+			g_allWork[i] = g_allNodes[i];
+		}
+
+		totalNodes += g_allNodes[i];
+	}
+
+	// Single threaded time of each object. Small objects are below the timer resolution, so each one is updated several times.
+
+	std::vector<double> allTimes(BENCHMARK_PARTITION_OBJECTS, 0.0);
+
+	double totalTime = 0.0;
+
+	for (uint32_t i = 0; i < BENCHMARK_PARTITION_OBJECTS; i++)
+	{
+		double startTime = vkts::timeGetRaw();
+
+		for (uint32_t k = 0; k < BENCHMARK_PARTITION_REPEATS; k++)
+		{
+			benchmarkPartitionUpdate(i);
+		}
+
+		allTimes[i] = (vkts::timeGetRaw() - startTime) / (double)BENCHMARK_PARTITION_REPEATS;
+
+		totalTime += allTimes[i];
+	}
+
+	vkts::logPrint(VKTS_LOG_INFO, __FILE__, __LINE__, "Benchmark 'partition': %u objects, %u characters, %u nodes, %u frames, %.3f ms single threaded.", BENCHMARK_PARTITION_OBJECTS, BENCHMARK_PARTITION_CHARACTERS, totalNodes, BENCHMARK_PARTITION_FRAMES, totalTime * 1000.0);
+
+	for (uint32_t taskExecutorCount = 1; taskExecutorCount <= 15; taskExecutorCount = taskExecutorCount * 2 + 1)
+	{
+		g_threadCount = taskExecutorCount + 1;
+
+		g_partition.setCount(BENCHMARK_PARTITION_OBJECTS);
+
+		for (uint32_t i = 0; i < BENCHMARK_PARTITION_OBJECTS; i++)
+		{
+			g_partition.setCost(i, (float)g_allNodes[i]);
+		}
+
+		// Balance of the previous split and of the estimated partition, before any time was measured.
+
+		double staticMakespan = 0.0;
+
+		for (uint32_t objectOffset = 0; objectOffset < g_threadCount; objectOffset++)
+		{
+			double threadTime = 0.0;
+
+			for (uint32_t i = objectOffset; i < BENCHMARK_PARTITION_OBJECTS; i += g_threadCount)
+			{
+				threadTime += allTimes[i];
+			}
+
+			staticMakespan = glm::max(staticMakespan, threadTime);
+		}
+
+		if (!g_partition.partition(g_threadCount * BENCHMARK_PARTITION_CHUNKS_PER_THREAD))
+		{
+			return VK_FALSE;
+		}
+
+		double estimatedMakespan = benchmarkPartitionMakespan(g_partition, allTimes);
+
+		//
+
+		double staticTime = benchmarkRunEngine(taskExecutorCount, BENCHMARK_PARTITION_FRAMES, benchmarkPartitionStaticFrame);
+
+		double partitionTime = benchmarkRunEngine(taskExecutorCount, BENCHMARK_PARTITION_FRAMES, benchmarkPartitionFrame);
+
+		if (staticTime == 0.0 || partitionTime == 0.0)
+		{
+			return VK_FALSE;
+		}
+
+		double measuredMakespan = benchmarkPartitionMakespan(g_partition, allTimes);
+
+		// Balance is the ideal time divided by the time of the slowest thread.
+
+		const double idealTime = totalTime / (double)g_threadCount;
+
+		vkts::logPrint(VKTS_LOG_INFO, __FILE__, __LINE__, "Benchmark 'partition': %2u threads: balance every n-th %3.0f%%, estimated %3.0f%%, measured %3.0f%%, speedup %.2fx. Frame every n-th %7.3f ms, partition %7.3f ms", g_threadCount, 100.0 * idealTime / staticMakespan, 100.0 * idealTime / estimatedMakespan, 100.0 * idealTime / measuredMakespan, staticMakespan / measuredMakespan, staticTime * 1000.0, partitionTime * 1000.0);
+	}
+
+	return VK_TRUE;
+}
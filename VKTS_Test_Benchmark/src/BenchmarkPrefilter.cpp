@@ -0,0 +1,204 @@
+#include "Benchmark.hpp"
+
+#define BENCHMARK_PREFILTER_LENGTH 128
+#define BENCHMARK_PREFILTER_SAMPLES 64
+
+static vkts::IImageDataSP g_cubeMap;
+
+static vkts::SmartPointerVector<vkts::IImageDataSP> g_allCookTorranceImages;
+
+static glm::vec3 benchmarkPrefilterGetScanVector(const uint32_t x, const uint32_t y, const uint32_t side, const float step, const float offset)
+{
+	const float s = -1.0f + offset + step * (float)x;
+	const float t = 1.0f - offset - step * (float)y;
+
+	// Same orientation as the internal scan vector of the pre-filter.
+	const glm::vec3 allScanVectors[6] = {glm::vec3(1.0f, t, -s), glm::vec3(-1.0f, t, s), glm::vec3(s, 1.0f, -t), glm::vec3(s, -1.0f, t), glm::vec3(s, t, 1.0f), glm::vec3(-s, t, -1.0f)};
+
+	return glm::normalize(allScanVectors[side]);
+}
+
+/**
+ * Copy of the previous, per texel Cook-Torrance pre-filter, used as the reference.
+ */
+static vkts::SmartPointerVector<vkts::IImageDataSP> benchmarkPrefilterLegacy(const vkts::IImageDataSP& sourceImage, const uint32_t samples)
+{
+	vkts::SmartPointerVector<vkts::IImageDataSP> result;
+
+	int32_t width = sourceImage->getWidth();
+
+	while (width > 0)
+	{
+		for (uint32_t layer = 0; layer < 6; layer++)
+		{
+			result.append(vkts::imageDataCreate("legacy.data", width, width, 1, 0.0f, 0.0f, 0.0f, 0.0f, sourceImage->getImageType(), sourceImage->getFormat()));
+		}
+
+		width = width / 2;
+	}
+
+	uint32_t roughnessSamples = result.size() / 6;
+
+	for (uint32_t side = 0; side < 6; side++)
+	{
+		for (uint32_t roughnessSampleIndex = 0; roughnessSampleIndex < roughnessSamples; roughnessSampleIndex++)
+		{
+			uint32_t length = sourceImage->getWidth() / (1 << roughnessSampleIndex);
+
+			float step = 2.0f / (float)length;
+			float offset = step * 0.5f;
+
+			float roughness = (float)roughnessSampleIndex / (float)(roughnessSamples - 1);
+
+			for (uint32_t y = 0; y < length; y++)
+			{
+				for (uint32_t x = 0; x < length; x++)
+				{
+					glm::vec3 scanVector = benchmarkPrefilterGetScanVector(x, y, side, step, offset);
+
+					glm::mat3 basis = vkts::renderGetBasis(scanVector);
+
+					glm::vec3 colorCookTorrance = glm::vec3(0.0f, 0.0f, 0.0f);
+
+					float sampleDivisior = 0.0f;
+
+					for (uint32_t sampleIndex = 0; sampleIndex < samples; sampleIndex++)
+					{
+						glm::vec2 randomPoint = vkts::randomHammersley(sampleIndex, samples);
+
+						auto currentColorCookTorrance = vkts::renderCookTorrance(sourceImage, VK_FILTER_LINEAR, 0, randomPoint, basis, scanVector, roughness);
+
+						if (!std::isnan(currentColorCookTorrance.x) && !std::isnan(currentColorCookTorrance.y) && !std::isnan(currentColorCookTorrance.z))
+						{
+							colorCookTorrance += currentColorCookTorrance;
+
+							sampleDivisior += 1.0f;
+						}
+					}
+
+					if (sampleDivisior > 0.0f)
+					{
+						colorCookTorrance = colorCookTorrance / sampleDivisior;
+					}
+
+					// Same order as the pre-filter: Side major, level minor.
+					result[side * roughnessSamples + roughnessSampleIndex]->setTexel(glm::vec4(colorCookTorrance, 1.0f), x, y, 0, 0, 0);
+				}
+			}
+		}
+	}
+
+	return result;
+}
+
+static vkts::IImageDataSP benchmarkPrefilterCreateCubeMap(const uint32_t length)
+{
+	vkts::SmartPointerVector<vkts::IImageDataSP> allFaces;
+
+	for (uint32_t side = 0; side < 6; side++)
+	{
+		auto face = vkts::imageDataCreate("face.data", length, length, 1, 0.0f, 0.0f, 0.0f, 0.0f, VK_IMAGE_TYPE_2D, VK_FORMAT_R32G32B32A32_SFLOAT);
+
+		if (!face.get())
+		{
+			return vkts::IImageDataSP();
+		}
+
+		for (uint32_t y = 0; y < length; y++)
+		{
+			for (uint32_t x = 0; x < length; x++)
+			{
+				// Bright spots like a sun make the pre-filter visible.
+				float intensity = ((x / 8 + y / 8) % 5 == 0) ? 8.0f : 0.5f;
+
+				face->setTexel(glm::vec4(intensity * (float)x / (float)length, intensity * (float)y / (float)length, intensity * (float)(side + 1) / 6.0f, 1.0f), x, y, 0, 0, 0);
+			}
+		}
+
+		allFaces.append(face);
+	}
+
+	return vkts::imageDataMerge(allFaces, "cube.data", 1, 6);
+}
+
+static VkBool32 benchmarkPrefilterFrame(const vkts::IUpdateThreadContext& updateContext)
+{
+	g_allCookTorranceImages = vkts::imageDataPrefilterCookTorrance(g_cubeMap, BENCHMARK_PREFILTER_SAMPLES, "benchmark.data");
+
+	auto allOrenNayarImages = vkts::imageDataPrefilterOrenNayar(g_cubeMap, BENCHMARK_PREFILTER_SAMPLES, "benchmark.data");
+
+	auto allLambertImages = vkts::imageDataPrefilterLambert(g_cubeMap, BENCHMARK_PREFILTER_SAMPLES, "benchmark.data");
+
+	return g_allCookTorranceImages.size() > 0 && allOrenNayarImages.size() > 0 && allLambertImages.size() > 0;
+}
+
+VkBool32 benchmarkPrefilter()
+{
+	g_cubeMap = benchmarkPrefilterCreateCubeMap(BENCHMARK_PREFILTER_LENGTH);
+
+	if (!g_cubeMap.get())
+	{
+		return VK_FALSE;
+	}
+
+	vkts::logPrint(VKTS_LOG_INFO, __FILE__, __LINE__, "Benchmark 'prefilter': %u x %u cube map, %u samples.", BENCHMARK_PREFILTER_LENGTH, BENCHMARK_PREFILTER_LENGTH, BENCHMARK_PREFILTER_SAMPLES);
+
+	double startTime = vkts::timeGetRaw();
+
+	auto allLegacyImages = benchmarkPrefilterLegacy(g_cubeMap, BENCHMARK_PREFILTER_SAMPLES);
+
+	double legacyTime = vkts::timeGetRaw() - startTime;
+
+	startTime = vkts::timeGetRaw();
+
+	auto allCookTorranceImages = vkts::imageDataPrefilterCookTorrance(g_cubeMap, BENCHMARK_PREFILTER_SAMPLES, "benchmark.data");
+
+	double prefilterTime = vkts::timeGetRaw() - startTime;
+
+	if (allCookTorranceImages.size() != allLegacyImages.size())
+	{
+		return VK_FALSE;
+	}
+
+	float maxDifference = 0.0f;
+
+	for (uint32_t i = 0; i < allLegacyImages.size(); i++)
+	{
+		for (uint32_t y = 0; y < allLegacyImages[i]->getHeight(); y++)
+		{
+			for (uint32_t x = 0; x < allLegacyImages[i]->getWidth(); x++)
+			{
+				glm::vec4 difference = glm::abs(allLegacyImages[i]->getTexel(x, y, 0, 0, 0) - allCookTorranceImages[i]->getTexel(x, y, 0, 0, 0));
+
+				maxDifference = glm::max(maxDifference, glm::max(glm::max(difference.r, difference.g), glm::max(difference.b, difference.a)));
+			}
+		}
+	}
+
+	vkts::logPrint(VKTS_LOG_INFO, __FILE__, __LINE__, "Benchmark 'prefilter': Cook-Torrance: per texel %8.2f ms, vectorized %8.2f ms, speedup %.2fx, max difference %f", legacyTime * 1000.0, prefilterTime * 1000.0, legacyTime / prefilterTime, maxDifference);
+
+	if (maxDifference > 1e-3f)
+	{
+		vkts::logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Benchmark 'prefilter': Result differs from the reference.");
+
+		return VK_FALSE;
+	}
+
+	for (uint32_t taskExecutorCount = 1; taskExecutorCount <= 8; taskExecutorCount *= 2)
+	{
+		double frameTime = benchmarkRunEngine(taskExecutorCount, 1, benchmarkPrefilterFrame);
+
+		if (frameTime == 0.0)
+		{
+			return VK_FALSE;
+		}
+
+		vkts::logPrint(VKTS_LOG_INFO, __FILE__, __LINE__, "Benchmark 'prefilter': %u executors: Cook-Torrance, Oren-Nayar and Lambert %8.2f ms", taskExecutorCount, frameTime * 1000.0);
+	}
+
+	g_allCookTorranceImages.clear();
+
+	g_cubeMap = vkts::IImageDataSP();
+
+	return VK_TRUE;
+}
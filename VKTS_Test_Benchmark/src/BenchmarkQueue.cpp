@@ -0,0 +1,399 @@
+#include "Benchmark.hpp"
+
+#define BENCHMARK_QUEUE_NODES 4000
+#define BENCHMARK_QUEUE_PIPELINES 8
+#define BENCHMARK_QUEUE_MATERIALS 64
+#define BENCHMARK_QUEUE_MESHES 256
+#define BENCHMARK_QUEUE_FRAMES 100
+
+typedef struct BenchmarkQueueSubMesh_
+{
+	uint32_t vertexBufferType;
+	uint32_t material;
+	uint32_t mesh;
+	uint32_t numberIndices;
+} BenchmarkQueueSubMesh;
+
+typedef struct BenchmarkQueueNode_
+{
+	std::string name;
+	float depth;
+	std::vector<BenchmarkQueueSubMesh> allSubMeshes;
+} BenchmarkQueueNode;
+
+/**
+ * Counts the commands instead of recording them.
+ */
+class BenchmarkQueueCommandStream : public vkts::IRenderCommandStream
+{
+
+public:
+
+	uint32_t pipelineCount;
+	uint32_t descriptorSetCount;
+	uint32_t meshCount;
+	uint32_t drawCount;
+
+	// Descriptor sets are looked up by node index as in the recursive drawing, but only when they change.
+	const std::vector<uint32_t>* allDescriptorSets;
+	const std::vector<uint64_t>* allBindingPresent;
+	const std::vector<uint32_t>* allDescriptorSetNodes;
+
+	uint64_t checksum;
+
+	BenchmarkQueueCommandStream() :
+		IRenderCommandStream(), pipelineCount(0), descriptorSetCount(0), meshCount(0), drawCount(0), allDescriptorSets(nullptr), allBindingPresent(nullptr), allDescriptorSetNodes(nullptr), checksum(0)
+	{
+	}
+
+	virtual ~BenchmarkQueueCommandStream()
+	{
+	}
+
+	virtual void bindPipeline(const uint32_t /*pipeline*/) override
+	{
+		pipelineCount++;
+	}
+
+	virtual void bindDescriptorSet(const uint32_t /*pipeline*/, const uint32_t descriptorSet) override
+	{
+		const uint32_t nodeIndex = (*allDescriptorSetNodes)[descriptorSet];
+
+		checksum += (*allDescriptorSets)[nodeIndex] + (*allBindingPresent)[nodeIndex];
+
+		descriptorSetCount++;
+	}
+
+	virtual void bindMesh(const uint32_t /*mesh*/) override
+	{
+		meshCount++;
+	}
+
+	virtual void draw(const VkTsRenderItem& /*renderItem*/) override
+	{
+		drawCount++;
+	}
+
+};
+
+static std::vector<BenchmarkQueueNode> g_allNodes;
+
+static uint32_t g_allPipelineVertexTypes[BENCHMARK_QUEUE_PIPELINES];
+
+// Descriptor sets and present dynamic bindings of a material, indexed by the node index.
+static std::vector<uint32_t> g_allDescriptorSets;
+static std::vector<uint64_t> g_allBindingPresent;
+
+/**
+ * Copy of the recursive drawing: each sub mesh searches and binds its pipeline,
+ * binds its descriptor set looked up by node index and binds its buffers.
+ */
+static uint64_t benchmarkQueueLegacy(BenchmarkQueueCommandStream& commandStream)
+{
+	uint64_t checksum = 0;
+
+	for (uint32_t n = 0; n < g_allNodes.size(); n++)
+	{
+		const auto& currentNode = g_allNodes[n];
+
+		for (uint32_t s = 0; s < currentNode.allSubMeshes.size(); s++)
+		{
+			const auto& currentSubMesh = currentNode.allSubMeshes[s];
+
+			uint32_t pipeline = UINT32_MAX;
+
+			for (uint32_t i = 0; i < BENCHMARK_QUEUE_PIPELINES; i++)
+			{
+				if (g_allPipelineVertexTypes[i] == currentSubMesh.vertexBufferType)
+				{
+					pipeline = i;
+
+					break;
+				}
+			}
+
+			commandStream.bindPipeline(pipeline);
+
+			checksum += g_allDescriptorSets[n] + g_allBindingPresent[n];
+
+			commandStream.descriptorSetCount++;
+
+			commandStream.bindMesh(currentSubMesh.mesh);
+
+			commandStream.drawCount++;
+		}
+	}
+
+	return checksum;
+}
+
+/**
+ * Same collection as the sort overwrite: hash maps from the state to its index,
+ * descriptor sets are only searched among the ones of the current node.
+ */
+static void benchmarkQueueCollect(vkts::RenderQueue& renderQueue, std::vector<uint32_t>& allDescriptorSetNodes, std::vector<uint32_t>& allDescriptorSetMaterials, vkts::HashMap<uint32_t, uint32_t>& allPipelineIndices, vkts::HashMap<uint32_t, uint32_t>& allMaterialIndices, vkts::HashMap<uint32_t, uint32_t>& allMeshIndices)
+{
+	renderQueue.reset();
+
+	allDescriptorSetNodes.clear();
+	allDescriptorSetMaterials.clear();
+
+	allPipelineIndices.clear();
+	allMaterialIndices.clear();
+	allMeshIndices.clear();
+
+	for (uint32_t n = 0; n < g_allNodes.size(); n++)
+	{
+		const auto& currentNode = g_allNodes[n];
+
+		const uint32_t firstDescriptorSet = (uint32_t)allDescriptorSetNodes.size();
+
+		for (uint32_t s = 0; s < currentNode.allSubMeshes.size(); s++)
+		{
+			const auto& currentSubMesh = currentNode.allSubMeshes[s];
+
+			VkTsRenderItem renderItem;
+
+			uint32_t index = allPipelineIndices.find(currentSubMesh.vertexBufferType);
+			if (index == allPipelineIndices.size())
+			{
+				allPipelineIndices.set(currentSubMesh.vertexBufferType, index);
+			}
+			renderItem.pipeline = allPipelineIndices.valueAt(index);
+
+			index = allMaterialIndices.find(currentSubMesh.material);
+			if (index == allMaterialIndices.size())
+			{
+				allMaterialIndices.set(currentSubMesh.material, index);
+			}
+			renderItem.material = allMaterialIndices.valueAt(index);
+
+			renderItem.descriptorSet = firstDescriptorSet;
+			while (renderItem.descriptorSet < allDescriptorSetMaterials.size() && allDescriptorSetMaterials[renderItem.descriptorSet] != currentSubMesh.material)
+			{
+				renderItem.descriptorSet++;
+			}
+			if (renderItem.descriptorSet == allDescriptorSetMaterials.size())
+			{
+				allDescriptorSetNodes.push_back(n);
+				allDescriptorSetMaterials.push_back(currentSubMesh.material);
+			}
+
+			index = allMeshIndices.find(currentSubMesh.mesh);
+			if (index == allMeshIndices.size())
+			{
+				allMeshIndices.set(currentSubMesh.mesh, index);
+			}
+			renderItem.mesh = allMeshIndices.valueAt(index);
+
+			renderItem.depth = currentNode.depth;
+			renderItem.draw = s;
+
+			renderQueue.add(renderItem);
+		}
+	}
+}
+
+static uint32_t benchmarkQueueDepthBucket(const float depth)
+{
+	// Same precision as in the sort key.
+	uint32_t depthBits;
+
+	memcpy(&depthBits, &depth, sizeof(uint32_t));
+
+	return depthBits >> 21;
+}
+
+static float benchmarkQueueRandom(uint32_t& random)
+{
+	random = random * 1664525u + 1013904223u;
+
+	return (float)(random >> 8) / (float)(1 << 24);
+}
+
+VkBool32 benchmarkQueue()
+{
+	// Each node has one to three sub meshes. Meshes and materials are shared by several nodes.
+
+	uint32_t random = 0x12345678;
+
+	for (uint32_t i = 0; i < BENCHMARK_QUEUE_PIPELINES; i++)
+	{
+		g_allPipelineVertexTypes[i] = 1u << i;
+	}
+
+	g_allNodes.resize(BENCHMARK_QUEUE_NODES);
+
+	uint32_t subMeshCount = 0;
+
+	for (uint32_t n = 0; n < BENCHMARK_QUEUE_NODES; n++)
+	{
+		auto& currentNode = g_allNodes[n];
+
+		currentNode.name = "Scene_Object_Node_" + std::to_string(n);
+		currentNode.depth = 1.0f + benchmarkQueueRandom(random) * 500.0f;
+
+		const uint32_t currentSubMeshCount = 1 + (uint32_t)(benchmarkQueueRandom(random) * 3.0f);
+
+		for (uint32_t s = 0; s < currentSubMeshCount; s++)
+		{
+			BenchmarkQueueSubMesh subMesh;
+
+			subMesh.vertexBufferType = g_allPipelineVertexTypes[(uint32_t)(benchmarkQueueRandom(random) * (float)BENCHMARK_QUEUE_PIPELINES)];
+			subMesh.material = (uint32_t)(benchmarkQueueRandom(random) * (float)BENCHMARK_QUEUE_MATERIALS);
+			subMesh.mesh = (uint32_t)(benchmarkQueueRandom(random) * (float)BENCHMARK_QUEUE_MESHES);
+			subMesh.numberIndices = 36;
+
+			currentNode.allSubMeshes.push_back(subMesh);
+		}
+
+		subMeshCount += currentSubMeshCount;
+
+		g_allDescriptorSets.push_back(n);
+
+		g_allBindingPresent.push_back(3);
+	}
+
+	vkts::logPrint(VKTS_LOG_INFO, __FILE__, __LINE__, "Benchmark 'queue': %u nodes, %u sub meshes, %u pipelines, %u materials, %u meshes, %u frames.", BENCHMARK_QUEUE_NODES, subMeshCount, BENCHMARK_QUEUE_PIPELINES, BENCHMARK_QUEUE_MATERIALS, BENCHMARK_QUEUE_MESHES, BENCHMARK_QUEUE_FRAMES);
+
+	vkts::RenderQueue renderQueue;
+
+	std::vector<uint32_t> allDescriptorSetNodes;
+	std::vector<uint32_t> allDescriptorSetMaterials;
+
+	vkts::HashMap<uint32_t, uint32_t> allPipelineIndices;
+	vkts::HashMap<uint32_t, uint32_t> allMaterialIndices;
+	vkts::HashMap<uint32_t, uint32_t> allMeshIndices;
+
+	BenchmarkQueueCommandStream legacyStream;
+	BenchmarkQueueCommandStream queueStream;
+
+	queueStream.allDescriptorSets = &g_allDescriptorSets;
+	queueStream.allBindingPresent = &g_allBindingPresent;
+	queueStream.allDescriptorSetNodes = &allDescriptorSetNodes;
+
+	double legacyTime = 0.0;
+	double collectTime = 0.0;
+	double sortTime = 0.0;
+	double recordTime = 0.0;
+	double newStateTime = 0.0;
+
+	uint64_t checksum = 0;
+
+	for (uint32_t frame = 0; frame < BENCHMARK_QUEUE_FRAMES; frame++)
+	{
+		legacyStream = BenchmarkQueueCommandStream();
+
+		double startTime = vkts::timeGetRaw();
+
+		checksum += benchmarkQueueLegacy(legacyStream);
+
+		legacyTime += vkts::timeGetRaw() - startTime;
+
+		//
+
+		queueStream.pipelineCount = 0;
+		queueStream.descriptorSetCount = 0;
+		queueStream.meshCount = 0;
+		queueStream.drawCount = 0;
+
+		startTime = vkts::timeGetRaw();
+
+		benchmarkQueueCollect(renderQueue, allDescriptorSetNodes, allDescriptorSetMaterials, allPipelineIndices, allMaterialIndices, allMeshIndices);
+
+		collectTime += vkts::timeGetRaw() - startTime;
+
+		startTime = vkts::timeGetRaw();
+
+		renderQueue.sort();
+
+		sortTime += vkts::timeGetRaw() - startTime;
+
+		startTime = vkts::timeGetRaw();
+
+		renderQueue.record(queueStream);
+
+		recordTime += vkts::timeGetRaw() - startTime;
+
+		// Same collection and sort, but with the state created for this frame only.
+
+		startTime = vkts::timeGetRaw();
+
+		{
+			vkts::RenderQueue newRenderQueue;
+
+			std::vector<uint32_t> newDescriptorSetNodes;
+			std::vector<uint32_t> newDescriptorSetMaterials;
+
+			vkts::HashMap<uint32_t, uint32_t> newPipelineIndices;
+			vkts::HashMap<uint32_t, uint32_t> newMaterialIndices;
+			vkts::HashMap<uint32_t, uint32_t> newMeshIndices;
+
+			benchmarkQueueCollect(newRenderQueue, newDescriptorSetNodes, newDescriptorSetMaterials, newPipelineIndices, newMaterialIndices, newMeshIndices);
+
+			newRenderQueue.sort();
+		}
+
+		newStateTime += vkts::timeGetRaw() - startTime;
+	}
+
+	// Same draws, sorted by pipeline, material, descriptor set, mesh and front to back.
+
+	if (queueStream.drawCount != legacyStream.drawCount || renderQueue.getNumberItems() != subMeshCount)
+	{
+		vkts::logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Benchmark 'queue': %u draws recorded, %u expected.", queueStream.drawCount, legacyStream.drawCount);
+
+		return VK_FALSE;
+	}
+
+	for (uint32_t i = 1; i < renderQueue.getNumberItems(); i++)
+	{
+		const VkTsRenderItem& previous = renderQueue.getItem(i - 1);
+		const VkTsRenderItem& current = renderQueue.getItem(i);
+
+		if (std::make_tuple(previous.pipeline, previous.material, previous.descriptorSet, previous.mesh, benchmarkQueueDepthBucket(previous.depth)) > std::make_tuple(current.pipeline, current.material, current.descriptorSet, current.mesh, benchmarkQueueDepthBucket(current.depth)))
+		{
+			vkts::logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Benchmark 'queue': Items %u and %u are not sorted.", i - 1, i);
+
+			return VK_FALSE;
+		}
+	}
+
+	// Draws sharing a pipeline and a descriptor set have to be recorded with one bind.
+
+	std::vector<uint64_t> allBoundDescriptorSets;
+
+	for (uint32_t i = 0; i < renderQueue.getNumberItems(); i++)
+	{
+		allBoundDescriptorSets.push_back(((uint64_t)renderQueue.getItem(i).pipeline << 32) | (uint64_t)renderQueue.getItem(i).descriptorSet);
+	}
+
+	std::sort(allBoundDescriptorSets.begin(), allBoundDescriptorSets.end());
+
+	allBoundDescriptorSets.erase(std::unique(allBoundDescriptorSets.begin(), allBoundDescriptorSets.end()), allBoundDescriptorSets.end());
+
+	if (queueStream.descriptorSetCount != (uint32_t)allBoundDescriptorSets.size())
+	{
+		vkts::logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Benchmark 'queue': %u descriptor set binds, %u expected.", queueStream.descriptorSetCount, (uint32_t)allBoundDescriptorSets.size());
+
+		return VK_FALSE;
+	}
+
+	legacyTime /= (double)BENCHMARK_QUEUE_FRAMES;
+	collectTime /= (double)BENCHMARK_QUEUE_FRAMES;
+	sortTime /= (double)BENCHMARK_QUEUE_FRAMES;
+	recordTime /= (double)BENCHMARK_QUEUE_FRAMES;
+	newStateTime /= (double)BENCHMARK_QUEUE_FRAMES;
+
+	vkts::logPrint(VKTS_LOG_INFO, __FILE__, __LINE__, "Benchmark 'queue': Binds: recursive %u pipelines, %u descriptor sets, %u meshes. Sorted %u pipelines, %u descriptor sets, %u meshes. Distinct %u descriptor sets, %u meshes.", legacyStream.pipelineCount, legacyStream.descriptorSetCount, legacyStream.meshCount, queueStream.pipelineCount, queueStream.descriptorSetCount, queueStream.meshCount, (uint32_t)allDescriptorSetNodes.size(), allMeshIndices.size());
+
+	vkts::logPrint(VKTS_LOG_INFO, __FILE__, __LINE__, "Benchmark 'queue': recursive %7.3f ms, collect %7.3f ms, sort %7.3f ms, record %7.3f ms per frame, speedup %.2fx (checksum %llu)", legacyTime * 1000.0, collectTime * 1000.0, sortTime * 1000.0, recordTime * 1000.0, legacyTime / (collectTime + sortTime + recordTime), (unsigned long long)(checksum + queueStream.checksum));
+
+	vkts::logPrint(VKTS_LOG_INFO, __FILE__, __LINE__, "Benchmark 'queue': collect and sort with reused state %7.3f ms, with new state %7.3f ms per frame", (collectTime + sortTime) * 1000.0, newStateTime * 1000.0);
+
+	g_allNodes.clear();
+	g_allDescriptorSets.clear();
+	g_allBindingPresent.clear();
+
+	return VK_TRUE;
+}
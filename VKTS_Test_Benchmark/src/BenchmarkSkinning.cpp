@@ -0,0 +1,204 @@
+#include "Benchmark.hpp"
+
+#define BENCHMARK_SKINNING_CHARACTERS 100
+#define BENCHMARK_SKINNING_JOINTS 64
+#define BENCHMARK_SKINNING_MAX_JOINTS 96
+#define BENCHMARK_SKINNING_FRAMES 100
+
+/**
+ * Stands in for the upload to device memory, which maps, copies and unmaps. Mapping is not measured.
+ */
+static void benchmarkSkinningUpload(std::vector<uint8_t>& deviceMemory, const uint32_t offset, const void* data, const uint32_t size)
+{
+	memcpy(&deviceMemory[offset], data, size);
+
+	vkts::profileAddUpload(size);
+}
+
+static float benchmarkSkinningRandom(uint32_t& random)
+{
+	random = random * 1664525u + 1013904223u;
+
+	return (float)(random >> 8) / (float)(1 << 24);
+}
+
+VkBool32 benchmarkSkinning()
+{
+	uint32_t random = 0x12345678;
+
+	// Joints are stored after their parent. Bind matrices are the same for all characters.
+
+	std::vector<int32_t> allParentIndices(BENCHMARK_SKINNING_JOINTS);
+	std::vector<glm::mat4> allBindMatrices(BENCHMARK_SKINNING_JOINTS);
+	std::vector<glm::mat4> allInverseBindMatrices(BENCHMARK_SKINNING_JOINTS);
+
+	for (uint32_t joint = 0; joint < BENCHMARK_SKINNING_JOINTS; joint++)
+	{
+		allParentIndices[joint] = joint == 0 ? -1 : (int32_t)(benchmarkSkinningRandom(random) * (float)joint);
+
+		allBindMatrices[joint] = vkts::translateMat4(benchmarkSkinningRandom(random), benchmarkSkinningRandom(random), benchmarkSkinningRandom(random)) * vkts::rotateRzRyRxMat4(benchmarkSkinningRandom(random) * 360.0f, benchmarkSkinningRandom(random) * 360.0f, 0.0f);
+		allInverseBindMatrices[joint] = glm::inverse(allBindMatrices[joint]);
+	}
+
+	const uint32_t paletteBufferSize = (uint32_t)sizeof(float) * ((16 + 12) * (BENCHMARK_SKINNING_MAX_JOINTS + 1));
+
+	std::vector<uint8_t> legacyDeviceMemory(paletteBufferSize * BENCHMARK_SKINNING_CHARACTERS);
+	std::vector<uint8_t> deviceMemory(paletteBufferSize * BENCHMARK_SKINNING_CHARACTERS);
+
+	std::vector<vkts::JointPalette> allPalettes(BENCHMARK_SKINNING_CHARACTERS);
+
+	for (uint32_t character = 0; character < BENCHMARK_SKINNING_CHARACTERS; character++)
+	{
+		allPalettes[character].reset(BENCHMARK_SKINNING_MAX_JOINTS);
+	}
+
+	std::vector<glm::mat4> allLegacyMatrices(BENCHMARK_SKINNING_JOINTS);
+	std::vector<glm::mat4> allMatrices(BENCHMARK_SKINNING_JOINTS);
+
+	vkts::logPrint(VKTS_LOG_INFO, __FILE__, __LINE__, "Benchmark 'skinning': %u characters, %u joints, %u frames.", BENCHMARK_SKINNING_CHARACTERS, BENCHMARK_SKINNING_JOINTS, BENCHMARK_SKINNING_FRAMES);
+
+	double legacyTime = 0.0;
+	double paletteTime = 0.0;
+
+	uint64_t legacyUploads = 0;
+	uint64_t legacyUploadSize = 0;
+	uint64_t paletteUploads = 0;
+	uint64_t paletteUploadSize = 0;
+
+	uint64_t uploads = 0;
+	uint64_t uploadSize = 0;
+
+	// Reset the counters.
+	vkts::profileGetUploads(uploads, uploadSize);
+
+	for (uint32_t frame = 0; frame < BENCHMARK_SKINNING_FRAMES; frame++)
+	{
+		const glm::mat4 parentTransformMatrix = vkts::translateMat4((float)frame * 0.1f, 0.0f, 0.0f);
+
+		for (uint32_t character = 0; character < BENCHMARK_SKINNING_CHARACTERS; character++)
+		{
+			const float time = (float)frame / 30.0f + (float)character;
+
+			// Previous update: Matrices of translate, rotate and scale are multiplied and each matrix is uploaded on its own.
+
+			double startTime = vkts::timeGetRaw();
+
+			const uint32_t dynamicOffset = character * paletteBufferSize;
+
+			benchmarkSkinningUpload(legacyDeviceMemory, dynamicOffset + 0, glm::value_ptr(parentTransformMatrix), sizeof(float) * 16);
+
+			glm::mat4 normalMatrix = glm::mat4(glm::transpose(glm::inverse(glm::mat3(parentTransformMatrix))));
+
+			benchmarkSkinningUpload(legacyDeviceMemory, dynamicOffset + sizeof(float) * 16, glm::value_ptr(normalMatrix), sizeof(float) * 11);
+
+			for (uint32_t joint = 0; joint < BENCHMARK_SKINNING_JOINTS; joint++)
+			{
+				const float angle = 20.0f * sinf(time + (float)joint);
+
+				glm::mat4 localMatrix = vkts::translateMat4(0.0f, 0.01f * angle, 0.0f) * vkts::rotateRyRzRxMat4(angle, angle * 0.5f, 0.0f) * vkts::scaleMat4(1.0f, 1.0f, 1.0f);
+
+				allLegacyMatrices[joint] = allBindMatrices[joint] * localMatrix * allInverseBindMatrices[joint];
+
+				if (allParentIndices[joint] >= 0)
+				{
+					allLegacyMatrices[joint] = allLegacyMatrices[allParentIndices[joint]] * allLegacyMatrices[joint];
+				}
+
+				const uint32_t offset = sizeof(float) * 16 + sizeof(float) * 12;
+
+				benchmarkSkinningUpload(legacyDeviceMemory, dynamicOffset + offset + joint * sizeof(float) * 16, glm::value_ptr(allLegacyMatrices[joint]), sizeof(float) * 16);
+
+				normalMatrix = glm::mat4(glm::transpose(glm::inverse(glm::mat3(allLegacyMatrices[joint]))));
+
+				benchmarkSkinningUpload(legacyDeviceMemory, dynamicOffset + offset + BENCHMARK_SKINNING_MAX_JOINTS * sizeof(float) * 16 + joint * sizeof(float) * 12, glm::value_ptr(normalMatrix), sizeof(float) * 11);
+			}
+
+			legacyTime += vkts::timeGetRaw() - startTime;
+
+			vkts::profileGetUploads(uploads, uploadSize);
+
+			legacyUploads += uploads;
+			legacyUploadSize += uploadSize;
+
+			// Joint palette: Matrices are gathered and uploaded at once.
+
+			startTime = vkts::timeGetRaw();
+
+			vkts::JointPalette& palette = allPalettes[character];
+
+			palette.setParent(parentTransformMatrix);
+
+			for (uint32_t joint = 0; joint < BENCHMARK_SKINNING_JOINTS; joint++)
+			{
+				const float angle = 20.0f * sinf(time + (float)joint);
+
+				glm::mat4 localMatrix = vkts::rotateRyRzRxMat4(angle, angle * 0.5f, 0.0f);
+
+				localMatrix[3] = glm::vec4(0.0f, 0.01f * angle, 0.0f, 1.0f);
+
+				vkts::multiplyMat4(allMatrices[joint], allBindMatrices[joint], localMatrix);
+				vkts::multiplyMat4(allMatrices[joint], allMatrices[joint], allInverseBindMatrices[joint]);
+
+				if (allParentIndices[joint] >= 0)
+				{
+					vkts::multiplyMat4(allMatrices[joint], allMatrices[allParentIndices[joint]], allMatrices[joint]);
+				}
+
+				palette.setJoint(joint, allMatrices[joint]);
+			}
+
+			palette.update();
+
+			benchmarkSkinningUpload(deviceMemory, dynamicOffset, palette.getData(), palette.getSize());
+
+			paletteTime += vkts::timeGetRaw() - startTime;
+
+			vkts::profileGetUploads(uploads, uploadSize);
+
+			paletteUploads += uploads;
+			paletteUploadSize += uploadSize;
+		}
+
+		// Both have to result in the same buffer content.
+
+		for (uint32_t character = 0; character < BENCHMARK_SKINNING_CHARACTERS; character++)
+		{
+			const float* legacyData = (const float*)&legacyDeviceMemory[character * paletteBufferSize];
+			const float* data = (const float*)&deviceMemory[character * paletteBufferSize];
+
+			for (uint32_t joint = 0; joint <= BENCHMARK_SKINNING_JOINTS; joint++)
+			{
+				const uint32_t matrixOffset = joint == 0 ? 0 : 16 + 12 + (joint - 1) * 16;
+				const uint32_t normalOffset = joint == 0 ? 16 : 16 + 12 + BENCHMARK_SKINNING_MAX_JOINTS * 16 + (joint - 1) * 12;
+
+				for (uint32_t i = 0; i < 16; i++)
+				{
+					if (glm::abs(legacyData[matrixOffset + i] - data[matrixOffset + i]) > 1e-3f)
+					{
+						vkts::logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Benchmark 'skinning': Joint matrix %u differs.", joint);
+
+						return VK_FALSE;
+					}
+				}
+
+				for (uint32_t i = 0; i < 11; i++)
+				{
+					if (glm::abs(legacyData[normalOffset + i] - data[normalOffset + i]) > 1e-3f)
+					{
+						vkts::logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Benchmark 'skinning': Normal matrix %u differs.", joint);
+
+						return VK_FALSE;
+					}
+				}
+			}
+		}
+	}
+
+	legacyTime /= (double)BENCHMARK_SKINNING_FRAMES;
+	paletteTime /= (double)BENCHMARK_SKINNING_FRAMES;
+
+	vkts::logPrint(VKTS_LOG_INFO, __FILE__, __LINE__, "Benchmark 'skinning': uploads per frame %u before, %u now; bytes per frame %u before, %u now", (uint32_t)(legacyUploads / BENCHMARK_SKINNING_FRAMES), (uint32_t)(paletteUploads / BENCHMARK_SKINNING_FRAMES), (uint32_t)(legacyUploadSize / BENCHMARK_SKINNING_FRAMES), (uint32_t)(paletteUploadSize / BENCHMARK_SKINNING_FRAMES));
+	vkts::logPrint(VKTS_LOG_INFO, __FILE__, __LINE__, "Benchmark 'skinning': per joint %7.3f ms, palette %7.3f ms per frame without mapping, speedup %.2fx", legacyTime * 1000.0, paletteTime * 1000.0, legacyTime / paletteTime);
+
+	return VK_TRUE;
+}
@@ -0,0 +1,257 @@
+#include "Benchmark.hpp"
+
+#define BENCHMARK_TASK_COUNT 64
+#define BENCHMARK_TASK_FRAMES 2000
+
+#define BENCHMARK_LEGACY_MAX_TASK_QUEUE_ELEMENT 1000
+
+/**
+ * Copy of the previous, mutex guarded task queue, used as the reference.
+ */
+class LegacyTaskQueueElement
+{
+
+public:
+
+	uint64_t index;
+
+	vkts::ITaskSP task;
+
+	LegacyTaskQueueElement() :
+		index(0), task(nullptr)
+	{
+	}
+
+};
+
+class LegacyTaskQueue
+{
+
+private:
+
+	LegacyTaskQueueElement taskQueueElementCache[BENCHMARK_LEGACY_MAX_TASK_QUEUE_ELEMENT];
+	VkBool32 taskQueueElementCacheUsed[BENCHMARK_LEGACY_MAX_TASK_QUEUE_ELEMENT];
+
+	vkts::ThreadsafeQueue<LegacyTaskQueueElement*> queue;
+
+	std::mutex mutex;
+
+	std::condition_variable conditionVariable;
+
+	uint64_t taskQueueElementCount;
+
+	LegacyTaskQueueElement* getTaskQueueElement()
+	{
+		std::unique_lock<std::mutex> uniqueLock(mutex);
+
+		if (taskQueueElementCount == BENCHMARK_LEGACY_MAX_TASK_QUEUE_ELEMENT)
+		{
+			conditionVariable.wait(uniqueLock, [this] {return taskQueueElementCount == BENCHMARK_LEGACY_MAX_TASK_QUEUE_ELEMENT;});
+		}
+
+		for (uint64_t i = 0; i < BENCHMARK_LEGACY_MAX_TASK_QUEUE_ELEMENT; i++)
+		{
+			if (taskQueueElementCacheUsed[i] == VK_FALSE)
+			{
+				taskQueueElementCacheUsed[i] = VK_TRUE;
+
+				taskQueueElementCount++;
+
+				return &taskQueueElementCache[i];
+			}
+		}
+
+		return nullptr;
+	}
+
+	void recycleTaskQueueElement(LegacyTaskQueueElement* taskQueueElement)
+	{
+		std::lock_guard<std::mutex> lockGuard(mutex);
+
+		taskQueueElement->task = vkts::ITaskSP();
+
+		taskQueueElementCacheUsed[taskQueueElement->index] = VK_FALSE;
+
+		taskQueueElementCount--;
+
+		conditionVariable.notify_all();
+	}
+
+public:
+
+	LegacyTaskQueue() :
+		taskQueueElementCache(), taskQueueElementCacheUsed(), queue(), mutex(), conditionVariable(), taskQueueElementCount(0)
+	{
+		for (uint64_t i = 0; i < BENCHMARK_LEGACY_MAX_TASK_QUEUE_ELEMENT; i++)
+		{
+			taskQueueElementCache[i].index = i;
+
+			taskQueueElementCacheUsed[i] = VK_FALSE;
+		}
+	}
+
+	VkBool32 addTask(const vkts::ITaskSP& task)
+	{
+		auto taskQueueElement = getTaskQueueElement();
+
+		if (!taskQueueElement)
+		{
+			return VK_FALSE;
+		}
+
+		taskQueueElement->task = task;
+
+		queue.add(taskQueueElement);
+
+		return VK_TRUE;
+	}
+
+	VkBool32 receiveTask(vkts::ITaskSP& task)
+	{
+		LegacyTaskQueueElement* taskQueueElement = nullptr;
+
+		queue.waitAndTake(taskQueueElement);
+
+		task = taskQueueElement->task;
+
+		recycleTaskQueueElement(taskQueueElement);
+
+		return task.get() != nullptr;
+	}
+
+};
+
+//
+
+class BenchmarkTask : public vkts::ITask
+{
+
+protected:
+
+	virtual VkBool32 execute() override
+	{
+		// Only the dispatch costs are measured.
+		return VK_TRUE;
+	}
+
+public:
+
+	BenchmarkTask(const uint64_t id) :
+		ITask(id)
+	{
+	}
+
+	virtual ~BenchmarkTask()
+	{
+	}
+
+	VkBool32 runLegacy()
+	{
+		return execute();
+	}
+
+};
+
+static vkts::SmartPointerVector<vkts::ITaskSP> g_allTasks;
+
+static VkBool32 benchmarkTaskFrame(const vkts::IUpdateThreadContext& updateContext)
+{
+	if (!updateContext.sendTasks(g_allTasks))
+	{
+		return VK_FALSE;
+	}
+
+	vkts::SmartPointerVector<vkts::ITaskSP> allExecutedTasks;
+
+	return updateContext.receiveExecutedTasks(allExecutedTasks, g_allTasks.size());
+}
+
+static double benchmarkTaskLegacy(const uint32_t taskExecutorCount)
+{
+	LegacyTaskQueue sendTaskQueue;
+	LegacyTaskQueue executedTaskQueue;
+
+	std::vector<std::thread> allThreads;
+
+	for (uint32_t i = 0; i < taskExecutorCount; i++)
+	{
+		allThreads.push_back(std::thread([&sendTaskQueue, &executedTaskQueue]() {
+			vkts::ITaskSP task;
+
+			while (sendTaskQueue.receiveTask(task))
+			{
+				static_cast<BenchmarkTask*>(task.get())->runLegacy();
+
+				executedTaskQueue.addTask(task);
+
+				task = vkts::ITaskSP();
+
+				std::this_thread::yield();
+			}
+		}));
+	}
+
+	double totalTime = 0.0;
+
+	for (uint32_t frame = 0; frame < BENCHMARK_TASK_FRAMES; frame++)
+	{
+		double startTime = vkts::timeGetRaw();
+
+		for (uint32_t i = 0; i < g_allTasks.size(); i++)
+		{
+			sendTaskQueue.addTask(g_allTasks[i]);
+		}
+
+		for (uint32_t i = 0; i < g_allTasks.size(); i++)
+		{
+			vkts::ITaskSP executedTask;
+
+			executedTaskQueue.receiveTask(executedTask);
+		}
+
+		totalTime += vkts::timeGetRaw() - startTime;
+	}
+
+	// Empty task stops an executor.
+	for (uint32_t i = 0; i < taskExecutorCount; i++)
+	{
+		sendTaskQueue.addTask(vkts::ITaskSP());
+	}
+
+	for (auto& currentThread : allThreads)
+	{
+		currentThread.join();
+	}
+
+	return totalTime / (double)BENCHMARK_TASK_FRAMES;
+}
+
+VkBool32 benchmarkTask()
+{
+	g_allTasks.clear();
+
+	for (uint32_t i = 0; i < BENCHMARK_TASK_COUNT; i++)
+	{
+		g_allTasks.append(vkts::ITaskSP(new BenchmarkTask(i)));
+	}
+
+	vkts::logPrint(VKTS_LOG_INFO, __FILE__, __LINE__, "Benchmark 'task': %u tasks per frame, %u frames.", BENCHMARK_TASK_COUNT, BENCHMARK_TASK_FRAMES);
+
+	for (uint32_t taskExecutorCount = 1; taskExecutorCount <= 64; taskExecutorCount *= 2)
+	{
+		double legacyTime = benchmarkTaskLegacy(taskExecutorCount);
+
+		double schedulerTime = benchmarkRunEngine(taskExecutorCount, BENCHMARK_TASK_FRAMES, benchmarkTaskFrame);
+
+		if (schedulerTime == 0.0)
+		{
+			return VK_FALSE;
+		}
+
+		vkts::logPrint(VKTS_LOG_INFO, __FILE__, __LINE__, "Benchmark 'task': %2u executors: queue %8.2f us, scheduler %8.2f us per frame, speedup %.2fx", taskExecutorCount, legacyTime * 1000000.0, schedulerTime * 1000000.0, legacyTime / schedulerTime);
+	}
+
+	g_allTasks.clear();
+
+	return VK_TRUE;
+}
@@ -0,0 +1,203 @@
+#include "Benchmark.hpp"
+
+#define BENCHMARK_TRANSFORM_NODES 100000
+#define BENCHMARK_TRANSFORM_FRAMES 100
+
+/**
+ * Copy of the recursive node transform update, used as the reference.
+ */
+class LegacyTransformNode
+{
+
+public:
+
+	glm::vec3 translate;
+	VkTsRotationMode rotationMode;
+	glm::vec3 rotate;
+	glm::vec3 scale;
+
+	glm::mat4 transformMatrix;
+	glm::mat3 transformNormalMatrix;
+	VkBool32 transformMatrixDirty;
+
+	std::vector<std::shared_ptr<LegacyTransformNode>> allChildNodes;
+
+	LegacyTransformNode() :
+		translate(0.0f, 0.0f, 0.0f), rotationMode(VKTS_EULER_XZY), rotate(0.0f, 0.0f, 0.0f), scale(1.0f, 1.0f, 1.0f), transformMatrix(1.0f), transformNormalMatrix(1.0f), transformMatrixDirty(VK_TRUE), allChildNodes()
+	{
+	}
+
+	virtual ~LegacyTransformNode()
+	{
+	}
+
+	virtual void updateTransformRecursive(const glm::mat4& parentTransformMatrix, const VkBool32 parentTransformMatrixDirty)
+	{
+		transformMatrixDirty = transformMatrixDirty || parentTransformMatrixDirty;
+
+		if (transformMatrixDirty)
+		{
+			glm::mat4 currentRotation(1.0f);
+
+			switch (rotationMode)
+			{
+				case VKTS_EULER_YXZ:
+					currentRotation = vkts::rotateRzRxRyMat4(rotate.z, rotate.x, rotate.y);
+					break;
+				case VKTS_EULER_XYZ:
+					currentRotation = vkts::rotateRzRyRxMat4(rotate.z, rotate.y, rotate.x);
+					break;
+				case VKTS_EULER_XZY:
+					currentRotation = vkts::rotateRyRzRxMat4(rotate.y, rotate.z, rotate.x);
+					break;
+			}
+
+			transformMatrix = parentTransformMatrix * vkts::translateMat4(translate.x, translate.y, translate.z) * currentRotation * vkts::scaleMat4(scale.x, scale.y, scale.z);
+
+			transformNormalMatrix = glm::transpose(glm::inverse(glm::mat3(transformMatrix)));
+		}
+
+		for (uint32_t i = 0; i < (uint32_t)allChildNodes.size(); i++)
+		{
+			allChildNodes[i]->updateTransformRecursive(transformMatrix, transformMatrixDirty);
+		}
+
+		transformMatrixDirty = VK_FALSE;
+	}
+
+};
+
+typedef std::shared_ptr<LegacyTransformNode> LegacyTransformNodeSP;
+
+static float benchmarkTransformRandom(uint32_t& random)
+{
+	random = random * 1664525u + 1013904223u;
+
+	return (float)(random >> 8) / (float)(1 << 24);
+}
+
+static void benchmarkTransformFlatten(vkts::TransformHierarchy& transformHierarchy, std::vector<LegacyTransformNode*>& allFlattenedNodes, const LegacyTransformNodeSP& node, const int32_t parentIndex)
+{
+	int32_t transformIndex = transformHierarchy.addTransform(parentIndex, node->translate, node->rotationMode, node->rotate, node->scale);
+
+	allFlattenedNodes.push_back(node.get());
+
+	for (uint32_t i = 0; i < (uint32_t)node->allChildNodes.size(); i++)
+	{
+		benchmarkTransformFlatten(transformHierarchy, allFlattenedNodes, node->allChildNodes[i], transformIndex);
+	}
+}
+
+static float benchmarkTransformDifference(const float* left, const float* right, const uint32_t count)
+{
+	float difference = 0.0f;
+
+	for (uint32_t i = 0; i < count; i++)
+	{
+		difference = glm::max(difference, glm::abs(left[i] - right[i]) / (1.0f + glm::abs(left[i])));
+	}
+
+	return difference;
+}
+
+VkBool32 benchmarkTransform()
+{
+	// Wide and shallow tree, as the parent is picked randomly from the previous nodes.
+
+	std::vector<LegacyTransformNodeSP> allNodes;
+
+	uint32_t random = 0x12345678;
+
+	for (uint32_t i = 0; i < BENCHMARK_TRANSFORM_NODES; i++)
+	{
+		LegacyTransformNodeSP node = LegacyTransformNodeSP(new LegacyTransformNode());
+
+		node->translate = glm::vec3(benchmarkTransformRandom(random) * 2.0f - 1.0f, benchmarkTransformRandom(random) * 2.0f - 1.0f, benchmarkTransformRandom(random) * 2.0f - 1.0f);
+		node->rotationMode = (VkTsRotationMode)(i % 3);
+		node->rotate = glm::vec3(benchmarkTransformRandom(random) * 360.0f, benchmarkTransformRandom(random) * 360.0f, benchmarkTransformRandom(random) * 360.0f);
+		node->scale = glm::vec3(0.9f + benchmarkTransformRandom(random) * 0.2f);
+
+		if (i > 0)
+		{
+			random = random * 1664525u + 1013904223u;
+
+			allNodes[(random >> 8) % i]->allChildNodes.push_back(node);
+		}
+
+		allNodes.push_back(node);
+	}
+
+	vkts::TransformHierarchy transformHierarchy;
+
+	std::vector<LegacyTransformNode*> allFlattenedNodes;
+
+	benchmarkTransformFlatten(transformHierarchy, allFlattenedNodes, allNodes[0], -1);
+
+	if (transformHierarchy.getSize() != BENCHMARK_TRANSFORM_NODES)
+	{
+		return VK_FALSE;
+	}
+
+	const glm::mat4 rootMatrix = vkts::translateMat4(1.0f, 2.0f, 3.0f);
+
+	vkts::logPrint(VKTS_LOG_INFO, __FILE__, __LINE__, "Benchmark 'transform': %u nodes, %u frames.", BENCHMARK_TRANSFORM_NODES, BENCHMARK_TRANSFORM_FRAMES);
+
+	// Every n-th node is animated.
+
+	for (uint32_t animatedStep = 1; animatedStep <= 100; animatedStep *= 10)
+	{
+		double legacyTime = 0.0;
+		double flattenedTime = 0.0;
+
+		for (uint32_t frame = 0; frame < BENCHMARK_TRANSFORM_FRAMES; frame++)
+		{
+			const VkBool32 rootDirty = frame == 0;
+
+			double startTime = vkts::timeGetRaw();
+
+			for (uint32_t i = animatedStep - 1; i < BENCHMARK_TRANSFORM_NODES; i += animatedStep)
+			{
+				allFlattenedNodes[i]->rotate.y += 1.0f;
+
+				allFlattenedNodes[i]->transformMatrixDirty = VK_TRUE;
+			}
+
+			allNodes[0]->updateTransformRecursive(rootMatrix, rootDirty);
+
+			legacyTime += vkts::timeGetRaw() - startTime;
+
+			startTime = vkts::timeGetRaw();
+
+			for (uint32_t i = animatedStep - 1; i < BENCHMARK_TRANSFORM_NODES; i += animatedStep)
+			{
+				transformHierarchy.setRotate(i, allFlattenedNodes[i]->rotate);
+			}
+
+			transformHierarchy.update(rootMatrix, rootDirty);
+
+			flattenedTime += vkts::timeGetRaw() - startTime;
+		}
+
+		float maxDifference = 0.0f;
+
+		for (uint32_t i = 0; i < BENCHMARK_TRANSFORM_NODES; i++)
+		{
+			maxDifference = glm::max(maxDifference, benchmarkTransformDifference(&allFlattenedNodes[i]->transformMatrix[0][0], &transformHierarchy.getWorldMatrix(i)[0][0], 16));
+			maxDifference = glm::max(maxDifference, benchmarkTransformDifference(&allFlattenedNodes[i]->transformNormalMatrix[0][0], &transformHierarchy.getNormalMatrix(i)[0][0], 9));
+		}
+
+		if (maxDifference > 1e-3f)
+		{
+			vkts::logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Benchmark 'transform': Flattened hierarchy differs by %f.", maxDifference);
+
+			return VK_FALSE;
+		}
+
+		legacyTime /= (double)BENCHMARK_TRANSFORM_FRAMES;
+		flattenedTime /= (double)BENCHMARK_TRANSFORM_FRAMES;
+
+		vkts::logPrint(VKTS_LOG_INFO, __FILE__, __LINE__, "Benchmark 'transform': %3u%% animated: recursive %8.3f ms, flattened %8.3f ms per frame, speedup %.2fx, max difference %g", 100 / animatedStep, legacyTime * 1000.0, flattenedTime * 1000.0, legacyTime / flattenedTime, (double)maxDifference);
+	}
+
+	return VK_TRUE;
+}
@@ -0,0 +1,269 @@
+#include "Benchmark.hpp"
+
+#define BENCHMARK_UPLOAD_NODES 4000
+#define BENCHMARK_UPLOAD_BUFFERS 2
+#define BENCHMARK_UPLOAD_FRAMES 100
+#define BENCHMARK_UPLOAD_STRIDE 256
+#define BENCHMARK_UPLOAD_ATOM_SIZE 64
+
+/**
+ * Counts the calls into the driver instead of doing them. Mapping and flushing is not measured.
+ */
+typedef struct BenchmarkUploadDevice_
+{
+	uint64_t mapCount;
+	uint64_t flushCount;
+	uint64_t flushRangeCount;
+} BenchmarkUploadDevice;
+
+static void benchmarkUploadFlush(BenchmarkUploadDevice& device, const uint32_t rangeCount)
+{
+	device.flushCount++;
+	device.flushRangeCount += rangeCount;
+
+	vkts::profileAddFlush(rangeCount);
+}
+
+/**
+ * Copy of the previous upload of non coherent memory: map, copy, flush and unmap for each value.
+ */
+static void benchmarkUploadLegacy(BenchmarkUploadDevice& device, std::vector<uint8_t>& deviceMemory, const uint32_t offset, const void* data, const uint32_t size)
+{
+	device.mapCount++;
+
+	memcpy(&deviceMemory[offset], data, size);
+
+	vkts::profileAddUpload(size);
+
+	benchmarkUploadFlush(device, 1);
+}
+
+static float benchmarkUploadRandom(uint32_t& random)
+{
+	random = random * 1664525u + 1013904223u;
+
+	return (float)(random >> 8) / (float)(1 << 24);
+}
+
+VkBool32 benchmarkUpload()
+{
+	uint32_t random = 0x12345678;
+
+	std::vector<glm::mat4> allTransformMatrices(BENCHMARK_UPLOAD_NODES);
+
+	for (auto& currentTransformMatrix : allTransformMatrices)
+	{
+		currentTransformMatrix = vkts::translateMat4(benchmarkUploadRandom(random), benchmarkUploadRandom(random), benchmarkUploadRandom(random)) * vkts::rotateRzRyRxMat4(benchmarkUploadRandom(random) * 360.0f, benchmarkUploadRandom(random) * 360.0f, 0.0f);
+	}
+
+	// Transform and normal matrix as in the node transform uniform buffer.
+
+	const uint32_t matrixSize = (uint32_t)sizeof(float) * 16;
+	const uint32_t normalMatrixSize = (uint32_t)sizeof(float) * 12;
+
+	std::vector<uint8_t> legacyDeviceMemory(BENCHMARK_UPLOAD_NODES * BENCHMARK_UPLOAD_BUFFERS * BENCHMARK_UPLOAD_STRIDE);
+	std::vector<uint8_t> deviceMemory(BENCHMARK_UPLOAD_NODES * BENCHMARK_UPLOAD_BUFFERS * BENCHMARK_UPLOAD_STRIDE);
+	std::vector<uint8_t> sharedDeviceMemory(BENCHMARK_UPLOAD_NODES * BENCHMARK_UPLOAD_BUFFERS * BENCHMARK_UPLOAD_STRIDE);
+
+	// One ring per node buffer, as the buffer objects do, and one ring shared by all nodes.
+
+	std::vector<std::shared_ptr<vkts::UploadRing>> allUploadRings(BENCHMARK_UPLOAD_NODES);
+
+	for (auto& currentUploadRing : allUploadRings)
+	{
+		currentUploadRing = std::shared_ptr<vkts::UploadRing>(new vkts::UploadRing(BENCHMARK_UPLOAD_STRIDE, BENCHMARK_UPLOAD_BUFFERS, BENCHMARK_UPLOAD_ATOM_SIZE));
+	}
+
+	vkts::UploadRing sharedUploadRing(BENCHMARK_UPLOAD_NODES * BENCHMARK_UPLOAD_STRIDE, BENCHMARK_UPLOAD_BUFFERS, BENCHMARK_UPLOAD_ATOM_SIZE);
+
+	std::vector<VkDeviceSize> allSharedOffsets(BENCHMARK_UPLOAD_NODES);
+
+	std::vector<VkTsMemoryRange> allFlushRanges;
+
+	// Ranges of all buffer objects, as collected by the context object.
+	std::vector<VkTsMemoryRange> allFrameFlushRanges;
+
+	vkts::logPrint(VKTS_LOG_INFO, __FILE__, __LINE__, "Benchmark 'upload': %u nodes, %u buffers, %u frames, non coherent atom size %u.", BENCHMARK_UPLOAD_NODES, BENCHMARK_UPLOAD_BUFFERS, BENCHMARK_UPLOAD_FRAMES, BENCHMARK_UPLOAD_ATOM_SIZE);
+
+	BenchmarkUploadDevice legacyDevice{};
+	BenchmarkUploadDevice device{};
+	BenchmarkUploadDevice sharedDevice{};
+
+	double legacyTime = 0.0;
+	double time = 0.0;
+	double sharedTime = 0.0;
+
+	uint64_t frameBytes = 0;
+
+	uint64_t startFlushes;
+	uint64_t startFlushRanges;
+	uint64_t flushes;
+	uint64_t flushRanges;
+
+	vkts::profileGetFlushes(startFlushes, startFlushRanges);
+
+	for (uint32_t frame = 0; frame < BENCHMARK_UPLOAD_FRAMES; frame++)
+	{
+		const uint32_t currentBuffer = frame % BENCHMARK_UPLOAD_BUFFERS;
+
+		for (auto& currentTransformMatrix : allTransformMatrices)
+		{
+			currentTransformMatrix = vkts::rotateRyMat4(1.0f) * currentTransformMatrix;
+		}
+
+		double startTime = vkts::timeGetRaw();
+
+		for (uint32_t node = 0; node < BENCHMARK_UPLOAD_NODES; node++)
+		{
+			const uint32_t dynamicOffset = (node * BENCHMARK_UPLOAD_BUFFERS + currentBuffer) * BENCHMARK_UPLOAD_STRIDE;
+
+			const glm::mat3 normalMatrix = glm::transpose(glm::inverse(glm::mat3(allTransformMatrices[node])));
+
+			benchmarkUploadLegacy(legacyDevice, legacyDeviceMemory, dynamicOffset, &allTransformMatrices[node][0][0], matrixSize);
+
+			float normalData[12];
+
+			for (uint32_t i = 0; i < 3; i++)
+			{
+				normalData[i * 4 + 0] = normalMatrix[i][0];
+				normalData[i * 4 + 1] = normalMatrix[i][1];
+				normalData[i * 4 + 2] = normalMatrix[i][2];
+				normalData[i * 4 + 3] = 0.0f;
+			}
+
+			benchmarkUploadLegacy(legacyDevice, legacyDeviceMemory, dynamicOffset + matrixSize, normalData, normalMatrixSize);
+		}
+
+		legacyTime += vkts::timeGetRaw() - startTime;
+
+		// Mapped once, written through the ring of each node and flushed once per frame.
+
+		startTime = vkts::timeGetRaw();
+
+		allFrameFlushRanges.clear();
+
+		for (uint32_t node = 0; node < BENCHMARK_UPLOAD_NODES; node++)
+		{
+			auto& currentUploadRing = *allUploadRings[node];
+
+			const uint32_t bufferOffset = node * BENCHMARK_UPLOAD_BUFFERS * BENCHMARK_UPLOAD_STRIDE;
+
+			currentUploadRing.reset(currentBuffer);
+
+			VkDeviceSize dynamicOffset;
+
+			if (!currentUploadRing.allocate(dynamicOffset, matrixSize + normalMatrixSize, 16))
+			{
+				vkts::logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Benchmark 'upload': Could not allocate node %u.", node);
+
+				return VK_FALSE;
+			}
+
+			const glm::mat3 normalMatrix = glm::transpose(glm::inverse(glm::mat3(allTransformMatrices[node])));
+
+			memcpy(&deviceMemory[bufferOffset + dynamicOffset], &allTransformMatrices[node][0][0], matrixSize);
+
+			currentUploadRing.addDirtyRange(dynamicOffset, matrixSize);
+
+			float* normalData = (float*)&deviceMemory[bufferOffset + dynamicOffset + matrixSize];
+
+			for (uint32_t i = 0; i < 3; i++)
+			{
+				normalData[i * 4 + 0] = normalMatrix[i][0];
+				normalData[i * 4 + 1] = normalMatrix[i][1];
+				normalData[i * 4 + 2] = normalMatrix[i][2];
+				normalData[i * 4 + 3] = 0.0f;
+			}
+
+			currentUploadRing.addDirtyRange(dynamicOffset + matrixSize, normalMatrixSize);
+
+			vkts::profileAddUpload(matrixSize + normalMatrixSize);
+
+			currentUploadRing.getFlushRanges(allFlushRanges);
+
+			for (const auto& currentFlushRange : allFlushRanges)
+			{
+				allFrameFlushRanges.push_back(VkTsMemoryRange{bufferOffset + currentFlushRange.offset, currentFlushRange.size});
+			}
+		}
+
+		benchmarkUploadFlush(device, (uint32_t)allFrameFlushRanges.size());
+
+		time += vkts::timeGetRaw() - startTime;
+
+		// All nodes in one ring, flushed once per frame.
+
+		startTime = vkts::timeGetRaw();
+
+		sharedUploadRing.reset(currentBuffer);
+
+		for (uint32_t node = 0; node < BENCHMARK_UPLOAD_NODES; node++)
+		{
+			VkDeviceSize& dynamicOffset = allSharedOffsets[node];
+
+			if (!sharedUploadRing.allocate(dynamicOffset, matrixSize + normalMatrixSize, BENCHMARK_UPLOAD_ATOM_SIZE))
+			{
+				vkts::logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Benchmark 'upload': Could not allocate node %u.", node);
+
+				return VK_FALSE;
+			}
+
+			const glm::mat3 normalMatrix = glm::transpose(glm::inverse(glm::mat3(allTransformMatrices[node])));
+
+			memcpy(&sharedDeviceMemory[dynamicOffset], &allTransformMatrices[node][0][0], matrixSize);
+
+			float* normalData = (float*)&sharedDeviceMemory[dynamicOffset + matrixSize];
+
+			for (uint32_t i = 0; i < 3; i++)
+			{
+				normalData[i * 4 + 0] = normalMatrix[i][0];
+				normalData[i * 4 + 1] = normalMatrix[i][1];
+				normalData[i * 4 + 2] = normalMatrix[i][2];
+				normalData[i * 4 + 3] = 0.0f;
+			}
+
+			sharedUploadRing.addDirtyRange(dynamicOffset, matrixSize + normalMatrixSize);
+
+			vkts::profileAddUpload(matrixSize + normalMatrixSize);
+		}
+
+		sharedUploadRing.getFlushRanges(allFlushRanges);
+
+		benchmarkUploadFlush(sharedDevice, (uint32_t)allFlushRanges.size());
+
+		sharedTime += vkts::timeGetRaw() - startTime;
+
+		frameBytes = sharedUploadRing.getFrameBytes();
+	}
+
+	vkts::profileGetFlushes(flushes, flushRanges);
+
+	// All three have to write the same matrices of the last frame.
+
+	const uint32_t lastBuffer = (BENCHMARK_UPLOAD_FRAMES - 1) % BENCHMARK_UPLOAD_BUFFERS;
+
+	for (uint32_t node = 0; node < BENCHMARK_UPLOAD_NODES; node++)
+	{
+		const uint32_t dynamicOffset = (node * BENCHMARK_UPLOAD_BUFFERS + lastBuffer) * BENCHMARK_UPLOAD_STRIDE;
+
+		if (memcmp(&legacyDeviceMemory[dynamicOffset], &deviceMemory[dynamicOffset], matrixSize + normalMatrixSize) != 0 || memcmp(&legacyDeviceMemory[dynamicOffset], &sharedDeviceMemory[allSharedOffsets[node]], matrixSize + normalMatrixSize) != 0)
+		{
+			vkts::logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Benchmark 'upload': Data of node %u differs.", node);
+
+			return VK_FALSE;
+		}
+	}
+
+	if (flushes - startFlushes != legacyDevice.flushCount + device.flushCount + sharedDevice.flushCount || flushRanges - startFlushRanges != legacyDevice.flushRangeCount + device.flushRangeCount + sharedDevice.flushRangeCount)
+	{
+		vkts::logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Benchmark 'upload': Profiled flushes do not match.");
+
+		return VK_FALSE;
+	}
+
+	vkts::logPrint(VKTS_LOG_INFO, __FILE__, __LINE__, "Benchmark 'upload': Per frame %llu bytes. Maps: legacy %llu, persistent once. Flushes (ranges): legacy %llu (%llu), per buffer ring %llu (%llu), shared ring %llu (%llu).", (unsigned long long)frameBytes, (unsigned long long)(legacyDevice.mapCount / BENCHMARK_UPLOAD_FRAMES), (unsigned long long)(legacyDevice.flushCount / BENCHMARK_UPLOAD_FRAMES), (unsigned long long)(legacyDevice.flushRangeCount / BENCHMARK_UPLOAD_FRAMES), (unsigned long long)(device.flushCount / BENCHMARK_UPLOAD_FRAMES), (unsigned long long)(device.flushRangeCount / BENCHMARK_UPLOAD_FRAMES), (unsigned long long)(sharedDevice.flushCount / BENCHMARK_UPLOAD_FRAMES), (unsigned long long)(sharedDevice.flushRangeCount / BENCHMARK_UPLOAD_FRAMES));
+
+	vkts::logPrint(VKTS_LOG_INFO, __FILE__, __LINE__, "Benchmark 'upload': legacy %7.3f ms, per buffer ring %7.3f ms, shared ring %7.3f ms per frame, without driver calls.", legacyTime * 1000.0 / (double)BENCHMARK_UPLOAD_FRAMES, time * 1000.0 / (double)BENCHMARK_UPLOAD_FRAMES, sharedTime * 1000.0 / (double)BENCHMARK_UPLOAD_FRAMES);
+
+	return VK_TRUE;
+}
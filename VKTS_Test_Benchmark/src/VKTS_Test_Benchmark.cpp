@@ -0,0 +1,198 @@
+#include "Benchmark.hpp"
+
+class BenchmarkUpdateThread : public vkts::IUpdateThread
+{
+
+public:
+
+	PFN_benchmarkFrameFunction frameFunction;
+
+	uint32_t frameCount;
+
+	uint32_t currentFrame;
+
+	double totalTime;
+
+	BenchmarkUpdateThread() :
+		IUpdateThread(), frameFunction(nullptr), frameCount(0), currentFrame(0), totalTime(0.0)
+	{
+	}
+
+	virtual ~BenchmarkUpdateThread()
+	{
+	}
+
+	virtual VkBool32 init(const vkts::IUpdateThreadContext& updateContext)
+	{
+		currentFrame = 0;
+
+		totalTime = 0.0;
+
+		return frameFunction != nullptr;
+	}
+
+	virtual VkBool32 update(const vkts::IUpdateThreadContext& updateContext)
+	{
+		if (currentFrame >= frameCount)
+		{
+			return VK_FALSE;
+		}
+
+		double startTime = vkts::timeGetRaw();
+
+		if (!frameFunction(updateContext))
+		{
+			return VK_FALSE;
+		}
+
+		totalTime += vkts::timeGetRaw() - startTime;
+
+		currentFrame++;
+
+		return VK_TRUE;
+	}
+
+	virtual void terminate(const vkts::IUpdateThreadContext& updateContext)
+	{
+	}
+
+};
+
+static std::shared_ptr<BenchmarkUpdateThread> g_benchmarkUpdateThread;
+
+double benchmarkRunEngine(const uint32_t taskExecutorCount, const uint32_t frameCount, const PFN_benchmarkFrameFunction frameFunction)
+{
+	// The engine does not allow to remove update threads, so the same one is reused.
+	if (!g_benchmarkUpdateThread.get())
+	{
+		g_benchmarkUpdateThread = std::shared_ptr<BenchmarkUpdateThread>(new BenchmarkUpdateThread());
+
+		if (!vkts::engineAddUpdateThread(g_benchmarkUpdateThread))
+		{
+			return 0.0;
+		}
+	}
+
+	g_benchmarkUpdateThread->frameFunction = frameFunction;
+	g_benchmarkUpdateThread->frameCount = frameCount;
+
+	vkts::engineSetTaskExecutorCount(taskExecutorCount);
+
+	if (!vkts::engineRun())
+	{
+		return 0.0;
+	}
+
+	if (g_benchmarkUpdateThread->currentFrame == 0)
+	{
+		return 0.0;
+	}
+
+	return g_benchmarkUpdateThread->totalTime / (double)g_benchmarkUpdateThread->currentFrame;
+}
+
+static std::vector<std::string> g_allArguments;
+
+const std::vector<std::string>& benchmarkGetArguments()
+{
+	return g_allArguments;
+}
+
+typedef VkBool32 (*PFN_benchmarkFunction)();
+
+typedef struct BenchmarkEntry_
+{
+	const char* name;
+	PFN_benchmarkFunction benchmarkFunction;
+} BenchmarkEntry;
+
+static const BenchmarkEntry g_allBenchmarks[] = {
+	{"task", benchmarkTask},
+	{"map", benchmarkMap},
+	{"json", benchmarkJson},
+	{"file", benchmarkFile},
+	{"prefilter", benchmarkPrefilter},
+	{"transform", benchmarkTransform},
+	{"bvh", benchmarkBvh},
+	{"frustum", benchmarkFrustum},
+	{"animation", benchmarkAnimation},
+	{"clip", benchmarkClip},
+	{"skinning", benchmarkSkinning},
+	{"partition", benchmarkPartition},
+	{"queue", benchmarkQueue},
+	{"descriptor", benchmarkDescriptor},
+	{"memory", benchmarkMemory},
+	{"upload", benchmarkUpload}
+};
+
+int main(int argc, char* argv[])
+{
+	vkts::engineInit();
+
+	vkts::logSetLevel(VKTS_LOG_INFO);
+
+	vkts::logPrint(VKTS_LOG_INFO, __FILE__, __LINE__, "Benchmark: Number of processors = %u.", vkts::processorGetNumber());
+
+	// Without benchmark names, all benchmarks are executed. Otherwise, only the given ones.
+
+	VkBool32 anyBenchmarkName = VK_FALSE;
+
+	for (int k = 1; k < argc; k++)
+	{
+		VkBool32 isBenchmarkName = VK_FALSE;
+
+		for (size_t i = 0; i < sizeof(g_allBenchmarks) / sizeof(g_allBenchmarks[0]); i++)
+		{
+			if (strcmp(argv[k], g_allBenchmarks[i].name) == 0)
+			{
+				isBenchmarkName = VK_TRUE;
+			}
+		}
+
+		if (isBenchmarkName)
+		{
+			anyBenchmarkName = VK_TRUE;
+		}
+		else
+		{
+			g_allArguments.push_back(argv[k]);
+		}
+	}
+
+	int result = 0;
+
+	for (size_t i = 0; i < sizeof(g_allBenchmarks) / sizeof(g_allBenchmarks[0]); i++)
+	{
+		VkBool32 doRun = !anyBenchmarkName;
+
+		for (int k = 1; k < argc; k++)
+		{
+			if (strcmp(argv[k], g_allBenchmarks[i].name) == 0)
+			{
+				doRun = VK_TRUE;
+			}
+		}
+
+		if (!doRun)
+		{
+			continue;
+		}
+
+		vkts::logPrint(VKTS_LOG_INFO, __FILE__, __LINE__, "Benchmark '%s': Started.", g_allBenchmarks[i].name);
+
+		if (!g_allBenchmarks[i].benchmarkFunction())
+		{
+			vkts::logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Benchmark '%s': Failed.", g_allBenchmarks[i].name);
+
+			result = -1;
+		}
+		else
+		{
+			vkts::logPrint(VKTS_LOG_INFO, __FILE__, __LINE__, "Benchmark '%s': Done.", g_allBenchmarks[i].name);
+		}
+	}
+
+	vkts::engineTerminate();
+
+	return result;
+}
@@ -263,11 +263,13 @@ int main(int argc, char* argv[])
 			vkts::logPrint(VKTS_LOG_WARNING, __FILE__, __LINE__, "Test: Could not save TGA image.");
 		}
 
-		auto mipMaps = vkts::imageDataMipmap(imageTga, VK_TRUE, "test/general/crate_output.tga");
+		auto mipMaps = vkts::imageDataMipmap(imageTga, "test/general/crate_output.tga");
 
-		for (uint32_t i = 0; i < mipMaps.size(); i++)
+		for (uint32_t i = 0; mipMaps.get() && i < mipMaps->getMipLevels(); i++)
 		{
-			if (!vkts::imageDataSave(mipMaps[i]->getName().c_str(), mipMaps[i]))
+			auto mipMapFilename = "test/general/crate_output_LEVEL" + std::to_string(i) + ".tga";
+
+			if (!vkts::imageDataSave(mipMapFilename.c_str(), mipMaps, i))
 			{
 				vkts::logPrint(VKTS_LOG_WARNING, __FILE__, __LINE__, "Test: Could not save mip map TGA image.");
 			}